@@ -1,5 +1,5 @@
 # build minidfs
-mkdir -p build/config build/logging build/minidfs build/proto build/rpc build/threadpool build/test
+mkdir -p build/checksum build/compression build/config build/erasure build/logging build/metrics build/minidfs build/proto build/rpc build/threadpool build/test
 mkdir -p bin data/client data/chunkserver
 make proto
 make
\ No newline at end of file
@@ -0,0 +1,81 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include "checksum/chunked_checksum.h"
+#include "checksum/crc32c.h"
+
+#include <arpa/inet.h>
+#include <cstring>
+
+namespace checksum {
+
+constexpr int ChunkedChecksum::kBytesPerChecksum;
+
+ChunkedChecksum::ChunkedChecksum(int bytesPerChecksum)
+    : bytesPerChecksum_(bytesPerChecksum) {
+}
+
+void ChunkedChecksum::update(const char* data, size_t len) {
+  while (len > 0) {
+    /// whole chunks in one go
+    if (chunkPos_ == 0 && len >= (size_t)bytesPerChecksum_) {
+      size_t n = len / bytesPerChecksum_;
+      size_t start = crcs_.size();
+      crcs_.resize(start + n);
+      crc32cChunks(data, n, bytesPerChecksum_, &crcs_[start]);
+      data += n * bytesPerChecksum_;
+      len -= n * bytesPerChecksum_;
+      continue;
+    }
+    size_t n = bytesPerChecksum_ - chunkPos_;
+    if (n > len) {
+      n = len;
+    }
+    crc_ = crc32c(crc_, data, n);
+    chunkPos_ += n;
+    data += n;
+    len -= n;
+    if (chunkPos_ == bytesPerChecksum_) {
+      crcs_.push_back(crc_);
+      crc_ = 0;
+      chunkPos_ = 0;
+    }
+  }
+}
+
+const std::vector<uint32_t>& ChunkedChecksum::finish() {
+  if (chunkPos_ > 0) {
+    crcs_.push_back(crc_);
+    crc_ = 0;
+    chunkPos_ = 0;
+  }
+  return crcs_;
+}
+
+size_t ChunkedChecksum::nChunks(uint64_t len, int bytesPerChecksum) {
+  return (len + bytesPerChecksum - 1) / bytesPerChecksum;
+}
+
+void ChunkedChecksum::putCrcs(const std::vector<uint32_t>& crcs, string* out) {
+  size_t start = out->size();
+  out->resize(start + crcs.size() * 4);
+  char* p = &(*out)[start];
+  for (uint32_t crc : crcs) {
+    uint32_t be = htonl(crc);
+    memcpy(p, &be, 4);
+    p += 4;
+  }
+}
+
+void ChunkedChecksum::getCrcs(const char* buf, size_t n, std::vector<uint32_t>* crcs) {
+  crcs->resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    uint32_t be;
+    memcpy(&be, buf + i * 4, 4);
+    (*crcs)[i] = ntohl(be);
+  }
+}
+
+} // namespace checksum
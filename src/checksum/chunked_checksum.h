@@ -0,0 +1,59 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Per-chunk CRC32C of a data stream.
+
+#ifndef CHUNKED_CHECKSUM_H_
+#define CHUNKED_CHECKSUM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using std::string;
+
+namespace checksum {
+
+/// \brief ChunkedChecksum computes a CRC32C for every bytesPerChecksum bytes
+/// of a stream. The last chunk may be shorter.
+///
+/// Data can be fed in pieces of any size, e.g. as they are received from
+/// a socket. Block data is checksummed in chunks of kBytesPerChecksum, both
+/// on the wire and in the .meta file of a block.
+class ChunkedChecksum {
+ public:
+  /// bytes per checksum of block data
+  static constexpr int kBytesPerChecksum = 512;
+
+  explicit ChunkedChecksum(int bytesPerChecksum = kBytesPerChecksum);
+
+  /// Feed len bytes of data
+  void update(const char* data, size_t len);
+
+  /// Finish the last partial chunk, and return the crcs of all the chunks
+  const std::vector<uint32_t>& finish();
+
+  /// Number of chunks of len bytes of data
+  static size_t nChunks(uint64_t len, int bytesPerChecksum = kBytesPerChecksum);
+
+  /// Append the crcs to out, 4 bytes each in network byte order
+  static void putCrcs(const std::vector<uint32_t>& crcs, string* out);
+
+  /// Parse n crcs written by putCrcs()
+  static void getCrcs(const char* buf, size_t n, std::vector<uint32_t>* crcs);
+
+ private:
+  const int bytesPerChecksum_;
+  /// crc of the current chunk
+  uint32_t crc_ = 0;
+  /// bytes in the current chunk
+  int chunkPos_ = 0;
+  /// crcs of the finished chunks
+  std::vector<uint32_t> crcs_;
+};
+
+} // namespace checksum
+
+#endif
@@ -0,0 +1,277 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include "checksum/crc32c.h"
+
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+namespace checksum {
+
+namespace {
+
+/// reflected Castagnoli polynomial
+constexpr uint32_t kPoly = 0x82f63b78;
+
+/// The hardware version runs 3 streams in parallel to hide the latency of
+/// the crc32 instruction, and combines them with shift tables.
+constexpr size_t kLong = 8192;
+constexpr size_t kShort = 256;
+
+/// Multiply the 32x32 GF(2) matrix mat by vec.
+uint32_t gf2MatrixTimes(const uint32_t* mat, uint32_t vec) {
+  uint32_t sum = 0;
+  while (vec) {
+    if (vec & 1) {
+      sum ^= *mat;
+    }
+    vec >>= 1;
+    ++mat;
+  }
+  return sum;
+}
+
+void gf2MatrixSquare(uint32_t* square, const uint32_t* mat) {
+  for (int n = 0; n < 32; ++n) {
+    square[n] = gf2MatrixTimes(mat, mat[n]);
+  }
+}
+
+/// Build the operator that applies len zero bytes to a crc. len is a power of 2.
+void zerosOperator(uint32_t* even, size_t len) {
+  uint32_t odd[32];
+  /// operator for one zero bit
+  odd[0] = kPoly;
+  uint32_t row = 1;
+  for (int n = 1; n < 32; ++n) {
+    odd[n] = row;
+    row <<= 1;
+  }
+  /// 2 and 4 zero bits
+  gf2MatrixSquare(even, odd);
+  gf2MatrixSquare(odd, even);
+  /// 1, 2, 4... zero bytes, alternating between even and odd
+  do {
+    gf2MatrixSquare(even, odd);
+    len >>= 1;
+    if (len == 0) {
+      return;
+    }
+    gf2MatrixSquare(odd, even);
+    len >>= 1;
+  } while (len);
+  memcpy(even, odd, sizeof(odd));
+}
+
+struct Tables {
+  /// slicing-by-8 tables
+  uint32_t slice[8][256];
+  /// shift a crc over kLong and kShort zero bytes, a byte at a time
+  uint32_t shiftLong[4][256];
+  uint32_t shiftShort[4][256];
+  bool hardware;
+
+  Tables() {
+    for (uint32_t n = 0; n < 256; ++n) {
+      uint32_t crc = n;
+      for (int k = 0; k < 8; ++k) {
+        crc = (crc & 1) ? (crc >> 1) ^ kPoly : crc >> 1;
+      }
+      slice[0][n] = crc;
+    }
+    for (uint32_t n = 0; n < 256; ++n) {
+      uint32_t crc = slice[0][n];
+      for (int k = 1; k < 8; ++k) {
+        crc = slice[0][crc & 0xff] ^ (crc >> 8);
+        slice[k][n] = crc;
+      }
+    }
+    buildShift(shiftLong, kLong);
+    buildShift(shiftShort, kShort);
+#if defined(__x86_64__)
+    hardware = __builtin_cpu_supports("sse4.2");
+#else
+    hardware = false;
+#endif
+  }
+
+  void buildShift(uint32_t shift[4][256], size_t len) {
+    uint32_t op[32];
+    zerosOperator(op, len);
+    for (uint32_t n = 0; n < 256; ++n) {
+      shift[0][n] = gf2MatrixTimes(op, n);
+      shift[1][n] = gf2MatrixTimes(op, n << 8);
+      shift[2][n] = gf2MatrixTimes(op, n << 16);
+      shift[3][n] = gf2MatrixTimes(op, n << 24);
+    }
+  }
+};
+
+const Tables& tables() {
+  static const Tables t;
+  return t;
+}
+
+inline uint32_t shift(const uint32_t table[4][256], uint32_t crc) {
+  return table[0][crc & 0xff] ^ table[1][(crc >> 8) & 0xff] ^
+         table[2][(crc >> 16) & 0xff] ^ table[3][crc >> 24];
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2")))
+uint32_t crc32cSse42(const Tables& t, uint32_t crc, const void* data, size_t len) {
+  const unsigned char* next = static_cast<const unsigned char*>(data);
+  uint64_t crc0 = crc ^ 0xffffffff;
+
+  /// align to 8 bytes
+  while (len > 0 && (reinterpret_cast<uintptr_t>(next) & 7) != 0) {
+    crc0 = _mm_crc32_u8(crc0, *next);
+    ++next;
+    --len;
+  }
+
+  /// 3 parallel streams, then shift crc0 over the next stream and combine
+  while (len >= kLong * 3) {
+    uint64_t crc1 = 0;
+    uint64_t crc2 = 0;
+    const unsigned char* end = next + kLong;
+    do {
+      crc0 = _mm_crc32_u64(crc0, *reinterpret_cast<const uint64_t*>(next));
+      crc1 = _mm_crc32_u64(crc1, *reinterpret_cast<const uint64_t*>(next + kLong));
+      crc2 = _mm_crc32_u64(crc2, *reinterpret_cast<const uint64_t*>(next + kLong * 2));
+      next += 8;
+    } while (next < end);
+    crc0 = shift(t.shiftLong, crc0) ^ crc1;
+    crc0 = shift(t.shiftLong, crc0) ^ crc2;
+    next += kLong * 2;
+    len -= kLong * 3;
+  }
+  while (len >= kShort * 3) {
+    uint64_t crc1 = 0;
+    uint64_t crc2 = 0;
+    const unsigned char* end = next + kShort;
+    do {
+      crc0 = _mm_crc32_u64(crc0, *reinterpret_cast<const uint64_t*>(next));
+      crc1 = _mm_crc32_u64(crc1, *reinterpret_cast<const uint64_t*>(next + kShort));
+      crc2 = _mm_crc32_u64(crc2, *reinterpret_cast<const uint64_t*>(next + kShort * 2));
+      next += 8;
+    } while (next < end);
+    crc0 = shift(t.shiftShort, crc0) ^ crc1;
+    crc0 = shift(t.shiftShort, crc0) ^ crc2;
+    next += kShort * 2;
+    len -= kShort * 3;
+  }
+
+  while (len >= 8) {
+    crc0 = _mm_crc32_u64(crc0, *reinterpret_cast<const uint64_t*>(next));
+    next += 8;
+    len -= 8;
+  }
+  while (len > 0) {
+    crc0 = _mm_crc32_u8(crc0, *next);
+    ++next;
+    --len;
+  }
+  return static_cast<uint32_t>(crc0) ^ 0xffffffff;
+}
+
+/// 3 independent chunks at a time. chunkLen is a multiple of 8.
+__attribute__((target("sse4.2")))
+void crc32cChunksSse42(const unsigned char* next, size_t nChunks, size_t chunkLen, uint32_t* crcs) {
+  for (; nChunks >= 3; nChunks -= 3) {
+    uint64_t crc0 = 0xffffffff;
+    uint64_t crc1 = 0xffffffff;
+    uint64_t crc2 = 0xffffffff;
+    for (size_t i = 0; i < chunkLen; i += 8) {
+      uint64_t w0, w1, w2;
+      memcpy(&w0, next + i, 8);
+      memcpy(&w1, next + chunkLen + i, 8);
+      memcpy(&w2, next + chunkLen * 2 + i, 8);
+      crc0 = _mm_crc32_u64(crc0, w0);
+      crc1 = _mm_crc32_u64(crc1, w1);
+      crc2 = _mm_crc32_u64(crc2, w2);
+    }
+    *crcs++ = static_cast<uint32_t>(crc0) ^ 0xffffffff;
+    *crcs++ = static_cast<uint32_t>(crc1) ^ 0xffffffff;
+    *crcs++ = static_cast<uint32_t>(crc2) ^ 0xffffffff;
+    next += chunkLen * 3;
+  }
+  for (; nChunks > 0; --nChunks) {
+    *crcs++ = crc32cSse42(tables(), 0, next, chunkLen);
+    next += chunkLen;
+  }
+}
+#endif
+
+uint32_t crc32cTable(const Tables& t, uint32_t crc, const void* data, size_t len) {
+  const unsigned char* next = static_cast<const unsigned char*>(data);
+  crc = ~crc;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  while (len > 0 && (reinterpret_cast<uintptr_t>(next) & 7) != 0) {
+    crc = t.slice[0][(crc ^ *next) & 0xff] ^ (crc >> 8);
+    ++next;
+    --len;
+  }
+  while (len >= 8) {
+    uint64_t word;
+    memcpy(&word, next, 8);
+    word ^= crc;
+    crc = t.slice[7][word & 0xff] ^
+          t.slice[6][(word >> 8) & 0xff] ^
+          t.slice[5][(word >> 16) & 0xff] ^
+          t.slice[4][(word >> 24) & 0xff] ^
+          t.slice[3][(word >> 32) & 0xff] ^
+          t.slice[2][(word >> 40) & 0xff] ^
+          t.slice[1][(word >> 48) & 0xff] ^
+          t.slice[0][word >> 56];
+    next += 8;
+    len -= 8;
+  }
+#endif
+  while (len > 0) {
+    crc = t.slice[0][(crc ^ *next) & 0xff] ^ (crc >> 8);
+    ++next;
+    --len;
+  }
+  return ~crc;
+}
+
+} // namespace
+
+uint32_t crc32c(uint32_t crc, const void* data, size_t len) {
+  const Tables& t = tables();
+#if defined(__x86_64__)
+  if (t.hardware) {
+    return crc32cSse42(t, crc, data, len);
+  }
+#endif
+  return crc32cTable(t, crc, data, len);
+}
+
+void crc32cChunks(const void* data, size_t nChunks, size_t chunkLen, uint32_t* crcs) {
+  const unsigned char* next = static_cast<const unsigned char*>(data);
+#if defined(__x86_64__)
+  if (tables().hardware && chunkLen % 8 == 0) {
+    crc32cChunksSse42(next, nChunks, chunkLen, crcs);
+    return;
+  }
+#endif
+  for (size_t i = 0; i < nChunks; ++i) {
+    crcs[i] = crc32c(0, next + i * chunkLen, chunkLen);
+  }
+}
+
+uint32_t crc32cSoftware(uint32_t crc, const void* data, size_t len) {
+  return crc32cTable(tables(), crc, data, len);
+}
+
+bool crc32cHardware() {
+  return tables().hardware;
+}
+
+} // namespace checksum
@@ -0,0 +1,44 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief CRC-32C (Castagnoli) used to checksum block data.
+
+#ifndef CRC32C_H_
+#define CRC32C_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace checksum {
+
+/// Extend crc with len bytes of data. Start with crc = 0.
+/// crc32c(crc32c(0, a, m), b, n) equals the crc of a followed by b.
+///
+/// SSE4.2 crc32 instructions are used if the cpu supports them,
+/// otherwise a slicing-by-8 table.
+///
+/// \param crc crc of the previous data, 0 for none
+/// \param data data to be checksummed
+/// \param len length of data
+/// \return the crc of the previous data followed by data
+uint32_t crc32c(uint32_t crc, const void* data, size_t len);
+
+/// Compute the crcs of nChunks consecutive chunks of chunkLen bytes each.
+/// With SSE4.2, 3 chunks are checksummed in parallel.
+///
+/// \param data data of the chunks
+/// \param nChunks number of chunks
+/// \param chunkLen length of each chunk
+/// \param crcs the returning crcs, nChunks of them
+void crc32cChunks(const void* data, size_t nChunks, size_t chunkLen, uint32_t* crcs);
+
+/// The portable table version of crc32c(). Used by tests and benchmarks.
+uint32_t crc32cSoftware(uint32_t crc, const void* data, size_t len);
+
+/// Return true if crc32c() uses the SSE4.2 instructions.
+bool crc32cHardware();
+
+} // namespace checksum
+
+#endif
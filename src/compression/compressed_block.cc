@@ -0,0 +1,211 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include "compression/compressed_block.h"
+#include "compression/lz4.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace compression {
+
+namespace {
+
+const uint32_t kRawFrame = 1U << 31;
+/// dataLen, n and codec
+const size_t kTrailerSize = 8 + 4 + 1;
+
+void put32(uint32_t v, std::string* out) {
+  char bytes[4] = {(char)(v >> 24), (char)(v >> 16), (char)(v >> 8), (char)v};
+  out->append(bytes, 4);
+}
+
+uint32_t get32(const char* p) {
+  const uint8_t* b = reinterpret_cast<const uint8_t*>(p);
+  return ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | b[3];
+}
+
+/// \return number of compressed bytes in out, or 0 if it doesn't compress
+size_t compressFrame(Codec codec, const char* data, size_t len, std::string* out) {
+  if (codec == kCodecLz4) {
+    out->resize(lz4Bound(len));
+    return lz4Compress(data, len, &(*out)[0]);
+  }
+  uLongf outLen = compressBound(len);
+  out->resize(outLen);
+  if (::compress2(reinterpret_cast<Bytef*>(&(*out)[0]), &outLen,
+                  reinterpret_cast<const Bytef*>(data), len, Z_DEFAULT_COMPRESSION) != Z_OK) {
+    return 0;
+  }
+  return outLen;
+}
+
+} // namespace
+
+const size_t CompressedBlock::kFrameSize;
+
+const char* codecName(Codec codec) {
+  switch (codec) {
+    case kCodecLz4:
+      return "lz4";
+    case kCodecZlib:
+      return "zlib";
+    default:
+      return "none";
+  }
+}
+
+int parseCodec(const std::string& name, Codec* codec) {
+  for (Codec c : {kCodecNone, kCodecLz4, kCodecZlib}) {
+    if (name == codecName(c)) {
+      *codec = c;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+void CompressedBlock::compress(Codec codec, const char* data, size_t len, std::string* stored) {
+  stored->clear();
+  std::string index;
+  std::string frame;
+  for (size_t off = 0; off < len; off += kFrameSize) {
+    size_t n = std::min(kFrameSize, len - off);
+    size_t compressedLen = codec == kCodecNone ? 0 : compressFrame(codec, data + off, n, &frame);
+    if (compressedLen == 0 || compressedLen >= n) {
+      stored->append(data + off, n);
+      put32(n | kRawFrame, &index);
+    } else {
+      stored->append(frame.data(), compressedLen);
+      put32(compressedLen, &index);
+    }
+  }
+  stored->append(index);
+  put32((uint64_t)len >> 32, stored);
+  put32(len, stored);
+  put32(index.size() / 4, stored);
+  stored->push_back((char)codec);
+}
+
+int64_t CompressedBlock::maxStoredLength(int64_t len) {
+  int64_t nFrames = (len + kFrameSize - 1) / kFrameSize;
+  return len + nFrames * 4 + kTrailerSize;
+}
+
+CompressedBlock::CompressedBlock()
+    : codec_(kCodecNone), dataLen_(0), cachedFrame_(-1) {
+}
+
+int CompressedBlock::open(std::string* stored) {
+  stored_.swap(*stored);
+  frameStarts_.clear();
+  rawFrames_.clear();
+  cachedFrame_ = -1;
+  if (stored_.size() < kTrailerSize) {
+    return -1;
+  }
+  const char* trailer = stored_.data() + stored_.size() - kTrailerSize;
+  dataLen_ = ((int64_t)get32(trailer) << 32) | get32(trailer + 4);
+  size_t nFrames = get32(trailer + 8);
+  codec_ = static_cast<Codec>(trailer[12]);
+  if (codec_ != kCodecNone && codec_ != kCodecLz4 && codec_ != kCodecZlib) {
+    return -1;
+  }
+  if (nFrames != (dataLen_ + kFrameSize - 1) / kFrameSize
+      || nFrames * 4 + kTrailerSize > stored_.size()) {
+    return -1;
+  }
+  const char* index = trailer - nFrames * 4;
+  size_t indexStart = index - stored_.data();
+  size_t start = 0;
+  for (size_t i = 0; i < nFrames; ++i) {
+    uint32_t entry = get32(index + i * 4);
+    size_t len = entry & ~kRawFrame;
+    bool raw = entry & kRawFrame;
+    if (len > indexStart - start || (raw && len != frameLen(i))) {
+      return -1;
+    }
+    frameStarts_.push_back(start);
+    rawFrames_.push_back(raw);
+    start += len;
+  }
+  if (start != indexStart) {
+    return -1;
+  }
+  frameStarts_.push_back(start);
+  return 0;
+}
+
+int CompressedBlock::read(int64_t offset, size_t len, char* out) {
+  while (len > 0) {
+    size_t i = offset / kFrameSize;
+    size_t inFrame = offset - (int64_t)i * kFrameSize;
+    size_t n = std::min(len, frameLen(i) - inFrame);
+    if (rawFrames_[i]) {
+      memcpy(out, stored_.data() + frameStarts_[i] + inFrame, n);
+    } else {
+      if (cachedFrame_ != (int64_t)i) {
+        frame_.resize(kFrameSize);
+        cachedFrame_ = -1;
+        if (-1 == decompressFrame(i, &frame_[0])) {
+          return -1;
+        }
+        cachedFrame_ = i;
+      }
+      memcpy(out, frame_.data() + inFrame, n);
+    }
+    offset += n;
+    out += n;
+    len -= n;
+  }
+  return 0;
+}
+
+int CompressedBlock::readAll(std::string* data) {
+  data->resize(dataLen_);
+  std::string frame(kFrameSize, 0);
+  for (size_t i = 0; i + 1 < frameStarts_.size(); ++i) {
+    char* out = &(*data)[i * kFrameSize];
+    if (rawFrames_[i]) {
+      memcpy(out, stored_.data() + frameStarts_[i], frameLen(i));
+      continue;
+    }
+    /// the last frame may be shorter than kFrameSize
+    char* to = frameLen(i) == kFrameSize ? out : &frame[0];
+    if (-1 == decompressFrame(i, to)) {
+      return -1;
+    }
+    if (to != out) {
+      memcpy(out, to, frameLen(i));
+    }
+  }
+  return 0;
+}
+
+int CompressedBlock::decompressFrame(size_t i, char* out) const {
+  const char* src = stored_.data() + frameStarts_[i];
+  size_t srcLen = frameStarts_[i + 1] - frameStarts_[i];
+  size_t expected = frameLen(i);
+  if (codec_ == kCodecLz4) {
+    return lz4Decompress(src, srcLen, out, kFrameSize) == (int64_t)expected ? 0 : -1;
+  }
+  if (codec_ == kCodecZlib) {
+    uLongf outLen = kFrameSize;
+    if (::uncompress(reinterpret_cast<Bytef*>(out), &outLen,
+                     reinterpret_cast<const Bytef*>(src), srcLen) != Z_OK) {
+      return -1;
+    }
+    return outLen == expected ? 0 : -1;
+  }
+  return -1;
+}
+
+size_t CompressedBlock::frameLen(size_t i) const {
+  return std::min<int64_t>(kFrameSize, dataLen_ - (int64_t)i * kFrameSize);
+}
+
+} // namespace compression
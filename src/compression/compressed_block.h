@@ -0,0 +1,104 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Header file for class CompressedBlock.
+
+#ifndef COMPRESSED_BLOCK_H_
+#define COMPRESSED_BLOCK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace compression {
+
+/// Codecs of a block, see Block.codec
+enum Codec {
+  kCodecNone = 0,
+  /// fast, the LZ4 block format
+  kCodecLz4 = 1,
+  /// slower, but compresses better
+  kCodecZlib = 2,
+};
+
+/// Name of a codec, e.g. "lz4".
+const char* codecName(Codec codec);
+
+/// Parse the name of a codec.
+///
+/// \return return 0 on success, -1 for unknown names
+int parseCodec(const std::string& name, Codec* codec);
+
+/// \brief CompressedBlock reads the data of a block stored compressed.
+///
+/// The data is cut into frames of kFrameSize bytes, which are compressed one
+/// by one, so that a range is read by decompressing only the frames covering
+/// it. A stored block is
+///
+///   frame 0 | ... | frame n-1 | index | dataLen (8) | n (4) | codec (1)
+///
+/// where index entry i (4 bytes) is the stored size of frame i, with the top
+/// bit set if the frame is stored raw because it doesn't compress.
+/// Integers are in network byte order.
+class CompressedBlock {
+ public:
+  static const size_t kFrameSize = 64 * 1024;
+
+  /// \brief Compress len bytes of data into a stored block.
+  static void compress(Codec codec, const char* data, size_t len, std::string* stored);
+
+  /// \brief Max number of bytes of the stored block of len bytes of data,
+  /// i.e. with every frame stored raw.
+  static int64_t maxStoredLength(int64_t len);
+
+  CompressedBlock();
+
+  /// \brief Take a stored block and parse its index.
+  ///
+  /// \return return 0 on success, -1 if the block is malformed
+  int open(std::string* stored);
+
+  /// \brief Number of bytes of the data.
+  int64_t length() const { return dataLen_; }
+
+  /// \brief Number of bytes of the stored block.
+  int64_t storedLength() const { return stored_.size(); }
+
+  /// \brief Read a range of the data. The last frame decompressed is
+  /// kept, so that small sequential reads decompress each frame once.
+  ///
+  /// \param offset offset in the data
+  /// \param len number of bytes, the range must be in the data
+  /// \param out the output
+  /// \return return 0 on success, -1 if a frame is malformed
+  int read(int64_t offset, size_t len, char* out);
+
+  /// \brief Read all of the data.
+  ///
+  /// \return return 0 on success, -1 if a frame is malformed
+  int readAll(std::string* data);
+
+ private:
+  /// \brief Decompress frame i into out, which has kFrameSize bytes.
+  int decompressFrame(size_t i, char* out) const;
+
+  /// \brief Number of bytes of the data in frame i.
+  size_t frameLen(size_t i) const;
+
+  std::string stored_;
+  Codec codec_;
+  int64_t dataLen_;
+  /// offset of each frame in stored_, and the end of the last one
+  std::vector<size_t> frameStarts_;
+  std::vector<bool> rawFrames_;
+
+  /// the last frame decompressed by read()
+  std::string frame_;
+  int64_t cachedFrame_;
+};
+
+} // namespace compression
+
+#endif
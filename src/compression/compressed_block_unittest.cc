@@ -0,0 +1,169 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for lz4 and CompressedBlock
+
+#include "compression/compressed_block.h"
+#include "compression/lz4.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace {
+
+const compression::Codec kCodecs[] = {compression::kCodecNone, compression::kCodecLz4,
+                                   compression::kCodecZlib};
+
+/// Lines of a server log, which compress well
+std::string LogLines(size_t len, int seed) {
+  std::mt19937 rng(seed);
+  const char* levels[] = {"INFO", "WARN", "ERROR"};
+  const char* msgs[] = {"Succeed to send block", "Failed to connect chunkserver",
+                        "Heartbeat from", "Block report of"};
+  auto next = [&rng](unsigned n) { return (unsigned)(rng() % n); };
+  std::string text;
+  char line[256];
+  while (text.size() < len) {
+    int n = snprintf(line, sizeof(line), "2020/06/%02u 12:%02u:%02u.%06u %u %s %s %u - %s:%u\n",
+                     next(30), next(60), next(60), next(1000000),
+                     140000000 + next(16), levels[next(3)], msgs[next(4)],
+                     next(5000), "src/minidfs/dfs_chunkserver.cpp", next(1000));
+    text.append(line, n);
+  }
+  text.resize(len);
+  return text;
+}
+
+std::string RandomBytes(size_t len, int seed) {
+  std::mt19937 rng(seed);
+  std::string bytes(len, 0);
+  for (auto& c : bytes) {
+    c = rng();
+  }
+  return bytes;
+}
+
+void TestLz4() {
+  std::mt19937 rng(7);
+  for (int i = 0; i < 300; ++i) {
+    size_t len = rng() % 3000;
+    std::string src = i % 3 == 0 ? RandomBytes(len, i) : LogLines(len, i);
+    if (i % 5 == 0) {
+      /// long runs, matches overlapping their own output
+      src.assign(len, 'a' + i % 26);
+    }
+    std::string dst(compression::lz4Bound(len), 0);
+    size_t n = compression::lz4Compress(src.data(), len, &dst[0]);
+    assert(n <= dst.size());
+    std::string out(len, 0);
+    assert(compression::lz4Decompress(dst.data(), n, &out[0], len) == (int64_t)len);
+    assert(out == src);
+    /// truncated input, or not enough room
+    if (len > 0) {
+      assert(compression::lz4Decompress(dst.data(), n, &out[0], len - 1) == -1);
+    }
+  }
+  ::printf("lz4 pass ...\n");
+}
+
+void TestRoundTrip() {
+  const size_t kFrame = compression::CompressedBlock::kFrameSize;
+  for (auto codec : kCodecs) {
+    for (size_t len : {(size_t)0, (size_t)1, kFrame - 1, kFrame, 3 * kFrame + 17}) {
+      for (int kind = 0; kind < 2; ++kind) {
+        std::string data = kind == 0 ? LogLines(len, len) : RandomBytes(len, len);
+        std::string stored;
+        compression::CompressedBlock::compress(codec, data.data(), len, &stored);
+        compression::CompressedBlock blk;
+        assert(blk.open(&stored) == 0);
+        assert(blk.length() == (int64_t)len);
+        std::string out;
+        assert(blk.readAll(&out) == 0);
+        assert(out == data);
+      }
+    }
+  }
+  ::printf("round trip pass ...\n");
+}
+
+void TestRangedRead() {
+  const size_t len = 5 * compression::CompressedBlock::kFrameSize + 999;
+  std::string data = LogLines(len, 3);
+  std::mt19937 rng(3);
+  for (auto codec : kCodecs) {
+    std::string stored;
+    compression::CompressedBlock::compress(codec, data.data(), len, &stored);
+    compression::CompressedBlock blk;
+    assert(blk.open(&stored) == 0);
+    for (int i = 0; i < 200; ++i) {
+      size_t off = rng() % len;
+      size_t n = rng() % (len - off + 1);
+      std::string out(n, 0);
+      assert(blk.read(off, n, &out[0]) == 0);
+      assert(out == data.substr(off, n));
+    }
+  }
+  ::printf("ranged read pass ...\n");
+}
+
+void TestMalformed() {
+  std::string data = LogLines(200000, 9);
+  std::string stored;
+  compression::CompressedBlock::compress(compression::kCodecLz4, data.data(), data.size(), &stored);
+  compression::CompressedBlock blk;
+  std::string truncated = stored.substr(1);
+  assert(blk.open(&truncated) == -1);
+  std::string tiny("abc");
+  assert(blk.open(&tiny) == -1);
+  /// a corrupted frame is detected when it is read
+  std::string corrupted = stored;
+  corrupted[10] ^= 0x5a;
+  corrupted[100] ^= 0x5a;
+  assert(blk.open(&corrupted) == 0);
+  std::string out;
+  int ret = blk.readAll(&out);
+  assert(ret == -1 || out != data);
+  ::printf("malformed pass ...\n");
+}
+
+/// Compression ratio and throughput of the data in MB/s on one core
+void BenchmarkCodecs() {
+  const size_t len = 8 << 20;
+  std::string data = LogLines(len, 1);
+  for (auto codec : kCodecs) {
+    std::string stored;
+    auto start = std::chrono::steady_clock::now();
+    compression::CompressedBlock::compress(codec, data.data(), len, &stored);
+    std::chrono::duration<double> compressSec = std::chrono::steady_clock::now() - start;
+    double ratio = (double)len / stored.size();
+
+    compression::CompressedBlock blk;
+    assert(blk.open(&stored) == 0);
+    std::string out;
+    start = std::chrono::steady_clock::now();
+    assert(blk.readAll(&out) == 0);
+    std::chrono::duration<double> decompressSec = std::chrono::steady_clock::now() - start;
+    assert(out == data);
+    ::printf("log lines %s: ratio %.2f, compress %.0f MB/s, decompress %.0f MB/s\n",
+             compression::codecName(codec), ratio, len / compressSec.count() / 1e6,
+             len / decompressSec.count() / 1e6);
+  }
+}
+
+} // namespace
+
+void TestCompressedBlock() {
+  ::printf("Test CompressedBlock...\n");
+
+  TestLz4();
+  TestRoundTrip();
+  TestRangedRead();
+  TestMalformed();
+  BenchmarkCodecs();
+
+  ::printf("\n");
+}
@@ -0,0 +1,178 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include "compression/lz4.h"
+
+#include <cstring>
+#include <vector>
+
+namespace compression {
+
+namespace {
+
+const size_t kMinMatch = 4;
+/// the last 5 bytes are always literals
+const size_t kLastLiterals = 5;
+/// a match starts at least 12 bytes before the end
+const size_t kMatchLimit = 12;
+const size_t kMaxOffset = 65535;
+const int kHashLog = 12;
+
+inline uint32_t read32(const char* p) {
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+inline uint32_t hash(uint32_t seq) {
+  return (seq * 2654435761U) >> (32 - kHashLog);
+}
+
+/// 15 in the token, then bytes of 255 and a byte of the rest
+inline char* putLen(char* op, size_t len) {
+  for (; len >= 255; len -= 255) {
+    *op++ = (char)255;
+  }
+  *op++ = (char)len;
+  return op;
+}
+
+char* putSequence(char* op, const char* literals, size_t nLiterals,
+                  size_t offset, size_t matchLen) {
+  char* token = op++;
+  *token = (char)((nLiterals < 15 ? nLiterals : 15) << 4);
+  if (nLiterals >= 15) {
+    op = putLen(op, nLiterals - 15);
+  }
+  memcpy(op, literals, nLiterals);
+  op += nLiterals;
+  if (matchLen == 0) {
+    return op;
+  }
+  *op++ = (char)(offset & 0xff);
+  *op++ = (char)(offset >> 8);
+  matchLen -= kMinMatch;
+  *token |= (char)(matchLen < 15 ? matchLen : 15);
+  if (matchLen >= 15) {
+    op = putLen(op, matchLen - 15);
+  }
+  return op;
+}
+
+/// The extra length bytes after a nibble of 15
+inline bool getLen(const uint8_t* src, size_t len, size_t* ip, size_t* n) {
+  uint8_t b;
+  do {
+    if (*ip >= len) {
+      return false;
+    }
+    b = src[(*ip)++];
+    *n += b;
+  } while (b == 255);
+  return true;
+}
+
+} // namespace
+
+size_t lz4Bound(size_t len) {
+  return len + len / 255 + 16;
+}
+
+size_t lz4Compress(const char* src, size_t len, char* dst) {
+  char* op = dst;
+  size_t anchor = 0;
+  if (len > kMatchLimit) {
+    /// positions + 1, 0 for empty slots
+    std::vector<uint32_t> table(1 << kHashLog, 0);
+    const size_t mfLimit = len - kMatchLimit;
+    const size_t matchEnd = len - kLastLiterals;
+    size_t ip = 0;
+    while (ip < mfLimit) {
+      uint32_t seq = read32(src + ip);
+      uint32_t h = hash(seq);
+      size_t ref = table[h];
+      table[h] = ip + 1;
+      if (ref == 0 || ip - (ref - 1) > kMaxOffset || read32(src + ref - 1) != seq) {
+        /// move faster the longer nothing matches
+        ip += 1 + ((ip - anchor) >> 6);
+        continue;
+      }
+      --ref;
+      while (ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1]) {
+        --ip;
+        --ref;
+      }
+      size_t matchLen = kMinMatch;
+      while (ip + matchLen < matchEnd && src[ip + matchLen] == src[ref + matchLen]) {
+        ++matchLen;
+      }
+      op = putSequence(op, src + anchor, ip - anchor, ip - ref, matchLen);
+      ip += matchLen;
+      anchor = ip;
+      if (ip < mfLimit) {
+        table[hash(read32(src + ip - 2))] = ip - 2 + 1;
+      }
+    }
+  }
+  op = putSequence(op, src + anchor, len - anchor, 0, 0);
+  return op - dst;
+}
+
+int64_t lz4Decompress(const char* src, size_t len, char* dst, size_t cap) {
+  const uint8_t* in = reinterpret_cast<const uint8_t*>(src);
+  size_t ip = 0;
+  size_t op = 0;
+  while (ip < len) {
+    uint8_t token = in[ip++];
+    size_t nLiterals = token >> 4;
+    if (nLiterals == 15 && getLen(in, len, &ip, &nLiterals) == false) {
+      return -1;
+    }
+    if (nLiterals > len - ip || nLiterals > cap - op) {
+      return -1;
+    }
+    memcpy(dst + op, src + ip, nLiterals);
+    ip += nLiterals;
+    op += nLiterals;
+    /// the last sequence has no match
+    if (ip == len) {
+      break;
+    }
+
+    if (len - ip < 2) {
+      return -1;
+    }
+    size_t offset = in[ip] | (in[ip + 1] << 8);
+    ip += 2;
+    size_t matchLen = token & 15;
+    if (matchLen == 15 && getLen(in, len, &ip, &matchLen) == false) {
+      return -1;
+    }
+    matchLen += kMinMatch;
+    if (offset == 0 || offset > op || matchLen > cap - op) {
+      return -1;
+    }
+    char* from = dst + op - offset;
+    char* to = dst + op;
+    if (offset >= 8) {
+      /// copy 8 bytes at a time, the ranges overlap by at least 8 bytes
+      size_t i = 0;
+      for (; i + 8 <= matchLen; i += 8) {
+        memcpy(to + i, from + i, 8);
+      }
+      for (; i < matchLen; ++i) {
+        to[i] = from[i];
+      }
+    } else {
+      for (size_t i = 0; i < matchLen; ++i) {
+        to[i] = from[i];
+      }
+    }
+    op += matchLen;
+  }
+  return op;
+}
+
+} // namespace compression
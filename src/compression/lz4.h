@@ -0,0 +1,39 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief The LZ4 block format.
+
+#ifndef LZ4_H_
+#define LZ4_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace compression {
+
+/// Largest output of lz4Compress() for len bytes of input.
+size_t lz4Bound(size_t len);
+
+/// Compress src into dst in the LZ4 block format, which stock LZ4
+/// decoders read. Matches are found greedily through a hash table of
+/// 4-byte sequences, skipping faster over incompressible input.
+///
+/// \param src the input
+/// \param len number of input bytes, at most 2G
+/// \param dst the output, at least lz4Bound(len) bytes
+/// \return number of bytes written to dst
+size_t lz4Compress(const char* src, size_t len, char* dst);
+
+/// Decompress a block of the LZ4 block format.
+///
+/// \param src the compressed block
+/// \param len number of compressed bytes
+/// \param dst the output
+/// \param cap size of dst
+/// \return number of bytes written to dst, -1 if src is malformed or dst is too small
+int64_t lz4Decompress(const char* src, size_t len, char* dst, size_t cap);
+
+} // namespace compression
+
+#endif
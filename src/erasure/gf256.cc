@@ -0,0 +1,186 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include "erasure/gf256.h"
+
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace erasure {
+
+namespace {
+
+const unsigned kPoly = 0x11d;
+
+struct Tables {
+  /// exp[i] = 2^i, doubled so that exp[log a + log b] needs no modulo
+  uint8_t exp[512];
+  /// log[a] for a != 0
+  uint8_t log[256];
+  /// products with the low and high nibbles: c * n and c * (n << 4)
+  uint8_t low[256][16];
+  uint8_t high[256][16];
+  GfKernel best;
+
+  Tables() {
+    unsigned x = 1;
+    for (int i = 0; i < 255; ++i) {
+      exp[i] = static_cast<uint8_t>(x);
+      log[x] = static_cast<uint8_t>(i);
+      x <<= 1;
+      if (x & 0x100) {
+        x ^= kPoly;
+      }
+    }
+    for (int i = 255; i < 512; ++i) {
+      exp[i] = exp[i - 255];
+    }
+    log[0] = 0;
+    for (int c = 0; c < 256; ++c) {
+      for (int n = 0; n < 16; ++n) {
+        low[c][n] = mul(c, n);
+        high[c][n] = mul(c, n << 4);
+      }
+    }
+    best = kGfScalar;
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx2")) {
+      best = kGfAvx2;
+    } else if (__builtin_cpu_supports("ssse3")) {
+      best = kGfSsse3;
+    }
+#endif
+  }
+
+  uint8_t mul(int a, int b) const {
+    if (a == 0 || b == 0) {
+      return 0;
+    }
+    return exp[log[a] + log[b]];
+  }
+};
+
+const Tables& tables() {
+  static const Tables t;
+  return t;
+}
+
+void mulRegionScalar(const Tables& t, uint8_t c, const uint8_t* src, uint8_t* dst,
+                     size_t len, bool accumulate) {
+  const uint8_t* low = t.low[c];
+  const uint8_t* high = t.high[c];
+  if (accumulate) {
+    for (size_t i = 0; i < len; ++i) {
+      dst[i] ^= low[src[i] & 0x0f] ^ high[src[i] >> 4];
+    }
+  } else {
+    for (size_t i = 0; i < len; ++i) {
+      dst[i] = low[src[i] & 0x0f] ^ high[src[i] >> 4];
+    }
+  }
+}
+
+#if defined(__x86_64__)
+__attribute__((target("ssse3")))
+void mulRegionSsse3(const Tables& t, uint8_t c, const uint8_t* src, uint8_t* dst,
+                    size_t len, bool accumulate) {
+  const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.low[c]));
+  const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.high[c]));
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i l = _mm_shuffle_epi8(low, _mm_and_si128(x, mask));
+    __m128i h = _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+    __m128i p = _mm_xor_si128(l, h);
+    if (accumulate) {
+      p = _mm_xor_si128(p, _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i)));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), p);
+  }
+  mulRegionScalar(t, c, src + i, dst + i, len - i, accumulate);
+}
+
+__attribute__((target("avx2")))
+void mulRegionAvx2(const Tables& t, uint8_t c, const uint8_t* src, uint8_t* dst,
+                   size_t len, bool accumulate) {
+  /// the same table in both lanes, vpshufb looks up within each lane
+  const __m256i low = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.low[c])));
+  const __m256i high = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.high[c])));
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  size_t i = 0;
+  for (; i + 32 <= len; i += 32) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    __m256i l = _mm256_shuffle_epi8(low, _mm256_and_si256(x, mask));
+    __m256i h = _mm256_shuffle_epi8(high, _mm256_and_si256(_mm256_srli_epi64(x, 4), mask));
+    __m256i p = _mm256_xor_si256(l, h);
+    if (accumulate) {
+      p = _mm256_xor_si256(p, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i)));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), p);
+  }
+  mulRegionSsse3(t, c, src + i, dst + i, len - i, accumulate);
+}
+#endif
+
+} // namespace
+
+uint8_t gfMul(uint8_t a, uint8_t b) {
+  return tables().mul(a, b);
+}
+
+uint8_t gfInv(uint8_t a) {
+  const Tables& t = tables();
+  return t.exp[255 - t.log[a]];
+}
+
+void gfMulRegion(uint8_t c, const uint8_t* src, uint8_t* dst, size_t len, bool accumulate) {
+  gfMulRegionWith(tables().best, c, src, dst, len, accumulate);
+}
+
+void gfMulRegionWith(GfKernel kernel, uint8_t c, const uint8_t* src, uint8_t* dst,
+                     size_t len, bool accumulate) {
+  const Tables& t = tables();
+  /// the trivial constants
+  if (c == 0) {
+    if (accumulate == false) {
+      memset(dst, 0, len);
+    }
+    return;
+  }
+#if defined(__x86_64__)
+  if (kernel == kGfAvx2) {
+    mulRegionAvx2(t, c, src, dst, len, accumulate);
+    return;
+  }
+  if (kernel == kGfSsse3) {
+    mulRegionSsse3(t, c, src, dst, len, accumulate);
+    return;
+  }
+#endif
+  mulRegionScalar(t, c, src, dst, len, accumulate);
+}
+
+GfKernel gfBestKernel() {
+  return tables().best;
+}
+
+const char* gfKernelName(GfKernel kernel) {
+  switch (kernel) {
+    case kGfAvx2:
+      return "avx2";
+    case kGfSsse3:
+      return "ssse3";
+    default:
+      return "scalar";
+  }
+}
+
+} // namespace erasure
@@ -0,0 +1,56 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Arithmetic in GF(2^8) for Reed-Solomon codes.
+
+#ifndef GF256_H_
+#define GF256_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace erasure {
+
+/// Kernels of gfMulRegion(), slowest first
+enum GfKernel {
+  kGfScalar = 0,
+  kGfSsse3 = 1,
+  kGfAvx2 = 2,
+};
+
+/// Product of a and b in GF(2^8), polynomial x^8 + x^4 + x^3 + x^2 + 1 (0x11d).
+uint8_t gfMul(uint8_t a, uint8_t b);
+
+/// Multiplicative inverse of a, a != 0.
+uint8_t gfInv(uint8_t a);
+
+/// Multiply a region of bytes by the constant c: dst = c * src,
+/// or dst ^= c * src if accumulate.
+///
+/// Each product is looked up in two 16-entry tables, one for the low and one
+/// for the high nibble of the byte, so that 16 (SSSE3 pshufb) or 32
+/// (AVX2 vpshufb) bytes are multiplied by one instruction each.
+/// The fastest kernel the cpu supports is used.
+///
+/// \param c the constant
+/// \param src source bytes
+/// \param dst destination bytes, may not overlap src
+/// \param len number of bytes
+/// \param accumulate add the products into dst instead of overwriting it
+void gfMulRegion(uint8_t c, const uint8_t* src, uint8_t* dst, size_t len, bool accumulate);
+
+/// gfMulRegion() with the given kernel. Used by tests and benchmarks.
+/// The kernel must be supported, see gfBestKernel().
+void gfMulRegionWith(GfKernel kernel, uint8_t c, const uint8_t* src, uint8_t* dst,
+                     size_t len, bool accumulate);
+
+/// The fastest kernel the cpu supports.
+GfKernel gfBestKernel();
+
+/// Name of a kernel, e.g. "avx2".
+const char* gfKernelName(GfKernel kernel);
+
+} // namespace erasure
+
+#endif
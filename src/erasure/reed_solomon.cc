@@ -0,0 +1,128 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include "erasure/reed_solomon.h"
+
+#include <utility>
+
+namespace erasure {
+
+ReedSolomon::ReedSolomon(int nData, int nParity, GfKernel kernel)
+    : nData_(nData), nParity_(nParity), kernel_(kernel), parityMatrix_(nParity * nData) {
+  for (int i = 0; i < nParity; ++i) {
+    for (int j = 0; j < nData; ++j) {
+      parityMatrix_[i * nData + j] = gfInv(static_cast<uint8_t>((nData + i) ^ j));
+    }
+  }
+}
+
+void ReedSolomon::encode(const uint8_t* const* data, uint8_t* const* parity, size_t len) const {
+  for (int i = 0; i < nParity_; ++i) {
+    const uint8_t* row = &parityMatrix_[i * nData_];
+    for (int j = 0; j < nData_; ++j) {
+      gfMulRegionWith(kernel_, row[j], data[j], parity[i], len, j > 0);
+    }
+  }
+}
+
+int ReedSolomon::decode(uint8_t* const* shards, const std::vector<bool>& present, size_t len) const {
+  /// the rows of the first nData shards present
+  std::vector<int> rows;
+  std::vector<int> missingData;
+  bool missingParity = false;
+  for (int s = 0; s < nData_ + nParity_; ++s) {
+    if (present[s]) {
+      if ((int)rows.size() < nData_) {
+        rows.push_back(s);
+      }
+    } else if (s < nData_) {
+      missingData.push_back(s);
+    } else {
+      missingParity = true;
+    }
+  }
+  if ((int)rows.size() < nData_) {
+    return -1;
+  }
+
+  if (missingData.empty() == false) {
+    std::vector<uint8_t> matrix(nData_ * nData_, 0);
+    for (int r = 0; r < nData_; ++r) {
+      int s = rows[r];
+      if (s < nData_) {
+        matrix[r * nData_ + s] = 1;
+      } else {
+        for (int j = 0; j < nData_; ++j) {
+          matrix[r * nData_ + j] = parityMatrix_[(s - nData_) * nData_ + j];
+        }
+      }
+    }
+    if (-1 == invert(&matrix, nData_)) {
+      return -1;
+    }
+    /// data[j] = sum_r inverse[j][r] * shards[rows[r]]
+    for (int j : missingData) {
+      for (int r = 0; r < nData_; ++r) {
+        gfMulRegionWith(kernel_, matrix[j * nData_ + r], shards[rows[r]], shards[j], len, r > 0);
+      }
+    }
+  }
+
+  if (missingParity) {
+    for (int i = 0; i < nParity_; ++i) {
+      if (present[nData_ + i]) {
+        continue;
+      }
+      const uint8_t* row = &parityMatrix_[i * nData_];
+      for (int j = 0; j < nData_; ++j) {
+        gfMulRegionWith(kernel_, row[j], shards[j], shards[nData_ + i], len, j > 0);
+      }
+    }
+  }
+  return 0;
+}
+
+int ReedSolomon::invert(std::vector<uint8_t>* matrix, int n) {
+  std::vector<uint8_t>& m = *matrix;
+  std::vector<uint8_t> inverse(n * n, 0);
+  for (int i = 0; i < n; ++i) {
+    inverse[i * n + i] = 1;
+  }
+  /// Gauss-Jordan elimination. Subtraction is xor.
+  for (int col = 0; col < n; ++col) {
+    int pivot = col;
+    while (pivot < n && m[pivot * n + col] == 0) {
+      ++pivot;
+    }
+    if (pivot == n) {
+      return -1;
+    }
+    if (pivot != col) {
+      for (int j = 0; j < n; ++j) {
+        std::swap(m[pivot * n + j], m[col * n + j]);
+        std::swap(inverse[pivot * n + j], inverse[col * n + j]);
+      }
+    }
+    uint8_t scale = gfInv(m[col * n + col]);
+    for (int j = 0; j < n; ++j) {
+      m[col * n + j] = gfMul(m[col * n + j], scale);
+      inverse[col * n + j] = gfMul(inverse[col * n + j], scale);
+    }
+    for (int r = 0; r < n; ++r) {
+      uint8_t factor = m[r * n + col];
+      if (r == col || factor == 0) {
+        continue;
+      }
+      for (int j = 0; j < n; ++j) {
+        m[r * n + j] ^= gfMul(factor, m[col * n + j]);
+        inverse[r * n + j] ^= gfMul(factor, inverse[col * n + j]);
+      }
+    }
+  }
+  m.swap(inverse);
+  return 0;
+}
+
+} // namespace erasure
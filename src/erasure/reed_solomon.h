@@ -0,0 +1,65 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Systematic Reed-Solomon erasure code over GF(2^8).
+
+#ifndef REED_SOLOMON_H_
+#define REED_SOLOMON_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "erasure/gf256.h"
+
+namespace erasure {
+
+/// \brief ReedSolomon encodes nData data shards into nParity parity shards,
+/// all of the same length. Any nData of the nData + nParity shards are enough
+/// to rebuild the others.
+///
+/// The generator matrix is the identity on top of a Cauchy matrix,
+/// parity[i] = sum_j data[j] / ((nData + i) ^ j), so every square submatrix of
+/// it is invertible. Decoding inverts the rows of the surviving shards.
+/// The regions are multiplied by gfMulRegion().
+class ReedSolomon {
+ public:
+  /// nData + nParity <= 256
+  ReedSolomon(int nData, int nParity, GfKernel kernel = gfBestKernel());
+
+  int nData() const { return nData_; }
+  int nParity() const { return nParity_; }
+
+  /// Compute the parity shards.
+  ///
+  /// \param data nData shards of len bytes
+  /// \param parity nParity shards of len bytes, overwritten
+  /// \param len length of each shard
+  void encode(const uint8_t* const* data, uint8_t* const* parity, size_t len) const;
+
+  /// Rebuild the missing shards from the present ones.
+  ///
+  /// \param shards nData + nParity shards of len bytes, data shards first.
+  ///        The missing ones are overwritten.
+  /// \param present whether each shard is intact
+  /// \param len length of each shard
+  /// \return return 0 on success, -1 if fewer than nData shards are present
+  int decode(uint8_t* const* shards, const std::vector<bool>& present, size_t len) const;
+
+ private:
+  /// Invert a n x n matrix in place.
+  ///
+  /// \return return 0 on success, -1 if it is singular
+  static int invert(std::vector<uint8_t>* matrix, int n);
+
+  const int nData_;
+  const int nParity_;
+  const GfKernel kernel_;
+  /// nParity x nData coefficients of the parity shards
+  std::vector<uint8_t> parityMatrix_;
+};
+
+} // namespace erasure
+
+#endif
@@ -0,0 +1,181 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for gf256 and ReedSolomon
+
+#include "erasure/gf256.h"
+#include "erasure/reed_solomon.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+typedef std::vector<std::vector<uint8_t>> Shards;
+
+std::vector<erasure::GfKernel> Kernels() {
+  std::vector<erasure::GfKernel> kernels;
+  for (int k = erasure::kGfScalar; k <= erasure::gfBestKernel(); ++k) {
+    kernels.push_back(static_cast<erasure::GfKernel>(k));
+  }
+  return kernels;
+}
+
+void TestField() {
+  for (int a = 1; a < 256; ++a) {
+    assert(erasure::gfMul(a, erasure::gfInv(a)) == 1);
+    assert(erasure::gfMul(a, 1) == a);
+    assert(erasure::gfMul(a, 0) == 0);
+    for (int b = 1; b < 256; b += 7) {
+      assert(erasure::gfMul(a, b) == erasure::gfMul(b, a));
+    }
+  }
+  /// x * x^7 wraps around the polynomial
+  assert(erasure::gfMul(2, 0x80) == 0x1d);
+  ::printf("field pass ...\n");
+}
+
+void TestKernels() {
+  std::mt19937 rng(5);
+  std::vector<uint8_t> src(1000);
+  for (auto& c : src) {
+    c = rng();
+  }
+  for (int i = 0; i < 500; ++i) {
+    uint8_t c = rng();
+    size_t off = rng() % 40;
+    size_t len = rng() % (src.size() - off);
+    bool accumulate = rng() % 2;
+    std::vector<uint8_t> init(len);
+    for (auto& b : init) {
+      b = rng();
+    }
+    std::vector<uint8_t> expected(init);
+    for (size_t j = 0; j < len; ++j) {
+      uint8_t p = erasure::gfMul(c, src[off + j]);
+      expected[j] = accumulate ? expected[j] ^ p : p;
+    }
+    for (auto kernel : Kernels()) {
+      std::vector<uint8_t> dst(init);
+      erasure::gfMulRegionWith(kernel, c, src.data() + off, dst.data(), len, accumulate);
+      assert(dst == expected);
+    }
+  }
+  ::printf("kernels pass (best: %s) ...\n", erasure::gfKernelName(erasure::gfBestKernel()));
+}
+
+Shards Encode(const erasure::ReedSolomon& rs, size_t len, int seed) {
+  std::mt19937 rng(seed);
+  Shards shards(rs.nData() + rs.nParity(), std::vector<uint8_t>(len));
+  for (int i = 0; i < rs.nData(); ++i) {
+    for (auto& c : shards[i]) {
+      c = rng();
+    }
+  }
+  std::vector<const uint8_t*> data;
+  std::vector<uint8_t*> parity;
+  for (int i = 0; i < rs.nData(); ++i) {
+    data.push_back(shards[i].data());
+  }
+  for (int i = 0; i < rs.nParity(); ++i) {
+    parity.push_back(shards[rs.nData() + i].data());
+  }
+  rs.encode(data.data(), parity.data(), len);
+  return shards;
+}
+
+/// Erase the shards in the bits of mask and decode them
+int Decode(const erasure::ReedSolomon& rs, const Shards& encoded, int mask, Shards* decoded) {
+  int n = rs.nData() + rs.nParity();
+  *decoded = encoded;
+  std::vector<bool> present(n);
+  std::vector<uint8_t*> ptrs(n);
+  for (int s = 0; s < n; ++s) {
+    present[s] = (mask & (1 << s)) == 0;
+    if (present[s] == false) {
+      memset((*decoded)[s].data(), 0xaa, (*decoded)[s].size());
+    }
+    ptrs[s] = (*decoded)[s].data();
+  }
+  return rs.decode(ptrs.data(), present, encoded[0].size());
+}
+
+void TestCode(int nData, int nParity) {
+  for (auto kernel : Kernels()) {
+    erasure::ReedSolomon rs(nData, nParity, kernel);
+    Shards encoded = Encode(rs, 333, nData * 10 + nParity);
+    int n = nData + nParity;
+    for (int mask = 1; mask < (1 << n); ++mask) {
+      int nErased = __builtin_popcount(mask);
+      Shards decoded;
+      int ret = Decode(rs, encoded, mask, &decoded);
+      if (nErased > nParity) {
+        assert(ret == -1);
+      } else {
+        assert(ret == 0);
+        assert(decoded == encoded);
+      }
+    }
+  }
+  ::printf("RS(%d,%d) pass ...\n", nData, nParity);
+}
+
+/// Throughput of the data shards in GB/s on one core
+template<typename F>
+double Measure(size_t bytes, int rounds, F f) {
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r) {
+    f();
+  }
+  std::chrono::duration<double> sec = std::chrono::steady_clock::now() - start;
+  return (double)bytes * rounds / sec.count() / 1e9;
+}
+
+void BenchmarkThroughput() {
+  const int nData = 6;
+  const int nParity = 3;
+  const size_t len = 1 << 20;
+  for (auto kernel : Kernels()) {
+    erasure::ReedSolomon rs(nData, nParity, kernel);
+    Shards shards = Encode(rs, len, 1);
+    std::vector<uint8_t*> ptrs;
+    for (auto& s : shards) {
+      ptrs.push_back(s.data());
+    }
+    int rounds = kernel == erasure::kGfScalar ? 4 : 32;
+    double encode = Measure(nData * len, rounds, [&]() {
+      rs.encode(ptrs.data(), ptrs.data() + nData, len);
+    });
+    /// the worst case, nParity data shards lost
+    std::vector<bool> present(nData + nParity, true);
+    for (int i = 0; i < nParity; ++i) {
+      present[i] = false;
+    }
+    double decode = Measure(nData * len, rounds, [&]() {
+      rs.decode(ptrs.data(), present, len);
+    });
+    ::printf("RS(6,3) %s: encode %.2f GB/s, decode %.2f GB/s\n",
+             erasure::gfKernelName(kernel), encode, decode);
+  }
+}
+
+} // namespace
+
+void TestReedSolomon() {
+  ::printf("Test ReedSolomon...\n");
+
+  TestField();
+  TestKernels();
+  TestCode(6, 3);
+  TestCode(4, 2);
+  TestCode(10, 4);
+  TestCode(1, 1);
+  BenchmarkThroughput();
+
+  ::printf("\n");
+}
@@ -0,0 +1,257 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+
+#include "logging/async_logging.h"
+#include "logging/log_stream.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace logging {
+
+/// A single-producer single-consumer byte ring.
+struct AsyncLogging::Ring {
+  explicit Ring(size_t capacity)
+      : data(new char[capacity]), capacity(capacity), head(0), tail(0), closed(false) {
+  }
+
+  std::unique_ptr<char[]> data;
+  const size_t capacity;
+
+  /// bytes written, by the thread
+  std::atomic<uint64_t> head;
+
+  /// bytes read, by the writer
+  std::atomic<uint64_t> tail;
+
+  /// the thread has exited
+  std::atomic<bool> closed;
+};
+
+std::atomic<uint64_t> AsyncLogging::g_next_id_(1);
+
+AsyncLogging::AsyncLogging(const string& file, int flush_interval_ms, OverflowPolicy policy,
+                           size_t buffer_size)
+    : file_(file), flush_interval_ms_(flush_interval_ms), policy_(policy),
+      buffer_size_(std::max<size_t>(buffer_size, 4096)), id_(g_next_id_.fetch_add(1)), fd_(-1),
+      attached_(false), running_(false), wakeup_(false), dropped_(0), flush_requested_(0),
+      flush_done_(0) {
+}
+
+AsyncLogging::~AsyncLogging() {
+  stop();
+}
+
+int AsyncLogging::start() {
+  if (running_) {
+    return 0;
+  }
+  if (file_ == "-") {
+    fd_ = STDOUT_FILENO;
+  } else {
+    fd_ = ::open(file_.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+      ::fprintf(stderr, "Failed to open log file %s: %s\n", file_.c_str(), ::strerror(errno));
+      return -1;
+    }
+  }
+  running_ = true;
+  writer_ = std::thread(&AsyncLogging::write_loop, this);
+  return 0;
+}
+
+void AsyncLogging::stop() {
+  if (attached_) {
+    g_out = [](const char* buf, size_t size){
+      ::fwrite(buf, 1, size, ::stdout);
+    };
+    g_flush = [](){
+      ::fflush(::stdout);
+    };
+    g_sync = g_flush;
+    attached_ = false;
+  }
+  if (running_ == false) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+  }
+  cond_.notify_one();
+  writer_.join();
+  cond_flushed_.notify_all();
+  if (fd_ != STDOUT_FILENO) {
+    ::close(fd_);
+  }
+  fd_ = -1;
+}
+
+void AsyncLogging::attach() {
+  g_out = [this](const char* buf, size_t size){
+    append(buf, size);
+  };
+  /// the lines are flushed by the writer
+  g_flush = [](){};
+  g_sync = [this](){
+    flush();
+  };
+  attached_ = true;
+}
+
+void AsyncLogging::append(const char* line, size_t size) {
+  Ring* ring = local_ring();
+  size = std::min(size, ring->capacity);
+
+  uint64_t head = ring->head.load(std::memory_order_relaxed);
+  uint64_t tail = ring->tail.load(std::memory_order_acquire);
+  while (ring->capacity - (head - tail) < size) {
+    if (policy_ == DROP || running_ == false) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    wake();
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+    tail = ring->tail.load(std::memory_order_acquire);
+  }
+
+  /// the line may wrap around the end
+  size_t offset = head % ring->capacity;
+  size_t first = std::min(size, ring->capacity - offset);
+  ::memcpy(ring->data.get() + offset, line, first);
+  ::memcpy(ring->data.get(), line + first, size - first);
+  ring->head.store(head + size, std::memory_order_release);
+
+  if (head + size - tail > ring->capacity / 2) {
+    wake();
+  }
+}
+
+void AsyncLogging::flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (running_ == false) {
+    return;
+  }
+  uint64_t ticket = ++flush_requested_;
+  wakeup_ = true;
+  cond_.notify_one();
+  cond_flushed_.wait(lock, [this, ticket]{return flush_done_ >= ticket || running_ == false;});
+}
+
+uint64_t AsyncLogging::dropped() const {
+  return dropped_.load();
+}
+
+AsyncLogging::Ring* AsyncLogging::local_ring() {
+  struct Local {
+    uint64_t owner = 0;
+    std::shared_ptr<Ring> ring;
+
+    ~Local() {
+      if (ring) {
+        ring->closed = true;
+      }
+    }
+  };
+  static thread_local Local local;
+
+  if (local.owner != id_) {
+    if (local.ring) {
+      local.ring->closed = true;
+    }
+    local.ring = std::make_shared<Ring>(buffer_size_);
+    local.owner = id_;
+    std::lock_guard<std::mutex> lock(mutex_);
+    rings_.push_back(local.ring);
+  }
+  return local.ring.get();
+}
+
+void AsyncLogging::wake() {
+  if (wakeup_.exchange(true) == false) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cond_.notify_one();
+  }
+}
+
+void AsyncLogging::write_loop() {
+  string buf;
+  uint64_t dropped_reported = 0;
+  bool stopping = false;
+  while (stopping == false) {
+    std::vector<std::shared_ptr<Ring>> rings;
+    uint64_t ticket = 0;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cond_.wait_for(lock, std::chrono::milliseconds(flush_interval_ms_),
+                     [this]{return wakeup_ || running_ == false;});
+      wakeup_ = false;
+      stopping = running_ == false;
+      ticket = flush_requested_;
+      rings = rings_;
+    }
+
+    buf.clear();
+    drain(rings, &buf);
+    uint64_t dropped = dropped_.load();
+    if (dropped != dropped_reported) {
+      char line[64];
+      ::snprintf(line, sizeof(line), "%llu log lines dropped\n",
+                 static_cast<unsigned long long>(dropped - dropped_reported));
+      buf += line;
+      dropped_reported = dropped;
+    }
+    write_out(buf);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      /// the rings of the threads gone are freed once drained
+      rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [](const std::shared_ptr<Ring>& r) {
+        return r->closed && r->head.load() == r->tail.load();
+      }), rings_.end());
+      flush_done_ = ticket;
+    }
+    cond_flushed_.notify_all();
+  }
+}
+
+void AsyncLogging::drain(const std::vector<std::shared_ptr<Ring>>& rings, string* buf) {
+  for (const auto& ring : rings) {
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    uint64_t head = ring->head.load(std::memory_order_acquire);
+    if (head == tail) {
+      continue;
+    }
+    size_t size = head - tail;
+    size_t offset = tail % ring->capacity;
+    size_t first = std::min(size, ring->capacity - offset);
+    buf->append(ring->data.get() + offset, first);
+    buf->append(ring->data.get(), size - first);
+    /// the room is given back before the slow write
+    ring->tail.store(head, std::memory_order_release);
+  }
+}
+
+void AsyncLogging::write_out(const string& buf) {
+  size_t written = 0;
+  while (written < buf.size()) {
+    ssize_t ret = ::write(fd_, buf.data() + written, buf.size() - written);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+    written += ret;
+  }
+}
+
+} // namespace logging
@@ -0,0 +1,134 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief A log sink written by a background thread.
+
+#ifndef ASYNC_LOGGING_H_
+#define ASYNC_LOGGING_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using std::string;
+
+namespace logging {
+
+/// What a thread does when its log buffer is full.
+enum OverflowPolicy: int {
+  /// wait for the writer to make room
+  BLOCK = 0,
+  /// drop the line, and count it
+  DROP
+};
+
+/// \brief AsyncLogging takes the log lines off the logging threads.
+///
+/// Each thread appends its lines to a buffer of its own, a lock-free ring
+/// shared with the writer thread only. The writer drains all the rings into
+/// one buffer, and writes it with a single write(2): every
+/// flush_interval_ms, when a ring is half full, or when flush() is called.
+/// So a line costs a copy, and the lines of a thread keep their order, while
+/// the lines of different threads may be written out of order.
+///
+/// Call attach() to make it the sink of LOG_XXX. Then a FATAL line is flushed
+/// before the program aborts.
+class AsyncLogging {
+ public:
+  /// \param file the log file appended to, "-" for stdout
+  /// \param flush_interval_ms max time a line waits in a buffer
+  /// \param policy what to do when the buffer of a thread is full
+  /// \param buffer_size size of the buffer of each thread
+  AsyncLogging(const string& file, int flush_interval_ms = 1000, OverflowPolicy policy = BLOCK,
+               size_t buffer_size = 256 * 1024);
+
+  /// Stop and flush.
+  ~AsyncLogging();
+
+  /// \brief Open the file and start the writer thread.
+  ///
+  /// \return return 0 on success, -1 for errors.
+  int start();
+
+  /// \brief Write all the lines and stop the writer thread. The lines
+  /// appended after are kept in the buffers, or dropped.
+  void stop();
+
+  /// \brief Send the lines of LOG_XXX to this sink, until stop().
+  /// Call it before the other threads log.
+  void attach();
+
+  /// \brief Append a line.
+  ///
+  /// \param line the line, with the new line char
+  /// \param size length of the line
+  void append(const char* line, size_t size);
+
+  /// \brief Write all the lines appended before, and return.
+  void flush();
+
+  /// \brief Number of lines dropped since the start.
+  uint64_t dropped() const;
+
+ private:
+  struct Ring;
+
+  /// \brief Get the buffer of this thread, creating it at the first call.
+  Ring* local_ring();
+
+  /// \brief Wake up the writer thread.
+  void wake();
+
+  /// \brief Writer thread method.
+  void write_loop();
+
+  /// \brief Move the lines of the rings to buf.
+  ///
+  /// \param rings the rings
+  /// \param buf the returning lines
+  void drain(const std::vector<std::shared_ptr<Ring>>& rings, string* buf);
+
+  /// \brief Write buf to the file, retrying partial writes.
+  void write_out(const string& buf);
+
+  const string file_;
+  const int flush_interval_ms_;
+  const OverflowPolicy policy_;
+  const size_t buffer_size_;
+
+  /// tells the rings of this sink from those of a former one
+  const uint64_t id_;
+
+  int fd_;
+  bool attached_;
+
+  std::atomic<bool> running_;
+  std::thread writer_;
+
+  /// set when the writer should run before the interval ends
+  std::atomic<bool> wakeup_;
+
+  std::atomic<uint64_t> dropped_;
+
+  /// guards rings_, the flush tickets, and the condition variables
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::condition_variable cond_flushed_;
+  std::vector<std::shared_ptr<Ring>> rings_;
+
+  /// flush() waits until flush_done_ reaches its ticket
+  uint64_t flush_requested_;
+  uint64_t flush_done_;
+
+  static std::atomic<uint64_t> g_next_id_;
+};
+
+} // namespace logging
+
+#endif
@@ -0,0 +1,179 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test and benchmark for AsyncLogging.
+
+#include "logging/async_logging.h"
+#include "logging/logger.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+string TempFile() {
+  char name[] = "/tmp/minidfs_async_log_XXXXXX";
+  int fd = ::mkstemp(name);
+  assert(fd >= 0);
+  ::close(fd);
+  return name;
+}
+
+std::vector<string> ReadLines(const string& file) {
+  std::ifstream in(file);
+  std::vector<string> lines;
+  string line;
+  while (std::getline(in, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+void TestOrder() {
+  string file = TempFile();
+  const int kThreads = 4;
+  const int kLines = 20000;
+  {
+    /// small buffers, so the threads wait for the writer
+    logging::AsyncLogging log(file, 1000, logging::BLOCK, 4096);
+    assert(log.start() == 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&log, t]() {
+        char line[32];
+        for (int i = 0; i < kLines; ++i) {
+          int size = ::snprintf(line, sizeof(line), "%d %d\n", t, i);
+          log.append(line, size);
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    assert(log.dropped() == 0);
+  }
+
+  /// the lines of a thread are in order
+  std::vector<int> next(kThreads, 0);
+  for (const auto& line : ReadLines(file)) {
+    int t = -1;
+    int i = -1;
+    std::istringstream(line) >> t >> i;
+    assert(t >= 0 && t < kThreads && i == next[t]);
+    ++next[t];
+  }
+  for (int t = 0; t < kThreads; ++t) {
+    assert(next[t] == kLines);
+  }
+  ::unlink(file.c_str());
+  ::printf("order pass ...\n");
+}
+
+void TestDrop() {
+  string file = TempFile();
+  {
+    logging::AsyncLogging log(file, 1000, logging::DROP, 4096);
+    /// not started, nothing is written
+    string line(99, 'x');
+    line += '\n';
+    for (int i = 0; i < 100; ++i) {
+      log.append(line.data(), line.size());
+    }
+    assert(log.dropped() == 60);
+    assert(log.start() == 0);
+  }
+  auto lines = ReadLines(file);
+  assert(lines.size() == 41);
+  assert(lines.back() == "60 log lines dropped");
+  ::unlink(file.c_str());
+  ::printf("drop pass ...\n");
+}
+
+void TestFlush() {
+  string file = TempFile();
+  logging::AsyncLogging log(file, 60 * 1000);
+  assert(log.start() == 0);
+  log.append("flushed\n", 8);
+  log.flush();
+  auto lines = ReadLines(file);
+  assert(lines.size() == 1 && lines[0] == "flushed");
+
+  /// the lines of LOG_XXX too
+  log.attach();
+  LOG_WARN << "attached";
+  logging::g_sync();
+  lines = ReadLines(file);
+  assert(lines.size() == 2 && lines[1].find("WARN attached") != string::npos);
+
+  log.stop();
+  ::unlink(file.c_str());
+  ::printf("flush pass ...\n");
+}
+
+/// Print the time to log a line synchronously, as Logger did, and with
+/// the async sink by nThread threads.
+void Bench(int nThread, int nLines) {
+  string file = TempFile();
+  string line(100, 'x');
+  line += '\n';
+
+  FILE* out = ::fopen(file.c_str(), "a");
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nLines; ++i) {
+    ::fwrite(line.data(), 1, line.size(), out);
+    ::fflush(out);
+  }
+  double sync = std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count() / nLines;
+  ::fclose(out);
+
+  double async = 0;
+  {
+    logging::AsyncLogging log(file, 1000, logging::BLOCK);
+    log.start();
+    std::vector<double> costs(nThread);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nThread; ++t) {
+      threads.emplace_back([&, t]() {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < nLines / nThread; ++i) {
+          log.append(line.data(), line.size());
+        }
+        costs[t] = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / (nLines / nThread);
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    for (double c : costs) {
+      async += c / nThread;
+    }
+  }
+  ::printf("%d threads: sync %7.1f ns/line, async %7.1f ns/line\n", nThread, sync, async);
+  ::unlink(file.c_str());
+}
+
+} // namespace
+
+void TestAsyncLogging() {
+  ::printf("Test AsyncLogging...\n");
+
+  TestOrder();
+  TestDrop();
+  TestFlush();
+
+  Bench(1, 200000);
+  Bench(4, 200000);
+
+  ::printf("\n");
+}
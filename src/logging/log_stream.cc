@@ -6,8 +6,8 @@
 
 #include "logging/log_stream.h"
 
-#include <thread>
-#include <sstream>
+#include <algorithm>
+#include <cmath>
 
 
 
@@ -21,71 +21,62 @@ void LogStream::buf(char** p_buf, size_t* size) {
 
 LogStream &LogStream::operator<<(bool arg) {
   if(arg)
-    append("true");
+    append("true", 4);
   else
-    append("false");
+    append("false", 5);
   return *this;
 }
 
 LogStream &LogStream::operator<<(char arg) {
-  char str[2] = {arg,'\0'};
-  append(str);
+  append(&arg, 1);
 
   return *this;
 }
 
 LogStream &LogStream::operator<<(int16_t arg) {
-  auto str = std::to_string(arg);
-  append(str.c_str());
-  
+  append_integer(arg);
+
   return *this;
 }
 
 LogStream &LogStream::operator<<(uint16_t arg) {
-  auto str = std::to_string(arg);
-  append(str.c_str());
+  append_unsigned(arg, false);
 
   return *this;
 }
 
 LogStream &LogStream::operator<<(int32_t arg) {
-  auto str = std::to_string(arg);
-  append(str.c_str());
+  append_integer(arg);
 
   return *this;
 }
 
 LogStream &LogStream::operator<<(uint32_t arg) {
-  auto str = std::to_string(arg);
-  append(str.c_str());
+  append_unsigned(arg, false);
 
   return *this;
 }
 
 LogStream &LogStream::operator<<(int64_t arg) {
-  auto str = std::to_string(arg);
-  append(str.c_str());
+  append_integer(arg);
 
   return *this;
 }
 
 LogStream &LogStream::operator<<(uint64_t arg) {
-  auto str = std::to_string(arg);
-  append(str.c_str());
+  append_unsigned(arg, false);
 
   return *this;
 }
 
 LogStream &LogStream::operator<<(float arg) {
-  auto str = std::to_string(arg);
-  append(str.c_str());
+  append_double(arg);
 
   return *this;
 }
 
 LogStream &LogStream::operator<<(double arg) {
-  auto str = std::to_string(arg);
-  append(str.c_str());
+  append_double(arg);
 
   return *this;
 }
@@ -97,14 +88,107 @@ LogStream &LogStream::operator<<(const char *arg) {
 }
 
 LogStream &LogStream::operator<<(const string &arg) {
-  append(arg.c_str());
+  append(arg.data(), arg.size());
 
   return *this;
 }
 
 void LogStream::append(const char *s) {
-  auto buf_left = buf_size_ - buf_pointer_ > 0 ? buf_size_ - buf_pointer_ : 0;
-  buf_pointer_ += ::snprintf(buf_ + buf_pointer_, buf_left, "%s", s);
+  append(s, ::strlen(s));
+}
+
+void LogStream::append(const char *s, size_t size) {
+  size_t buf_left = buf_size_ - 1 - buf_pointer_;
+  if (size > buf_left) {
+    size = buf_left;
+  }
+  ::memcpy(buf_ + buf_pointer_, s, size);
+  buf_pointer_ += size;
+  buf_[buf_pointer_] = '\0';
+}
+
+namespace {
+
+const char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/// Write the decimal digits of arg backwards from end, two at a time.
+/// Return the first digit.
+char *format_decimal(uint64_t arg, char *end) {
+  while (arg >= 100) {
+    const char *pair = digit_pairs + arg % 100 * 2;
+    arg /= 100;
+    *--end = pair[1];
+    *--end = pair[0];
+  }
+  if (arg < 10) {
+    *--end = static_cast<char>('0' + arg);
+  } else {
+    *--end = digit_pairs[arg * 2 + 1];
+    *--end = digit_pairs[arg * 2];
+  }
+  return end;
+}
+
+} // namespace
+
+void LogStream::append_integer(int64_t arg) {
+  if (arg < 0) {
+    append_unsigned(0 - static_cast<uint64_t>(arg), true);
+  } else {
+    append_unsigned(arg, false);
+  }
+}
+
+void LogStream::append_unsigned(uint64_t arg, bool negative) {
+  char digits[24];
+  char *end = digits + sizeof(digits);
+  char *begin = format_decimal(arg, end);
+  if (negative) {
+    *--begin = '-';
+  }
+  append(begin, end - begin);
+}
+
+void LogStream::append_double(double arg) {
+  /// Fast path: round |arg| to millionths in an integer. Below 1e6, the
+  /// product is off by less than 2^-12, so it rounds as printf does, unless
+  /// it is that close to a tie.
+  double scaled = std::fabs(arg) * 1e6;
+  if (std::fabs(arg) < 1e6 && std::fabs(scaled - std::floor(scaled) - 0.5) > 1e-3) {
+    uint64_t units = static_cast<uint64_t>(scaled + 0.5);
+    char digits[32];
+    char *end = digits + sizeof(digits);
+    char *begin = end;
+    uint64_t fraction = units % 1000000;
+    for (int i = 0; i < 6; ++i) {
+      *--begin = static_cast<char>('0' + fraction % 10);
+      fraction /= 10;
+    }
+    *--begin = '.';
+    begin = format_decimal(units / 1000000, begin);
+    if (std::signbit(arg)) {
+      *--begin = '-';
+    }
+    append(begin, end - begin);
+    return;
+  }
+
+  /// large, NaN, infinite, or near a tie
+  size_t buf_left = buf_size_ - buf_pointer_;
+  int size = ::snprintf(buf_ + buf_pointer_, buf_left, "%f", arg);
+  if (size > 0) {
+    buf_pointer_ += std::min<size_t>(size, buf_left - 1);
+  }
 }
 
 
@@ -118,6 +202,11 @@ std::function<void()> g_flush = [](){
   ::fflush(::stdout);
 };
 
+/// global flush before abort
+std::function<void()> g_sync = [](){
+  ::fflush(::stdout);
+};
+
 
 
 } // namespace logging
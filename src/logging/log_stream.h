@@ -21,9 +21,13 @@ using std::string;
 namespace logging {
 
 
+/// \brief LogStream formats the values into its buffer without allocating.
+/// The numbers are formatted as std::to_string does.
 class LogStream {
  public:
-  LogStream() = default;
+  LogStream() {
+    buf_[0] = '\0';
+  }
   ~LogStream() = default;
 
   LogStream &operator<<(bool arg);
@@ -51,12 +55,22 @@ class LogStream {
   /// Append s to buf_
   void append(const char *s);
 
+  /// Append size chars of s to buf_, as many as fit
+  void append(const char *s, size_t size);
+
+  /// Append the decimal digits of an integer
+  void append_integer(int64_t arg);
+  void append_unsigned(uint64_t arg, bool negative);
+
+  /// Append a double as "%f"
+  void append_double(double arg);
+
   //
-  // buffer for a line of log
+  // buffer for a line of log, always null-terminated
   //
   static constexpr int buf_size_ = 4 * 1024;
 
-  char buf_[buf_size_] = {0};
+  char buf_[buf_size_];
   size_t buf_pointer_ = 0;
 
 
@@ -70,6 +84,10 @@ extern std::function<void(const char*, size_t)> g_out;
 /// global flush
 extern std::function<void()> g_flush;
 
+/// global flush, which returns when the lines are written. Called before
+/// the program aborts on FATAL.
+extern std::function<void()> g_sync;
+
   
 } // namespace logging
 
@@ -5,9 +5,14 @@
 /// \brief Test for log stream
 
 #include "logging/log_stream.h"
+#include "logging/logger.h"
 
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <cstring>
+#include <sstream>
+#include <thread>
 
 void TestBool() {
   logging::LogStream s;
@@ -71,6 +76,52 @@ void TestNumber() {
   ::printf("number test pass ...\n");
 }
 
+void TestFormat() {
+  /// formatted as std::to_string does
+  const int64_t integers[] = {0, 7, -7, 10, 99, 100, -1000, 123456789, INT64_MAX, INT64_MIN};
+  for (int64_t i : integers) {
+    logging::LogStream s;
+    s << i;
+    char *buf;
+    size_t size = 0;
+    s.buf(&buf, &size);
+    assert(std::to_string(i) == string(buf, size));
+  }
+  logging::LogStream u;
+  u << UINT64_MAX << ' ' << static_cast<uint16_t>(65535) << ' ' << static_cast<int16_t>(-32768);
+  char *buf;
+  size_t size = 0;
+  u.buf(&buf, &size);
+  assert(string(buf) == std::to_string(UINT64_MAX) + " 65535 -32768");
+
+  const double doubles[] = {0.0, -0.0, 1.5, 0.0000005, 0.0000015, 2.0000025, -8.88, 1e-7,
+                            -1e-7, 123456.789, 999999.9999995, 1e6, 1e300, INFINITY, NAN};
+  for (double d : doubles) {
+    logging::LogStream s;
+    s << d;
+    s.buf(&buf, &size);
+    assert(std::to_string(d) == string(buf, size));
+  }
+  for (int i = 0; i < 100000; ++i) {
+    double d = (i - 50000) * 0.0123456789;
+    logging::LogStream s;
+    s << d << ' ' << static_cast<float>(d);
+    s.buf(&buf, &size);
+    assert(std::to_string(d) + " " + std::to_string(static_cast<float>(d)) == string(buf, size));
+  }
+
+  /// the line is cut at the end of the buffer
+  logging::LogStream s;
+  string chunk(1000, 'x');
+  for (int i = 0; i < 5; ++i) {
+    s << chunk << i;
+  }
+  s.buf(&buf, &size);
+  assert(size == 4095 && ::strlen(buf) == 4095);
+
+  ::printf("format test pass ...\n");
+}
+
 void TestString() {
   logging::LogStream s;
 
@@ -95,12 +146,90 @@ void TestString() {
   ::printf("string test pass ...\n");
 }
 
+namespace {
+
+/// A line formatted as Logger and LogStream formerly did, as the baseline.
+class FormerLine {
+ public:
+  FormerLine(const char *level) {
+    char log_header[36] = {0};
+    time_t time_now;
+    ::time(&time_now);
+    auto tm_now = ::localtime(&time_now);
+    auto size_ = ::strftime(log_header, 36, "%Y/%m/%d %H:%M:%S", tm_now);
+    auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::system_clock().now().time_since_epoch()).count();
+    ::snprintf(log_header + size_, 36 - size_, ".%06u", static_cast<uint32_t>(timestamp % 1000000));
+    *this << log_header;
+    std::ostringstream ss;
+    ss << std::this_thread::get_id();
+    *this << " " << ss.str().c_str() << " " << level << " ";
+  }
+
+  ~FormerLine() {
+    char file_buf[128] = {0};
+    ::snprintf(file_buf, 128, " - %s:%s:%u\n", __FILE__, __FUNCTION__, __LINE__);
+    *this << file_buf;
+  }
+
+  FormerLine &operator<<(const char *s) {
+    pointer_ += ::snprintf(buf_ + pointer_, sizeof(buf_) - pointer_, "%s", s);
+    return *this;
+  }
+
+  FormerLine &operator<<(int64_t arg) {
+    return *this << std::to_string(arg).c_str();
+  }
+
+  FormerLine &operator<<(double arg) {
+    return *this << std::to_string(arg).c_str();
+  }
+
+ private:
+  char buf_[4 * 1024] = {0};
+  size_t pointer_ = 0;
+};
+
+/// Print the lines formatted per second, formerly and now. The lines are
+/// not written out.
+void BenchLine(int nLines) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nLines; ++i) {
+    FormerLine("INFO") << "Recv block " << static_cast<int64_t>(i) << " of "
+                       << static_cast<int64_t>(2097152) << " bytes at " << 12.5 << " MB/s";
+  }
+  double former = nLines / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  auto out = logging::g_out;
+  auto flush = logging::g_flush;
+  logging::g_out = [](const char*, size_t) {};
+  logging::g_flush = []() {};
+  auto level = logging::Logger::log_level();
+  logging::Logger::set_log_level(logging::INFO);
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nLines; ++i) {
+    LOG_INFO << "Recv block " << static_cast<int64_t>(i) << " of "
+             << static_cast<int64_t>(2097152) << " bytes at " << 12.5 << " MB/s";
+  }
+  double now = nLines / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  logging::Logger::set_log_level(level);
+  logging::g_out = out;
+  logging::g_flush = flush;
+
+  ::printf("format a line: former %9.0f lines/s, now %9.0f lines/s\n", former, now);
+}
+
+} // namespace
+
 void TestLogStream() {
   ::printf("Test LogStream...\n");
 
   TestBool();
   TestNumber();
+  TestFormat();
   TestString();
 
+  BenchLine(200000);
+
   ::printf("\n");
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 
 #include "logging/logger.h"
 
+#include <algorithm>
+#include <chrono>
 #include <thread>
 #include <sstream>
 
@@ -15,41 +17,75 @@ const char *log_level_str[] = {"TRACE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL
 
 LogLevel Logger::g_log_level_ = INFO;
 
+namespace {
+
+/// The date and time to the second, and the thread id, formatted once a
+/// second and once a thread.
+struct ThreadCache {
+  int64_t second = -1;
+  char time[32];
+  size_t time_size = 0;
+  char tid[32];
+  size_t tid_size = 0;
+};
+
+thread_local ThreadCache t_cache;
+
+} // namespace
+
 Logger::Logger(LogLevel level, const char *file, const char *function, uint32_t line)
     : log_level_(level), file_(file), function_(function), line_(line) {
-  
-  constexpr int HEADER_SIZE = 36;
-  char log_header[HEADER_SIZE] = {0};
+  ThreadCache &cache = t_cache;
 
   // set time stamp
-  time_t time_now;
-  ::time(&time_now);
-  auto tm_now = ::localtime(&time_now);
-
-  auto size_ = ::strftime(log_header, HEADER_SIZE, "%Y/%m/%d %H:%M:%S", tm_now);
   auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
                    std::chrono::system_clock().now().time_since_epoch())
                    .count();
-  
-  ::snprintf(log_header + size_, HEADER_SIZE - size_, ".%06u", static_cast<uint32_t>(timestamp % 1000000));
-  stream_ << log_header;
+  int64_t second = timestamp / 1000000;
+  if (second != cache.second) {
+    time_t time_now = static_cast<time_t>(second);
+    struct tm tm_now;
+    ::localtime_r(&time_now, &tm_now);
+    cache.time_size = ::strftime(cache.time, sizeof(cache.time), "%Y/%m/%d %H:%M:%S", &tm_now);
+    cache.second = second;
+  }
 
   // set thread id
-  auto id = std::this_thread::get_id();
-
-  std::ostringstream ss;
-  ss << id;
-  stream_ << ' ' << ss.str();
+  if (cache.tid_size == 0) {
+    std::ostringstream ss;
+    ss << std::this_thread::get_id();
+    cache.tid_size = ss.str().copy(cache.tid, sizeof(cache.tid) - 1);
+    cache.tid[cache.tid_size] = '\0';
+  }
 
-  // set log level
-  stream_ << ' ' << log_level_str[level] << ' ';
+  // "date time.micro tid LEVEL "
+  constexpr int HEADER_SIZE = 96;
+  char log_header[HEADER_SIZE];
+  char *p = log_header;
+  ::memcpy(p, cache.time, cache.time_size);
+  p += cache.time_size;
+  *p++ = '.';
+  uint32_t micro = static_cast<uint32_t>(timestamp % 1000000);
+  for (int i = 5; i >= 0; --i) {
+    p[i] = static_cast<char>('0' + micro % 10);
+    micro /= 10;
+  }
+  p += 6;
+  *p++ = ' ';
+  ::memcpy(p, cache.tid, cache.tid_size);
+  p += cache.tid_size;
+  *p++ = ' ';
+  size_t level_size = ::strlen(log_level_str[level]);
+  ::memcpy(p, log_level_str[level], level_size);
+  p += level_size;
+  *p++ = ' ';
+  *p = '\0';
+  stream_ << log_header;
 }
 
 Logger::~Logger() {
   // add file and line info
-  char file_buf[128] = {0};
-  ::snprintf(file_buf, 128, " - %s:%s:%u\n", file_, function_, line_);
-  stream_ << file_buf;
+  stream_ << " - " << file_ << ':' << function_ << ':' << line_ << '\n';
 
   char* buf;
   size_t size;
@@ -57,19 +93,42 @@ Logger::~Logger() {
   
   // flush
   g_out(buf, size);
-  g_flush();
 
   if (log_level_ == FATAL) {
+    g_sync();
     ::abort();
   }
+  g_flush();
 }
 
 void Logger::set_log_level(LogLevel level) {
   g_log_level_ = level;
 }
 
-LogLevel Logger::log_level() {
-  return g_log_level_;
+bool Logger::parse_log_level(const std::string& name, LogLevel* level) {
+  for (int i = TRACE; i <= FATAL; ++i) {
+    if (name == log_level_str[i]) {
+      *level = static_cast<LogLevel>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Logger::every_n(std::atomic<uint64_t>* count, uint64_t n) {
+  return count->fetch_add(1, std::memory_order_relaxed) % std::max<uint64_t>(n, 1) == 0;
+}
+
+bool Logger::every_t(std::atomic<int64_t>* next, int64_t interval_ms) {
+  return every_t(next, interval_ms, std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool Logger::every_t(std::atomic<int64_t>* next, int64_t interval_ms, int64_t now_ms) {
+  int64_t expected = next->load(std::memory_order_relaxed);
+  /// one of the threads racing for the line wins
+  return now_ms >= expected
+      && next->compare_exchange_strong(expected, now_ms + interval_ms, std::memory_order_relaxed);
 }
 
 
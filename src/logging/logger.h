@@ -12,6 +12,10 @@
 
 #include "logging/log_stream.h"
 
+#include <atomic>
+#include <cstdint>
+#include <string>
+
 
 namespace logging {
 
@@ -37,6 +41,35 @@ class Logger {
   /// Get log level
   static LogLevel log_level();
 
+  /// \brief Parse the name of a level, e.g. "INFO".
+  ///
+  /// \param name name of the level
+  /// \param level the returning level
+  /// \return true if the name is of a level
+  static bool parse_log_level(const std::string& name, LogLevel* level);
+
+  /// \brief Count a time a line is reached.
+  ///
+  /// \param count the times the line was reached
+  /// \param n the line is logged once every n times
+  /// \return true if the line should be logged
+  static bool every_n(std::atomic<uint64_t>* count, uint64_t n);
+
+  /// \brief Check if a line may be logged again.
+  ///
+  /// \param next the time in ms the line may be logged again
+  /// \param interval_ms the line is logged at most once every interval_ms
+  /// \return true if the line should be logged
+  static bool every_t(std::atomic<int64_t>* next, int64_t interval_ms);
+
+  /// \brief Check if a line may be logged again at a given time.
+  ///
+  /// \param next the time in ms the line may be logged again
+  /// \param interval_ms the line is logged at most once every interval_ms
+  /// \param now_ms the time in ms of steady_clock
+  /// \return true if the line should be logged
+  static bool every_t(std::atomic<int64_t>* next, int64_t interval_ms, int64_t now_ms);
+
   /// return log stream which binds with this logger
   LogStream &stream();
 
@@ -58,27 +91,60 @@ class Logger {
 
 
 
+/// Turns the stream of a line into void, for the two branches of LOG_IF.
+struct LogVoidify {
+  void operator&(LogStream&) {
+  }
+};
+
+inline LogLevel Logger::log_level() {
+  return g_log_level_;
+}
+
 } // namespace logging
 
 
 
-#define LOG_TRACE if (logging::Logger::log_level() <= logging::TRACE) \
-    logging::Logger(logging::TRACE, __FILE__, __FUNCTION__, __LINE__).stream()
+/// LOG_MIN_LEVEL is the lowest level compiled in, e.g. -DLOG_MIN_LEVEL=2 for
+/// INFO. The lines of lower levels are removed at compile time, and set_log_level()
+/// can not bring them back.
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL 0
+#endif
+
+/// True if the lines of the level are compiled in and not filtered out.
+#define LOG_IS_ON(level) \
+    (LOG_MIN_LEVEL <= logging::level && logging::Logger::log_level() <= logging::level)
+
+/// Log if the level is on and the condition holds. The operands of << are
+/// evaluated only if the line is logged, and the macro is safe in an if
+/// without braces.
+#define LOG_IF(level, condition) \
+    !(LOG_IS_ON(level) && (condition)) ? (void)0 : logging::LogVoidify() & \
+    logging::Logger(logging::level, __FILE__, __FUNCTION__, __LINE__).stream()
+
+#define LOG_TRACE LOG_IF(TRACE, true)
+
+#define LOG_DEBUG LOG_IF(DEBUG, true)
+
+#define LOG_INFO LOG_IF(INFO, true)
 
-#define LOG_DEBUG if (logging::Logger::log_level() <= logging::DEBUG) \
-    logging::Logger(logging::DEBUG, __FILE__, __FUNCTION__, __LINE__).stream()
+#define LOG_WARN LOG_IF(WARN, true)
 
-#define LOG_INFO if (logging::Logger::log_level() <= logging::INFO) \
-    logging::Logger(logging::INFO, __FILE__, __FUNCTION__, __LINE__).stream()
+#define LOG_ERROR LOG_IF(ERROR, true)
 
-#define LOG_WARN if (logging::Logger::log_level() <= logging::WARN) \
-    logging::Logger(logging::WARN, __FILE__, __FUNCTION__, __LINE__).stream()
+#define LOG_FATAL LOG_IF(FATAL, true)
 
-#define LOG_ERROR \
-    logging::Logger(logging::ERROR, __FILE__, __FUNCTION__, __LINE__).stream()
+/// Log the 1st, (n+1)th, (2n+1)th... time this line is reached, for lines on
+/// the path of every request, e.g. LOG_EVERY_N(INFO, 100) << "...".
+#define LOG_EVERY_N(level, n) \
+    LOG_IF(level, logging::Logger::every_n(([]() -> std::atomic<uint64_t>* { \
+        static std::atomic<uint64_t> count(0); return &count; })(), (n)))
 
-#define LOG_FATAL \
-    logging::Logger(logging::FATAL, __FILE__, __FUNCTION__, __LINE__).stream()
+/// Log this line at most once every ms milliseconds.
+#define LOG_EVERY_T(level, ms) \
+    LOG_IF(level, logging::Logger::every_t(([]() -> std::atomic<int64_t>* { \
+        static std::atomic<int64_t> next(0); return &next; })(), (ms)))
 
 
 
@@ -10,6 +10,100 @@
 #include <cassert>
 #include <cstring>
 
+namespace {
+
+/// Count the lines logged, instead of printing them.
+struct CountLines {
+  CountLines() : saved(logging::g_out) {
+    logging::g_out = [this](const char*, size_t){
+      ++lines;
+    };
+  }
+
+  ~CountLines() {
+    logging::g_out = saved;
+  }
+
+  int lines = 0;
+  std::function<void(const char*, size_t)> saved;
+};
+
+int Evaluate(int* times) {
+  return ++*times;
+}
+
+void TestLazy() {
+  CountLines count;
+  int times = 0;
+  logging::Logger::set_log_level(logging::WARN);
+  LOG_INFO << Evaluate(&times);
+  assert(times == 0 && count.lines == 0);
+  LOG_WARN << Evaluate(&times);
+  assert(times == 1 && count.lines == 1);
+
+  /// ERROR can be filtered out too
+  logging::Logger::set_log_level(logging::FATAL);
+  LOG_ERROR << Evaluate(&times);
+  assert(times == 1 && count.lines == 1);
+
+  /// no dangling else
+  logging::Logger::set_log_level(logging::INFO);
+  bool taken = false;
+  if (times == 0)
+    LOG_INFO << "not taken";
+  else
+    taken = true;
+  assert(taken && count.lines == 1);
+  ::printf("lazy pass ...\n");
+}
+
+void TestEveryN() {
+  CountLines count;
+  int times = 0;
+  for (int i = 0; i < 25; ++i) {
+    LOG_EVERY_N(INFO, 10) << Evaluate(&times);
+  }
+  /// the 1st, 11th and 21st
+  assert(count.lines == 3 && times == 3);
+
+  /// each line counts on its own
+  for (int i = 0; i < 5; ++i) {
+    LOG_EVERY_N(INFO, 10) << i;
+    LOG_EVERY_N(INFO, 2) << i;
+  }
+  assert(count.lines == 3 + 1 + 3);
+  ::printf("every n pass ...\n");
+}
+
+void TestEveryT() {
+  std::atomic<int64_t> next(0);
+  int logged = 0;
+  for (int64_t now = 1000; now < 1250; ++now) {
+    logged += logging::Logger::every_t(&next, 100, now);
+  }
+  /// at 1000, 1100 and 1200
+  assert(logged == 3 && next.load() == 1300);
+
+  /// the clock is not controlled here, so only the first line is certain
+  CountLines count;
+  for (int i = 0; i < 10; ++i) {
+    LOG_EVERY_T(INFO, 100) << "tick";
+  }
+  assert(count.lines >= 1);
+  ::printf("every t pass ...\n");
+}
+
+void TestParseLevel() {
+  logging::LogLevel level = logging::FATAL;
+  assert(logging::Logger::parse_log_level("INFO", &level) && level == logging::INFO);
+  assert(logging::Logger::parse_log_level("TRACE", &level) && level == logging::TRACE);
+  assert(!logging::Logger::parse_log_level("info", &level) && level == logging::TRACE);
+  assert(!logging::Logger::parse_log_level("", &level));
+  ::printf("parse level pass ...\n");
+}
+
+} // namespace
+
 
 void TestLogger() {
   ::printf("Test Logger...\n");
@@ -23,6 +117,12 @@ void TestLogger() {
   LOG_WARN << "i am warn log " << 9.93;
   LOG_ERROR << "i am error log " << false;
 
+  TestLazy();
+  TestEveryN();
+  TestEveryT();
+  TestParseLevel();
+  logging::Logger::set_log_level(logging::DEBUG);
+
 
   ::printf("\n");
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+
+#include "metrics/counter.h"
+
+#include <mutex>
+#include <vector>
+
+namespace metrics {
+
+namespace {
+
+/// The free slots. Never destroyed, as the threads exiting after main()
+/// still give their slots back.
+struct Slots {
+  std::mutex mutex;
+  std::vector<int> free;
+  int next = 0;
+};
+
+Slots* slots() {
+  static Slots* slots = new Slots();
+  return slots;
+}
+
+/// Gives the slot of the thread back when the thread exits. A slot given
+/// back keeps the counts of its former thread, so the sums stay right.
+struct SlotOwner {
+  int* slot = nullptr;
+
+  ~SlotOwner() {
+    if (slot == nullptr || *slot < 0) {
+      return;
+    }
+    Slots* s = slots();
+    std::lock_guard<std::mutex> lock(s->mutex);
+    s->free.push_back(*slot);
+    /// the metrics updated later by this thread share the last cell
+    *slot = -1;
+  }
+};
+
+} // namespace
+
+int acquire_thread_slot(int* slot) {
+  static thread_local SlotOwner owner;
+  Slots* s = slots();
+  std::lock_guard<std::mutex> lock(s->mutex);
+  if (s->free.empty() == false) {
+    *slot = s->free.back();
+    s->free.pop_back();
+  } else if (s->next < kSlots) {
+    *slot = s->next++;
+  } else {
+    *slot = -1;
+  }
+  owner.slot = slot;
+  return *slot;
+}
+
+} // namespace metrics
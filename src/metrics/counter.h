@@ -0,0 +1,105 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Counters and gauges with a cell per thread.
+
+#ifndef METRICS_COUNTER_H_
+#define METRICS_COUNTER_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace metrics {
+
+/// Max number of threads with a slot of their own in the metrics. The
+/// threads beyond share the last cell, with atomic adds.
+const int kSlots = 64;
+
+/// \brief Give the calling thread a free slot, until it exits.
+///
+/// \param slot the slot variable of the thread, set to -1 when the thread
+/// exits, or when no slot is free
+/// \return the slot, -1 if none is free
+int acquire_thread_slot(int* slot);
+
+/// \brief Get the slot of the calling thread, -1 for none. No other thread
+/// writes the cells of the slot while this one is alive.
+inline int thread_slot() {
+  /// constant initialized, so reading it is a plain TLS load
+  static thread_local int slot = -2;
+  if (__builtin_expect(slot == -2, 0)) {
+    acquire_thread_slot(&slot);
+  }
+  return slot;
+}
+
+/// \brief A 64-bit integer updated by many threads.
+///
+/// Each thread has a cell of its own, in a cache line of its own. So an
+/// update is a load and a store, not even an atomic add, and the threads
+/// don't bounce the line between the cores. Reading sums up the cells, and
+/// is not atomic with respect to the updates.
+class ShardedInt {
+ public:
+  ShardedInt() {
+    for (auto& c : cells_) {
+      c.value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  ShardedInt(const ShardedInt&) = delete;
+  ShardedInt& operator=(const ShardedInt&) = delete;
+
+  void add(int64_t n) {
+    int slot = thread_slot();
+    if (__builtin_expect(slot >= 0, 1)) {
+      auto& value = cells_[slot].value;
+      value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    } else {
+      cells_[kSlots].value.fetch_add(n, std::memory_order_relaxed);
+    }
+  }
+
+  int64_t value() const {
+    int64_t sum = 0;
+    for (const auto& c : cells_) {
+      sum += c.value.load(std::memory_order_relaxed);
+    }
+    return sum;
+  }
+
+ private:
+  /// two cache lines a cell, as new doesn't align them to one before C++17
+  struct Cell {
+    std::atomic<int64_t> value;
+    char pad[128 - sizeof(std::atomic<int64_t>)];
+  };
+
+  /// a cell per slot, and the one shared by the threads without a slot
+  Cell cells_[kSlots + 1];
+};
+
+/// \brief A number of events, or of bytes, since the start.
+class Counter : public ShardedInt {
+ public:
+  void inc() {
+    add(1);
+  }
+};
+
+/// \brief A level going up and down, e.g. the connections open.
+class Gauge : public ShardedInt {
+ public:
+  void inc() {
+    add(1);
+  }
+
+  void dec() {
+    add(-1);
+  }
+};
+
+} // namespace metrics
+
+#endif
@@ -0,0 +1,101 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+
+#include "metrics/histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace metrics {
+
+const int Histogram::kSubBits;
+const int64_t Histogram::kSubBuckets;
+const int Histogram::kMaxBits;
+const int Histogram::kBuckets;
+
+int64_t HistogramSnapshot::percentile(double q) const {
+  if (count == 0) {
+    return 0;
+  }
+  /// the rank of the value, from 1
+  int64_t rank = std::max<int64_t>(1, static_cast<int64_t>(std::ceil(q * count)));
+  int64_t seen = 0;
+  for (size_t i = 0; i < buckets.size(); ++i) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      return std::min(Histogram::bucket_max(i), max);
+    }
+  }
+  return max;
+}
+
+Histogram::Shard::Shard() {
+  sum.store(0, std::memory_order_relaxed);
+  max.store(0, std::memory_order_relaxed);
+  for (auto& b : buckets) {
+    b.store(0, std::memory_order_relaxed);
+  }
+}
+
+Histogram::Histogram() {
+  for (auto& s : shards_) {
+    s.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+Histogram::~Histogram() {
+  for (auto& s : shards_) {
+    delete s.load();
+  }
+}
+
+void Histogram::record_slow(int slot, int64_t value) {
+  if (slot >= 0) {
+    /// the shard is published for snapshot(), then written as usual
+    shards_[slot].store(new Shard(), std::memory_order_release);
+    record(value);
+    return;
+  }
+  shared_.buckets[bucket(value)].fetch_add(1, std::memory_order_relaxed);
+  shared_.sum.fetch_add(value, std::memory_order_relaxed);
+  int64_t max = shared_.max.load(std::memory_order_relaxed);
+  while (value > max && !shared_.max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+  }
+}
+
+void Histogram::snapshot(HistogramSnapshot* snapshot) const {
+  snapshot->count = 0;
+  snapshot->sum = 0;
+  snapshot->max = 0;
+  snapshot->buckets.assign(kBuckets, 0);
+  auto merge = [snapshot](const Shard& s) {
+    for (int i = 0; i < kBuckets; ++i) {
+      int64_t n = s.buckets[i].load(std::memory_order_relaxed);
+      snapshot->buckets[i] += n;
+      snapshot->count += n;
+    }
+    snapshot->sum += s.sum.load(std::memory_order_relaxed);
+    snapshot->max = std::max(snapshot->max, s.max.load(std::memory_order_relaxed));
+  };
+  for (const auto& s : shards_) {
+    const Shard* shard = s.load(std::memory_order_acquire);
+    if (shard != nullptr) {
+      merge(*shard);
+    }
+  }
+  merge(shared_);
+}
+
+int64_t Histogram::bucket_max(int index) {
+  if (index < kSubBuckets) {
+    return index;
+  }
+  int shift = index / kSubBuckets - 1;
+  int64_t lowest = (kSubBuckets + index % kSubBuckets) << shift;
+  return lowest + (int64_t(1) << shift) - 1;
+}
+
+} // namespace metrics
@@ -0,0 +1,135 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief A latency histogram with log-linear buckets.
+
+#ifndef METRICS_HISTOGRAM_H_
+#define METRICS_HISTOGRAM_H_
+
+#include "metrics/counter.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace metrics {
+
+/// \brief Merged buckets of a histogram.
+struct HistogramSnapshot {
+  int64_t count = 0;
+  int64_t sum = 0;
+  int64_t max = 0;
+  std::vector<int64_t> buckets;
+
+  /// \brief Get the value below which a fraction of the values fall.
+  ///
+  /// \param q the fraction, in [0, 1]
+  /// \return the highest value of the bucket the quantile is in, or max
+  int64_t percentile(double q) const;
+};
+
+/// \brief Histogram counts the values, e.g. latencies in us, in buckets
+/// like HdrHistogram's.
+///
+/// The values below kSubBuckets have a bucket each. Above, each power of two
+/// is split into kSubBuckets buckets, so a value is known within 1/16 of it,
+/// from 1 us to 19 hours in 528 buckets. The values beyond go to the last one.
+///
+/// Like the counters, each thread records to buckets of its own, allocated
+/// at its first value. So recording a value is a few loads and stores.
+class Histogram {
+ public:
+  static const int kSubBits = 4;
+  static const int64_t kSubBuckets = 1 << kSubBits;
+  /// values are below 2^kMaxBits
+  static const int kMaxBits = 36;
+  static const int kBuckets = kSubBuckets * (kMaxBits - kSubBits + 1);
+
+  Histogram();
+  ~Histogram();
+
+  Histogram(const Histogram&) = delete;
+  Histogram& operator=(const Histogram&) = delete;
+
+  /// \brief Count a value. A negative one counts as 0.
+  void record(int64_t value) {
+    if (value < 0) {
+      value = 0;
+    }
+    int slot = thread_slot();
+    Shard* s = slot >= 0 ? shards_[slot].load(std::memory_order_relaxed) : nullptr;
+    if (__builtin_expect(s == nullptr, 0)) {
+      record_slow(slot, value);
+      return;
+    }
+    /// only this thread writes the shard
+    auto& count = s->buckets[bucket(value)];
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    s->sum.store(s->sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    if (value > s->max.load(std::memory_order_relaxed)) {
+      s->max.store(value, std::memory_order_relaxed);
+    }
+  }
+
+  /// \brief Merge the shards.
+  ///
+  /// \param snapshot the returning buckets
+  void snapshot(HistogramSnapshot* snapshot) const;
+
+  /// \brief Get the bucket of a value.
+  static int bucket(int64_t value) {
+    if (value < kSubBuckets) {
+      return static_cast<int>(value);
+    }
+    int msb = 63 - __builtin_clzll(static_cast<uint64_t>(value));
+    if (msb >= kMaxBits) {
+      return kBuckets - 1;
+    }
+    int shift = msb - kSubBits;
+    return static_cast<int>(kSubBuckets * (shift + 1) + ((value >> shift) & (kSubBuckets - 1)));
+  }
+
+  /// \brief Get the highest value counted in a bucket.
+  static int64_t bucket_max(int index);
+
+ private:
+  struct Shard {
+    Shard();
+
+    std::atomic<int64_t> sum;
+    std::atomic<int64_t> max;
+    std::atomic<int64_t> buckets[kBuckets];
+  };
+
+  /// \brief Record a value from a thread without a shard yet, or without a slot.
+  void record_slow(int slot, int64_t value);
+
+  /// a shard of 4K per slot, allocated at the first value
+  std::atomic<Shard*> shards_[kSlots];
+
+  /// shared by the threads without a slot, with atomic adds
+  Shard shared_;
+};
+
+/// \brief Record the time from its construction to its destruction, in us.
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(Histogram* histogram)
+      : histogram_(histogram), start_(std::chrono::steady_clock::now()) {
+  }
+
+  ~ScopedTimer() {
+    histogram_->record(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_).count());
+  }
+
+ private:
+  Histogram* histogram_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace metrics
+
+#endif
@@ -0,0 +1,112 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test and benchmark for Histogram.
+
+#include "metrics/histogram.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void TestBuckets() {
+  using metrics::Histogram;
+  int last = 0;
+  for (int64_t v = 0; v < (int64_t(1) << 20); v += 1 + v / 100) {
+    int b = Histogram::bucket(v);
+    assert(b >= last && b < Histogram::kBuckets);
+    last = b;
+    /// the bucket holds the value, within 1/16 of it
+    int64_t max = Histogram::bucket_max(b);
+    assert(max >= v && max - v <= v / Histogram::kSubBuckets);
+    assert(b == 0 || Histogram::bucket_max(b - 1) < v);
+  }
+  assert(Histogram::bucket(int64_t(1) << 40) == Histogram::kBuckets - 1);
+  ::printf("buckets pass ...\n");
+}
+
+void TestPercentiles() {
+  metrics::Histogram histogram;
+  for (int v = 1; v <= 10000; ++v) {
+    histogram.record(v);
+  }
+  histogram.record(-5);
+  metrics::HistogramSnapshot snapshot;
+  histogram.snapshot(&snapshot);
+  assert(snapshot.count == 10001);
+  assert(snapshot.sum == 10000LL * 10001 / 2);
+  assert(snapshot.max == 10000);
+  assert(snapshot.percentile(0) == 0);
+  assert(snapshot.percentile(1) == 10000);
+
+  int64_t p50 = snapshot.percentile(0.5);
+  int64_t p99 = snapshot.percentile(0.99);
+  assert(p50 >= 5000 && p50 <= 5000 + 5000 / 16);
+  assert(p99 >= 9900 && p99 <= 10000);
+  ::printf("percentiles pass ...\n");
+}
+
+void TestThreads() {
+  metrics::Histogram histogram;
+  const int kThreads = 4;
+  const int kValues = 100000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&histogram, t]() {
+      for (int i = 0; i < kValues; ++i) {
+        histogram.record(t * 1000 + i % 100);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  metrics::HistogramSnapshot snapshot;
+  histogram.snapshot(&snapshot);
+  assert(snapshot.count == kThreads * kValues);
+  assert(snapshot.max == (kThreads - 1) * 1000 + 99);
+  ::printf("threads pass ...\n");
+}
+
+/// Print the time to record a value with nThread threads.
+void Bench(int nThread, int nValues) {
+  metrics::Histogram histogram;
+  std::vector<double> costs(nThread);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nThread; ++t) {
+    threads.emplace_back([&, t]() {
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < nValues; ++i) {
+        histogram.record(i & 4095);
+      }
+      costs[t] = std::chrono::duration<double, std::nano>(
+          std::chrono::steady_clock::now() - start).count() / nValues;
+    });
+  }
+  double cost = 0;
+  for (int t = 0; t < nThread; ++t) {
+    threads[t].join();
+    cost += costs[t] / nThread;
+  }
+  ::printf("%d threads: %5.1f ns/record\n", nThread, cost);
+}
+
+} // namespace
+
+void TestHistogram() {
+  ::printf("Test Histogram...\n");
+
+  TestBuckets();
+  TestPercentiles();
+  TestThreads();
+
+  Bench(1, 10000000);
+  Bench(4, 10000000);
+
+  ::printf("\n");
+}
@@ -0,0 +1,123 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+
+#include "metrics/registry.h"
+#include "proto/minidfs.pb.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace metrics {
+
+Registry* Registry::global() {
+  /// never destroyed, as the threads may update the metrics while exiting
+  static Registry* registry = new Registry();
+  return registry;
+}
+
+Counter* Registry::counter(const string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& c = counters_[name];
+  if (!c) {
+    c.reset(new Counter());
+  }
+  return c.get();
+}
+
+Gauge* Registry::gauge(const string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& g = gauges_[name];
+  if (!g) {
+    g.reset(new Gauge());
+  }
+  return g.get();
+}
+
+Histogram* Registry::histogram(const string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& h = histograms_[name];
+  if (!h) {
+    h.reset(new Histogram());
+  }
+  return h.get();
+}
+
+void Registry::gauge_fn(const string& name, std::function<int64_t()> fn) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  gauge_fns_[name] = std::move(fn);
+}
+
+void Registry::remove_gauge_fn(const string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  gauge_fns_.erase(name);
+}
+
+void Registry::dump(minidfs::Metrics* metrics) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& c : counters_) {
+    auto m = metrics->add_metrics();
+    m->set_name(c.first);
+    m->set_type(minidfs::Metric::COUNTER);
+    m->set_value(c.second->value());
+  }
+  for (const auto& g : gauges_) {
+    auto m = metrics->add_metrics();
+    m->set_name(g.first);
+    m->set_type(minidfs::Metric::GAUGE);
+    m->set_value(g.second->value());
+  }
+  for (const auto& g : gauge_fns_) {
+    auto m = metrics->add_metrics();
+    m->set_name(g.first);
+    m->set_type(minidfs::Metric::GAUGE);
+    m->set_value(g.second());
+  }
+  HistogramSnapshot snapshot;
+  for (const auto& h : histograms_) {
+    h.second->snapshot(&snapshot);
+    auto m = metrics->add_metrics();
+    m->set_name(h.first);
+    m->set_type(minidfs::Metric::HISTOGRAM);
+    m->set_count(snapshot.count);
+    m->set_sum(snapshot.sum);
+    m->set_max(snapshot.max);
+    m->set_p50(snapshot.percentile(0.5));
+    m->set_p90(snapshot.percentile(0.9));
+    m->set_p99(snapshot.percentile(0.99));
+    m->set_p999(snapshot.percentile(0.999));
+  }
+  std::sort(metrics->mutable_metrics()->begin(), metrics->mutable_metrics()->end(),
+            [](const minidfs::Metric& a, const minidfs::Metric& b) {
+    return a.name() < b.name();
+  });
+}
+
+void Registry::dump_text(string* text) const {
+  minidfs::Metrics metrics;
+  dump(&metrics);
+  format_text(metrics, text);
+}
+
+void Registry::format_text(const minidfs::Metrics& metrics, string* text) {
+  char line[256];
+  for (const auto& m : metrics.metrics()) {
+    if (m.type() != minidfs::Metric::HISTOGRAM) {
+      ::snprintf(line, sizeof(line), "%s %lld\n", m.name().c_str(),
+                 static_cast<long long>(m.value()));
+    } else {
+      ::snprintf(line, sizeof(line),
+                 "%s count=%lld mean=%lld p50=%lld p90=%lld p99=%lld p999=%lld max=%lld\n",
+                 m.name().c_str(), static_cast<long long>(m.count()),
+                 static_cast<long long>(m.count() > 0 ? m.sum() / m.count() : 0),
+                 static_cast<long long>(m.p50()), static_cast<long long>(m.p90()),
+                 static_cast<long long>(m.p99()), static_cast<long long>(m.p999()),
+                 static_cast<long long>(m.max()));
+    }
+    *text += line;
+  }
+}
+
+} // namespace metrics
@@ -0,0 +1,93 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief The metrics of the process, by name.
+
+#ifndef METRICS_REGISTRY_H_
+#define METRICS_REGISTRY_H_
+
+#include "metrics/counter.h"
+#include "metrics/histogram.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+using std::string;
+
+namespace minidfs {
+class Metrics;
+} // namespace minidfs
+
+namespace metrics {
+
+/// \brief Registry keeps the counters, the gauges and the histograms of the
+/// process by name, e.g. "rpc.create.us".
+///
+/// A metric is created at the first lookup, and lives as long as the
+/// process, so the pointer can be kept and updated without a lookup. A gauge
+/// may also be a function called at each dump, e.g. for the size of a
+/// queue; it is removed by its owner before it is gone.
+///
+/// It is thread safe.
+class Registry {
+ public:
+  Registry() = default;
+
+  Registry(const Registry&) = delete;
+  Registry& operator=(const Registry&) = delete;
+
+  /// \brief The registry of the process.
+  static Registry* global();
+
+  /// \brief Get a counter, creating it at the first call.
+  Counter* counter(const string& name);
+
+  /// \brief Get a gauge, creating it at the first call.
+  Gauge* gauge(const string& name);
+
+  /// \brief Get a histogram, creating it at the first call.
+  Histogram* histogram(const string& name);
+
+  /// \brief Add a gauge read by calling fn, replacing the one of the same name.
+  ///
+  /// \param name the name of the gauge
+  /// \param fn returns the value. It is called with the registry locked.
+  void gauge_fn(const string& name, std::function<int64_t()> fn);
+
+  /// \brief Remove a gauge added by gauge_fn(). It returns after any call of
+  /// fn in progress.
+  void remove_gauge_fn(const string& name);
+
+  /// \brief Dump all the metrics, sorted by name.
+  ///
+  /// \param metrics the returning metrics
+  void dump(minidfs::Metrics* metrics) const;
+
+  /// \brief Dump all the metrics as text, a line each.
+  ///
+  /// \param text the returning text
+  void dump_text(string* text) const;
+
+  /// \brief Format dumped metrics as text, a line each: the value of a
+  /// counter or a gauge, and the count, the mean, the percentiles and the max
+  /// of a histogram.
+  ///
+  /// \param metrics the dumped metrics
+  /// \param text the returning text
+  static void format_text(const minidfs::Metrics& metrics, string* text);
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<string, std::unique_ptr<Counter>> counters_;
+  std::map<string, std::unique_ptr<Gauge>> gauges_;
+  std::map<string, std::unique_ptr<Histogram>> histograms_;
+  std::map<string, std::function<int64_t()>> gauge_fns_;
+};
+
+} // namespace metrics
+
+#endif
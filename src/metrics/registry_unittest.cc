@@ -0,0 +1,145 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test and benchmark for the counters and Registry.
+
+#include "metrics/registry.h"
+#include "proto/minidfs.pb.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void TestCounters() {
+  metrics::Counter counter;
+  metrics::Gauge gauge;
+  const int kThreads = 4;
+  const int kIncs = 100000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < kIncs; ++i) {
+        counter.inc();
+        gauge.inc();
+        gauge.dec();
+      }
+      counter.add(10);
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  assert(counter.value() == kThreads * (kIncs + 10));
+  assert(gauge.value() == 0);
+  ::printf("counters pass ...\n");
+}
+
+void TestManyThreads() {
+  /// more threads than slots, so some share a cell, and the slots of the
+  /// threads gone are reused
+  metrics::Counter counter;
+  metrics::Histogram histogram;
+  const int kThreads = metrics::kSlots + 16;
+  for (int round = 0; round < 2; ++round) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&]() {
+        for (int i = 0; i < 1000; ++i) {
+          counter.inc();
+          histogram.record(i);
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+  }
+  metrics::HistogramSnapshot snapshot;
+  histogram.snapshot(&snapshot);
+  assert(counter.value() == 2 * kThreads * 1000);
+  assert(snapshot.count == 2 * kThreads * 1000 && snapshot.max == 999);
+  ::printf("many threads pass ...\n");
+}
+
+void TestLookup() {
+  metrics::Registry registry;
+  auto calls = registry.counter("rpc.calls");
+  assert(registry.counter("rpc.calls") == calls);
+  calls->add(3);
+  registry.gauge("queued")->add(-2);
+  auto latency = registry.histogram("rpc.us");
+  for (int v = 1; v <= 100; ++v) {
+    latency->record(v);
+  }
+  int64_t size = 7;
+  registry.gauge_fn("size", [&size]() {
+    return size;
+  });
+
+  minidfs::Metrics dumped;
+  registry.dump(&dumped);
+  assert(dumped.metrics_size() == 4);
+  /// sorted by name
+  assert(dumped.metrics(0).name() == "queued" && dumped.metrics(0).value() == -2);
+  assert(dumped.metrics(1).name() == "rpc.calls" && dumped.metrics(1).value() == 3);
+  assert(dumped.metrics(1).type() == minidfs::Metric::COUNTER);
+  const auto& h = dumped.metrics(2);
+  assert(h.name() == "rpc.us" && h.type() == minidfs::Metric::HISTOGRAM);
+  assert(h.count() == 100 && h.sum() == 5050 && h.max() == 100 && h.p50() == 51);
+  assert(dumped.metrics(3).name() == "size" && dumped.metrics(3).value() == 7);
+
+  string text;
+  registry.dump_text(&text);
+  assert(text.find("rpc.calls 3\n") != string::npos);
+  assert(text.find("rpc.us count=100 mean=50 p50=51 ") != string::npos);
+
+  registry.remove_gauge_fn("size");
+  dumped.Clear();
+  registry.dump(&dumped);
+  assert(dumped.metrics_size() == 3);
+  ::printf("registry pass ...\n");
+}
+
+/// Print the time to add to a counter with nThread threads.
+void Bench(int nThread, int nIncs) {
+  metrics::Counter counter;
+  std::vector<double> costs(nThread);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nThread; ++t) {
+    threads.emplace_back([&, t]() {
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < nIncs; ++i) {
+        counter.inc();
+      }
+      costs[t] = std::chrono::duration<double, std::nano>(
+          std::chrono::steady_clock::now() - start).count() / nIncs;
+    });
+  }
+  double cost = 0;
+  for (int t = 0; t < nThread; ++t) {
+    threads[t].join();
+    cost += costs[t] / nThread;
+  }
+  assert(counter.value() == static_cast<int64_t>(nThread) * nIncs);
+  ::printf("%d threads: %5.1f ns/inc\n", nThread, cost);
+}
+
+} // namespace
+
+void TestRegistry() {
+  ::printf("Test Registry...\n");
+
+  TestCounters();
+  TestManyThreads();
+  TestLookup();
+
+  Bench(1, 10000000);
+  Bench(4, 10000000);
+
+  ::printf("\n");
+}
@@ -0,0 +1,63 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+
+#include "metrics/reporter.h"
+#include "logging/logger.h"
+
+#include <chrono>
+#include <sstream>
+
+namespace metrics {
+
+Reporter::Reporter(Registry* registry, int interval_ms)
+    : registry_(registry), interval_ms_(interval_ms), running_(false) {
+}
+
+Reporter::~Reporter() {
+  stop();
+}
+
+void Reporter::start() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (running_) {
+    return;
+  }
+  running_ = true;
+  reporter_ = std::thread(&Reporter::report_loop, this);
+}
+
+void Reporter::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_ == false) {
+      return;
+    }
+    running_ = false;
+  }
+  cond_.notify_one();
+  reporter_.join();
+}
+
+void Reporter::report_loop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (running_) {
+    cond_.wait_for(lock, std::chrono::milliseconds(interval_ms_), [this]{return running_ == false;});
+    if (running_ == false) {
+      break;
+    }
+    lock.unlock();
+    string text;
+    registry_->dump_text(&text);
+    std::istringstream lines(text);
+    string line;
+    while (std::getline(lines, line)) {
+      LOG_INFO << "metric " << line;
+    }
+    lock.lock();
+  }
+}
+
+} // namespace metrics
@@ -0,0 +1,50 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Logs the metrics periodically.
+
+#ifndef METRICS_REPORTER_H_
+#define METRICS_REPORTER_H_
+
+#include "metrics/registry.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace metrics {
+
+/// \brief Reporter logs a text dump of a registry at INFO every interval,
+/// a line per metric, from a thread of its own.
+class Reporter {
+ public:
+  /// \param registry the registry dumped
+  /// \param interval_ms time between two dumps
+  Reporter(Registry* registry, int interval_ms);
+
+  /// Stop.
+  ~Reporter();
+
+  /// \brief Start the reporting thread.
+  void start();
+
+  /// \brief Stop the reporting thread, without a last dump.
+  void stop();
+
+ private:
+  /// \brief Reporting thread method.
+  void report_loop();
+
+  Registry* registry_;
+  const int interval_ms_;
+
+  bool running_;
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::thread reporter_;
+};
+
+} // namespace metrics
+
+#endif
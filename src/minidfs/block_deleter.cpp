@@ -0,0 +1,213 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include <minidfs/block_deleter.hpp>
+#include <minidfs/block_store.hpp>
+#include "logging/logger.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <chrono>
+
+namespace minidfs {
+
+BlockDeleter::BlockDeleter(const string& journalFile, std::function<string(int)> blkPath,
+                           int batchSize, long long batchInterval)
+    : journalFile(journalFile), blkPath(blkPath),
+      batchSize(batchSize > 0 ? batchSize : 1), batchInterval(batchInterval),
+      nJournalLines(0), running(false) {
+}
+
+BlockDeleter::~BlockDeleter() {
+  running = false;
+  condition.notify_all();
+  if (deleterThread.joinable()) {
+    deleterThread.join();
+  }
+}
+
+int BlockDeleter::start() {
+  std::lock_guard<std::mutex> lockJournal(mutexJournal);
+  {
+    std::lock_guard<std::mutex> lockPending(mutexPending);
+    std::ifstream fIn(journalFile);
+    std::vector<int> added;
+    int blkID = 0;
+    while (fIn >> blkID) {
+      if (blkID >= 0) {
+        pendingSet.insert(blkID);
+        added.push_back(blkID);
+      } else {
+        pendingSet.erase(-blkID);
+      }
+    }
+    /// in the order they were added
+    std::set<int> queued;
+    for (int b : added) {
+      if (pendingSet.find(b) != pendingSet.end() && queued.insert(b).second) {
+        pending.push_back(b);
+      }
+    }
+    if (pending.empty() == false) {
+      LOG_INFO << "Replay " << (int)pending.size() << " pending deletes from " << journalFile;
+    }
+  }
+  if (-1 == compactJournal()) {
+    LOG_ERROR << "Failed to compact " << journalFile;
+    return -1;
+  }
+  running = true;
+  deleterThread = std::thread(&BlockDeleter::work, this);
+  return 0;
+}
+
+int BlockDeleter::remove(const std::vector<int>& blkIDs) {
+  if (blkIDs.empty()) {
+    return 0;
+  }
+  std::vector<int> added;
+  int ret = 0;
+  {
+    /// the journal lock orders the records of a block: added before unlinked
+    std::lock_guard<std::mutex> lockJournal(mutexJournal);
+    {
+      std::lock_guard<std::mutex> lockPending(mutexPending);
+      for (int blkID : blkIDs) {
+        if (pendingSet.insert(blkID).second) {
+          pending.push_back(blkID);
+          added.push_back(blkID);
+        }
+      }
+    }
+    ret = appendJournal(added);
+  }
+  condition.notify_one();
+  return ret;
+}
+
+bool BlockDeleter::isPending(int blkID) {
+  std::lock_guard<std::mutex> lockPending(mutexPending);
+  return pendingSet.find(blkID) != pendingSet.end();
+}
+
+size_t BlockDeleter::nPending() {
+  std::lock_guard<std::mutex> lockPending(mutexPending);
+  /// including the batch being unlinked
+  return pendingSet.size();
+}
+
+void BlockDeleter::work() {
+  while (running) {
+    std::vector<int> batch;
+    {
+      std::unique_lock<std::mutex> lockPending(mutexPending);
+      condition.wait(lockPending, [this]{return pending.empty() == false || running == false;});
+      if (running == false) {
+        return;
+      }
+      for (int i = 0; i < batchSize && pending.empty() == false; ++i) {
+        batch.push_back(pending.front());
+        pending.pop_front();
+      }
+    }
+
+    /// unlink outside the lock
+    std::vector<int> done;
+    for (int blkID : batch) {
+      string path = blkPath(blkID);
+      ::remove((path + ".meta").c_str());
+      if (::remove(path.c_str()) == 0 || errno == ENOENT) {
+        LOG_DEBUG << "Succeed removing block: " << blkID;
+      } else {
+        LOG_ERROR << "Failed removing block " << blkID << ": " << strerror(errno);
+      }
+      done.push_back(-blkID);
+    }
+
+    {
+      std::lock_guard<std::mutex> lockJournal(mutexJournal);
+      if (-1 == appendJournal(done)) {
+        LOG_ERROR << "Failed to append to " << journalFile;
+      }
+      size_t nLeft = 0;
+      {
+        std::lock_guard<std::mutex> lockPending(mutexPending);
+        for (int blkID : batch) {
+          pendingSet.erase(blkID);
+        }
+        nLeft = pendingSet.size();
+      }
+      /// each compaction at least halves the journal, so the lines written
+      /// stay linear in the blocks deleted
+      if (nJournalLines >= 2 * nLeft + kMinCompactLines && -1 == compactJournal()) {
+        LOG_ERROR << "Failed to compact " << journalFile;
+      }
+    }
+    LOG_INFO << "Removed " << (int)batch.size() << " blocks";
+
+    if (batchInterval > 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(batchInterval));
+    }
+  }
+}
+
+int BlockDeleter::appendJournal(const std::vector<int>& records) {
+  if (records.empty()) {
+    return 0;
+  }
+  std::ofstream fOut(journalFile, std::ios::out | std::ios::app);
+  if (fOut.is_open() == false) {
+    LOG_ERROR << "Failed to open " << journalFile;
+    return -1;
+  }
+  for (int r : records) {
+    fOut << r << "\n";
+  }
+  fOut.close();
+  nJournalLines += records.size();
+  return fOut.fail() ? -1 : 0;
+}
+
+int BlockDeleter::compactJournal() {
+  string data;
+  {
+    std::lock_guard<std::mutex> lockPending(mutexPending);
+    for (int blkID : pendingSet) {
+      data += std::to_string(blkID);
+      data += '\n';
+    }
+    nJournalLines = pendingSet.size();
+  }
+  string tmpFile = journalFile + ".tmp";
+  int fd = ::open(tmpFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    return -1;
+  }
+  size_t written = 0;
+  while (written < data.size()) {
+    ssize_t n = ::write(fd, data.data() + written, data.size() - written);
+    if (n == -1 && errno != EINTR) {
+      ::close(fd);
+      return -1;
+    }
+    written += n > 0 ? n : 0;
+  }
+  /// durable before it replaces the journal, or a crash may leave it empty
+  BlockSyncer syncer(fd, "close", 0);
+  int ret = syncer.sync();
+  ::close(fd);
+  if (ret == -1 || -1 == ::rename(tmpFile.c_str(), journalFile.c_str())) {
+    return -1;
+  }
+  size_t slash = journalFile.rfind('/');
+  return syncer.syncDir(slash == string::npos ? "." : journalFile.substr(0, slash));
+}
+
+} // namespace minidfs
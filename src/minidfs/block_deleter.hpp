@@ -0,0 +1,121 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Header file for class BlockDeleter.
+
+#ifndef BLOCK_DELETER_H_
+#define BLOCK_DELETER_H_
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+using std::string;
+
+namespace minidfs {
+
+/// \brief BlockDeleter unlinks the block files of deleted blocks in the background.
+/// The .meta file next to a block file is unlinked with it.
+///
+/// The chunkserver stops serving a block before handing it to the deleter, so
+/// the files are unlinked without holding any lock of the chunkserver. Files are
+/// unlinked in batches of batchSize, one batch every batchInterval ms.
+///
+/// The blocks to be unlinked are appended to a journal file, one id per line,
+/// and the unlinked ones are appended as their negated ids. The journal is
+/// replayed by start(), so deletions survive a restart. When most of it is
+/// unlinked blocks, it is compacted to the pending ones, off mutexPending.
+class BlockDeleter {
+ private:
+  /// the journal isn't compacted below this number of lines
+  static const size_t kMinCompactLines = 1024;
+
+  /// the pending-deletes journal
+  const string journalFile;
+
+  /// maps a block id to the path of its file
+  const std::function<string(int)> blkPath;
+
+  /// max number of files unlinked in a batch
+  const int batchSize;
+
+  /// interval between batches, in ms
+  const long long batchInterval;
+
+  /// blocks to be unlinked, in order
+  std::deque<int> pending;
+  /// the same blocks as pending, for lookups
+  std::set<int> pendingSet;
+  /// a mutex for pending and pendingSet
+  std::mutex mutexPending;
+
+  /// number of lines in the journal
+  size_t nJournalLines;
+  /// a mutex for the journal and nJournalLines, taken before mutexPending
+  std::mutex mutexJournal;
+  /// notified when blocks are added or it is stopped
+  std::condition_variable condition;
+
+  /// set to false when shutting down
+  std::atomic<bool> running;
+
+  /// the deleter thread
+  std::thread deleterThread;
+
+ public:
+  /// \brief Create a BlockDeleter. Nothing is done until start().
+  ///
+  /// \param journalFile the pending-deletes journal
+  /// \param blkPath maps a block id to the path of its file
+  /// \param batchSize max number of files unlinked in a batch
+  /// \param batchInterval interval between batches, in ms
+  BlockDeleter(const string& journalFile, std::function<string(int)> blkPath,
+               int batchSize, long long batchInterval);
+
+  /// \brief Stop the deleter thread. Blocks still pending stay in the journal.
+  ~BlockDeleter();
+
+  /// \brief Replay the journal and start the deleter thread.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int start();
+
+  /// \brief Record the blocks in the journal and queue them for unlinking.
+  ///
+  /// \param blkIDs ids of the blocks no longer served
+  /// \return return 0 on success, -1 if the journal can't be appended
+  int remove(const std::vector<int>& blkIDs);
+
+  /// \brief Check whether a block is waiting to be unlinked.
+  bool isPending(int blkID);
+
+  /// \brief Get the number of blocks waiting to be unlinked.
+  size_t nPending();
+
+ private:
+  /// \brief Deleter thread method. Unlink the pending files batch by batch.
+  void work();
+
+  /// \brief Append records to the journal. mutexJournal must be held.
+  ///
+  /// \param records block ids, negated for the unlinked blocks
+  /// \return return 0 on success, -1 for errors
+  int appendJournal(const std::vector<int>& records);
+
+  /// \brief Rewrite the journal with the blocks still pending, durably.
+  /// mutexJournal must be held, mutexPending must not.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int compactJournal();
+};
+
+} // namespace minidfs
+
+#endif
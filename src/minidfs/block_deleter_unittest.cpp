@@ -0,0 +1,130 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for BlockDeleter
+
+#include <minidfs/block_deleter.hpp>
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace {
+
+const string kDir = "/tmp/block_deleter_unittest";
+const string kJournal = kDir + "/pending_deletes";
+
+string BlkPath(int blkID) {
+  return kDir + "/blk_" + std::to_string(blkID);
+}
+
+bool Exists(const string& path) {
+  struct stat st;
+  return ::stat(path.c_str(), &st) == 0;
+}
+
+void CreateBlks(int n) {
+  ::mkdir(kDir.c_str(), 0755);
+  ::remove(kJournal.c_str());
+  for (int i = 1; i <= n; ++i) {
+    std::ofstream(BlkPath(i)) << i;
+  }
+}
+
+int JournalLines() {
+  std::ifstream fIn(kJournal);
+  int n = 0;
+  for (string line; std::getline(fIn, line);) {
+    ++n;
+  }
+  return n;
+}
+
+void WaitEmpty(minidfs::BlockDeleter& deleter) {
+  for (int i = 0; i < 1000 && deleter.nPending() > 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+void TestRemove() {
+  CreateBlks(10);
+  minidfs::BlockDeleter deleter(kJournal, BlkPath, 4, 0);
+  assert(0 == deleter.start());
+  assert(0 == deleter.remove({1, 2, 3, 4, 5, 6, 7}));
+  WaitEmpty(deleter);
+  assert(deleter.nPending() == 0);
+  for (int i = 1; i <= 7; ++i) {
+    assert(Exists(BlkPath(i)) == false);
+  }
+  assert(Exists(BlkPath(8)));
+  ::printf("remove pass ...\n");
+}
+
+void TestReplay() {
+  CreateBlks(10);
+  {
+    /// one block per second: the deleter is stopped with blocks pending
+    minidfs::BlockDeleter deleter(kJournal, BlkPath, 1, 1000);
+    assert(0 == deleter.start());
+    assert(0 == deleter.remove({8, 9, 10}));
+    assert(deleter.isPending(10));
+    assert(deleter.isPending(1) == false);
+  }
+  assert(Exists(BlkPath(10)));
+
+  minidfs::BlockDeleter deleter(kJournal, BlkPath, 16, 0);
+  assert(0 == deleter.start());
+  WaitEmpty(deleter);
+  assert(Exists(BlkPath(9)) == false);
+  assert(Exists(BlkPath(10)) == false);
+  assert(Exists(BlkPath(1)));
+  ::printf("replay pass ...\n");
+}
+
+void TestCompact() {
+  const int kBlks = 5000;
+  CreateBlks(kBlks);
+  std::vector<int> blkIDs;
+  for (int i = 1; i <= kBlks; ++i) {
+    blkIDs.push_back(i);
+  }
+  {
+    minidfs::BlockDeleter deleter(kJournal, BlkPath, 64, 0);
+    assert(0 == deleter.start());
+    assert(0 == deleter.remove(blkIDs));
+    WaitEmpty(deleter);
+    assert(deleter.nPending() == 0);
+  }
+  /// an added and a done line per block, without the compactions
+  assert(JournalLines() < kBlks);
+  assert(Exists(BlkPath(kBlks)) == false && Exists(kJournal + ".tmp") == false);
+
+  /// done markers are replayed
+  CreateBlks(3);
+  std::ofstream(kJournal) << "1\n2\n3\n-1\n-3\n";
+  minidfs::BlockDeleter deleter(kJournal, BlkPath, 1, 1000);
+  assert(0 == deleter.start());
+  assert(deleter.isPending(2));
+  assert(deleter.isPending(1) == false && deleter.isPending(3) == false);
+  assert(JournalLines() == 1);
+  ::printf("compact pass ...\n");
+}
+
+} // namespace
+
+void TestBlockDeleter() {
+  ::printf("Test BlockDeleter...\n");
+
+  TestRemove();
+  TestReplay();
+  TestCompact();
+
+  ::printf("\n");
+}
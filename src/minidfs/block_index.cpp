@@ -0,0 +1,295 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include <minidfs/block_index.hpp>
+#include <rpc/blk_id_codec.hpp>
+#include <proto/minidfs.pb.h>
+#include "checksum/crc32c.h"
+#include "logging/logger.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <mutex>
+
+namespace minidfs {
+
+BlockIndex::BlockIndex(const string& dataDir, const string& snapshotFile, int nScanThread)
+    : dataDir(dataDir), snapshotFile(snapshotFile),
+      nScanThread(nScanThread > 0 ? nScanThread : 1) {
+}
+
+string BlockIndex::subdirPath(int subdir) const {
+  char name[16];
+  snprintf(name, sizeof(name), "/subdir%02x", subdir);
+  return dataDir + name;
+}
+
+string BlockIndex::blkFilePath(int bID) const {
+  return subdirPath(bID & (kSubdirs - 1)) + "/blk_" + std::to_string(bID);
+}
+
+bool BlockIndex::parseBlkFileName(const char* name, int* bID) {
+  if (strncmp(name, "blk_", 4) != 0) {
+    return false;
+  }
+  const char* digits = name + 4;
+  /// strtol accepts leading spaces and signs
+  if ((*digits < '0' || *digits > '9') && *digits != '-') {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  long id = strtol(digits, &end, 10);
+  /// rejects blk_<id>.meta, temp files etc.
+  if (end == digits || *end != '\0' || errno == ERANGE || id < INT_MIN || id > INT_MAX) {
+    return false;
+  }
+  *bID = static_cast<int>(id);
+  return true;
+}
+
+int BlockIndex::prepare() {
+  for (int i = 0; i < kSubdirs; ++i) {
+    if (::mkdir(subdirPath(i).c_str(), 0755) == -1 && errno != EEXIST) {
+      LOG_ERROR << "Failed to create " << subdirPath(i) << ": " << strerror(errno);
+      return -1;
+    }
+  }
+
+  /// the old layout kept all the block files in dataDir
+  auto dir = opendir(dataDir.c_str());
+  if (!dir) {
+    LOG_ERROR << "Cannot open " << dataDir;
+    return -1;
+  }
+  std::vector<string> names;
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    string name(entry->d_name);
+    int bID = 0;
+    size_t dot = name.find('.');
+    if (parseBlkFileName(name.substr(0, dot).c_str(), &bID)
+        && (dot == string::npos || name.compare(dot, string::npos, ".meta") == 0)) {
+      names.push_back(name);
+    }
+  }
+  closedir(dir);
+
+  int nMoved = 0;
+  for (const auto& name : names) {
+    int bID = 0;
+    parseBlkFileName(name.substr(0, name.find('.')).c_str(), &bID);
+    string target = subdirPath(bID & (kSubdirs - 1)) + "/" + name;
+    if (::rename((dataDir + "/" + name).c_str(), target.c_str()) == -1) {
+      LOG_ERROR << "Failed to move " << name << ": " << strerror(errno);
+      return -1;
+    }
+    ++nMoved;
+  }
+  if (nMoved > 0) {
+    LOG_INFO << "Moved " << nMoved << " files into subdirs of " << dataDir;
+  }
+  return nMoved;
+}
+
+int BlockIndex::scanSubdir(int subdir, std::vector<int>* blkIDs) const {
+  string path = subdirPath(subdir);
+  auto dir = opendir(path.c_str());
+  if (!dir) {
+    LOG_ERROR << "Cannot open " << path;
+    return -1;
+  }
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    if (entry->d_type != DT_REG && entry->d_type != DT_UNKNOWN) {
+      continue;
+    }
+    int bID = 0;
+    if (parseBlkFileName(entry->d_name, &bID)) {
+      blkIDs->push_back(bID);
+    }
+  }
+  closedir(dir);
+  return 0;
+}
+
+int BlockIndex::fsNow(int64_t* now) const {
+  string clockFile = snapshotFile + ".clock";
+  int fd = ::open(clockFile.c_str(), O_WRONLY | O_CREAT, 0644);
+  if (fd == -1) {
+    return -1;
+  }
+  struct stat st;
+  int ret = futimens(fd, nullptr);
+  if (ret == 0) {
+    ret = fstat(fd, &st);
+  }
+  ::close(fd);
+  if (ret == -1) {
+    return -1;
+  }
+  *now = st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+  return 0;
+}
+
+int BlockIndex::statSubdirs(std::vector<int64_t>* mtimes) const {
+  mtimes->assign(kSubdirs, 0);
+  for (int i = 0; i < kSubdirs; ++i) {
+    struct stat st;
+    if (::stat(subdirPath(i).c_str(), &st) == -1) {
+      return -1;
+    }
+    (*mtimes)[i] = st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+  }
+  return 0;
+}
+
+int BlockIndex::stampSubdirs(std::vector<int64_t>* mtimes) const {
+  /// taken first: a subdir changed after its stat in the same tick has
+  /// an mtime of at least now
+  int64_t now = 0;
+  if (-1 == fsNow(&now) || -1 == statSubdirs(mtimes)) {
+    return -1;
+  }
+  int nDistrusted = 0;
+  for (auto& t : *mtimes) {
+    if (t >= now) {
+      t = -1;
+      ++nDistrusted;
+    }
+  }
+  if (nDistrusted > 0) {
+    LOG_DEBUG << nDistrusted << " subdirs of " << dataDir << " changed in the snapshot tick";
+  }
+  return 0;
+}
+
+int BlockIndex::readSnapshot(std::vector<int>* blkIDs, std::vector<int64_t>* mtimes) const {
+  std::ifstream fIn(snapshotFile, std::ios::in | std::ios::binary);
+  if (fIn.is_open() == false) {
+    return -1;
+  }
+  std::stringstream buf;
+  buf << fIn.rdbuf();
+  string data = buf.str();
+  if (data.size() < 4) {
+    return -1;
+  }
+
+  uint32_t crc = 0;
+  memcpy(&crc, data.data() + data.size() - 4, 4);
+  data.resize(data.size() - 4);
+  if (ntohl(crc) != checksum::crc32c(0, data.data(), data.size())) {
+    LOG_WARN << "Checksum mismatch of " << snapshotFile;
+    return -1;
+  }
+
+  BlockIndexSnapshot snapshot;
+  if (snapshot.ParseFromString(data) == false || snapshot.subdirmtimes_size() != kSubdirs) {
+    return -1;
+  }
+  if (-1 == rpc::decodeBlkIDs(snapshot.encodedblkids(), blkIDs)) {
+    return -1;
+  }
+  mtimes->assign(snapshot.subdirmtimes().begin(), snapshot.subdirmtimes().end());
+  return 0;
+}
+
+int BlockIndex::load(std::set<int>* blkIDs) {
+  std::vector<int> saved;
+  std::vector<int64_t> savedMtimes;
+  std::vector<int64_t> mtimes;
+  if (-1 == statSubdirs(&mtimes)) {
+    LOG_ERROR << "Failed to stat subdirs of " << dataDir;
+    return -1;
+  }
+  if (-1 == readSnapshot(&saved, &savedMtimes)) {
+    LOG_INFO << "No valid block index snapshot in " << snapshotFile;
+    savedMtimes.assign(kSubdirs, -1);
+  }
+
+  std::vector<int> stale;
+  for (int i = 0; i < kSubdirs; ++i) {
+    if (mtimes[i] != savedMtimes[i]) {
+      stale.push_back(i);
+    }
+  }
+  for (int bID : saved) {
+    if (mtimes[bID & (kSubdirs - 1)] == savedMtimes[bID & (kSubdirs - 1)]) {
+      blkIDs->insert(blkIDs->end(), bID);
+    }
+  }
+
+  /// rescan the stale subdirs in parallel
+  std::atomic<size_t> next(0);
+  std::atomic<bool> failed(false);
+  std::mutex mutexBlkIDs;
+  auto scan = [&]() {
+    size_t i;
+    while ((i = next++) < stale.size()) {
+      std::vector<int> found;
+      if (-1 == scanSubdir(stale[i], &found)) {
+        failed = true;
+        return;
+      }
+      std::lock_guard<std::mutex> lockBlkIDs(mutexBlkIDs);
+      blkIDs->insert(found.begin(), found.end());
+    }
+  };
+  std::vector<std::thread> threads;
+  int nThread = std::min<int>(nScanThread, stale.size());
+  for (int i = 0; i < nThread; ++i) {
+    threads.emplace_back(scan);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  if (failed) {
+    return -1;
+  }
+  LOG_INFO << "Loaded " << (int)blkIDs->size() << " blocks, "
+           << (int)stale.size() << " subdirs rescanned";
+  return stale.size();
+}
+
+int BlockIndex::save(const std::vector<int>& blkIDs, const std::vector<int64_t>& mtimes) const {
+  BlockIndexSnapshot snapshot;
+  for (int64_t t : mtimes) {
+    snapshot.add_subdirmtimes(t);
+  }
+  rpc::encodeBlkIDs(blkIDs, snapshot.mutable_encodedblkids());
+  string data = snapshot.SerializeAsString();
+  uint32_t crc = htonl(checksum::crc32c(0, data.data(), data.size()));
+  data.append(reinterpret_cast<char*>(&crc), 4);
+
+  string tmpFile = snapshotFile + ".tmp";
+  {
+    std::ofstream fOut(tmpFile, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (fOut.is_open() == false) {
+      return -1;
+    }
+    fOut.write(data.data(), data.size());
+    fOut.close();
+    if (fOut.fail()) {
+      return -1;
+    }
+  }
+  return ::rename(tmpFile.c_str(), snapshotFile.c_str());
+}
+
+} // namespace minidfs
@@ -0,0 +1,124 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Header file for class BlockIndex.
+
+#ifndef BLOCK_INDEX_H_
+#define BLOCK_INDEX_H_
+
+#include <string>
+#include <vector>
+#include <set>
+#include <cstdint>
+
+using std::string;
+
+namespace minidfs {
+
+/// \brief BlockIndex lays out the block files of a chunkserver, and keeps a
+/// snapshot of them so that the chunkserver restarts without listing them all.
+///
+/// Block files are spread over kSubdirs subdirs by the low bits of their ids:
+/// dataDir/subdir<xx>/blk_<id>, with xx in hex. Block ids are sequential, so
+/// every subdir holds about 1/kSubdirs of the blocks.
+///
+/// The snapshot file records the stored block ids and the mtime of every subdir.
+/// A subdir whose mtime has changed since then is stale: files were added or
+/// removed in it, and it is rescanned at loading. The other subdirs are trusted.
+/// The mtimes come from the coarse clock of the file system, so a change in the
+/// same tick as the snapshot keeps the mtime. The subdirs changed in the tick the
+/// snapshot is taken in are thus saved as stale, and are always rescanned.
+/// The snapshot is a serialized BlockIndexSnapshot followed by its CRC32C.
+class BlockIndex {
+ public:
+  /// number of subdirs, a power of 2
+  static const int kSubdirs = 256;
+
+ private:
+  /// folder that stores the subdirs
+  const string dataDir;
+
+  /// the snapshot file
+  const string snapshotFile;
+
+  /// max number of threads rescanning the stale subdirs
+  const int nScanThread;
+
+ public:
+  /// \brief Create a BlockIndex.
+  ///
+  /// \param dataDir folder that stores the blocks
+  /// \param snapshotFile the snapshot file
+  /// \param nScanThread max number of threads rescanning the stale subdirs
+  BlockIndex(const string& dataDir, const string& snapshotFile, int nScanThread);
+
+  /// \brief Get the path of the file of a block.
+  string blkFilePath(int bID) const;
+
+  /// \brief Create the subdirs, and move the block files of the old flat
+  /// layout, i.e. dataDir/blk_<id>, into them.
+  ///
+  /// \return return the number of files moved, -1 for errors
+  int prepare();
+
+  /// \brief Load the stored block ids from the snapshot, and rescan the
+  /// stale subdirs in parallel. All the subdirs are rescanned if the
+  /// snapshot is missing or invalid.
+  ///
+  /// \param blkIDs the returning block ids
+  /// \return return the number of subdirs rescanned, -1 for errors
+  int load(std::set<int>* blkIDs);
+
+  /// \brief Get the mtime of every subdir. It must be called before the block ids
+  /// to be saved are collected, and with the renames into the subdirs blocked.
+  ///
+  /// \param mtimes the returning mtimes, in ns, or -1 for the subdirs changed
+  /// in the current tick of the file system clock
+  /// \return return 0 on success, -1 for errors
+  int stampSubdirs(std::vector<int64_t>* mtimes) const;
+
+  /// \brief Save a snapshot.
+  ///
+  /// \param blkIDs the stored block ids
+  /// \param mtimes mtimes from stampSubdirs()
+  /// \return return 0 on success, -1 for errors
+  int save(const std::vector<int>& blkIDs, const std::vector<int64_t>& mtimes) const;
+
+  /// \brief Parse a block file name "blk_<id>".
+  ///
+  /// \param name file name
+  /// \param bID the returning block id
+  /// \return return true if name is a block file name
+  static bool parseBlkFileName(const char* name, int* bID);
+
+ private:
+  /// \brief Get the path of a subdir.
+  string subdirPath(int subdir) const;
+
+  /// \brief List the block files in a subdir.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int scanSubdir(int subdir, std::vector<int>* blkIDs) const;
+
+  /// \brief Get the mtime of every subdir, in ns.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int statSubdirs(std::vector<int64_t>* mtimes) const;
+
+  /// \brief Get the current time of the file system clock, i.e. the mtime a
+  /// file changed now gets, by touching a file next to the snapshot.
+  ///
+  /// \param now the returning time, in ns
+  /// \return return 0 on success, -1 for errors
+  int fsNow(int64_t* now) const;
+
+  /// \brief Read and validate the snapshot.
+  ///
+  /// \return return 0 on success, -1 if it is missing or invalid
+  int readSnapshot(std::vector<int>* blkIDs, std::vector<int64_t>* mtimes) const;
+};
+
+} // namespace minidfs
+
+#endif
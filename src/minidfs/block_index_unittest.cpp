@@ -0,0 +1,140 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for BlockIndex
+
+#include <minidfs/block_index.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace {
+
+const string kDir = "/tmp/block_index_unittest";
+const string kSnapshot = kDir + "/block_index";
+
+bool Exists(const string& path) {
+  struct stat st;
+  return ::stat(path.c_str(), &st) == 0;
+}
+
+/// Wait until the clock of the file system moves on from the last change.
+void WaitTick() {
+  const string file = kDir + "/tick";
+  struct stat before, after;
+  std::ofstream(file) << 0;
+  ::stat(file.c_str(), &before);
+  do {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::ofstream(file) << 0;
+    ::stat(file.c_str(), &after);
+  } while (after.st_mtim.tv_sec == before.st_mtim.tv_sec &&
+           after.st_mtim.tv_nsec == before.st_mtim.tv_nsec);
+  ::remove(file.c_str());
+}
+
+void TestParse() {
+  int bID = 0;
+  assert(minidfs::BlockIndex::parseBlkFileName("blk_12", &bID) && bID == 12);
+  assert(minidfs::BlockIndex::parseBlkFileName("blk_-3", &bID) && bID == -3);
+  assert(false == minidfs::BlockIndex::parseBlkFileName("blk_12.meta", &bID));
+  assert(false == minidfs::BlockIndex::parseBlkFileName("blk_", &bID));
+  assert(false == minidfs::BlockIndex::parseBlkFileName("blk_ 1", &bID));
+  assert(false == minidfs::BlockIndex::parseBlkFileName("blk_99999999999", &bID));
+  assert(false == minidfs::BlockIndex::parseBlkFileName("pending_deletes", &bID));
+  ::printf("parse pass ...\n");
+}
+
+void TestLoad() {
+  ::system(("rm -rf " + kDir).c_str());
+  ::mkdir(kDir.c_str(), 0755);
+  /// the old flat layout
+  std::ofstream(kDir + "/blk_1") << 1;
+  std::ofstream(kDir + "/blk_1.meta") << 1;
+  std::ofstream(kDir + "/blk_1.meta.tmp") << 1;
+
+  minidfs::BlockIndex index(kDir, kSnapshot, 4);
+  assert(2 == index.prepare());
+  assert(Exists(index.blkFilePath(1)) && Exists(index.blkFilePath(1) + ".meta"));
+  assert(false == Exists(kDir + "/blk_1"));
+  assert(Exists(kDir + "/blk_1.meta.tmp"));
+  for (int i = 2; i <= 1000; ++i) {
+    std::ofstream(index.blkFilePath(i)) << i;
+  }
+
+  /// no snapshot, everything is rescanned
+  std::set<int> blks;
+  assert(minidfs::BlockIndex::kSubdirs == index.load(&blks));
+  assert(blks.size() == 1000 && *blks.begin() == 1 && *blks.rbegin() == 1000);
+
+  std::vector<int64_t> mtimes;
+  WaitTick();
+  assert(0 == index.stampSubdirs(&mtimes));
+  assert(0 == index.save(std::vector<int>(blks.begin(), blks.end()), mtimes));
+  blks.clear();
+  assert(0 == index.load(&blks));
+  assert(blks.size() == 1000);
+
+  /// only the changed subdir is rescanned
+  std::ofstream(index.blkFilePath(1001)) << 1001;
+  ::remove(index.blkFilePath(2).c_str());
+  blks.clear();
+  assert(2 == index.load(&blks));
+  assert(blks.size() == 1000 && blks.count(1001) == 1 && blks.count(2) == 0);
+
+  /// a damaged snapshot is ignored
+  {
+    std::fstream f(kSnapshot, std::ios::in | std::ios::out | std::ios::binary);
+    f.seekp(10);
+    f.put('\x55');
+  }
+  blks.clear();
+  assert(minidfs::BlockIndex::kSubdirs == index.load(&blks));
+  assert(blks.size() == 1000);
+
+  ::system(("rm -rf " + kDir).c_str());
+  ::printf("load pass ...\n");
+}
+
+void TestSameTick() {
+  ::system(("rm -rf " + kDir).c_str());
+  ::mkdir(kDir.c_str(), 0755);
+  minidfs::BlockIndex index(kDir, kSnapshot, 4);
+  assert(0 == index.prepare());
+  WaitTick();
+
+  /// changed right before and right after the snapshot, likely in one tick
+  std::ofstream(index.blkFilePath(1)) << 1;
+  std::vector<int64_t> mtimes;
+  assert(0 == index.stampSubdirs(&mtimes));
+  assert(0 == index.save({1}, mtimes));
+  std::ofstream(index.blkFilePath(1 + minidfs::BlockIndex::kSubdirs)) << 2;
+
+  /// the subdir is stale, whether its mtime changed or not
+  std::set<int> blks;
+  assert(1 == index.load(&blks));
+  assert(blks.size() == 2 && blks.count(1 + minidfs::BlockIndex::kSubdirs) == 1);
+
+  ::system(("rm -rf " + kDir).c_str());
+  ::printf("same tick pass ...\n");
+}
+
+} // namespace
+
+void TestBlockIndex() {
+  ::printf("Test BlockIndex...\n");
+
+  TestParse();
+  TestLoad();
+  TestSameTick();
+
+  ::printf("\n");
+}
@@ -0,0 +1,63 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include <minidfs/block_store.hpp>
+#include <minidfs/file_block_store.hpp>
+#include <minidfs/container_block_store.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace minidfs {
+
+BlockSyncer::BlockSyncer(int fd, const string& syncPolicy, long long offset)
+    : fd(fd), syncOnClose(syncPolicy != "none"), syncStream(syncPolicy == "stream"),
+      syncedEnd(offset), writtenEnd(offset) {
+}
+
+bool BlockSyncer::isValidPolicy(const string& syncPolicy) {
+  return syncPolicy == "none" || syncPolicy == "close" || syncPolicy == "stream";
+}
+
+void BlockSyncer::wrote(size_t n) {
+  writtenEnd += n;
+  if (syncStream && writtenEnd - syncedEnd >= kSyncWindow) {
+    /// asynchronous, the disk works while more data arrives
+    sync_file_range(fd, syncedEnd, writtenEnd - syncedEnd, SYNC_FILE_RANGE_WRITE);
+    syncedEnd = writtenEnd;
+  }
+}
+
+int BlockSyncer::sync() {
+  if (syncOnClose == false) {
+    return 0;
+  }
+  return fdatasync(fd);
+}
+
+int BlockSyncer::syncDir(const string& dir) {
+  if (syncOnClose == false) {
+    return 0;
+  }
+  int dirfd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+  if (dirfd == -1) {
+    return -1;
+  }
+  int ret = fsync(dirfd);
+  ::close(dirfd);
+  return ret;
+}
+
+std::unique_ptr<BlockStore> BlockStore::newBlockStore(const string& dir, const StoreOptions& options) {
+  if (options.engine == "file") {
+    return std::unique_ptr<BlockStore>(new FileBlockStore(dir, options));
+  }
+  if (options.engine == "container") {
+    return std::unique_ptr<BlockStore>(new ContainerBlockStore(dir, options));
+  }
+  return nullptr;
+}
+
+} // namespace minidfs
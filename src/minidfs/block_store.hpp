@@ -0,0 +1,185 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Header file for the block store interface.
+
+#ifndef BLOCK_STORE_H_
+#define BLOCK_STORE_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+using std::string;
+
+namespace minidfs {
+
+/// \brief Options of the block stores. Each engine uses its own ones.
+struct StoreOptions {
+  /// storage engine, "file" or "container"
+  string engine;
+
+  /// when the data of a new block reaches the disk, see BlockSyncer
+  string syncPolicy;
+
+  /// file: max number of block files unlinked in a batch
+  int blkDeleteBatch;
+  /// file: interval between batches of unlinking, in ms
+  long long blkDeleteInterval;
+
+  /// container: size of a container file, in bytes
+  long long containerSize;
+  /// container: interval between two compactions, in ms
+  long long compactInterval;
+  /// container: a sealed container is compacted when at least
+  /// this percentage of it is garbage
+  int compactGarbagePercent;
+};
+
+/// \brief Syncs the data of a new block being written to a file, by a sync policy:
+/// "none": left to the page cache.
+/// "close": fdatasync() before the block is committed.
+/// "stream": also starts the writeback of every kSyncWindow bytes as it is written
+/// with sync_file_range(), so that the page cache holds no more than that, and
+/// the fdatasync() on commit has little left to do.
+class BlockSyncer {
+ private:
+  /// bytes written before the writeback is started
+  static const long long kSyncWindow = 1024 * 1024;
+
+  int fd;
+  const bool syncOnClose;
+  const bool syncStream;
+  /// start of the data not handed to writeback yet
+  long long syncedEnd;
+  /// end of the data written
+  long long writtenEnd;
+
+ public:
+  /// \param fd the file written
+  /// \param syncPolicy "none", "close" or "stream"
+  /// \param offset where the block starts in the file
+  BlockSyncer(int fd, const string& syncPolicy, long long offset);
+
+  /// \brief Check if it is a known sync policy.
+  static bool isValidPolicy(const string& syncPolicy);
+
+  /// \brief Called after n more bytes are written.
+  void wrote(size_t n);
+
+  /// \brief Make the data written durable, before the block is committed.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int sync();
+
+  /// \brief Make a rename in a folder durable.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int syncDir(const string& dir);
+};
+
+/// \brief Writes the data of a new block. The block isn't visible until commit().
+/// A writer dropped without commit() is aborted.
+class BlockWriter {
+ public:
+  virtual ~BlockWriter() {}
+
+  /// \brief Append data to the block.
+  ///
+  /// \return return 0 on success, -1 for errors
+  virtual int write(const char* data, size_t len) = 0;
+
+  /// \brief Make the block visible, with the checksums of its data.
+  /// A block of the same id stored before is replaced.
+  ///
+  /// \return return 0 on success, -1 for errors
+  virtual int commit(const std::vector<uint32_t>& crcs) = 0;
+};
+
+/// \brief Reads the data of a stored block sequentially. The data stays readable
+/// while the reader is alive, even if the block is removed in between.
+class BlockReader {
+ public:
+  virtual ~BlockReader() {}
+
+  /// \brief Get the length of the block.
+  virtual long long length() const = 0;
+
+  /// \brief Read the next part of the data.
+  ///
+  /// \return return the number of bytes read, 0 at the end, -1 for errors
+  virtual int read(char* buf, size_t len) = 0;
+
+  /// \brief Move to offset in the block, where the next read() starts.
+  ///
+  /// \return return 0 on success, -1 for errors
+  virtual int seek(long long offset) = 0;
+
+  /// \brief Read the stored checksums of the block.
+  ///
+  /// \return return 0 on success, -1 if there are none or they are invalid
+  virtual int readCrcs(std::vector<uint32_t>* crcs) = 0;
+
+  /// \brief Drop the data read from the page cache, e.g. after scrubbing.
+  virtual void dropCache() = 0;
+};
+
+/// \brief BlockStore stores the blocks of a volume. The chunkserver only deals
+/// with block ids and streams of data; how they are laid out is up to the engine.
+///
+/// "file": one file per block, see FileBlockStore.
+/// "container": blocks appended into large container files, see ContainerBlockStore.
+class BlockStore {
+ public:
+  virtual ~BlockStore() {}
+
+  /// \brief Create a block store of options.engine in a folder.
+  ///
+  /// \return return nullptr for unknown engines
+  static std::unique_ptr<BlockStore> newBlockStore(const string& dir, const StoreOptions& options);
+
+  /// \brief Load the stored blocks and start the background work.
+  ///
+  /// \param blkIDs the returning ids of the stored blocks
+  /// \return return 0 on success, -1 for errors
+  virtual int start(std::vector<int>* blkIDs) = 0;
+
+  /// \brief Start writing a new block.
+  ///
+  /// \param bID block id
+  /// \param len length of the data
+  /// \return return nullptr for errors
+  virtual std::unique_ptr<BlockWriter> create(int bID, long long len) = 0;
+
+  /// \brief Open a stored block for reading.
+  ///
+  /// \return return nullptr if the block isn't stored or can't be read
+  virtual std::unique_ptr<BlockReader> open(int bID) = 0;
+
+  /// \brief Remove blocks. The space is reclaimed in the background.
+  ///
+  /// \return return 0 on success, -1 for errors
+  virtual int remove(const std::vector<int>& blkIDs) = 0;
+
+  /// \brief Remove a corrupt block at once, so that it may be received again.
+  ///
+  /// \return return 0 on success, -1 for errors
+  virtual int removeCorrupt(int bID) = 0;
+
+  /// \brief Store the checksums of a block stored without them.
+  ///
+  /// \return return 0 on success, -1 for errors
+  virtual int setCrcs(int bID, const std::vector<uint32_t>& crcs) = 0;
+
+  /// \brief Persist the index of the stored blocks, so that the next start()
+  /// is fast. It is called periodically.
+  ///
+  /// \return return 0 on success, -1 for errors
+  virtual int checkpoint() = 0;
+};
+
+} // namespace minidfs
+
+#endif
@@ -0,0 +1,245 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for the block stores
+
+#include <minidfs/block_store.hpp>
+#include <minidfs/container_block_store.hpp>
+#include "checksum/chunked_checksum.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace {
+
+const string kDir = "/tmp/block_store_unittest";
+
+minidfs::StoreOptions Options(const string& engine) {
+  minidfs::StoreOptions options;
+  options.engine = engine;
+  options.syncPolicy = engine == "file" ? "close" : "stream";
+  options.blkDeleteBatch = 64;
+  options.blkDeleteInterval = 1;
+  options.containerSize = 64 * 1024;
+  /// compacted by the tests only
+  options.compactInterval = 3600 * 1000;
+  options.compactGarbagePercent = 50;
+  return options;
+}
+
+string Data(int bID) {
+  string data((bID * 997) % 20000, 0);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>(bID * 31 + i);
+  }
+  return data;
+}
+
+std::vector<uint32_t> Crcs(const string& data) {
+  checksum::ChunkedChecksum dataChecksum;
+  dataChecksum.update(data.data(), data.size());
+  return dataChecksum.finish();
+}
+
+void Write(minidfs::BlockStore* store, int bID) {
+  string data = Data(bID);
+  auto writer = store->create(bID, data.size());
+  assert(writer);
+  /// in two parts
+  assert(0 == writer->write(data.data(), data.size() / 2));
+  assert(0 == writer->write(data.data() + data.size() / 2, data.size() - data.size() / 2));
+  assert(0 == writer->commit(Crcs(data)));
+}
+
+void Check(minidfs::BlockStore* store, int bID) {
+  string data = Data(bID);
+  auto reader = store->open(bID);
+  assert(reader);
+  assert(reader->length() == (long long)data.size());
+  string read(data.size(), 0);
+  size_t done = 0;
+  while (done < read.size()) {
+    int n = reader->read(&read[done], std::min<size_t>(1000, read.size() - done));
+    assert(n > 0);
+    done += n;
+  }
+  char c;
+  assert(0 == reader->read(&c, 1));
+  assert(read == data);
+  std::vector<uint32_t> crcs;
+  assert(0 == reader->readCrcs(&crcs));
+  assert(crcs == Crcs(data));
+
+  /// ranged reads
+  size_t offset = data.size() / 3;
+  assert(0 == reader->seek(offset));
+  assert(reader->read(&read[0], 100) == 100);
+  assert(read.compare(0, 100, data, offset, 100) == 0);
+  assert(0 == reader->seek(0));
+  assert(reader->read(&c, 1) == 1 && c == data[0]);
+}
+
+std::vector<int> Start(minidfs::BlockStore* store) {
+  std::vector<int> blks;
+  assert(0 == store->start(&blks));
+  std::sort(blks.begin(), blks.end());
+  return blks;
+}
+
+void TestEngine(const string& engine) {
+  ::system(("rm -rf " + kDir).c_str());
+  ::mkdir(kDir.c_str(), 0755);
+  {
+    auto store = minidfs::BlockStore::newBlockStore(kDir, Options(engine));
+    assert(Start(store.get()).empty());
+    for (int i = 1; i <= 50; ++i) {
+      Write(store.get(), i);
+    }
+    /// aborted
+    {
+      auto writer = store->create(100, 10);
+      assert(0 == writer->write("0123456789", 10));
+    }
+    assert(!store->open(100));
+    /// a block is written again
+    Write(store.get(), 7);
+
+    for (int i = 1; i <= 50; ++i) {
+      Check(store.get(), i);
+    }
+    /// a reader keeps the data of a removed block
+    auto reader = store->open(3);
+    assert(0 == store->remove({1, 2, 3, 4, 5}));
+    assert(0 == store->removeCorrupt(6));
+    assert(!store->open(1) && !store->open(6));
+    assert(reader->length() == (long long)Data(3).size());
+    string read(Data(3).size(), 0);
+    assert(reader->read(&read[0], read.size()) > 0);
+    assert(0 == store->checkpoint());
+  }
+  /// restart
+  auto store = minidfs::BlockStore::newBlockStore(kDir, Options(engine));
+  auto blks = Start(store.get());
+  assert(blks.size() == 44 && blks.front() == 7 && blks.back() == 50);
+  for (int bID : blks) {
+    Check(store.get(), bID);
+  }
+  ::printf("%s pass ...\n", engine.c_str());
+}
+
+void TestCompact() {
+  ::system(("rm -rf " + kDir).c_str());
+  ::mkdir(kDir.c_str(), 0755);
+  std::vector<int> removed;
+  {
+    minidfs::ContainerBlockStore store(kDir, Options("container"));
+    Start(&store);
+    for (int i = 1; i <= 100; ++i) {
+      Write(&store, i);
+      if (i % 4 != 0) {
+        removed.push_back(i);
+      }
+    }
+    assert(0 == store.remove(removed));
+    assert(store.compact() > 0);
+    for (int i = 4; i <= 100; i += 4) {
+      Check(&store, i);
+    }
+    struct stat st;
+    assert(::stat((kDir + "/container_1").c_str(), &st) == -1);
+  }
+  {
+    /// replays the moves
+    minidfs::ContainerBlockStore store(kDir, Options("container"));
+    auto blks = Start(&store);
+    assert(blks.size() == 25);
+    for (int bID : blks) {
+      assert(bID % 4 == 0);
+      Check(&store, bID);
+    }
+  }
+
+  /// a torn record at the tail of the index log
+  {
+    std::ofstream f(kDir + "/container_index", std::ios::app | std::ios::binary);
+    f << "torn";
+  }
+  {
+    minidfs::ContainerBlockStore store(kDir, Options("container"));
+    assert(Start(&store).size() == 25);
+  }
+
+  /// rebuilt from the containers without the index log
+  ::remove((kDir + "/container_index").c_str());
+  {
+    minidfs::ContainerBlockStore store(kDir, Options("container"));
+    auto blks = Start(&store);
+    for (int i = 4; i <= 100; i += 4) {
+      assert(std::binary_search(blks.begin(), blks.end(), i));
+      Check(&store, i);
+    }
+  }
+  ::system(("rm -rf " + kDir).c_str());
+  ::printf("compact pass ...\n");
+}
+
+void TestCompactWriting() {
+  ::system(("rm -rf " + kDir).c_str());
+  ::mkdir(kDir.c_str(), 0755);
+  struct stat st;
+  {
+    minidfs::ContainerBlockStore store(kDir, Options("container"));
+    Start(&store);
+    /// reserved in container_1, and written after it is sealed
+    string data = Data(1);
+    auto writer = store.create(1, data.size());
+    assert(writer);
+    std::vector<int> others;
+    for (int i = 2; i <= 20; ++i) {
+      Write(&store, i);
+      others.push_back(i);
+    }
+    assert(0 == store.remove(others));
+
+    /// all garbage but the record being written, the other sealed ones go
+    assert(store.compact() > 0);
+    assert(::stat((kDir + "/container_2").c_str(), &st) == -1);
+    assert(::stat((kDir + "/container_1").c_str(), &st) == 0);
+
+    assert(0 == writer->write(data.data(), data.size()));
+    assert(0 == writer->commit(Crcs(data)));
+    writer.reset();
+    Check(&store, 1);
+    assert(1 == store.compact());
+    assert(::stat((kDir + "/container_1").c_str(), &st) == -1);
+    Check(&store, 1);
+  }
+  {
+    minidfs::ContainerBlockStore store(kDir, Options("container"));
+    assert(Start(&store) == std::vector<int>({1}));
+    Check(&store, 1);
+  }
+  ::system(("rm -rf " + kDir).c_str());
+  ::printf("compact while writing pass ...\n");
+}
+
+} // namespace
+
+void TestBlockStore() {
+  ::printf("Test BlockStore...\n");
+
+  assert(!minidfs::BlockStore::newBlockStore(kDir, Options("unknown")));
+  TestEngine("file");
+  TestEngine("container");
+  TestCompact();
+  TestCompactWriting();
+
+  ::printf("\n");
+}
@@ -8,6 +8,10 @@
 #include <minidfs/dfs_chunkserver.hpp>
 #include "logging/logger.h"
 #include "config/config.h"
+#include "logging/async_logging.h"
+#include "metrics/reporter.h"
+
+#include <memory>
 
 const char* config_file = "./config/chunkserver.txt";
 
@@ -19,10 +23,31 @@ int maxConnections = 5;
 string dataDir = "./data/chunkserver";
 long long blockSize = 2 * 1024 * 1024;
 size_t nThread = 2;
+size_t maxThread = 0;
+int maxQueueDelayMs = 10;
 int BUFFER_SIZE = 2 * 1024;
 long long HEART_BEAT_INTERVAL = 3000;
-long long BLOCK_REPORT_INTERVAL = 7000;
+long long BLOCK_REPORT_INTERVAL = 6 * 60 * 60 * 1000;
 long long BLK_TASK_STARTUP_INTERVAL = 13000;
+size_t nReplicationThread = 2;
+long long REPLICATION_BANDWIDTH = 0;
+int BLK_DELETE_BATCH = 64;
+long long BLK_DELETE_INTERVAL = 100;
+long long SCRUB_BANDWIDTH = 1;
+long long SCRUB_PASS_INTERVAL = 24 * 60 * 60 * 1000;
+long long BLK_INDEX_INTERVAL = 10 * 60 * 1000;
+size_t nVolumeIOThread = 2;
+string volumePolicy = "round-robin";
+string storageEngine = "file";
+string SYNC_POLICY = "close";
+long long CONTAINER_SIZE = 256 * 1024 * 1024;
+long long COMPACT_INTERVAL = 60 * 1000;
+int COMPACT_GARBAGE_PERCENT = 50;
+string logLevel = "INFO";
+string logFile = "";
+int logFlushInterval = 1000;
+string logOverflow = "block";
+int metricsInterval = 60000;
 
 void configure() {
   config::Config c(config_file);
@@ -35,25 +60,84 @@ void configure() {
   c.get("dataDir", &dataDir);
   c.get("blockSize", &blockSize);
   c.get("nThread", &nThread);
+  c.get("maxThread", &maxThread);
+  c.get("maxQueueDelayMs", &maxQueueDelayMs);
   c.get("BUFFER_SIZE", &BUFFER_SIZE);
   c.get("HEART_BEAT_INTERVAL", &HEART_BEAT_INTERVAL);
   c.get("BLOCK_REPORT_INTERVAL", &BLOCK_REPORT_INTERVAL);
   c.get("BLK_TASK_STARTUP_INTERVAL", &BLK_TASK_STARTUP_INTERVAL);
+  c.get("nReplicationThread", &nReplicationThread);
+  c.get("REPLICATION_BANDWIDTH", &REPLICATION_BANDWIDTH);
+  c.get("BLK_DELETE_BATCH", &BLK_DELETE_BATCH);
+  c.get("BLK_DELETE_INTERVAL", &BLK_DELETE_INTERVAL);
+  c.get("SCRUB_BANDWIDTH", &SCRUB_BANDWIDTH);
+  c.get("SCRUB_PASS_INTERVAL", &SCRUB_PASS_INTERVAL);
+  c.get("BLK_INDEX_INTERVAL", &BLK_INDEX_INTERVAL);
+  c.get("nVolumeIOThread", &nVolumeIOThread);
+  c.get("volumePolicy", &volumePolicy);
+  c.get("storageEngine", &storageEngine);
+  c.get("SYNC_POLICY", &SYNC_POLICY);
+  c.get("CONTAINER_SIZE", &CONTAINER_SIZE);
+  c.get("COMPACT_INTERVAL", &COMPACT_INTERVAL);
+  c.get("COMPACT_GARBAGE_PERCENT", &COMPACT_GARBAGE_PERCENT);
+  c.get("logLevel", &logLevel);
+  c.get("logFile", &logFile);
+  c.get("logFlushInterval", &logFlushInterval);
+  c.get("logOverflow", &logOverflow);
+  c.get("metricsInterval", &metricsInterval);
 
 }
 
-
 /// Start Chunkserver and provide services endlessly.
 int main(int argc, char const *argv[])
 {
   configure();
-  logging::Logger::set_log_level(logging::DEBUG);
+  logging::LogLevel level = logging::INFO;
+  if (logging::Logger::parse_log_level(logLevel, &level) == false) {
+    LOG_ERROR << "Unknown log level: " << logLevel;
+    return 1;
+  }
+  logging::Logger::set_log_level(level);
+  std::unique_ptr<logging::AsyncLogging> asyncLogging;
+  if (logFile.empty() == false) {
+    asyncLogging.reset(new logging::AsyncLogging(logFile, logFlushInterval,
+                                                 logOverflow == "drop" ? logging::DROP : logging::BLOCK));
+    if (asyncLogging->start() == 0) {
+      asyncLogging->attach();
+    }
+  }
+  std::unique_ptr<metrics::Reporter> reporter;
+  if (metricsInterval > 0) {
+    reporter.reset(new metrics::Reporter(metrics::Registry::global(), metricsInterval));
+    reporter->start();
+  }
   LOG_INFO << "Start Chunkserver...";
+  if (storageEngine != "file" && storageEngine != "container") {
+    LOG_ERROR << "Unknown storage engine: " << storageEngine;
+    return 1;
+  }
+  if (minidfs::BlockSyncer::isValidPolicy(SYNC_POLICY) == false) {
+    LOG_ERROR << "Unknown sync policy: " << SYNC_POLICY;
+    return 1;
+  }
+  minidfs::StoreOptions storeOptions;
+  storeOptions.engine = storageEngine;
+  storeOptions.syncPolicy = SYNC_POLICY;
+  storeOptions.blkDeleteBatch = BLK_DELETE_BATCH;
+  storeOptions.blkDeleteInterval = BLK_DELETE_INTERVAL;
+  storeOptions.containerSize = CONTAINER_SIZE;
+  storeOptions.compactInterval = COMPACT_INTERVAL;
+  storeOptions.compactGarbagePercent = COMPACT_GARBAGE_PERCENT;
   minidfs::DFSChunkserver chunkserver(masterIP, masterPort, serverIP, serverPort,
-                                        dataDir, blockSize, maxConnections, BUFFER_SIZE,
-                                        nThread,
+                                        minidfs::Volume::splitDirs(dataDir), blockSize, maxConnections, BUFFER_SIZE,
+                                        nThread, maxThread, maxQueueDelayMs,
                                         HEART_BEAT_INTERVAL, BLOCK_REPORT_INTERVAL,
-                                        BLK_TASK_STARTUP_INTERVAL);
+                                        BLK_TASK_STARTUP_INTERVAL,
+                                        nReplicationThread, REPLICATION_BANDWIDTH,
+                                        storeOptions,
+                                        SCRUB_BANDWIDTH, SCRUB_PASS_INTERVAL,
+                                        BLK_INDEX_INTERVAL,
+                                        nVolumeIOThread, volumePolicy);
   
   chunkserver.run();
   return 0;
@@ -16,16 +16,22 @@ namespace minidfs {
 
 /// \brief ChunkserverProtocol is the communication protocol between DFSChunkserver with Master.
 ///
-/// Chunkserver sends hearbeat to inform the Master that it's still alive.
+/// Chunkserver sends hearbeat to inform the Master that it's still alive,
+/// and gets the block tasks (copy/delete) in the response.
 /// Chunkserver sends blockreport to tell the Master about all the blocks it has.
 /// This class is just an interface.
 class ChunkserverProtocol {
  public:
   /// \brief Send heartbeat information to Master. MethodID = 101.
   ///
-  /// \param chunkserverInfo containing the ip and port of the chunkserver
+  /// The heartbeat also carries the load of the chunkserver and the blocks
+  /// received since the last heartbeat. Master replies with block tasks.
+  /// \param heartbeat containing the chunkserver info, load and received blocks
+  /// \param blkTasks block tasks (OpCode::OP_COPY, OpCode::OP_DELETE) from master.
+  ///        It is the returning parameter.
   /// \return return OpCode. OpCode::OP_SUCCESS on success, OpCode::OP_FAILURE for error.
-  virtual int heartBeat(const ChunkserverInfo& chunkserverInfo) = 0;
+  ///         OpCode::OP_BLK_REPORT_REQUIRED if master needs a full block report first.
+  virtual int heartBeat(const Heartbeat& heartbeat, BlockTasks* blkTasks) = 0;
 
   /// \brief Send block report to Master. MethodID = 102.
   ///
@@ -37,22 +43,6 @@ class ChunkserverProtocol {
   /// \return return OpCode. OpCode::OP_SUCCESS on success, OpCode::OP_FAILURE for error.
   virtual int blkReport(const ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs, std::vector<int>& deletedBlks) = 0;
 
-  /// \brief Get block task from Master. MethodID = 103.
-  ///
-  /// \param chunkserverInfo containing the ip and port of the chunkserver
-  /// \param blkTasks block tasks from master. 
-  ///        It is the returning parameter.      
-  /// \return return OpCode.
-  virtual int getBlkTask(const ChunkserverInfo& chunkserverInfo, BlockTasks* blkTasks) = 0;
-
-  /// \brief Inform Master about the received blocks. MethodID = 104.
-  ///
-  /// The chunkserver informs Master about all the blocks it received
-  /// \param chunkserverInfo containing the ip and port of the chunkserver
-  /// \param blkIDs all the block ids it received
-  /// \return return OpCode.
-  virtual int recvedBlks(const ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs) = 0;
-
 };
 
 } // namespace minidfs
@@ -43,6 +43,18 @@ class ClientProtocol {
   /// \return return OpCode.
   virtual int create(const string& file, LocatedBlock* locatedBlk) = 0;
 
+  /// \brief Create an erasure-coded file. MethodID = 6.
+  ///
+  /// Same as create(), but each block of the file is a block group laid out by schema.
+  /// The returned block has the schema, and a chunkserver for each internal block.
+  ///
+  /// \param file the file name stored in minidfs.
+  /// \param schema the layout of the block groups
+  /// \param locatedBlk contains chunkservers' information.
+  ///        It is the returning parameter. 
+  /// \return return OpCode.
+  virtual int createEC(const string& file, const ECSchema& schema, LocatedBlock* locatedBlk) = 0;
+
   /// \brief Add a block when the client has finished the previous block. MethodID = 3.
   ///
   /// When the client create() a file and finishes the 1st block, it calls addBlock()
@@ -76,6 +88,37 @@ class ClientProtocol {
   /// \return return OpCode.
   virtual int complete(const string& file) = 0;
 
+  /// \brief Create small files packed one after another into a shared container
+  /// block. MethodID = 7.
+  ///
+  /// calling order: createPack() -> completePack()
+  /// The names of the files are reserved, and the container block is allocated.
+  ///
+  /// \param pack the names and lengths of the files
+  /// \param locatedBlk the container block and its chunkservers.
+  ///        It is the returning parameter.
+  /// \return return OpCode.
+  virtual int createPack(const Pack& pack, LocatedBlock* locatedBlk) = 0;
+
+  /// \brief Complete writing packed small files. MethodID = 8.
+  ///
+  /// Each file becomes an extent of the written container block.
+  ///
+  /// \param pack the files of createPack(), and the written container block
+  ///        with the chunkservers storing it
+  /// \return return OpCode.
+  virtual int completePack(const Pack& pack) = 0;
+
+  /// \brief Create a tiny file with its contents stored inline in the master. MethodID = 9.
+  ///
+  /// The file is created in a single call, and no chunkserver is involved.
+  /// getBlockLocations() returns its contents instead of blocks.
+  ///
+  /// \param file the name and the contents of the file
+  /// \return return OpCode. OpCode::OP_FAILURE if the contents exceed the
+  ///         master's inline size limit.
+  virtual int createInline(const InlineFile& file) = 0;
+
 
   //////////////////////////
   /// Name system operations
@@ -106,6 +149,20 @@ class ClientProtocol {
   ///        It is the returning parameter.
   /// \return return OpCode.
   virtual int listDir(const string& dirName,  FileInfos& items) = 0;
+
+
+  //////////////////////////
+  /// Administration
+  //////////////////////////
+
+  /// \brief Get the statistics of the master's RPC server. MethodID = 21.
+  ///
+  /// It is answered before the call is queued, so it works under overload.
+  ///
+  /// \param stats the queue depth and the calls handled of each lane.
+  ///        It is the returning parameter.
+  /// \return return OpCode.
+  virtual int getServerStats(ServerStats* stats) = 0;
 };
 
 } // namespace minidfs
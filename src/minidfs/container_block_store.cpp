@@ -0,0 +1,728 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include <minidfs/container_block_store.hpp>
+#include "checksum/chunked_checksum.h"
+#include "checksum/crc32c.h"
+#include "logging/logger.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <set>
+
+namespace minidfs {
+
+namespace {
+
+const uint32_t kRecordMagic = 0x424c4b31;
+const int kHeaderLen = 24;
+const int kIndexRecordLen = 32;
+
+const uint32_t kStateWriting = 0;
+const uint32_t kStateCommitted = 1;
+
+const uint32_t kIndexAdd = 1;
+const uint32_t kIndexDel = 2;
+
+void put32(char* p, uint32_t v) {
+  for (int i = 3; i >= 0; --i, v >>= 8) {
+    p[i] = static_cast<char>(v & 0xff);
+  }
+}
+
+void put64(char* p, uint64_t v) {
+  put32(p, v >> 32);
+  put32(p + 4, static_cast<uint32_t>(v));
+}
+
+uint32_t get32(const char* p) {
+  uint32_t v = 0;
+  for (int i = 0; i < 4; ++i) {
+    v = v << 8 | static_cast<uint8_t>(p[i]);
+  }
+  return v;
+}
+
+uint64_t get64(const char* p) {
+  return static_cast<uint64_t>(get32(p)) << 32 | get32(p + 4);
+}
+
+/// pwrite/pread the whole buffer
+int pwriteAll(int fd, const char* buf, size_t len, long long offset) {
+  while (len > 0) {
+    ssize_t n = ::pwrite(fd, buf, len, offset);
+    if (n <= 0) {
+      return -1;
+    }
+    buf += n;
+    len -= n;
+    offset += n;
+  }
+  return 0;
+}
+
+int preadAll(int fd, char* buf, size_t len, long long offset) {
+  while (len > 0) {
+    ssize_t n = ::pread(fd, buf, len, offset);
+    if (n <= 0) {
+      return -1;
+    }
+    buf += n;
+    len -= n;
+    offset += n;
+  }
+  return 0;
+}
+
+int writeHeader(int fd, long long offset, int bID, long long len, uint32_t state) {
+  char header[kHeaderLen];
+  put32(header, kRecordMagic);
+  put32(header + 4, static_cast<uint32_t>(bID));
+  put64(header + 8, len);
+  put32(header + 16, state);
+  put32(header + 20, checksum::crc32c(0, header, 20));
+  return pwriteAll(fd, header, kHeaderLen, offset);
+}
+
+/// \return return 0 if it is a valid header
+int readHeader(int fd, long long offset, int* bID, long long* len, uint32_t* state) {
+  char header[kHeaderLen];
+  if (-1 == preadAll(fd, header, kHeaderLen, offset)
+      || get32(header) != kRecordMagic
+      || get32(header + 20) != checksum::crc32c(0, header, 20)) {
+    return -1;
+  }
+  *bID = static_cast<int>(get32(header + 4));
+  *len = get64(header + 8);
+  *state = get32(header + 16);
+  return 0;
+}
+
+} // namespace
+
+/// \brief Writes a block into its reserved record.
+class ContainerBlockWriter : public BlockWriter {
+ private:
+  ContainerBlockStore* store;
+  int bID;
+  long long len;
+  std::shared_ptr<ContainerBlockStore::Container> container;
+  long long offset;
+  BlockSyncer syncer;
+  long long written;
+
+ public:
+  ContainerBlockWriter(ContainerBlockStore* store, int bID, long long len,
+                       std::shared_ptr<ContainerBlockStore::Container> container, long long offset)
+      : store(store), bID(bID), len(len), container(container), offset(offset),
+        syncer(container->fd, store->syncPolicy, offset + kHeaderLen), written(0) {
+  }
+
+  /// an uncommitted record is garbage, skipped by rebuildIndex()
+  ~ContainerBlockWriter() {
+    if (container) {
+      store->release(container);
+    }
+  }
+
+  virtual int write(const char* data, size_t n) override {
+    if (written + (long long)n > len
+        || -1 == pwriteAll(container->fd, data, n, offset + kHeaderLen + written)) {
+      return -1;
+    }
+    syncer.wrote(n);
+    written += n;
+    return 0;
+  }
+
+  virtual int commit(const std::vector<uint32_t>& crcs) override {
+    if (written != len || crcs.size() != checksum::ChunkedChecksum::nChunks(len)) {
+      return -1;
+    }
+    string crcBytes;
+    checksum::ChunkedChecksum::putCrcs(crcs, &crcBytes);
+    /// the header goes last, so a torn record is never taken as committed
+    if ((crcBytes.empty() == false
+         && -1 == pwriteAll(container->fd, crcBytes.data(), crcBytes.size(), offset + kHeaderLen + len))
+        || -1 == syncer.sync()
+        || -1 == writeHeader(container->fd, offset, bID, len, kStateCommitted)
+        || -1 == syncer.sync()) {
+      LOG_ERROR << "Failed to write block " << bID << ": " << strerror(errno);
+      return -1;
+    }
+    long long seq = 0;
+    int ret = 0;
+    {
+      std::lock_guard<std::mutex> lockIndex(store->mutexIndex);
+      ret = store->addExtent(bID, ContainerBlockStore::Extent{container, offset, len});
+      seq = store->indexSeq;
+      --container->nWriters;
+    }
+    container.reset();
+    if (ret == -1) {
+      LOG_ERROR << "Failed to index block " << bID;
+      return -1;
+    }
+    /// concurrent commits share one sync
+    return store->syncIndex(seq);
+  }
+};
+
+/// \brief Reads a block from its record.
+class ContainerBlockReader : public BlockReader {
+ private:
+  ContainerBlockStore::Extent extent;
+  long long pos;
+
+ public:
+  explicit ContainerBlockReader(const ContainerBlockStore::Extent& extent)
+      : extent(extent), pos(0) {
+  }
+
+  virtual long long length() const override {
+    return extent.len;
+  }
+
+  virtual int read(char* buf, size_t n) override {
+    if ((long long)n > extent.len - pos) {
+      n = extent.len - pos;
+    }
+    if (n == 0) {
+      return 0;
+    }
+    ssize_t ret = ::pread(extent.container->fd, buf, n, extent.offset + kHeaderLen + pos);
+    if (ret > 0) {
+      pos += ret;
+    }
+    return ret;
+  }
+
+  virtual int seek(long long offset) override {
+    if (offset < 0 || offset > extent.len) {
+      return -1;
+    }
+    pos = offset;
+    return 0;
+  }
+
+  virtual int readCrcs(std::vector<uint32_t>* crcs) override {
+    size_t nChunks = checksum::ChunkedChecksum::nChunks(extent.len);
+    string buf(nChunks * 4, 0);
+    if (nChunks > 0 && -1 == preadAll(extent.container->fd, &buf[0], buf.size(),
+                                      extent.offset + kHeaderLen + extent.len)) {
+      return -1;
+    }
+    checksum::ChunkedChecksum::getCrcs(buf.data(), nChunks, crcs);
+    return 0;
+  }
+
+  virtual void dropCache() override {
+    posix_fadvise(extent.container->fd, extent.offset,
+                  kHeaderLen + extent.len, POSIX_FADV_DONTNEED);
+  }
+};
+
+ContainerBlockStore::Container::Container(int id, int fd, long long size, long long end)
+    : id(id), fd(fd), size(size), end(end), liveBytes(0), sealed(false), nWriters(0) {
+}
+
+ContainerBlockStore::Container::~Container() {
+  ::close(fd);
+}
+
+ContainerBlockStore::ContainerBlockStore(const string& dir, const StoreOptions& options)
+    : dir(dir), indexFile(dir + "/container_index"), syncPolicy(options.syncPolicy),
+      containerSize(options.containerSize > 0 ? options.containerSize : 256LL * 1024 * 1024),
+      compactInterval(options.compactInterval), compactGarbagePercent(options.compactGarbagePercent),
+      maxContainerID(0), indexFd(-1), nIndexRecords(0), indexSeq(0), indexSyncedSeq(0),
+      running(false) {
+}
+
+ContainerBlockStore::~ContainerBlockStore() {
+  {
+    std::lock_guard<std::mutex> lockIndex(mutexIndex);
+    running = false;
+  }
+  condition.notify_all();
+  if (compactorThread.joinable()) {
+    compactorThread.join();
+  }
+  if (indexFd != -1) {
+    ::close(indexFd);
+  }
+}
+
+long long ContainerBlockStore::recordLen(long long len) {
+  return kHeaderLen + len + checksum::ChunkedChecksum::nChunks(len) * 4;
+}
+
+string ContainerBlockStore::containerPath(int id) const {
+  return dir + "/container_" + std::to_string(id);
+}
+
+int ContainerBlockStore::start(std::vector<int>* blkIDs) {
+  /// open the containers
+  auto d = opendir(dir.c_str());
+  if (!d) {
+    LOG_ERROR << "Cannot open " << dir;
+    return -1;
+  }
+  struct dirent* entry;
+  while ((entry = readdir(d)) != nullptr) {
+    if (strncmp(entry->d_name, "container_", 10) != 0) {
+      continue;
+    }
+    char* end = nullptr;
+    long id = strtol(entry->d_name + 10, &end, 10);
+    if (end == entry->d_name + 10 || *end != '\0' || id <= 0 || id > INT_MAX) {
+      continue;
+    }
+    int fd = ::open(containerPath(id).c_str(), O_RDWR);
+    struct stat st;
+    if (fd == -1 || fstat(fd, &st) == -1) {
+      LOG_ERROR << "Failed to open " << containerPath(id);
+      closedir(d);
+      return -1;
+    }
+    /// written before the restart, nothing is appended any more
+    std::shared_ptr<Container> c(new Container(id, fd, st.st_size, st.st_size));
+    c->sealed = true;
+    containers[id] = c;
+    maxContainerID = std::max<int>(maxContainerID, id);
+  }
+  closedir(d);
+
+  std::lock_guard<std::mutex> lockIndex(mutexIndex);
+  if (-1 == loadIndex()) {
+    LOG_WARN << "No index log in " << dir << ", rebuilding it from "
+             << (int)containers.size() << " containers";
+    rebuildIndex();
+  }
+  if (-1 == rewriteIndex()) {
+    LOG_ERROR << "Failed to write " << indexFile;
+    return -1;
+  }
+  for (const auto& e : index) {
+    blkIDs->push_back(e.first);
+  }
+  LOG_INFO << "Loaded " << (int)index.size() << " blocks in "
+           << (int)containers.size() << " containers from " << dir;
+
+  running = true;
+  compactorThread = std::thread(&ContainerBlockStore::compactor, this);
+  return 0;
+}
+
+int ContainerBlockStore::loadIndex() {
+  int fd = ::open(indexFile.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return -1;
+  }
+  char rec[kIndexRecordLen];
+  long long nRecords = 0;
+  while (::read(fd, rec, kIndexRecordLen) == kIndexRecordLen) {
+    /// a torn record at the tail
+    if (get32(rec + 28) != checksum::crc32c(0, rec, 28)) {
+      LOG_WARN << "Invalid record " << (int64_t)nRecords << " in " << indexFile;
+      break;
+    }
+    ++nRecords;
+    uint32_t type = get32(rec);
+    int bID = static_cast<int>(get32(rec + 4));
+    if (type == kIndexDel) {
+      dropExtent(bID);
+      continue;
+    }
+    auto c = containers.find(get32(rec + 8));
+    long long offset = get64(rec + 12);
+    long long len = get64(rec + 20);
+    if (type != kIndexAdd || c == containers.end()
+        || offset < 0 || len < 0 || offset + recordLen(len) > c->second->size) {
+      /// superseded by a later record if the container was compacted
+      continue;
+    }
+    addExtent(bID, Extent{c->second, offset, len});
+  }
+  ::close(fd);
+  return 0;
+}
+
+void ContainerBlockStore::rebuildIndex() {
+  for (const auto& c : containers) {
+    long long offset = 0;
+    int bID = 0;
+    long long len = 0;
+    uint32_t state = 0;
+    while (offset + kHeaderLen <= c.second->size
+           && 0 == readHeader(c.second->fd, offset, &bID, &len, &state)
+           && len >= 0 && offset + recordLen(len) <= c.second->size) {
+      if (state == kStateCommitted) {
+        /// a later record of the same block replaces it
+        addExtent(bID, Extent{c.second, offset, len});
+      }
+      offset += recordLen(len);
+    }
+  }
+}
+
+int ContainerBlockStore::rewriteIndex() {
+  string tmpFile = indexFile + ".tmp";
+  int fd = ::open(tmpFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    return -1;
+  }
+  string buf;
+  buf.reserve(index.size() * kIndexRecordLen);
+  for (const auto& e : index) {
+    char rec[kIndexRecordLen];
+    put32(rec, kIndexAdd);
+    put32(rec + 4, static_cast<uint32_t>(e.first));
+    put32(rec + 8, e.second.container->id);
+    put64(rec + 12, e.second.offset);
+    put64(rec + 20, e.second.len);
+    put32(rec + 28, checksum::crc32c(0, rec, 28));
+    buf.append(rec, kIndexRecordLen);
+  }
+  int ret = pwriteAll(fd, buf.data(), buf.size(), 0);
+  ret |= BlockSyncer(fd, syncPolicy, 0).sync();
+  ::close(fd);
+  if (ret != 0 || -1 == ::rename(tmpFile.c_str(), indexFile.c_str())) {
+    return -1;
+  }
+  if (indexFd != -1) {
+    ::close(indexFd);
+  }
+  indexFd = ::open(indexFile.c_str(), O_WRONLY | O_APPEND);
+  nIndexRecords = index.size();
+  return indexFd == -1 ? -1 : 0;
+}
+
+int ContainerBlockStore::appendIndex(int type, int bID, const Extent& extent) {
+  char rec[kIndexRecordLen];
+  put32(rec, type);
+  put32(rec + 4, static_cast<uint32_t>(bID));
+  put32(rec + 8, extent.container ? extent.container->id : 0);
+  put64(rec + 12, extent.offset);
+  put64(rec + 20, extent.len);
+  put32(rec + 28, checksum::crc32c(0, rec, 28));
+  ++nIndexRecords;
+  ++indexSeq;
+  if (indexFd == -1 || ::write(indexFd, rec, kIndexRecordLen) != kIndexRecordLen) {
+    LOG_ERROR << "Failed to append to " << indexFile;
+    return -1;
+  }
+  return 0;
+}
+
+int ContainerBlockStore::syncIndex(long long seq) {
+  if (syncPolicy == "none") {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lockSync(mutexSync);
+  /// synced by another writer while this one waited
+  if (indexSyncedSeq >= seq) {
+    return 0;
+  }
+  long long target = 0;
+  int fd = -1;
+  {
+    std::lock_guard<std::mutex> lockIndex(mutexIndex);
+    target = indexSeq;
+    /// rewriteIndex() may replace indexFd meanwhile, the new log is synced by it
+    fd = ::dup(indexFd);
+  }
+  if (fd == -1) {
+    return -1;
+  }
+  int ret = BlockSyncer(fd, syncPolicy, 0).sync();
+  ::close(fd);
+  if (ret == 0) {
+    indexSyncedSeq = target;
+  }
+  return ret;
+}
+
+int ContainerBlockStore::addExtent(int bID, const Extent& extent) {
+  /// the index never has a block the log doesn't
+  if (running && -1 == appendIndex(kIndexAdd, bID, extent)) {
+    return -1;
+  }
+  dropExtent(bID);
+  index[bID] = extent;
+  extent.container->liveBytes += recordLen(extent.len);
+  return 0;
+}
+
+void ContainerBlockStore::dropExtent(int bID) {
+  auto e = index.find(bID);
+  if (e == index.end()) {
+    return;
+  }
+  e->second.container->liveBytes -= recordLen(e->second.len);
+  index.erase(e);
+}
+
+std::shared_ptr<ContainerBlockStore::Container> ContainerBlockStore::newContainer(int id, long long size) {
+  string path = containerPath(id);
+  int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    LOG_ERROR << "Failed to create " << path << ": " << strerror(errno);
+    return nullptr;
+  }
+  /// reserve the space, so that the container is contiguous on disk and
+  /// the writes into it don't run out of space
+  int ret = posix_fallocate(fd, 0, size);
+  if (ret != 0) {
+    LOG_ERROR << "Failed to allocate " << path << ": " << strerror(ret);
+    ::close(fd);
+    ::unlink(path.c_str());
+    return nullptr;
+  }
+  /// the new file in dir
+  if (-1 == BlockSyncer(fd, syncPolicy, 0).syncDir(dir)) {
+    LOG_WARN << "Failed to sync " << dir;
+  }
+  LOG_INFO << "Created container " << path;
+  return std::shared_ptr<Container>(new Container(id, fd, size, 0));
+}
+
+int ContainerBlockStore::reserve(long long len, std::shared_ptr<Container>* container, long long* offset) {
+  long long needed = recordLen(len);
+  auto reserveActive = [&]() {
+    if (!active || active->end + needed > active->size) {
+      return false;
+    }
+    *container = active;
+    *offset = active->end;
+    active->end += needed;
+    ++active->nWriters;
+    return true;
+  };
+  {
+    std::lock_guard<std::mutex> lockIndex(mutexIndex);
+    if (reserveActive()) {
+      return 0;
+    }
+  }
+
+  /// the container is preallocated without mutexIndex, so that the reads and
+  /// commits of the other blocks go on
+  std::lock_guard<std::mutex> lockCreate(mutexCreate);
+  int id = 0;
+  {
+    std::lock_guard<std::mutex> lockIndex(mutexIndex);
+    /// created by another writer meanwhile
+    if (reserveActive()) {
+      return 0;
+    }
+    id = ++maxContainerID;
+  }
+  std::shared_ptr<Container> c = newContainer(id, std::max(containerSize, needed));
+  if (!c) {
+    return -1;
+  }
+  std::lock_guard<std::mutex> lockIndex(mutexIndex);
+  containers[id] = c;
+  if (active) {
+    active->sealed = true;
+  }
+  active = c;
+  reserveActive();
+  return 0;
+}
+
+void ContainerBlockStore::release(const std::shared_ptr<Container>& container) {
+  std::lock_guard<std::mutex> lockIndex(mutexIndex);
+  --container->nWriters;
+}
+
+std::unique_ptr<BlockWriter> ContainerBlockStore::create(int bID, long long len) {
+  std::shared_ptr<Container> container;
+  long long offset = 0;
+  if (len < 0 || -1 == reserve(len, &container, &offset)) {
+    return nullptr;
+  }
+  /// mark the record, so that rebuildIndex() can skip it if it isn't committed
+  if (-1 == writeHeader(container->fd, offset, bID, len, kStateWriting)) {
+    release(container);
+    return nullptr;
+  }
+  return std::unique_ptr<BlockWriter>(new ContainerBlockWriter(this, bID, len, container, offset));
+}
+
+std::unique_ptr<BlockReader> ContainerBlockStore::open(int bID) {
+  std::lock_guard<std::mutex> lockIndex(mutexIndex);
+  auto e = index.find(bID);
+  if (e == index.end()) {
+    return nullptr;
+  }
+  return std::unique_ptr<BlockReader>(new ContainerBlockReader(e->second));
+}
+
+int ContainerBlockStore::remove(const std::vector<int>& blkIDs) {
+  int ret = 0;
+  long long seq = 0;
+  {
+    std::lock_guard<std::mutex> lockIndex(mutexIndex);
+    for (int bID : blkIDs) {
+      if (index.find(bID) == index.end()) {
+        continue;
+      }
+      dropExtent(bID);
+      ret |= appendIndex(kIndexDel, bID, Extent{nullptr, 0, 0});
+    }
+    seq = indexSeq;
+  }
+  return ret | syncIndex(seq);
+}
+
+int ContainerBlockStore::removeCorrupt(int bID) {
+  return remove(std::vector<int>{bID});
+}
+
+int ContainerBlockStore::setCrcs(int, const std::vector<uint32_t>&) {
+  return -1;
+}
+
+int ContainerBlockStore::checkpoint() {
+  std::lock_guard<std::mutex> lockIndex(mutexIndex);
+  /// mostly removed or moved blocks
+  if (nIndexRecords <= 2 * (long long)index.size() + 1024) {
+    return 0;
+  }
+  return rewriteIndex();
+}
+
+int ContainerBlockStore::compact() {
+  std::vector<std::shared_ptr<Container>> victims;
+  {
+    std::lock_guard<std::mutex> lockIndex(mutexIndex);
+    for (const auto& c : containers) {
+      const auto& container = c.second;
+      if (container->sealed && container->nWriters == 0
+          && (container->size - container->liveBytes) * 100 >= container->size * compactGarbagePercent) {
+        victims.push_back(container);
+      }
+    }
+  }
+  int nCompacted = 0;
+  for (const auto& c : victims) {
+    if (running == false) {
+      break;
+    }
+    if (0 == compactContainer(c)) {
+      ++nCompacted;
+    }
+  }
+  return nCompacted;
+}
+
+int ContainerBlockStore::compactContainer(const std::shared_ptr<Container>& container) {
+  std::vector<std::pair<int, Extent>> live;
+  {
+    std::lock_guard<std::mutex> lockIndex(mutexIndex);
+    for (const auto& e : index) {
+      if (e.second.container == container) {
+        live.push_back(e);
+      }
+    }
+  }
+
+  /// copy all the records first, then move them in the index at once
+  std::vector<Extent> copies;
+  std::set<std::shared_ptr<Container>> targets;
+  /// the copies are reservations, until they are in the index
+  auto releaseCopies = [this, &copies]() {
+    for (const auto& c : copies) {
+      release(c.container);
+    }
+  };
+  std::vector<char> buf(1024 * 1024);
+  for (const auto& e : live) {
+    long long len = recordLen(e.second.len);
+    std::shared_ptr<Container> target;
+    long long offset = 0;
+    if (-1 == reserve(e.second.len, &target, &offset)) {
+      releaseCopies();
+      return -1;
+    }
+    copies.push_back(Extent{target, offset, e.second.len});
+    targets.insert(target);
+    /// copy the whole record, the header says committed already
+    for (long long done = 0; done < len; ) {
+      size_t n = std::min<long long>(buf.size(), len - done);
+      if (-1 == preadAll(container->fd, buf.data(), n, e.second.offset + done)
+          || -1 == pwriteAll(target->fd, buf.data(), n, offset + done)) {
+        LOG_ERROR << "Failed to move block " << e.first << ": " << strerror(errno);
+        releaseCopies();
+        return -1;
+      }
+      done += n;
+    }
+  }
+  for (const auto& target : targets) {
+    if (-1 == BlockSyncer(target->fd, syncPolicy, 0).sync()) {
+      releaseCopies();
+      return -1;
+    }
+  }
+
+  long long seq = 0;
+  bool indexed = true;
+  {
+    std::lock_guard<std::mutex> lockIndex(mutexIndex);
+    for (size_t i = 0; i < live.size(); ++i) {
+      --copies[i].container->nWriters;
+      auto cur = index.find(live[i].first);
+      /// removed or written again in between, the copy is garbage
+      if (cur == index.end() || cur->second.container != container
+          || cur->second.offset != live[i].second.offset) {
+        continue;
+      }
+      /// the block stays in the old container, which is kept
+      if (-1 == addExtent(live[i].first, copies[i])) {
+        indexed = false;
+      }
+    }
+    seq = indexSeq;
+  }
+  /// the moves are durable before the old records are gone
+  if (-1 == syncIndex(seq) || !indexed) {
+    return -1;
+  }
+  {
+    std::lock_guard<std::mutex> lockIndex(mutexIndex);
+    containers.erase(container->id);
+  }
+  /// the readers of it keep the fd
+  ::unlink(containerPath(container->id).c_str());
+  LOG_INFO << "Compacted " << containerPath(container->id) << ", moved "
+           << (int)live.size() << " blocks";
+  return 0;
+}
+
+void ContainerBlockStore::compactor() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lockIndex(mutexIndex);
+      condition.wait_for(lockIndex, std::chrono::milliseconds(compactInterval),
+                         [this]{return running == false;});
+      if (running == false) {
+        return;
+      }
+    }
+    compact();
+  }
+}
+
+} // namespace minidfs
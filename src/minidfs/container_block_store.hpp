@@ -0,0 +1,239 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Header file for class ContainerBlockStore.
+
+#ifndef CONTAINER_BLOCK_STORE_H_
+#define CONTAINER_BLOCK_STORE_H_
+
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+
+#include <minidfs/block_store.hpp>
+
+namespace minidfs {
+
+/// \brief ContainerBlockStore is a log-structured block store. Blocks are appended
+/// into large container files, preallocated to containerSize, so that writing many
+/// small blocks is sequential I/O and costs no inode per block.
+///
+/// Each block is a record in a container:
+/// header   : data    : crcs
+/// 24 bytes : n bytes : 4 bytes per chunk
+///
+/// header format:
+/// magic   : block id : len(data) : state   : crc of the header before it
+/// 4 bytes : 4 bytes  : 8 bytes   : 4 bytes : 4 bytes
+/// state is 1 once the block is committed. Space is reserved for a record when the
+/// block is created, so concurrent writers fill adjacent records of a container.
+///
+/// The index maps block ids to (container, offset, length). It is kept in memory,
+/// and every change is appended to the index log, dir/container_index:
+/// type    : block id : container : offset  : len(data) : crc of the record before it
+/// 4 bytes : 4 bytes  : 4 bytes   : 8 bytes : 8 bytes   : 4 bytes
+/// The log is replayed by start() and rewritten by checkpoint() when it grows.
+/// Without the log, the index is rebuilt from the record headers in the containers.
+///
+/// Removing a block only drops it from the index. The compactor copies the live
+/// blocks out of the sealed containers with compactGarbagePercent of garbage,
+/// and unlinks them. A container with records still being written is left
+/// alone until their writers are gone.
+class ContainerBlockStore : public BlockStore {
+  friend class ContainerBlockWriter;
+  friend class ContainerBlockReader;
+
+ private:
+  /// \brief A container file. The file may be unlinked by the compactor while
+  /// readers still use it; it is closed when the last of them is gone.
+  struct Container {
+    int id;
+    int fd;
+    /// size of the file
+    long long size;
+    /// space reserved so far. New records are appended here.
+    long long end;
+    /// bytes of the records in the index
+    long long liveBytes;
+    /// no more records are appended to it
+    bool sealed;
+    /// reserved records not committed or aborted yet. The container isn't
+    /// compacted while they are written.
+    int nWriters;
+
+    Container(int id, int fd, long long size, long long end);
+    ~Container();
+  };
+
+  /// \brief Where a block is stored.
+  struct Extent {
+    std::shared_ptr<Container> container;
+    /// offset of the record header
+    long long offset;
+    /// length of the data
+    long long len;
+  };
+
+  /// folder that stores the containers
+  const string dir;
+
+  /// the index log
+  const string indexFile;
+
+  /// when new records and index log records reach the disk, see BlockSyncer.
+  /// A record is synced before it is added to the index log.
+  const string syncPolicy;
+
+  /// size of a container file, in bytes
+  const long long containerSize;
+
+  /// interval between two compactions, in ms
+  const long long compactInterval;
+
+  /// a sealed container is compacted when at least this percentage of it is garbage
+  const int compactGarbagePercent;
+
+  /// maps block ids to where they are stored
+  std::unordered_map<int, Extent> index;
+
+  /// all the containers, by id
+  std::map<int, std::shared_ptr<Container>> containers;
+
+  /// the container new records are appended to
+  std::shared_ptr<Container> active;
+
+  /// the largest container id
+  int maxContainerID;
+
+  /// fd of the index log, opened for appending
+  int indexFd;
+
+  /// number of records in the index log
+  long long nIndexRecords;
+
+  /// number of records ever appended to the index log
+  long long indexSeq;
+
+  /// a mutex for index, containers, active and the index log
+  std::mutex mutexIndex;
+
+  /// indexSeq when the index log was synced last
+  long long indexSyncedSeq;
+
+  /// a mutex for indexSyncedSeq, taken before mutexIndex. One writer syncs
+  /// the index log for all the records appended before, outside mutexIndex.
+  std::mutex mutexSync;
+
+  /// a mutex taken before mutexIndex by the writer creating the next
+  /// container, so that the others wait for it instead of creating their own
+  std::mutex mutexCreate;
+
+  /// set to false when shutting down
+  std::atomic<bool> running;
+
+  /// notified when it is shut down
+  std::condition_variable condition;
+
+  /// the compactor thread
+  std::thread compactorThread;
+
+ public:
+  /// \brief Create a ContainerBlockStore. Nothing is done until start().
+  ContainerBlockStore(const string& dir, const StoreOptions& options);
+
+  /// \brief Stop the compactor and close the files.
+  ~ContainerBlockStore();
+
+  virtual int start(std::vector<int>* blkIDs) override;
+
+  virtual std::unique_ptr<BlockWriter> create(int bID, long long len) override;
+
+  virtual std::unique_ptr<BlockReader> open(int bID) override;
+
+  virtual int remove(const std::vector<int>& blkIDs) override;
+
+  virtual int removeCorrupt(int bID) override;
+
+  /// \brief Blocks are always stored with their checksums.
+  /// \return return -1
+  virtual int setCrcs(int bID, const std::vector<uint32_t>& crcs) override;
+
+  virtual int checkpoint() override;
+
+  /// \brief Compact the sealed containers with enough garbage now.
+  ///
+  /// \return return the number of containers unlinked
+  int compact();
+
+ private:
+  /// \brief Get the length of the record of a block.
+  static long long recordLen(long long len);
+
+  /// \brief Get the path of a container file.
+  string containerPath(int id) const;
+
+  /// \brief Create and preallocate a new container. mutexIndex must not be
+  /// held, the container is added to containers by the caller.
+  ///
+  /// \return return the container, nullptr for errors
+  std::shared_ptr<Container> newContainer(int id, long long size);
+
+  /// \brief Reserve space for the record of a block in the active container.
+  /// The reservation is given back by release().
+  ///
+  /// \return return 0 on success, -1 for errors
+  int reserve(long long len, std::shared_ptr<Container>* container, long long* offset);
+
+  /// \brief Give back a reservation, once the record is committed or aborted.
+  void release(const std::shared_ptr<Container>& container);
+
+  /// \brief Add a committed block to the index. mutexIndex must be held.
+  /// The index is left as it was if the record can't be appended to the log.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int addExtent(int bID, const Extent& extent);
+
+  /// \brief Drop a block from the index. mutexIndex must be held.
+  void dropExtent(int bID);
+
+  /// \brief Append a record to the index log. mutexIndex must be held.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int appendIndex(int type, int bID, const Extent& extent);
+
+  /// \brief Sync the index log by syncPolicy, up to a record. mutexIndex must
+  /// not be held.
+  ///
+  /// \param seq indexSeq after the record was appended
+  /// \return return 0 on success, -1 for errors
+  int syncIndex(long long seq);
+
+  /// \brief Replay the index log.
+  ///
+  /// \return return 0 on success, -1 if it doesn't exist
+  int loadIndex();
+
+  /// \brief Rebuild the index from the record headers in the containers.
+  void rebuildIndex();
+
+  /// \brief Rewrite the index log with the blocks in the index. mutexIndex must be held.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int rewriteIndex();
+
+  /// \brief Copy the live blocks out of a container and unlink it.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int compactContainer(const std::shared_ptr<Container>& container);
+
+  /// \brief Compactor thread method.
+  void compactor();
+};
+
+} // namespace minidfs
+
+#endif
@@ -0,0 +1,50 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include <minidfs/data_throttler.hpp>
+
+#include <thread>
+
+namespace minidfs {
+
+DataThrottler::DataThrottler(long long bytesPerSec)
+    : bytesPerSec(bytesPerSec), tokens(bytesPerSec),
+      lastRefill(std::chrono::steady_clock::now()) {
+}
+
+void DataThrottler::throttle(long long nBytes) {
+  if (bytesPerSec <= 0 || nBytes <= 0) {
+    return;
+  }
+  auto wait = take(nBytes, std::chrono::steady_clock::now());
+  /// sleep outside the lock, other callers queue up behind the debt
+  if (wait.count() > 0) {
+    std::this_thread::sleep_for(wait);
+  }
+}
+
+std::chrono::duration<double> DataThrottler::take(long long nBytes,
+                                                  std::chrono::steady_clock::time_point now) {
+  std::chrono::duration<double> wait(0);
+  if (bytesPerSec <= 0 || nBytes <= 0) {
+    return wait;
+  }
+  std::lock_guard<std::mutex> lockTokens(mutexTokens);
+  if (now > lastRefill) {
+    std::chrono::duration<double> elapsed = now - lastRefill;
+    lastRefill = now;
+    tokens += elapsed.count() * bytesPerSec;
+    if (tokens > bytesPerSec) {
+      tokens = bytesPerSec;
+    }
+  }
+  tokens -= nBytes;
+  if (tokens < 0) {
+    wait = std::chrono::duration<double>(-tokens / bytesPerSec);
+  }
+  return wait;
+}
+
+} // namespace minidfs
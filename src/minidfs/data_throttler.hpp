@@ -0,0 +1,60 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Header file for class DataThrottler.
+
+#ifndef DATA_THROTTLER_H_
+#define DATA_THROTTLER_H_
+
+#include <chrono>
+#include <mutex>
+
+namespace minidfs {
+
+/// \brief DataThrottler limits the bandwidth of data transfers with a token bucket.
+///
+/// The bucket is refilled at bytesPerSec and holds at most one second of tokens.
+/// Callers take tokens before sending data; when the bucket runs out, the caller
+/// sleeps until the tokens it took are refilled. It is shared by all the transfers
+/// to be limited together, e.g. all the replication tasks of a chunkserver.
+class DataThrottler {
+ private:
+  /// bandwidth, in bytes per second. <= 0 means unlimited.
+  const long long bytesPerSec;
+
+  /// available tokens, in bytes. It goes negative when the callers take more than
+  /// there are; the debt is paid by sleeping.
+  double tokens;
+
+  /// when the tokens were refilled last time
+  std::chrono::steady_clock::time_point lastRefill;
+
+  /// mutex for tokens and lastRefill
+  std::mutex mutexTokens;
+
+ public:
+  /// \brief Create a DataThrottler.
+  ///
+  /// \param bytesPerSec bandwidth in bytes per second, <= 0 for unlimited
+  explicit DataThrottler(long long bytesPerSec);
+
+  /// \brief Take nBytes of tokens. Block until they are available.
+  ///
+  /// \param nBytes number of bytes to be sent
+  void throttle(long long nBytes);
+
+  /// \brief Take nBytes of tokens at a given time, without blocking.
+  ///
+  /// \param nBytes number of bytes to be sent
+  /// \param now the current time
+  /// \return how long the caller has to wait before sending, 0 for no wait
+  std::chrono::duration<double> take(long long nBytes, std::chrono::steady_clock::time_point now);
+
+  /// \brief Get the bandwidth.
+  long long getBandwidth() const { return bytesPerSec; }
+};
+
+} // namespace minidfs
+
+#endif
@@ -0,0 +1,86 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for DataThrottler
+
+#include <minidfs/data_throttler.hpp>
+
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using std::chrono::steady_clock;
+using std::chrono::milliseconds;
+
+long long ElapsedMs(steady_clock::time_point start) {
+  return std::chrono::duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+bool Near(std::chrono::duration<double> wait, double seconds) {
+  return std::fabs(wait.count() - seconds) < 1e-6;
+}
+
+void TestUnlimited() {
+  minidfs::DataThrottler throttler(0);
+  auto now = steady_clock::now();
+  for (int i = 0; i < 1000; ++i) {
+    assert(throttler.take(1 << 20, now).count() == 0);
+  }
+  ::printf("unlimited pass ...\n");
+}
+
+void TestRate() {
+  /// 1 MB/s with a full bucket: 1 MB passes at once, then the debt is waited for
+  minidfs::DataThrottler throttler(1 << 20);
+  auto start = steady_clock::now();
+  for (int i = 0; i < 16; ++i) {
+    assert(throttler.take(64 * 1024, start).count() == 0);
+  }
+  assert(Near(throttler.take(512 * 1024, start), 0.5));
+  /// the debt is paid after 0.5 s, and 0.25 s more refills 256 KB
+  assert(throttler.take(256 * 1024, start + milliseconds(750)).count() == 0);
+  assert(Near(throttler.take(256 * 1024, start + milliseconds(750)), 0.25));
+  /// the bucket holds one second at most
+  assert(throttler.take(1 << 20, start + milliseconds(10000)).count() == 0);
+  assert(Near(throttler.take(1, start + milliseconds(10000)), 1.0 / (1 << 20)));
+  ::printf("rate pass ...\n");
+}
+
+void TestShared() {
+  /// 4 threads share 2 MB/s: 3 MB beyond the bucket takes at least 1.5 s
+  minidfs::DataThrottler throttler(2 << 20);
+  auto start = steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&throttler]() {
+      for (int i = 0; i < 20; ++i) {
+        throttler.throttle(64 * 1024);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  /// only the lower bound, a loaded host may take any longer
+  long long ms = ElapsedMs(start);
+  assert(ms >= 1400);
+  ::printf("shared pass (%lld ms) ...\n", ms);
+}
+
+} // namespace
+
+void TestDataThrottler() {
+  ::printf("Test DataThrottler...\n");
+
+  TestUnlimited();
+  TestRate();
+  TestShared();
+
+  ::printf("\n");
+}
@@ -4,23 +4,66 @@
 /// \author Wang Xi
 
 #include <minidfs/dfs_chunkserver.hpp>
+#include <minidfs/ec_block_group.hpp>
+#include "compression/compressed_block.h"
 #include "logging/logger.h"
 
 namespace minidfs {
 DFSChunkserver::DFSChunkserver(const string& masterIP, int masterPort,
                                const string& serverIP, int serverPort,
-                               const string& dataDir, long long blkSize,
+                               const std::vector<string>& dataDirs, long long blkSize,
                                int maxConnections, int BUFFER_SIZE,
-                               size_t nThread,
+                               size_t nThread, size_t maxThread, int maxQueueDelayMs,
                                long long HEART_BEAT_INTERVAL,
                                long long BLOCK_REPORT_INTERVAL,
-                               long long BLK_TASK_STARTUP_INTERVAL)
+                               long long BLK_TASK_STARTUP_INTERVAL,
+                               size_t nReplicationThread,
+                               long long replicationBandwidth,
+                               const StoreOptions& storeOptions,
+                               long long scrubBandwidth,
+                               long long SCRUB_PASS_INTERVAL,
+                               long long BLK_INDEX_INTERVAL,
+                               size_t nVolumeIOThread,
+                               const string& volumePolicy)
     : master(new rpc::ChunkserverProtocolProxy(masterIP, masterPort)),
-      serverIP(serverIP), serverPort(serverPort), dataDir(dataDir), blockSize(blkSize),
-      maxConnections(maxConnections), BUFFER_SIZE(BUFFER_SIZE),
-      threadPool(nThread),
+      serverPort(serverPort), serverIP(serverIP), maxConnections(maxConnections),
+      volumePolicy(volumePolicy), nextVolume(0), nActiveXfers(0),
+      blockSize(blkSize), BUFFER_SIZE(BUFFER_SIZE),
       HEART_BEAT_INTERVAL(HEART_BEAT_INTERVAL), BLOCK_REPORT_INTERVAL(BLOCK_REPORT_INTERVAL),
-      BLK_TASK_STARTUP_INTERVAL(BLK_TASK_STARTUP_INTERVAL){
+      BLK_TASK_STARTUP_INTERVAL(BLK_TASK_STARTUP_INTERVAL),
+      threadPool(nThread, maxThread, maxQueueDelayMs),
+      replicationThrottler(replicationBandwidth), replicationPool(nReplicationThread),
+      BLK_INDEX_INTERVAL(BLK_INDEX_INTERVAL),
+      scrubThrottler(scrubBandwidth * 1024 * 1024),
+      SCRUB_PASS_INTERVAL(SCRUB_PASS_INTERVAL), nScrubYieldsExpired(0) {
+  auto registry = metrics::Registry::global();
+  for (const auto& dir : dataDirs) {
+    volumes.emplace_back(new Volume(dir, nVolumeIOThread, storeOptions));
+    volumes.back()->exportMetrics("chunkserver.volume" + std::to_string(volumes.size() - 1));
+  }
+  threadPool.exportMetrics("chunkserver.request");
+  replicationPool.exportMetrics("chunkserver.replication");
+
+  bytesRecved = registry->counter("chunkserver.recv.bytes");
+  bytesSent = registry->counter("chunkserver.send.bytes");
+  recvLatency = registry->histogram("chunkserver.recv.us");
+  sendLatency = registry->histogram("chunkserver.send.us");
+  nXferErrors = registry->counter("chunkserver.xfer.errors");
+  nReplicated = registry->counter("chunkserver.replicated");
+  nCorrupt = registry->counter("chunkserver.corrupt");
+  registry->gauge_fn("chunkserver.blocks", [this]() -> int64_t {
+    std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
+    return blksServed.size();
+  });
+  registry->gauge_fn("chunkserver.xfers", [this]() -> int64_t {
+    return nActiveXfers.load();
+  });
+}
+
+DFSChunkserver::~DFSChunkserver() {
+  auto registry = metrics::Registry::global();
+  registry->remove_gauge_fn("chunkserver.blocks");
+  registry->remove_gauge_fn("chunkserver.xfers");
 }
 
 void DFSChunkserver::run() {
@@ -35,40 +78,47 @@ void DFSChunkserver::run() {
   std::thread dataServiceThread(&DFSChunkserver::dataService, this);
   dataServiceThread.detach();
 
+  /// start scrubber
+  if (scrubThrottler.getBandwidth() > 0) {
+    std::thread scrubberThread(&DFSChunkserver::scrubber, this);
+    scrubberThread.detach();
+  }
+
   //
   // Interact with master
   //
   using std::chrono::system_clock;
   auto lastHeartbeat = system_clock::now();
-  auto lastBlkReport = lastHeartbeat;
   auto startup = lastHeartbeat;
+  /// the 1st full report is sent when the master asks for it. The periodic ones
+  /// start at a random point of the 1st interval to spread chunkservers out.
+  std::mt19937_64 rng(std::random_device{}());
+  std::uniform_int_distribution<long long> firstReportDelay(0, BLOCK_REPORT_INTERVAL);
+  auto nextBlkReport = startup + std::chrono::milliseconds(firstReportDelay(rng));
+  auto nextBlkIndex = startup + std::chrono::milliseconds(BLK_INDEX_INTERVAL);
   while(true) {
     auto now = system_clock::now();
     auto t = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastHeartbeat);
-    /// heart beat
+    /// heart beat. It also reports the received blocks and executes
+    /// the block tasks in the response.
     if (t.count() > HEART_BEAT_INTERVAL) {
-      heartBeat();
+      auto up = std::chrono::duration_cast<std::chrono::milliseconds>(now - startup);
+      if (heartBeat(up.count() > BLK_TASK_STARTUP_INTERVAL) == OpCode::OP_BLK_REPORT_REQUIRED) {
+        nextBlkReport = now;
+      }
       lastHeartbeat = now;
     }
 
     /// block report
-    //now = system_clock::now();
-    t = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastBlkReport);
-    if (t.count() > BLOCK_REPORT_INTERVAL) {
+    if (now >= nextBlkReport) {
       blkReport();
-      lastBlkReport = now;
-    }
-
-    /// inform the master about the received blocks
-    if (blksRecved.empty() == false) {
-      recvedBlks();
+      nextBlkReport = now + std::chrono::milliseconds(BLOCK_REPORT_INTERVAL);
     }
 
-    /// get block tasks
-    //now = system_clock::now();
-    t = std::chrono::duration_cast<std::chrono::milliseconds>(now - startup);
-    if (t.count() > BLK_TASK_STARTUP_INTERVAL) {
-      getBlkTask();
+    /// block index snapshot
+    if (now >= nextBlkIndex) {
+      saveBlkIndex();
+      nextBlkIndex = now + std::chrono::milliseconds(BLK_INDEX_INTERVAL);
     }
 
     /// sleep until next heart beat
@@ -119,89 +169,261 @@ void DFSChunkserver::dataService() {
       LOG_WARN << "Failed to accept socket " << strerror(errno);
       continue;
     }
-    std::function<void()> f = std::bind(&DFSChunkserver::handleBlockRequest, this, connfd);
-    threadPool.enqueue(f);
+    threadPool.post([this, connfd]() { handleBlockRequest(connfd); });
   }
 }
 
-int DFSChunkserver::scanStoredBlocks() {
-  struct dirent* blkFile;
-  auto dir = opendir(dataDir.c_str());
-  if (!dir) {
-    LOG_ERROR << "Cannot open " << dataDir;
-    return OpCode::OP_FAILURE;
+void DFSChunkserver::scrubber() {
+  while (true) {
+    std::vector<int> blks;
+    {
+      std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
+      for (const auto& b : blksServed) {
+        blks.push_back(b.first);
+      }
+    }
+    LOG_INFO << "Scrubbing " << (int)blks.size() << " blocks";
+    int nCorrupt = 0;
+    nScrubYieldsExpired = 0;
+    for (int bID : blks) {
+      if (verifyBlk(bID) == 1) {
+        markCorrupt(bID);
+        ++nCorrupt;
+      }
+    }
+    LOG_INFO << "Scrubbing pass done, " << nCorrupt << " corrupt blocks";
+    if (nScrubYieldsExpired > 0) {
+      LOG_WARN << "Scrubbed " << nScrubYieldsExpired << " blocks while transfers were running";
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(SCRUB_PASS_INTERVAL));
   }
+}
 
-  while ((blkFile = readdir(dir)) != nullptr) {
-    if (strcmp(blkFile->d_name, ".") == 0 || strcmp(blkFile->d_name, "..") == 0) {
-      continue;
-    }
-    
-    if (blkFile->d_type == DT_REG) {
-      /// regular file
+int DFSChunkserver::verifyBlk(int bID) {
+  /// removed since the pass started
+  int vol = findVolume(bID);
+  if (vol == -1) {
+    return -1;
+  }
+  auto reader = volumes[vol]->getStore().open(bID);
+  if (!reader) {
+    LOG_ERROR << "Failed to open block " << bID;
+    return -1;
+  }
+  long long blkLen = reader->length();
 
-      /// the block name is stored in format of "blk_" + blockID
-      auto blkname = string(blkFile->d_name);
-      size_t idPos = blkname.find("blk_");
+  std::vector<uint32_t> crcs;
+  bool storedCrcs = (0 == reader->readCrcs(&crcs));
+  checksum::ChunkedChecksum dataChecksum;
 
-      if (idPos == blkname.size()) {
-        continue;
+  std::vector<char> dataBuffer(BUFFER_SIZE);
+  long long byteLeft = blkLen;
+  long long yielded = 0;
+  while (byteLeft > 0) {
+    /// yield to the clients and replications, for a while
+    while (nActiveXfers > 0 && yielded < SCRUB_MAX_YIELD) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(SCRUB_YIELD_INTERVAL));
+      yielded += SCRUB_YIELD_INTERVAL;
+      if (yielded >= SCRUB_MAX_YIELD) {
+        LOG_DEBUG << "Stop yielding to the transfers for block " << bID;
+        ++nScrubYieldsExpired;
       }
+    }
+    int nRead = byteLeft < BUFFER_SIZE ? byteLeft : BUFFER_SIZE;
+    scrubThrottler.throttle(nRead);
+    if ((nRead = reader->read(dataBuffer.data(), nRead)) <= 0) {
+      /// truncated
+      break;
+    }
+    dataChecksum.update(dataBuffer.data(), nRead);
+    byteLeft -= nRead;
+  }
+  reader->dropCache();
 
-      idPos = idPos + 4;
-      int blkid = atoi(blkname.substr(idPos).c_str());
-      std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
-      blksServed.emplace(blkid);
+  if (byteLeft > 0) {
+    LOG_ERROR << "Failed reading block " << bID << ", " << (int64_t)byteLeft << " bytes left";
+    return 1;
+  }
+  if (storedCrcs == false) {
+    /// written before checksums existed, keep what is there from now on
+    volumes[vol]->getStore().setCrcs(bID, dataChecksum.finish());
+    return 0;
+  }
+  const auto& computed = dataChecksum.finish();
+  for (size_t i = 0; i < computed.size(); ++i) {
+    if (computed[i] != crcs[i]) {
+      LOG_ERROR << "Checksum mismatch of block " << bID << " at offset "
+                << (int64_t)i * checksum::ChunkedChecksum::kBytesPerChecksum;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void DFSChunkserver::markCorrupt(int bID) {
+  int vol = -1;
+  {
+    std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
+    auto b = blksServed.find(bID);
+    if (b == blksServed.end()) {
+      return;
+    }
+    vol = b->second;
+    blksServed.erase(b);
+  }
+  volumes[vol]->getStore().removeCorrupt(bID);
+  std::lock_guard<std::mutex> lockBlksRecved(mutexBlksRecved);
+  blksRecved.erase(bID);
+  blksCorrupt.insert(bID);
+  nCorrupt->inc();
+}
+
+int DFSChunkserver::scanStoredBlocks() {
+  /// load the volumes in parallel, they are on different disks
+  std::vector<std::vector<int>> stored(volumes.size());
+  std::vector<int> ret(volumes.size(), 0);
+  std::vector<std::thread> threads;
+  for (size_t v = 0; v < volumes.size(); ++v) {
+    threads.emplace_back([this, v, &stored, &ret]() {
+      ret[v] = volumes[v]->getStore().start(&stored[v]);
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
+  for (size_t v = 0; v < volumes.size(); ++v) {
+    if (ret[v] == -1) {
+      LOG_ERROR << "Failed to load volume " << volumes[v]->getDir();
+      return OpCode::OP_FAILURE;
+    }
+    for (int blkid : stored[v]) {
+      if (blksServed.emplace(blkid, v).second == false) {
+        LOG_WARN << "Block " << blkid << " is in both " << volumes[blksServed[blkid]]->getDir()
+                 << " and " << volumes[v]->getDir();
+      }
     }
   }
   return OpCode::OP_SUCCESS;
 }
 
+int DFSChunkserver::saveBlkIndex() {
+  int ret = 0;
+  for (auto& v : volumes) {
+    if (-1 == v->getStore().checkpoint()) {
+      LOG_ERROR << "Failed to checkpoint volume " << v->getDir();
+      ret = -1;
+    }
+  }
+  return ret;
+}
+
 void DFSChunkserver::handleBlockRequest(int connfd) {
   char opcode = 0;
-  if (recv(connfd, &opcode, 1, 0) == -1) {
+  if (recv(connfd, &opcode, 1, 0) <= 0) {
     close(connfd);
     return;
   }
 
-  LOG_INFO << "One request " << (int)opcode << " ";
+  LOG_DEBUG << "One request " << (int)opcode << " ";
 
+  //
+  // read header
+  //
+  uint16_t len = 0;
+  /// read the length
+  if (recv(connfd, &len, 2, MSG_WAITALL) != 2) {
+    close(connfd);
+    return;
+  }
+  len = ntohs(len);
+  LOG_DEBUG << "Succeed recving header length: " << (int)len;
+  string header(len, 0);
+  if (len > 0 && recv(connfd, &header[0], len, MSG_WAITALL) != len) {
+    close(connfd);
+    return;
+  }
+
+  /// the data is transferred by the I/O workers of the volume,
+  /// so that a slow disk only holds up its own requests
+  int vol = -1;
+  std::function<int()> transfer;
   switch (opcode) {
-    case OpCode::OP_WRITE :
-      recvBlock(connfd);
+    case OpCode::OP_WRITE : {
+      LocatedBlock lb;
+      lb.ParseFromString(header);
+      LOG_DEBUG << "Succeed recving lb: " << lb.DebugString();
+      /// a replica of it is kept in the same volume
+      vol = findVolume(lb.block().blockid());
+      if (vol == -1) {
+        vol = chooseVolume();
+      }
+      if (vol == -1) {
+        LOG_ERROR << "No volume has space for block " << lb.block().blockid();
+        char retOp = 0;
+        send(connfd, &retOp, 1, 0);
+        break;
+      }
+      transfer = std::bind(&DFSChunkserver::recvBlock, this, connfd, lb, vol);
       break;
-    case OpCode::OP_READ :
-      sendBlock(connfd);
+    }
+    case OpCode::OP_READ : {
+      Block b;
+      b.ParseFromString(header);
+      LOG_DEBUG << "Succeed recving b: " << b.DebugString();
+      vol = findVolume(b.blockid());
+      if (vol == -1) {
+        LOG_ERROR << "Invalid block: " << b.blockid();
+        char op = OpCode::OP_FAILURE;
+        send(connfd, &op, 1, 0);
+        break;
+      }
+      transfer = std::bind(&DFSChunkserver::sendBlock, this, connfd, b, vol);
       break;
+    }
     default:
       LOG_INFO << "Wrong OpCode ";
       break;
   }
-  close(connfd);
-}
-
-int DFSChunkserver::recvBlock(int connfd) {
-  //
-  // read header
-  //
-  uint16_t len = 0;
-  /// read the length
-  if (recv(connfd, &len, 2, 0) < 0) {
-    return -1;
+  if (!transfer) {
+    close(connfd);
+    return;
   }
-  len = ntohs(len);
 
-  LOG_INFO << "Succeed recving lb length: " << (int)len;
+  ++nActiveXfers;
+  metrics::Histogram* latency = opcode == OpCode::OP_WRITE ? recvLatency : sendLatency;
+  volumes[vol]->submit([this, connfd, transfer, latency]() {
+    {
+      metrics::ScopedTimer timer(latency);
+      if (transfer() == -1) {
+        nXferErrors->inc();
+      }
+    }
+    --nActiveXfers;
+    close(connfd);
+  });
+}
 
-  std::vector<char> lbBuf(len, 0);
-  /// read located block
-  if (recv(connfd, lbBuf.data(), len, 0) < 0) {
-    return -1;
+int DFSChunkserver::findVolume(int bID) {
+  std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
+  auto b = blksServed.find(bID);
+  return b == blksServed.end() ? -1 : b->second;
+}
+
+int DFSChunkserver::chooseVolume() {
+  std::vector<long long> available(volumes.size(), 0);
+  for (size_t v = 0; v < volumes.size(); ++v) {
+    long long capacity = 0;
+    if (-1 == volumes[v]->getSpace(&capacity, &available[v])) {
+      LOG_ERROR << "Failed to stat volume " << volumes[v]->getDir();
+      available[v] = 0;
+    }
   }
-  LocatedBlock lb;
-  lb.ParseFromArray(lbBuf.data(), len);
-  LOG_INFO << "Succeed recving lb: " << lb.DebugString();
+  return Volume::choose(available, blockSize, volumePolicy, &nextVolume);
+}
 
+int DFSChunkserver::recvBlock(int connfd, const LocatedBlock& lb, int vol) {
   /// forward the block to the next chunkserver if required
   bool willForward = false;
   LocatedBlock forwardLB;
@@ -255,22 +477,28 @@ int DFSChunkserver::recvBlock(int connfd) {
     return -1;
   }
   dataLen += ntohl(halfLen);
-  LOG_INFO << "Succeed recving data length: " << (int)dataLen;
+  LOG_DEBUG << "Succeed recving data length: " << (int)dataLen;
+  /// the store allocates the announced length, it is at most a block,
+  /// or a block stored compressed
+  if (dataLen > (uint64_t)compression::CompressedBlock::maxStoredLength(blockSize)) {
+    LOG_ERROR << "Block " << lb.block().blockid() << " of " << (int64_t)dataLen
+              << " bytes is larger than a block";
+    if (willForward == true) {
+      ::close(forwardSockfd);
+    }
+    return -1;
+  }
   if (forwardSockfd != -1 && send(forwardSockfd, &halfLen, 4, 0) < 0) {
     ::close(forwardSockfd);
     willForward = false;
   }
   
 
-  string folder("/tmp");
-  string blkFileName("blk_");
   int bID = lb.block().blockid();
-  blkFileName += std::to_string(bID);
-  std::fstream fOut(folder+"/"+blkFileName, std::ios::out | std::ios::trunc | std::ios::binary);
-  if (fOut.is_open() == false) {
-    LOG_ERROR << "Failed to open " << folder+"/"+blkFileName;
-    fOut.clear();
-    fOut.close();
+  /// dropped without commit() on errors
+  auto writer = volumes[vol]->getStore().create(bID, dataLen);
+  if (!writer) {
+    LOG_ERROR << "Failed to create block " << bID << " in " << volumes[vol]->getDir();
     if (willForward == true) {
       ::close(forwardSockfd);
     }
@@ -278,20 +506,26 @@ int DFSChunkserver::recvBlock(int connfd) {
   }
 
   std::vector<char> dataBuffer(BUFFER_SIZE);
+  checksum::ChunkedChecksum dataChecksum;
   long long byteLeft = dataLen;
   while (byteLeft > 0) {
 
     int nRead = byteLeft < BUFFER_SIZE ? byteLeft : BUFFER_SIZE;
-    if ((nRead = recv(connfd, dataBuffer.data(), nRead, 0)) == -1) {
-      fOut.clear();
-      fOut.close();
+    if ((nRead = recv(connfd, dataBuffer.data(), nRead, 0)) <= 0) {
+      if (willForward == true) {
+        ::close(forwardSockfd);
+      }
+      return -1;
+    }
+    /// write to the store
+    if (-1 == writer->write(dataBuffer.data(), nRead)) {
+      LOG_ERROR << "Failed to write block " << bID << " to " << volumes[vol]->getDir();
       if (willForward == true) {
         ::close(forwardSockfd);
       }
       return -1;
     }
-    /// write to file
-    fOut.write(dataBuffer.data(), nRead);
+    dataChecksum.update(dataBuffer.data(), nRead);
 
     /// forward to downstream
     if (willForward == true && send(forwardSockfd, dataBuffer.data(), nRead, 0) < 0) {
@@ -300,17 +534,49 @@ int DFSChunkserver::recvBlock(int connfd) {
     }
     byteLeft -= nRead;
   }
-  fOut.clear();
-  fOut.close();
-  
-  /// move to final folder
-  rename((folder+"/"+blkFileName).c_str(), (dataDir+"/"+blkFileName).c_str());
+
+  /// verify the checksums following the data, and forward them
+  const auto& crcs = dataChecksum.finish();
+  string crcBytes(crcs.size() * 4, 0);
+  std::vector<uint32_t> recvedCrcs;
+  if (crcBytes.empty() == false
+      && recv(connfd, &crcBytes[0], crcBytes.size(), MSG_WAITALL) != (ssize_t)crcBytes.size()) {
+    LOG_ERROR << "Failed recving checksums of block " << bID;
+    crcBytes.clear();
+  } else {
+    checksum::ChunkedChecksum::getCrcs(crcBytes.data(), crcs.size(), &recvedCrcs);
+  }
+  if (recvedCrcs != crcs) {
+    LOG_ERROR << "Checksum mismatch of block " << bID;
+    if (willForward == true) {
+      ::close(forwardSockfd);
+    }
+    char retOp = 0;
+    send(connfd, &retOp, 1, 0);
+    return -1;
+  }
+  if (willForward == true && crcBytes.empty() == false
+      && send(forwardSockfd, crcBytes.data(), crcBytes.size(), 0) < 0) {
+    ::close(forwardSockfd);
+    willForward = false;
+  }
+
+  if (-1 == writer->commit(crcs)) {
+    LOG_ERROR << "Failed to store block " << bID << " in " << volumes[vol]->getDir();
+    if (willForward == true) {
+      ::close(forwardSockfd);
+    }
+    char retOp = 0;
+    send(connfd, &retOp, 1, 0);
+    return -1;
+  }
   {
     std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
     std::lock_guard<std::mutex> lockBlksRecved(mutexBlksRecved);
-    blksServed.emplace(bID);
+    blksServed[bID] = vol;
     blksRecved.emplace(bID);
   }
+  bytesRecved->add(dataLen);
   /// recv response from downstream chunkserver
   char nSuccess = 0;
   if (willForward == true) {
@@ -321,65 +587,41 @@ int DFSChunkserver::recvBlock(int connfd) {
   /// send response
   char retOp = nSuccess + 1;
   int ret = send(connfd, &retOp, 1, 0);
-  LOG_INFO << "Succeed recving block: " << bID;
+  LOG_EVERY_T(INFO, 1000) << "Succeed recving block: " << bID;
   return ret;
 }
 
-int DFSChunkserver::sendBlock(int connfd) {
-  //
-  // read header
-  //
-  uint16_t len = 0;
-  /// read the length
-  if (recv(connfd, &len, 2, 0) < 0) {
-    return -1;
-  }
-  len = ntohs(len);
-  LOG_INFO << "Succeed recving b length: " << (int)len;
-
-  std::vector<char> bBuf(len, 0);
-  /// read located block
-  if (recv(connfd, bBuf.data(), len, 0) < 0) {
-    return -1;
-  }
-  Block b;
-  b.ParseFromArray(bBuf.data(), len);
-  LOG_INFO << "Succeed recving b: " << b.DebugString();
+int DFSChunkserver::sendBlock(int connfd, const Block& b, int vol) {
   //
   // response: send data to client
   //
   char op = 0;
   int bID = b.blockid();
-  /// send OpCode
-  {
-    std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
-    if (blksServed.find(bID) == blksServed.end()) {
-      LOG_ERROR << "Invalid block: " << bID;
-      op = OpCode::OP_FAILURE;
-      send(connfd, &op, 1, 0);
-      return -1;
-    }
+  /// send OpCode. It may be removed while the request was queued.
+  if (findVolume(bID) != vol) {
+    LOG_ERROR << "Invalid block: " << bID;
+    op = OpCode::OP_FAILURE;
+    send(connfd, &op, 1, 0);
+    return -1;
   }
   op = OpCode::OP_SUCCESS;
   send(connfd, &op, 1, 0);
-  LOG_INFO << "Succeed sending ret op ";
+  LOG_DEBUG << "Succeed sending ret op ";
   /// send block data
-  if ( sendBlkData(connfd, bID) == -1) {
+  if ( sendBlkData(connfd, vol, bID, nullptr, b.has_extent() ? &b.extent() : nullptr) == -1) {
     LOG_ERROR << "Failed sending block: " << bID;
     return -1;
   }
-  LOG_INFO << "Succeed sending block data ";
+  LOG_DEBUG << "Succeed sending block data ";
   return 0;
 }
 
 int DFSChunkserver::replicateBlock(const LocatedBlock& locatedB) {
   int bID = locatedB.block().blockid();
-  {
-    std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
-    if (blksServed.find(bID) == blksServed.end()) {
-      LOG_ERROR << "Invalid block: " << bID;
-      return -1;
-    }
+  int vol = findVolume(bID);
+  if (vol == -1) {
+    LOG_ERROR << "Invalid block: " << bID;
+    return -1;
   }
 
 
@@ -390,7 +632,7 @@ int DFSChunkserver::replicateBlock(const LocatedBlock& locatedB) {
     return -1;
   }
   /// send block data
-  if ( sendBlkData(sockfd, bID) == -1) {
+  if ( sendBlkData(sockfd, vol, bID, &replicationThrottler) == -1) {
     LOG_ERROR << "Failed sending block: " << bID;
     ::close(sockfd);
     return -1;
@@ -406,61 +648,126 @@ int DFSChunkserver::replicateBlock(const LocatedBlock& locatedB) {
   }
 }
 
+int DFSChunkserver::reconstructBlock(const BlockTask& task) {
+  const Block& group = task.blkgroup().block();
+  int bID = task.locatedblk().block().blockid();
+  int index = bID - ECBlockGroup::internalBlkID(group, 0);
+  if (group.has_ecschema() == false || index < 0 || index >= ECBlockGroup::nBlks(group)) {
+    LOG_ERROR << "Invalid reconstruction task of block " << bID;
+    return -1;
+  }
 
-int DFSChunkserver::sendBlkData(int connfd, int bID) {
-  string blkFileName("blk_");
-  blkFileName += std::to_string(bID);
-  std::fstream fIn(dataDir+"/"+blkFileName, std::ios::in | std::ios::binary);
-  if (fIn.is_open() == false) {
-    LOG_ERROR << "Failed to open " << dataDir+"/"+blkFileName;
-    fIn.clear();
-    fIn.close();
+  string data;
+  if (-1 == ECBlockGroup(task.blkgroup()).reconstruct(index, &data)) {
+    return -1;
+  }
+  int vol = chooseVolume();
+  if (vol == -1) {
+    LOG_ERROR << "No space for reconstructed block " << bID;
+    return -1;
+  }
+  checksum::ChunkedChecksum dataChecksum;
+  dataChecksum.update(data.data(), data.size());
+  auto writer = volumes[vol]->getStore().create(bID, data.size());
+  if (!writer || -1 == writer->write(data.data(), data.size())
+      || -1 == writer->commit(dataChecksum.finish())) {
+    LOG_ERROR << "Failed to store reconstructed block " << bID << " in " << volumes[vol]->getDir();
     return -1;
   }
+  {
+    std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
+    std::lock_guard<std::mutex> lockBlksRecved(mutexBlksRecved);
+    blksServed[bID] = vol;
+    blksRecved.emplace(bID);
+  }
+  LOG_INFO << "Reconstructed block " << bID << " of block group " << group.blockid();
+  return 0;
+}
 
-  /// send datalen
-  long long blkLen = - fIn.tellg();
-  fIn.seekg(0, std::ios::end);
-  blkLen += fIn.tellg();
+int DFSChunkserver::sendBlkData(int connfd, int vol, int bID, DataThrottler* throttler,
+                                const Extent* range) {
+  auto reader = volumes[vol]->getStore().open(bID);
+  if (!reader) {
+    LOG_ERROR << "Failed to open block " << bID;
+    return -1;
+  }
 
-  /// seek to start
-  fIn.seekg(0, std::ios::beg);
+  /// the range in whole checksum chunks
+  const long long bytesPerChecksum = checksum::ChunkedChecksum::kBytesPerChecksum;
+  long long start = 0;
+  long long end = reader->length();
+  if (range != nullptr) {
+    if (range->offset() < 0 || range->len() < 0 || range->offset() + range->len() > end) {
+      LOG_ERROR << "Invalid range of block " << bID << ": " << (int64_t)range->offset()
+                << "+" << (int64_t)range->len();
+      return -1;
+    }
+    start = range->offset() / bytesPerChecksum * bytesPerChecksum;
+    end = std::min(end, (range->offset() + range->len() + bytesPerChecksum - 1)
+                        / bytesPerChecksum * bytesPerChecksum);
+    if (-1 == reader->seek(start)) {
+      return -1;
+    }
+  }
 
-  uint64_t dataLen = blkLen;
+  /// send datalen
+  uint64_t dataLen = end - start;
   uint32_t halfLen = dataLen >> 32;
   /// send the first half
   halfLen = htonl(halfLen);
   if (send(connfd, &halfLen, 4, 0) < 0) {
-    fIn.clear();
-    fIn.close();
     return -1;
   }
   halfLen = dataLen;
   halfLen = htonl(halfLen);
   /// the second half
   if (send(connfd, &halfLen, 4, 0) < 0) {
-    fIn.clear();
-    fIn.close();
     return -1;
   }
 
+  /// the stored checksums. Blocks written before checksums existed have none,
+  /// so they are computed while sending.
+  std::vector<uint32_t> crcs;
+  bool storedCrcs = (0 == reader->readCrcs(&crcs));
+  if (storedCrcs && range != nullptr) {
+    auto first = crcs.begin() + start / bytesPerChecksum;
+    crcs = std::vector<uint32_t>(first, first + checksum::ChunkedChecksum::nChunks(dataLen));
+  }
+  checksum::ChunkedChecksum dataChecksum;
+
   /// send data
   std::vector<char> dataBuffer(BUFFER_SIZE);
   long long byteLeft = dataLen;
   while (byteLeft > 0) {
     int nRead = byteLeft < BUFFER_SIZE ? byteLeft : BUFFER_SIZE;
-    /// read from file
-    fIn.read(dataBuffer.data(), nRead);
+    /// read from the store
+    if ((nRead = reader->read(dataBuffer.data(), nRead)) <= 0) {
+      LOG_ERROR << "Failed reading block " << bID << ", " << (int64_t)byteLeft << " bytes left";
+      return -1;
+    }
+    if (storedCrcs == false) {
+      dataChecksum.update(dataBuffer.data(), nRead);
+    }
+    if (throttler != nullptr) {
+      throttler->throttle(nRead);
+    }
     if (send(connfd, dataBuffer.data(), nRead, 0) == -1) {
-      fIn.clear();
-      fIn.close();
       return -1;
     }
     byteLeft -= nRead;
   }
-  fIn.clear();
-  fIn.close();
-  LOG_INFO << "Succeed sending block: " << bID;
+
+  /// send checksums
+  if (storedCrcs == false) {
+    crcs = dataChecksum.finish();
+  }
+  string crcBytes;
+  checksum::ChunkedChecksum::putCrcs(crcs, &crcBytes);
+  if (crcBytes.empty() == false && send(connfd, crcBytes.data(), crcBytes.size(), 0) == -1) {
+    return -1;
+  }
+  bytesSent->add(dataLen);
+  LOG_EVERY_T(INFO, 1000) << "Succeed sending block: " << bID;
   return 0;
 }
 
@@ -490,72 +797,153 @@ int DFSChunkserver::connectRemote(string serverIP, int serverPort) {
   return sockfd;
 }
 
-int DFSChunkserver::heartBeat() {
-  LOG_INFO << "Heartbeating ";
-  return master->heartBeat(chunkserverInfo);
+int DFSChunkserver::heartBeat(bool acceptBlkTasks) {
+  LOG_DEBUG << "Heartbeating ";
+  Heartbeat heartbeat;
+  *heartbeat.mutable_chunkserverinfo() = chunkserverInfo;
+  heartbeat.set_nactivexfers(nActiveXfers);
+  heartbeat.set_acceptblktasks(acceptBlkTasks);
+  for (const auto& v : volumes) {
+    auto volumeInfo = heartbeat.add_volumes();
+    long long capacity = 0;
+    long long available = 0;
+    if (-1 == v->getSpace(&capacity, &available)) {
+      LOG_ERROR << "Failed to stat volume " << v->getDir();
+    }
+    volumeInfo->set_dir(v->getDir());
+    volumeInfo->set_capacity(capacity);
+    volumeInfo->set_available(available >= blockSize ? available : 0);
+    volumeInfo->set_npendingio(v->getNPendingIO());
+  }
+  std::vector<int> recved;
+  std::vector<int> corrupt;
+  {
+    std::lock_guard<std::mutex> lockBlksRecved(mutexBlksRecved);
+    recved.assign(blksRecved.begin(), blksRecved.end());
+    corrupt.assign(blksCorrupt.begin(), blksCorrupt.end());
+  }
+  for (int b : recved) {
+    heartbeat.add_recvedblkids(b);
+  }
+  for (int b : corrupt) {
+    heartbeat.add_corruptblkids(b);
+  }
+  std::vector<int> failed;
+  {
+    std::lock_guard<std::mutex> lockReplication(mutexReplication);
+    failed.assign(blksFailedReplication.begin(), blksFailedReplication.end());
+  }
+  for (int b : failed) {
+    heartbeat.add_failedblkids(b);
+  }
+
+  BlockTasks blkTasks;
+  int opRet = master->heartBeat(heartbeat, &blkTasks);
+  if (opRet != OpCode::OP_SUCCESS) {
+    /// keep the received blocks; they are sent again or covered by the full report
+    return opRet;
+  }
+  {
+    /// blocks received during the rpc are sent next time
+    std::lock_guard<std::mutex> lockBlksRecved(mutexBlksRecved);
+    for (int b : recved) {
+      blksRecved.erase(b);
+    }
+    for (int b : corrupt) {
+      blksCorrupt.erase(b);
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lockReplication(mutexReplication);
+    for (int b : failed) {
+      blksFailedReplication.erase(b);
+    }
+  }
+  return execBlkTasks(blkTasks);
 }
 
 int DFSChunkserver::blkReport() {
   LOG_INFO << "Reporting blocks ";
-  std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
-  std::vector<int> blks(blksServed.begin(), blksServed.end());
+  std::vector<int> blks;
+  {
+    std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
+    for (const auto& b : blksServed) {
+      blks.push_back(b.first);
+    }
+  }
   std::vector<int> blksDeleted;
   int opRet = master->blkReport(chunkserverInfo, blks, blksDeleted);
-  if (opRet == OpCode::OP_FAILURE) {
+  if (opRet == OpCode::OP_FAILURE || opRet == OpCode::OP_SERVER_BUSY) {
     return opRet;
   }
-  for (int blkD : blksDeleted) {
-    if (blksServed.find(blkD) != blksServed.end()) {
-      blksServed.erase(blkD);
-
-      string blkFileName("blk_");
-      blkFileName += std::to_string(blkD);
-      if (remove((dataDir+"/"+blkFileName).c_str()) == 0) {
-        LOG_INFO << "Succeed removing block: " << blkD;
-      } else {
-        opRet = OpCode::OP_FAILURE;
-        LOG_INFO << "Failed removing block: " << blkD;
-      }
-    }
-  }
+  removeBlks(blksDeleted);
   return opRet;
 }
 
-int DFSChunkserver::getBlkTask() {
-  BlockTasks blockTasks;
-  int opRet = master->getBlkTask(chunkserverInfo, &blockTasks);
-  LOG_INFO << "Getting block tasks: " << blockTasks.DebugString();
-  
-  if (opRet == OpCode::OP_FAILURE || opRet == OpCode::OP_NO_BLK_TASK) {
-    return opRet;
-  }
-
-  for (int i = 0; i < blockTasks.blktasks_size(); ++i) {
-    const auto& task = blockTasks.blktasks(i);
-    if (task.operation() == OpCode::OP_COPY) {
-      if (0 == replicateBlock(task.locatedblk())) {
-        LOG_INFO << "Succeed to replicate block: " << task.locatedblk().block().blockid();
-      } else {
-        opRet = OpCode::OP_FAILURE;
-      }
+int DFSChunkserver::execBlkTasks(const BlockTasks& blkTasks) {
+  int opRet = OpCode::OP_SUCCESS;
+  std::vector<int> blksDeleted;
+  for (int i = 0; i < blkTasks.blktasks_size(); ++i) {
+    const auto& task = blkTasks.blktasks(i);
+    if (task.operation() == OpCode::OP_COPY || task.operation() == OpCode::OP_RECONSTRUCT) {
+      LOG_DEBUG << "Block task: " << task.DebugString();
+      queueReplication(task);
+    } else if (task.operation() == OpCode::OP_DELETE) {
+      blksDeleted.push_back(task.locatedblk().block().blockid());
     }
   }
+  removeBlks(blksDeleted);
   return opRet;
 }
 
-int DFSChunkserver::recvedBlks() {
-  //LOG_INFO << "Sending blocks received to master ";
-  std::lock_guard<std::mutex> lockBlksRecved(mutexBlksRecved);
-  if (blksRecved.size() == 0) {
-    return OpCode::OP_SUCCESS;
+void DFSChunkserver::queueReplication(const BlockTask& task) {
+  int bID = task.locatedblk().block().blockid();
+  {
+    std::lock_guard<std::mutex> lockReplication(mutexReplication);
+    if (blksInReplication.insert(bID).second == false) {
+      LOG_INFO << "Block " << bID << " is in replication already";
+      return;
+    }
   }
+  replicationPool.post([this, task, bID]() {
+    ++nActiveXfers;
+    int ret = task.operation() == OpCode::OP_RECONSTRUCT ? reconstructBlock(task)
+                                                         : replicateBlock(task.locatedblk());
+    --nActiveXfers;
+
+    std::lock_guard<std::mutex> lockReplication(mutexReplication);
+    blksInReplication.erase(bID);
+    if (ret == 0) {
+      LOG_INFO << "Succeed to replicate block: " << bID;
+      nReplicated->inc();
+    } else {
+      LOG_ERROR << "Failed to replicate block: " << bID;
+      blksFailedReplication.insert(bID);
+    }
+  });
+}
 
-  std::vector<int> blks(blksRecved.begin(), blksRecved.end());
-  int opRet = master->recvedBlks(chunkserverInfo, blks);
-  if (opRet == OpCode::OP_SUCCESS) {
-    blksRecved.clear();  
+void DFSChunkserver::removeBlks(const std::vector<int>& blkIDs) {
+  std::vector<std::vector<int>> removed(volumes.size());
+  {
+    std::lock_guard<std::mutex> lockBlksServed(mutexBlksServed);
+    for (int blkD : blkIDs) {
+      auto b = blksServed.find(blkD);
+      if (b != blksServed.end()) {
+        removed[b->second].push_back(blkD);
+        blksServed.erase(b);
+      }
+    }
+  }
+  for (size_t v = 0; v < volumes.size(); ++v) {
+    if (removed[v].empty()) {
+      continue;
+    }
+    LOG_INFO << "Removing " << (int)removed[v].size() << " blocks from " << volumes[v]->getDir();
+    if (-1 == volumes[v]->getStore().remove(removed[v])) {
+      LOG_ERROR << "Failed to remove blocks from " << volumes[v]->getDir();
+    }
   }
-  return opRet;
 }
 
 int DFSChunkserver::sendWriteHeader(const LocatedBlock& lb) {
@@ -8,15 +8,26 @@
 #define DFS_CHUNKSERVER_H_
 
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <string>
 #include <thread>
 #include <fstream>
 #include <chrono>
 #include <mutex>
+#include <atomic>
+#include <random>
+#include <map>
+#include <memory>
 
 #include <minidfs/chunkserver_protocol.hpp>
 #include <rpc/chunkserver_protocol_proxy.hpp>
 #include <threadpool/thread_pool.hpp>
+#include <minidfs/data_throttler.hpp>
+#include <minidfs/volume.hpp>
+#include "checksum/chunked_checksum.h"
+#include "metrics/registry.h"
 
 using std::string;
 
@@ -31,9 +42,17 @@ namespace minidfs {
 /// from clients/chunkservers. The second thread will fork a new thread
 /// each time to deal with the new-coming request.
 ///
+/// Blocks are stored in one or more volumes, usually one per disk. A request
+/// header is read by threadPool, then the data is transferred by the I/O
+/// workers of the volume holding the block.
+///
 /// Block writing request format:
-/// OP_WRITE : len(LocatedBlock) : LocatedBlock : len(data) : data
-/// 1 byte   : 2 bytes           : n bytes      : 8 bytes   : n bytes
+/// OP_WRITE : len(LocatedBlock) : LocatedBlock : len(data) : data    : crcs
+/// 1 byte   : 2 bytes           : n bytes      : 8 bytes   : n bytes : 4 bytes per 512 bytes of data
+///
+/// crcs are the CRC32C of each 512-byte chunk of data. Each chunkserver verifies
+/// them and stores them with the block in the store of its volume. They are sent
+/// with the data on reads and verified by the reader.
 ///
 /// Block reading request format:
 /// OP_READ  : len(Block) : Block 
@@ -53,18 +72,39 @@ class DFSChunkserver {
 
   ChunkserverInfo chunkserverInfo;
 
-  /// folder that stores the blocks
-  string dataDir;
-  /// store the block ids
-  std::set<int> blksServed;
+  /// data directories, usually one per disk
+  std::vector<std::unique_ptr<Volume>> volumes;
+  /// how a volume is chosen for a new block: "round-robin" or "available-space"
+  const string volumePolicy;
+  /// the next volume tried by round-robin
+  std::atomic<unsigned> nextVolume;
+
+  /// maps the served block ids to the index of their volumes
+  std::map<int, int> blksServed;
   /// a mutex for blksServed
   std::mutex mutexBlksServed;
 
   /// recently received blocks
   std::set<int> blksRecved;
-  /// a mutex for blksRecved
+  /// replicas found corrupt by the scrubber, reported in the next heartbeat
+  std::set<int> blksCorrupt;
+  /// a mutex for blksRecved and blksCorrupt
   std::mutex mutexBlksRecved;
 
+  /// number of block transfers in progress, reported in heartbeats
+  std::atomic<int> nActiveXfers;
+
+  /// bytes of the blocks received and sent, and the time of each transfer
+  metrics::Counter* bytesRecved;
+  metrics::Counter* bytesSent;
+  metrics::Histogram* recvLatency;
+  metrics::Histogram* sendLatency;
+
+  /// failed transfers, blocks replicated, and replicas found corrupt
+  metrics::Counter* nXferErrors;
+  metrics::Counter* nReplicated;
+  metrics::Counter* nCorrupt;
+
   /// block size
   long long blockSize;
 
@@ -74,7 +114,9 @@ class DFSChunkserver {
   /// heart beat interval, in ms
   const long long HEART_BEAT_INTERVAL;
 
-  /// block report interval, in ms
+  /// full block report interval, in ms. The 1st periodic report is delayed
+  /// randomly within the interval, so that reports from different chunkservers
+  /// are spread out. New blocks are reported by heartbeats in between.
   const long long BLOCK_REPORT_INTERVAL;
 
   /// at the startup, don't retrieve block tasks from master, in ms
@@ -83,6 +125,40 @@ class DFSChunkserver {
   /// thread pool
   ThreadPool threadPool;
 
+  /// bandwidth limit shared by all the replication tasks
+  DataThrottler replicationThrottler;
+
+  /// blocks queued or being replicated. Duplicated copy tasks are dropped.
+  std::set<int> blksInReplication;
+  /// blocks failed to be replicated, reported in the next heartbeat
+  std::set<int> blksFailedReplication;
+  /// a mutex for blksInReplication and blksFailedReplication
+  std::mutex mutexReplication;
+
+  /// thread pool running the replication tasks, off the heartbeat loop.
+  /// Its size is the number of concurrent copies.
+  ThreadPool replicationPool;
+
+  /// interval between two checkpoints of the block stores, in ms
+  const long long BLK_INDEX_INTERVAL;
+
+  /// bandwidth limit of the scrubber
+  DataThrottler scrubThrottler;
+
+  /// interval between two scrubbing passes, in ms
+  const long long SCRUB_PASS_INTERVAL;
+
+  /// how long the scrubber waits for the block transfers to finish, in ms
+  const long long SCRUB_YIELD_INTERVAL = 10;
+
+  /// max time the scrubber yields to the transfers per block, in ms. Past it
+  /// the block is read anyway, within scrubThrottler, so that a node always
+  /// busy with transfers is still scrubbed.
+  const long long SCRUB_MAX_YIELD = 1000;
+
+  /// blocks the scrubber read while transfers were running, in this pass
+  int nScrubYieldsExpired;
+
  public:
   /// \brief Create a DFSChunkserver.
   ///
@@ -90,22 +166,42 @@ class DFSChunkserver {
   /// \param masterPort the port of master
   /// \param serverIP IP of the chunkserver's host
   /// \param serverPort port of chunkserver
-  /// \param dataDir folder which contains the stored blocks
+  /// \param dataDirs folders which contain the stored blocks, one per volume
   /// \param blkSize preferred block size
   /// \param maxConnections the max connections from clients / other chunkservers
   /// \param BUFFER_SIZE the data sending/receiving buffer size
   /// \param nThread number of threads used by chunkserver to respond to clients
+  /// \param maxThread max number of threads responding to clients, nThread or less for a fixed number
+  /// \param maxQueueDelayMs more threads respond to clients when the transfers wait longer than it
   /// \param HEART_BEAT_INTERVAL heartbeat interval
   /// \param BLOCK_REPORT_INTERVAL block report interval
   /// \param BLK_TASK_STARTUP_INTERVAL time period before it is available to fetch block tasks
+  /// \param nReplicationThread number of concurrent replication tasks
+  /// \param replicationBandwidth total bandwidth of replication tasks in bytes/s, <= 0 for unlimited
+  /// \param storeOptions options of the block stores of the volumes
+  /// \param scrubBandwidth bandwidth of the scrubber in MB/s, <= 0 to disable it
+  /// \param SCRUB_PASS_INTERVAL interval between two scrubbing passes, in ms
+  /// \param BLK_INDEX_INTERVAL interval between two checkpoints of the block stores, in ms
+  /// \param nVolumeIOThread number of I/O workers of each volume
+  /// \param volumePolicy how a volume is chosen for a new block, "round-robin" or "available-space"
   DFSChunkserver(const string& masterIP, int masterPort,
                  const string& serverIP, int serverPort,
-                 const string& dataDir, long long blkSize,
+                 const std::vector<string>& dataDirs, long long blkSize,
                  int maxConnections, int BUFFER_SIZE,
-                 size_t nThread,
+                 size_t nThread, size_t maxThread, int maxQueueDelayMs,
                  long long HEART_BEAT_INTERVAL,
                  long long BLOCK_REPORT_INTERVAL,
-                 long long BLK_TASK_STARTUP_INTERVAL);
+                 long long BLK_TASK_STARTUP_INTERVAL,
+                 size_t nReplicationThread,
+                 long long replicationBandwidth,
+                 const StoreOptions& storeOptions,
+                 long long scrubBandwidth,
+                 long long SCRUB_PASS_INTERVAL,
+                 long long BLK_INDEX_INTERVAL,
+                 size_t nVolumeIOThread,
+                 const string& volumePolicy);
+
+  ~DFSChunkserver();
 
   /// \brief The chunkserver will run and exit only when this program is shut down.
   /// It provides services to clients to handle data writing/reading requests.
@@ -121,30 +217,70 @@ class DFSChunkserver {
 
 
  private:
-  /// \brief Scan the stored blocks.
+  /// \brief Scrubber thread method. It verifies the served blocks against their
+  /// checksums one pass every SCRUB_PASS_INTERVAL, within scrubThrottler.
+  /// The corrupt replicas are not served any more and reported to master,
+  /// which re-replicates them from the good ones.
+  void scrubber();
+
+  /// \brief Verify a block against its stored checksums. Reading pauses while
+  /// any block transfer is in progress, up to SCRUB_MAX_YIELD per block, and
+  /// the data read is dropped from the page cache, so that clients don't
+  /// compete with it.
+  /// Blocks stored without checksums get them.
+  ///
+  /// \param bID block id
+  /// \return return 0 if the block is intact, 1 if it is corrupt,
+  ///         -1 if it can't be read, e.g. it was removed.
+  int verifyBlk(int bID);
+
+  /// \brief Stop serving a corrupt replica, remove it and report it
+  /// in the next heartbeat.
+  void markCorrupt(int bID);
+
+  /// \brief Start the block stores of the volumes, and load the stored blocks.
   ///
   /// \return Opcode
   int scanStoredBlocks();
 
-  /// \brief Handle block reading/writing requests.
+  /// \brief Checkpoint the block stores, so that the next start is fast.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int saveBlkIndex();
+
+  /// \brief Handle block reading/writing requests. It reads the request header,
+  /// and submits the data transfer to the volume of the block.
   ///
   /// \param connfd the received socket fd
   void handleBlockRequest(int connfd);
 
+  /// \brief Find the volume of a served block.
+  ///
+  /// \return return the index of the volume, -1 if the block isn't served
+  int findVolume(int bID);
+
+  /// \brief Choose a volume with space for a new block, by volumePolicy.
+  ///
+  /// \return return the index of the volume, -1 if all of them are full
+  int chooseVolume();
+
   /// \brief Receive a block from client/chunkserver and forward it to other chunkservers
   /// if necessary. The chunkserver will response with the number of successful writes.
+  /// It responses 0 if the data doesn't match the checksums.
   ///
   /// Block writing request format:
-  /// OP_WRITE : len(LocatedBlock) : LocatedBlock : len(data) : data
-  /// 1 byte   : 2 bytes           : n bytes      : 8 bytes   : n bytes
+  /// OP_WRITE : len(LocatedBlock) : LocatedBlock : len(data) : data    : crcs
+  /// 1 byte   : 2 bytes           : n bytes      : 8 bytes   : n bytes : 4 bytes per chunk
   ///
   /// Response format:
   /// num(success):
   /// 1 byte      :
   ///
   /// \param connfd the received socket fd
+  /// \param lb the header of the request
+  /// \param vol the volume to store the block
   /// \return return 0 on success, -1 for errors
-  int recvBlock(int connfd);
+  int recvBlock(int connfd, const LocatedBlock& lb, int vol);
 
   /// \brief Send a block back to client. 
   ///
@@ -153,12 +289,17 @@ class DFSChunkserver {
   /// 1 byte   : 2 bytes    : n bytes
   ///
   /// Response format:
-  /// OpCode   : len(data) : data
-  /// 1 byte   : 8 bytes   : n bytes
+  /// OpCode   : len(data) : data    : crcs
+  /// 1 byte   : 8 bytes   : n bytes : 4 bytes per chunk
+  ///
+  /// If Block.extent is set, only that range is sent, widened to whole checksum
+  /// chunks so that the client can verify it.
   ///
   /// \param connfd the received socket fd
+  /// \param b the header of the request
+  /// \param vol the volume of the block
   /// \return return 0 on success, -1 for errors
-  int sendBlock(int connfd);
+  int sendBlock(int connfd, const Block& b, int vol);
 
   /// \brief This method is called when the chunkserver gets a block copy task
   /// from master. It sends a block to the targeted chunkservers.
@@ -167,8 +308,8 @@ class DFSChunkserver {
   /// Then it sends the data writing request and data to the remote.
   ///
   /// Block writing request format:
-  /// OP_WRITE : len(LocatedBlock) : LocatedBlock : len(data) : data
-  /// 1 byte   : 2 bytes           : n bytes      : 8 bytes   : n bytes
+  /// OP_WRITE : len(LocatedBlock) : LocatedBlock : len(data) : data    : crcs
+  /// 1 byte   : 2 bytes           : n bytes      : 8 bytes   : n bytes : 4 bytes per chunk
   ///
   /// Response format:
   /// num(success):
@@ -178,40 +319,60 @@ class DFSChunkserver {
   /// \return return 0 on success, -1 for errors
   int replicateBlock(const LocatedBlock& locatedB);
 
-  /// \brief Send heartbeat to Master.
+  /// \brief Rebuild a lost internal block of a block group from the other internal
+  /// blocks, and store it in a volume. It is reported to master like a received block.
   ///
-  /// \return return OpCode.
-  int heartBeat();
+  /// \param task OP_RECONSTRUCT task with the internal block and its block group
+  /// \return return 0 on success, -1 for errors
+  int reconstructBlock(const BlockTask& task);
 
-  /// \brief Send block report to master. It is revoked as the start of chunkserver.
-  /// And it is revoked every BLOCK_REPORT_PERIOD. It gets invalid blocks list and
-  /// delete them.
+  /// \brief Send heartbeat to Master, with the load, the blocks received and
+  /// the corrupt replicas found since the last heartbeat. Then execute the block tasks in the response.
+  ///
+  /// \param acceptBlkTasks whether master may assign replication tasks
+  /// \return return OpCode. OpCode::OP_BLK_REPORT_REQUIRED if the master
+  ///         asks for a full block report.
+  int heartBeat(bool acceptBlkTasks);
+
+  /// \brief Send block report to master. It is revoked when the master asks for it,
+  /// e.g. at the start of chunkserver. And it is revoked every BLOCK_REPORT_INTERVAL.
+  /// It gets invalid blocks list and delete them.
   /// 
   /// \return return OpCode.
   int blkReport();
 
-  /// \brief Get block tasks from master. Usually, they are copy tasks because some blocks
-  /// broke or some chunkservers died.
+  /// \brief Execute block tasks from master. Usually, they are copy tasks because
+  /// some blocks broke or some chunkservers died, or delete tasks for removed files.
+  /// Copy and reconstruction tasks are queued to replicationPool. The targets report the new replicas;
+  /// failed ones are reported in the next heartbeat, so that master reschedules them.
   /// 
   /// \return return OpCode.
-  int getBlkTask();
+  int execBlkTasks(const BlockTasks& blkTasks);
 
-  /// \brief Invoked when the chunkserver receives new blocks from clients/chunkservers.
-  /// 
-  /// \return return OpCode.
-  int recvedBlks();
+  /// \brief Queue a copy or reconstruction task to replicationPool, unless the block is
+  /// in replication already.
+  void queueReplication(const BlockTask& task);
+
+  /// \brief Stop serving the blocks, and remove them from the stores of their volumes.
+  /// The space is reclaimed in the background.
+  void removeBlks(const std::vector<int>& blkIDs);
 
  private:
   /// \brief Send block data to client/chunkserver through the connected socket.
   ///
   /// Block sending format:
-  /// len(data) : data
-  /// 8 bytes   : n bytes
+  /// len(data) : data    : crcs
+  /// 8 bytes   : n bytes : 4 bytes per chunk
   ///
   /// \param connfd connected socket fd, either from client or to another chunkserver
+  /// \param vol volume of the block
   /// \param bID ID of the block to be sent
   /// \return return 0 on success, -1 for errors
-  int sendBlkData(int connfd, int bID);
+  /// \param throttler limits the sending bandwidth, nullptr for unlimited
+  /// \param range the range to be sent, widened to whole checksum chunks,
+  ///        nullptr for the whole block
+  int sendBlkData(int connfd, int vol, int bID, DataThrottler* throttler,
+                  const Extent* range = nullptr);
 
   /// \brief Connect the remote Chunkserver.
   ///
@@ -7,24 +7,109 @@
 #include <minidfs/dfs_client.hpp>
 #include "logging/logger.h"
 
+#include <sys/stat.h>
+
 namespace minidfs {
 
 DFSClient::DFSClient(const string& serverIP, int serverPort, int buf,
-                     const string& bufferBlkName, const long long blockSize)
+                     const string& bufferBlkName, const long long blockSize,
+                     const long long inlineThreshold)
     : master(new rpc::ClientProtocolProxy(serverIP, serverPort)),
       masterIP(serverIP), masterPort(serverPort), BUFFER_SIZE(buf),
-      bufferBlkName(bufferBlkName), blockSize(blockSize) {
+      bufferBlkName(bufferBlkName), blockSize(blockSize),
+      inlineThreshold(inlineThreshold) {
 }
 
 DFSClient::~DFSClient() {
 }
 
 int DFSClient::putFile(const string& src, const string& dst) {
+  struct stat st;
+  if (inlineThreshold > 0 && ::stat(src.c_str(), &st) == 0 && st.st_size <= inlineThreshold) {
+    std::ifstream f(src, std::ios::in | std::ios::binary);
+    if (f.is_open() == false) {
+      LOG_ERROR << "Failed to open " << src;
+      return -1;
+    }
+    InlineFile file;
+    file.set_name(dst);
+    file.set_data(string((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>()));
+    int retOp = master->createInline(file);
+    if (retOp == OpCode::OP_SUCCESS) {
+      return 0;
+    }
+    /// the master refuses a file longer than its own limit, write it as usual
+    if (retOp != OpCode::OP_FAILURE) {
+      LOG_ERROR  << "Failed to create " << dst
+           << "Error code "  << retOp;
+      return -1;
+    }
+  }
+
   RemoteWriter writer(masterIP, masterPort, dst, BUFFER_SIZE, 2,
                       blockSize, bufferBlkName);
   if (-1 == writer.open()){
     return -1;
   }
+  return writeFrom(writer, src);
+}
+
+int DFSClient::putFileEC(const string& src, const string& dst, const ECSchema& schema) {
+  RemoteWriter writer(masterIP, masterPort, dst, BUFFER_SIZE, 2,
+                      blockSize, bufferBlkName);
+  if (-1 == writer.open(schema)){
+    return -1;
+  }
+  return writeFrom(writer, src);
+}
+
+int DFSClient::putFileCompressed(const string& src, const string& dst,
+                                 compression::Codec codec) {
+  RemoteWriter writer(masterIP, masterPort, dst, BUFFER_SIZE, 2,
+                      blockSize, bufferBlkName);
+  if (-1 == writer.open(codec)){
+    return -1;
+  }
+  return writeFrom(writer, src);
+}
+
+int DFSClient::putSmallFiles(const std::vector<string>& srcs, const string& dstDir) {
+  RemoteWriter writer = getWriter(dstDir);
+  Pack pack;
+  string data;
+  for (const auto& src : srcs) {
+    string dst = dstDir + (dstDir.back() == '/' ? "" : "/") + src.substr(src.find_last_of('/') + 1);
+    std::ifstream f(src, std::ios::in | std::ios::binary);
+    if (f.is_open() == false) {
+      LOG_ERROR << "Failed to open " << src;
+      return -1;
+    }
+    string content((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    if ((long long)content.size() > blockSize) {
+      if (-1 == putFile(src, dst)) {
+        return -1;
+      }
+      continue;
+    }
+    if ((long long)(data.size() + content.size()) > blockSize) {
+      if (-1 == writer.writePack(pack, data)) {
+        return -1;
+      }
+      pack.Clear();
+      data.clear();
+    }
+    PackedFile* file = pack.add_files();
+    file->set_name(dst);
+    file->set_len(content.size());
+    data += content;
+  }
+  if (pack.files_size() > 0 && -1 == writer.writePack(pack, data)) {
+    return -1;
+  }
+  return 0;
+}
+
+int DFSClient::writeFrom(RemoteWriter& writer, const string& src) {
   std::ifstream f(src, std::ios::in | std::ios::binary);
   if (f.is_open() == false) {
     LOG_ERROR << "Failed to open " << src;
@@ -90,8 +175,8 @@ int DFSClient::remove(const string& filename) {
 
 int DFSClient::exists(const string& file) {
   int retOp =  master->exists(file);
-  if (retOp == OpCode::OP_FAILURE) {
-    LOG_ERROR  << "Failed to query " << file;
+  if (retOp != OpCode::OP_EXIST && retOp != OpCode::OP_NOT_EXIST) {
+    LOG_ERROR  << "Failed to query " << file << " Error code " << retOp;
     return -1;
   }
   if (retOp == OpCode::OP_EXIST) {
@@ -128,5 +213,15 @@ int DFSClient::ls(const string& dirname, std::vector<FileInfo>& items) {
   return 0;
 }
 
+int DFSClient::serverStats(ServerStats& stats) {
+  int retOp = master->getServerStats(&stats);
+  if (retOp != OpCode::OP_SUCCESS) {
+    LOG_ERROR  << "Failed to get the server stats "
+         << "Error code "  << retOp;
+    return -1;
+  }
+  return 0;
+}
+
 } // namespace minidfs
 
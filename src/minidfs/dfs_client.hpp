@@ -47,22 +47,55 @@ class DFSClient {
 
   const long long blockSize;
 
+  /// files up to this length are stored inline in the master, 0 to disable
+  const long long inlineThreshold;
+
  public:
  
   /// \brief Create a DFSClient given the Master's IP and port.
   DFSClient(const string& serverIP, int serverPort, int buf,
-            const string& bufferBlkName, const long long blockSize);
+            const string& bufferBlkName, const long long blockSize,
+            const long long inlineThreshold = 0);
 
   ~DFSClient();
 
 
-  /// \brief Put a local file to the distributed file system
+  /// \brief Put a local file to the distributed file system.
+  /// A file no longer than inlineThreshold is stored inline in the master
+  /// with a single call, unless the master refuses it.
   ///
   /// \param src source file in local fs
   /// \param dst target file in dfs
   /// \return return 0 on success, -1 for errors
   int putFile(const string& src, const string& dst);
 
+  /// \brief Put a local file to the distributed file system as an
+  /// erasure-coded file
+  ///
+  /// \param src source file in local fs
+  /// \param dst target file in dfs
+  /// \param schema the layout of the block groups
+  /// \return return 0 on success, -1 for errors
+  int putFileEC(const string& src, const string& dst, const ECSchema& schema);
+
+  /// \brief Put a local file to the distributed file system, with its
+  /// blocks compressed
+  ///
+  /// \param src source file in local fs
+  /// \param dst target file in dfs
+  /// \param codec the codec of the blocks
+  /// \return return 0 on success, -1 for errors
+  int putFileCompressed(const string& src, const string& dst, compression::Codec codec);
+
+  /// \brief Put local files into a dfs directory, packing the small ones into
+  /// shared container blocks of up to blockSize bytes. Files larger than that
+  /// are put as usual.
+  ///
+  /// \param srcs source files in local fs
+  /// \param dstDir target directory in dfs, the files keep their base names
+  /// \return return 0 on success, -1 for errors
+  int putSmallFiles(const std::vector<string>& srcs, const string& dstDir);
+
   /// \brief Copy a file in the distributed file system to the local fs
   ///
   /// \param src source file in dfs
@@ -110,6 +143,19 @@ class DFSClient {
   /// \return return 0 on success, -1 for errors
   int ls(const string& dirname, std::vector<FileInfo>& items);
 
+  /// \brief Get the statistics of the master's RPC server
+  ///
+  /// \param stats the queue depth and the calls handled of each lane
+  /// \return return 0 on success, -1 for errors
+  int serverStats(ServerStats& stats);
+
+ private:
+  /// \brief Write a local file with an opened writer, and close it.
+  ///
+  /// \param writer the opened writer
+  /// \param src source file in local fs
+  /// \return return 0 on success, -1 for errors
+  int writeFrom(RemoteWriter& writer, const string& src);
 };
 
 
@@ -6,18 +6,50 @@
 
 
 #include <minidfs/dfs_master.hpp>
+#include <minidfs/ec_block_group.hpp>
 #include "logging/logger.h"
 
 namespace minidfs {
 
 DFSMaster::DFSMaster(const string& nameSysFile, const string& editLogFile,
-                     int serverPort, int maxConns, int replicationFactor, size_t nThread)
+                     int serverPort, int maxConns, int replicationFactor, size_t nThread,
+                     size_t nChunkserverThread, int maxInlineSize, int maxQueuedCalls,
+                     int busyRetryMs, size_t maxThread, int maxQueueDelayMs,
+                     size_t nReaderThread)
     : nameSysFile(nameSysFile), editLogFile(editLogFile),
-      server(serverPort, maxConns, this, nThread), replicationFactor(replicationFactor) {
+      server(serverPort, maxConns, this, nThread, nChunkserverThread, maxQueuedCalls, busyRetryMs,
+             maxThread, maxQueueDelayMs, nReaderThread),
+      replicationFactor(replicationFactor),
+      maxInlineSize(maxInlineSize), nFiles(0), nBlks(0), nChunkservers(0),
+      nBlksToBeReplicated(0) {
   editlogID = 0;
+
+  auto registry = metrics::Registry::global();
+  editBytes = registry->counter("master.editlog.bytes");
+  editLatency = registry->histogram("master.editlog.us");
+  nHeartbeats = registry->counter("master.heartbeats");
+  nBlkReports = registry->counter("master.blockreports");
+  /// the sizes are published on mutation, so that reading them takes no lock
+  registry->gauge_fn("master.files", [this]() -> int64_t {
+    return nFiles.load(std::memory_order_relaxed);
+  });
+  registry->gauge_fn("master.blocks", [this]() -> int64_t {
+    return nBlks.load(std::memory_order_relaxed);
+  });
+  registry->gauge_fn("master.chunkservers", [this]() -> int64_t {
+    return nChunkservers.load(std::memory_order_relaxed);
+  });
+  registry->gauge_fn("master.blocks.underreplicated", [this]() -> int64_t {
+    return nBlksToBeReplicated.load(std::memory_order_relaxed);
+  });
 }
 
 DFSMaster::~DFSMaster() {
+  auto registry = metrics::Registry::global();
+  registry->remove_gauge_fn("master.files");
+  registry->remove_gauge_fn("master.blocks");
+  registry->remove_gauge_fn("master.chunkservers");
+  registry->remove_gauge_fn("master.blocks.underreplicated");
 }
 
 int DFSMaster::format() {
@@ -43,7 +75,15 @@ int DFSMaster::format() {
     currentMaxBlkID = 0;
 
     blks.clear();
+    blkGroups.clear();
+    blkGroupOf.clear();
+    packedFiles.clear();
+    containerRefs.clear();
+    inlineFiles.clear();
     blkLocs.clear();
+    chunkserverBlks.clear();
+    blksToBeDeleted.clear();
+    publishNameSysSizes();
 
     /// clear editlog
     editlogID = 0;
@@ -124,9 +164,14 @@ void DFSMaster::statusChecker() {
           } else {
             LOG_WARN << "Lost connection with " << i->first.chunkserverip();
             findBlksToBeReplicated(i->first);
+            /// its full report on rejoining tells what to delete
+            blksToBeDeleted.erase(i->first);
+            chunkserverLoads.erase(i->first);
+            chunkserverAvailable.erase(i->first);
             i = aliveChunkservers.erase(i);
           }
         }
+        publishChunkserverSizes();
         LOG_INFO << numAliveChunkservers << " chunkservers alive";
       }
 
@@ -165,9 +210,39 @@ int DFSMaster::getBlockLocations(const string& file, minidfs::LocatedBlocks* loc
     return OpCode::OP_NO_SUCH_FILE;
   }
 
+  auto inlined = inlineFiles.find(dfid);
+  if (inlined != inlineFiles.end()) {
+    locatedBlks->set_inlinedata(inlined->second);
+    return OpCode::OP_SUCCESS;
+  }
+
+  /// a packed small file is an extent of its container block
+  auto packed = packedFiles.find(dfid);
+  if (packed != packedFiles.end()) {
+    auto locatedblk = locatedBlks->add_locatedblks();
+    *locatedblk->mutable_block() = packed->second;
+    for (const auto& cs : blkLocs[packed->second.blockid()]) {
+      *locatedblk->add_chunkserverinfos() = cs;
+    }
+    return OpCode::OP_SUCCESS;
+  }
+
   /// Set the return value
   for (int inodeid : inodes[dfid]) {
     auto locatedblk = locatedBlks->add_locatedblks();
+    auto group = blkGroups.find(inodeid);
+    if (group != blkGroups.end()) {
+      /// the location of each internal block, empty if it is lost
+      *locatedblk->mutable_block() = group->second;
+      for (int i = 0; i < ECBlockGroup::nBlks(group->second); ++i) {
+        auto chunkserverinfo = locatedblk->add_chunkserverinfos();
+        auto locs = blkLocs.find(ECBlockGroup::internalBlkID(group->second, i));
+        if (locs != blkLocs.end() && locs->second.empty() == false) {
+          *chunkserverinfo = locs->second.front();
+        }
+      }
+      continue;
+    }
     auto blk = locatedblk->mutable_block();
     *blk = blks[inodeid];
 
@@ -181,6 +256,28 @@ int DFSMaster::getBlockLocations(const string& file, minidfs::LocatedBlocks* loc
 }
 
 int DFSMaster::create(const string& file, LocatedBlock* locatedBlk) {
+  return create(file, locatedBlk, string());
+}
+
+int DFSMaster::create(const string& file, LocatedBlock* locatedBlk, const string& writerIP) {
+  return createFile(file, nullptr, locatedBlk, writerIP);
+}
+
+int DFSMaster::createEC(const string& file, const ECSchema& schema, LocatedBlock* locatedBlk) {
+  return createEC(file, schema, locatedBlk, string());
+}
+
+int DFSMaster::createEC(const string& file, const ECSchema& schema, LocatedBlock* locatedBlk,
+                        const string& writerIP) {
+  if (ECBlockGroup::isValidSchema(schema) == false) {
+    LOG_INFO  << "Invalid erasure coding schema " << schema.DebugString();
+    return OpCode::OP_FAILURE;
+  }
+  return createFile(file, &schema, locatedBlk, writerIP);
+}
+
+int DFSMaster::createFile(const string& file, const ECSchema* schema, LocatedBlock* locatedBlk,
+                          const string& writerIP) {
   std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
 
   std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
@@ -211,29 +308,23 @@ int DFSMaster::create(const string& file, LocatedBlock* locatedBlk) {
   /// When the master receives the complete() RPC call, it
   /// finalizes the file into the namesystem and assigns a new
   /// DfID to the newly created file.
-  
-  int newBlkid = ++currentMaxBlkID;
-  filesInCreating[file] = std::vector<int>{newBlkid};
-
-  auto retblock = locatedBlk->mutable_block();
-  retblock->set_blockid(newBlkid);
-  retblock->set_blocklen(0);
-
-  std::vector<ChunkserverInfo> allocatedCS;
-  if (-1 == allocateChunkservers(allocatedCS)) {
-    LOG_INFO  << "Chunkservers alive are fewer than replication factor";
-    return OpCode::OP_FAILURE;
+  filesInCreating[file] = std::vector<int>();
+  if (schema != nullptr) {
+    ecFilesInCreating[file] = *schema;
   }
 
-  for (const auto& cs : allocatedCS) {
-    *locatedBlk->add_chunkserverinfos() = cs;
+  int retOp = allocateBlk(file, locatedBlk, writerIP);
+  if (retOp == OpCode::OP_SUCCESS) {
+    LOG_INFO  << "A file is in creating";
   }
-
-  LOG_INFO  << "A file is in creating";
-  return OpCode::OP_SUCCESS;
+  return retOp;
 }
 
 int DFSMaster::addBlock(const string& file, LocatedBlock* locatedBlk) {
+  return addBlock(file, locatedBlk, string());
+}
+
+int DFSMaster::addBlock(const string& file, LocatedBlock* locatedBlk, const string& writerIP) {
   std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
   std::unique_lock<std::recursive_mutex> lockInCreating(mutexInCreating, std::defer_lock);
 
@@ -244,26 +335,12 @@ int DFSMaster::addBlock(const string& file, LocatedBlock* locatedBlk) {
     LOG_INFO  << file << " isn't in creating";
     return OpCode::OP_NO_SUCH_FILE;
   }
-  
-  int newBlkid = ++currentMaxBlkID;
-  filesInCreating[file].push_back(newBlkid);
-
-  auto retblock = locatedBlk->mutable_block();
-  retblock->set_blockid(newBlkid);
-  retblock->set_blocklen(0);
-
-  std::vector<ChunkserverInfo> allocatedCS;
-  if (-1 == allocateChunkservers(allocatedCS)) {
-    LOG_INFO  << "Chunkservers alive are fewer than replication factor";
-    return OpCode::OP_FAILURE;
-  }
 
-  for (const auto& cs : allocatedCS) {
-    *locatedBlk->add_chunkserverinfos() = cs;
+  int retOp = allocateBlk(file, locatedBlk, writerIP);
+  if (retOp == OpCode::OP_SUCCESS) {
+    LOG_INFO  << "A block is to be added to " << file;
   }
-
-  LOG_INFO  << "A block is to be added to " << file;
-  return OpCode::OP_SUCCESS;
+  return retOp;
 }
 
 int DFSMaster::blockAck(const LocatedBlock& locatedBlk) {
@@ -310,20 +387,46 @@ int DFSMaster::complete(const string& file) {
     }
     inodes[newDfID].push_back(b);
     const auto lb = blocksInCreating[b];
-    blks[b] = lb.block();    
     /// blkLocs are reported by chunkservers
-
-    if (lb.chunkserverinfos_size() < replicationFactor) {
-      blksToBeReplicated[b] = replicationFactor - lb.chunkserverinfos_size();
+    if (lb.block().has_ecschema()) {
+      addBlkGroup(lb.block());
+      /// the internal blocks failed to be written are reconstructed
+      for (int i = 0; i < ECBlockGroup::nBlks(lb.block()); ++i) {
+        if (i >= lb.chunkserverinfos_size() || lb.chunkserverinfos(i).chunkserverip().empty()) {
+          blksToBeReplicated[ECBlockGroup::internalBlkID(lb.block(), i)] = 1;
+        }
+      }
+    } else {
+      blks[b] = lb.block();
+      if (lb.chunkserverinfos_size() < replicationFactor) {
+        blksToBeReplicated[b] = replicationFactor - lb.chunkserverinfos_size();
+      }
     }
     /// the block is created successfully and is removed from
     /// blocksInCreating
     blocksInCreating.erase(b);
   }
+  /// with the internal blocks of the groups, acked or not
+  auto ec = ecFilesInCreating.find(file);
+  for (int b : fileBlks) {
+    blkIDsInCreating.erase(b);
+    if (ec == ecFilesInCreating.end()) {
+      continue;
+    }
+    Block group;
+    group.set_blockid(b);
+    *group.mutable_ecschema() = ec->second;
+    for (int i = 0; i < ECBlockGroup::nBlks(group); ++i) {
+      blkIDsInCreating.erase(ECBlockGroup::internalBlkID(group, i));
+    }
+  }
 
   /// the file is created successfully and is removed from
   /// filesInCreating
   filesInCreating.erase(file);
+  ecFilesInCreating.erase(file);
+  publishNameSysSizes();
+  publishChunkserverSizes();
 
   /// log the edit to disk
   EditLog editlog;
@@ -331,7 +434,7 @@ int DFSMaster::complete(const string& file) {
   editlog.set_src(file);
   editlog.set_dfid(newDfID);
   for (int b : inodes[newDfID]) {
-    *editlog.add_blks() = blks[b];
+    *editlog.add_blks() = getFileBlk(b);
   }
   if (-1 == logEdit(editlog.SerializeAsString())) {
     LOG_INFO << "Failed to create " << file;
@@ -342,8 +445,187 @@ int DFSMaster::complete(const string& file) {
   return OpCode::OP_SUCCESS;
 }
 
+int DFSMaster::createPack(const Pack& pack, LocatedBlock* locatedBlk) {
+  return createPack(pack, locatedBlk, string());
+}
+
+int DFSMaster::createPack(const Pack& pack, LocatedBlock* locatedBlk, const string& writerIP) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockInCreating(mutexInCreating, std::defer_lock);
+
+  std::lock(lockMemoryNameSys, lockChunkserverBlock, lockInCreating);
+  if (pack.files_size() == 0) {
+    LOG_INFO  << "Empty pack";
+    return OpCode::OP_FAILURE;
+  }
+  std::set<string> names;
+  for (const auto& f : pack.files()) {
+    if (dfIDs.find(f.name()) != dfIDs.end()) {
+      LOG_INFO  << f.name() << " existed!";
+      return OpCode::OP_FILE_ALREADY_EXISTED;
+    }
+    string dir;
+    splitPath(f.name(), dir);
+    if (dfIDs.find(dir) == dfIDs.end()) {
+      LOG_INFO  << "Dir " << dir << " does not exist!";
+      return OpCode::OP_NO_SUCH_FILE;
+    }
+    if (filesInCreating.find(f.name()) != filesInCreating.end()
+        || names.insert(f.name()).second == false) {
+      LOG_INFO  << f.name() << " is in creating";
+      return OpCode::OP_FILE_IN_CREATING;
+    }
+    if (f.len() < 0) {
+      return OpCode::OP_FAILURE;
+    }
+  }
+
+  std::vector<ChunkserverInfo> allocatedCS;
+  if (-1 == allocateChunkservers(allocatedCS, writerIP, replicationFactor)) {
+    LOG_INFO  << "Chunkservers alive are fewer than replication factor";
+    return OpCode::OP_FAILURE;
+  }
+  int containerID = ++currentMaxBlkID;
+  auto retblock = locatedBlk->mutable_block();
+  retblock->set_blockid(containerID);
+  retblock->set_blocklen(0);
+  for (const auto& cs : allocatedCS) {
+    *locatedBlk->add_chunkserverinfos() = cs;
+  }
+
+  for (const auto& f : pack.files()) {
+    filesInCreating[f.name()] = std::vector<int>{containerID};
+  }
+  blkIDsInCreating.insert(containerID);
+  Pack& packInCreating = packsInCreating[containerID];
+  *packInCreating.mutable_files() = pack.files();
+  LOG_INFO  << pack.files_size() << " files are in creating in container block " << containerID;
+  return OpCode::OP_SUCCESS;
+}
+
+int DFSMaster::completePack(const Pack& pack) {
+  std::unique_lock<std::recursive_mutex> lockFileNameSys(mutexFileNameSys, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
+  
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockInCreating(mutexInCreating, std::defer_lock);
+
+  std::lock(lockFileNameSys, lockMemoryNameSys, lockChunkserverBlock, lockInCreating);
+  const LocatedBlock& container = pack.container();
+  int containerID = container.block().blockid();
+  auto inCreating = packsInCreating.find(containerID);
+  if (inCreating == packsInCreating.end()) {
+    LOG_INFO  << "Container block " << containerID << " isn't in creating";
+    return OpCode::OP_NO_SUCH_FILE;
+  }
+  const Pack files = inCreating->second;
+  long long packLen = 0;
+  for (const auto& f : files.files()) {
+    packLen += f.len();
+  }
+  if (container.chunkserverinfos_size() == 0 || container.block().blocklen() != packLen) {
+    LOG_INFO  << "Container block " << containerID << " was not written";
+    packsInCreating.erase(inCreating);
+    blkIDsInCreating.erase(containerID);
+    for (const auto& f : files.files()) {
+      filesInCreating.erase(f.name());
+    }
+    return OpCode::OP_FAILURE;
+  }
+
+  /// the files follow each other in the container, and are logged in one edit
+  /// before any of them is created, so that all or none of them are
+  EditLog editlog;
+  editlog.set_op(OpCode::OP_CREATE_PACK);
+  long long offset = 0;
+  int newDfID = currentMaxDfID;
+  for (const auto& f : files.files()) {
+    EditLog* create = editlog.add_creates();
+    create->set_op(OpCode::OP_CREATE);
+    create->set_src(f.name());
+    create->set_dfid(++newDfID);
+    Block* blk = create->add_blks();
+    *blk = container.block();
+    blk->mutable_extent()->set_offset(offset);
+    blk->mutable_extent()->set_len(f.len());
+    offset += f.len();
+  }
+  if (-1 == logEdit(editlog.SerializeAsString())) {
+    /// the pack stays in creating, for the client to complete it again
+    LOG_INFO << "Failed to create the files in container block " << containerID;
+    return OpCode::OP_LOG_FAILURE;
+  }
+  editlogID++;
+
+  packsInCreating.erase(inCreating);
+  blkIDsInCreating.erase(containerID);
+  for (const auto& create : editlog.creates()) {
+    filesInCreating.erase(create.src());
+    applyCreate(create);
+  }
+  /// blkLocs are reported by chunkservers
+  if (container.chunkserverinfos_size() < replicationFactor) {
+    blksToBeReplicated[containerID] = replicationFactor - container.chunkserverinfos_size();
+  }
+  publishNameSysSizes();
+  publishChunkserverSizes();
+  LOG_INFO  << files.files_size() << " files created in container block " << containerID;
+  return OpCode::OP_SUCCESS;
+}
+
+int DFSMaster::createInline(const InlineFile& file) {
+  std::unique_lock<std::recursive_mutex> lockFileNameSys(mutexFileNameSys, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockInCreating(mutexInCreating, std::defer_lock);
+
+  std::lock(lockFileNameSys, lockMemoryNameSys, lockInCreating);
+  if ((long long)file.data().size() > maxInlineSize) {
+    LOG_INFO  << file.name() << " is too large to be stored inline";
+    return OpCode::OP_FAILURE;
+  }
+  if (dfIDs.find(file.name()) != dfIDs.end()) {
+    LOG_INFO  << file.name() << " existed!";
+    return OpCode::OP_FILE_ALREADY_EXISTED;
+  }
+
+  string dir;
+  splitPath(file.name(), dir);
+  if (dfIDs.find(dir) == dfIDs.end()) {
+    LOG_INFO  << "Dir " << dir << " does not exist!";
+    return OpCode::OP_NO_SUCH_FILE;
+  }
+  if (filesInCreating.find(file.name()) != filesInCreating.end()) {
+    LOG_INFO  << "File is in creating";
+    return OpCode::OP_FILE_IN_CREATING;
+  }
+
+  int newDfID = ++currentMaxDfID;
+  dfIDs[file.name()] = newDfID;
+  dfNames[newDfID] = file.name();
+  dentries[dfIDs[dir]].push_back(newDfID);
+  inodes[newDfID] = std::vector<int>();
+  inlineFiles[newDfID] = file.data();
+  publishNameSysSizes();
+
+  EditLog editlog;
+  editlog.set_op(OpCode::OP_CREATE);
+  editlog.set_src(file.name());
+  editlog.set_dfid(newDfID);
+  editlog.set_inlinedata(file.data());
+  if (-1 == logEdit(editlog.SerializeAsString())) {
+    LOG_INFO << "Failed to create " << file.name();
+    return OpCode::OP_LOG_FAILURE;
+  }
+  editlogID++;
+  LOG_INFO  << file.name() << " created inline";
+  return OpCode::OP_SUCCESS;
+}
+
 int DFSMaster::remove(const string& file) {
-  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys);
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
+  std::lock(lockMemoryNameSys, lockChunkserverBlock);
 
   if (dfIDs.find(file) == dfIDs.end()) {
     LOG_INFO  << file << " doesn't exist!";
@@ -378,11 +660,26 @@ int DFSMaster::remove(const string& file) {
   }
 
   /// delete the corresponding inode
+  inlineFiles.erase(dfid);
   auto& blockvec = inodes[dfid];
+  if (packedFiles.find(dfid) != packedFiles.end()) {
+    dropPackedFile(dfid);
+    blockvec.clear();
+  }
   for (int b : blockvec) {
-    blks.erase(b);
+    auto group = blkGroups.find(b);
+    if (group != blkGroups.end()) {
+      for (int i = 0; i < ECBlockGroup::nBlks(group->second); ++i) {
+        forgetBlk(ECBlockGroup::internalBlkID(group->second, i));
+      }
+      dropBlkGroup(b);
+    } else {
+      forgetBlk(b);
+    }
   }
   inodes.erase(dfid);
+  publishNameSysSizes();
+  publishChunkserverSizes();
 
   /// log the edit to disk
   EditLog editlog;
@@ -434,6 +731,7 @@ int DFSMaster::makeDir(const string& dirName) {
   int dirID = dfIDs[dir];
   dentries[dirID].push_back(newDfID);
   dentries[newDfID] = std::vector<int>();
+  publishNameSysSizes();
 
   /// log the edit to disk
   EditLog editlog;
@@ -479,106 +777,138 @@ int DFSMaster::listDir(const string& dirName, FileInfos& items) {
 
 }
 
-int DFSMaster::heartBeat(const ChunkserverInfo& chunkserverInfo) {
-  LOG_INFO << "Heartbeat from: " << chunkserverInfo.DebugString();
-  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock);
-  //int id = getChunkserverID(chunkserverInfo);
-
-  aliveChunkservers[chunkserverInfo] = true;
-  /// TODO: xiw, is returning value here useless?
+int DFSMaster::getServerStats(ServerStats* stats) {
+  server.getStats(stats);
   return OpCode::OP_SUCCESS;
 }
 
-int DFSMaster::blkReport(const ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs, std::vector<int>& deletedBlks) {
+int DFSMaster::heartBeat(const Heartbeat& heartbeat, BlockTasks* blkTasks) {
+  const ChunkserverInfo& chunkserverInfo = heartbeat.chunkserverinfo();
+  LOG_DEBUG << "Heartbeat from: " << heartbeat.DebugString();
+  nHeartbeats->inc();
+  /// most heartbeats only update the chunkserver state, under the block lock
   std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock);
 
-  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
-  std::lock(lockMemoryNameSys, lockChunkserverBlock);
-
-  //int id = getChunkserverID(chunkserverInfo);
   aliveChunkservers[chunkserverInfo] = true;
-  for (int blockid : blkIDs) {
-    /// all valid blocks should appear in blks
+  publishChunkserverSizes();
+  chunkserverLoads[chunkserverInfo] = heartbeat.nactivexfers();
+  if (heartbeat.volumes_size() > 0) {
+    long long available = 0;
+    for (const auto& v : heartbeat.volumes()) {
+      available += v.available();
+    }
+    chunkserverAvailable[chunkserverInfo] = available;
+  }
+  /// no block report received yet, e.g. master restarted or it was considered dead.
+  /// The received blocks will be included in the full report.
+  if (chunkserverBlks.find(chunkserverInfo) == chunkserverBlks.end()) {
+    LOG_INFO << "Ask for block report from " << chunkserverInfo.chunkserverip()
+             << ":" << chunkserverInfo.chunkserverport();
+    return OpCode::OP_BLK_REPORT_REQUIRED;
+  }
+  /// the piggybacked blocks and the block tasks are checked against the namespace
+  bool needNameSys = heartbeat.recvedblkids_size() > 0 || heartbeat.corruptblkids_size() > 0 ||
+                     heartbeat.failedblkids_size() > 0 ||
+                     (heartbeat.acceptblktasks() && blksToBeReplicated.empty() == false);
+  if (needNameSys) {
+    /// both locks, in the locking order
+    lockChunkserverBlock.unlock();
+    std::lock(lockMemoryNameSys, lockChunkserverBlock);
+    /// it was considered dead in between
+    if (chunkserverBlks.find(chunkserverInfo) == chunkserverBlks.end()) {
+      return OpCode::OP_BLK_REPORT_REQUIRED;
+    }
+  }
+  /// a corrupt replica may be received again later, so it goes first
+  auto& known = chunkserverBlks[chunkserverInfo];
+  for (int blockid : heartbeat.corruptblkids()) {
+    LOG_WARN << "Corrupt replica of block " << blockid << " on "
+             << chunkserverInfo.chunkserverip() << ":" << chunkserverInfo.chunkserverport();
+    if (known.erase(blockid) == 0) {
+      continue;
+    }
+    removeBlkLoc(blockid, chunkserverInfo);
+    if (blks.find(blockid) != blks.end()) {
+      blksToBeReplicated[blockid]++;
+    }
+  }
+  addRecvedBlks(chunkserverInfo, heartbeat);
+  /// reschedule the failed replications with the replicas still missing
+  for (int blockid : heartbeat.failedblkids()) {
     if (blks.find(blockid) == blks.end()) {
-      deletedBlks.push_back(blockid);
       continue;
     }
-    /// confirm the blkLocs
-    if (blkLocs.find(blockid) == blkLocs.end()) {
-      blkLocs[blockid].push_back(chunkserverInfo);
-    } else {
-      int contained = 0;
-      auto csEqualTo = ChunkserverInfoEqualTo();
-      for (const auto& cs : blkLocs[blockid]) {
-        if (csEqualTo(cs, chunkserverInfo)) {
-          contained = 1;
-          break;
-        }
-      }
-      if (contained == 0) {
-        blkLocs[blockid].push_back(chunkserverInfo);
-      }
+    auto locs = blkLocs.find(blockid);
+    int nMissing = nTargetReplicas(blockid) - (locs == blkLocs.end() ? 0 : (int)locs->second.size());
+    if (nMissing > 0) {
+      blksToBeReplicated[blockid] = nMissing;
     }
-
   }
+  assignBlkTasks(chunkserverInfo, heartbeat.acceptblktasks(), blkTasks);
+  publishChunkserverSizes();
   return OpCode::OP_SUCCESS;
 }
 
-int DFSMaster::getBlkTask(const ChunkserverInfo& chunkserverInfo, BlockTasks* blkTasks) {
-  LOG_INFO << "Get block tasks from " << chunkserverInfo.DebugString();
-  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock);
-  //int id = getChunkserverID(chunkserverInfo);
-  auto csEqualTo = ChunkserverInfoEqualTo();
-  bool hasTask = false;
-  LOG_INFO << "Number of blks to be rep: " << blksToBeReplicated.size();
-  for (auto b = blksToBeReplicated.begin(); b != blksToBeReplicated.end();) {
-    bool assignmentStatus = false;
-    for (auto& node : blkLocs[b->first]) {
-      if ( csEqualTo(node, chunkserverInfo) ) {
-        distributeBlkTask(b->first, b->second, blkTasks->add_blktasks());
-        b = blksToBeReplicated.erase(b);
-        assignmentStatus = true;
-        hasTask = true;
-        break;
-      }
-    }
-    if (assignmentStatus == false) {
-      ++b;
-    }
+int DFSMaster::blkReport(const ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs, std::vector<int>& deletedBlks) {
+  nBlkReports->inc();
+  std::vector<int> reported(blkIDs);
+  if (std::is_sorted(reported.begin(), reported.end()) == false) {
+    std::sort(reported.begin(), reported.end());
   }
-  if (hasTask)
-    LOG_INFO << "Master assign block task: " << blkTasks->DebugString();
-  return hasTask ? OpCode::OP_SUCCESS : OpCode::OP_NO_BLK_TASK;
-}
+  reported.erase(std::unique(reported.begin(), reported.end()), reported.end());
 
-int DFSMaster::recvedBlks(const ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs) {
-  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
+  /// diff the report against the blocks known on this chunkserver.
+  /// Only the block lock is needed, and it is usually all we have to do.
+  std::vector<int> added;
+  std::vector<int> lost;
+  {
+    std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock);
+    aliveChunkservers[chunkserverInfo] = true;
+    publishChunkserverSizes();
+    const auto& known = chunkserverBlks[chunkserverInfo];
+    std::set_difference(reported.begin(), reported.end(), known.begin(), known.end(),
+                        std::back_inserter(added));
+    std::set_difference(known.begin(), known.end(), reported.begin(), reported.end(),
+                        std::back_inserter(lost));
+  }
+  LOG_INFO << "Block report from " << chunkserverInfo.chunkserverip() << ":"
+           << chunkserverInfo.chunkserverport() << ": " << (int)reported.size() << " blocks, "
+           << (int)added.size() << " added, " << (int)lost.size() << " lost";
+  if (added.empty() && lost.empty()) {
+    return OpCode::OP_SUCCESS;
+  }
 
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
   std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
   std::lock(lockMemoryNameSys, lockChunkserverBlock);
 
-  //int id = getChunkserverID(chunkserverInfo);
-  auto csEqualTo = ChunkserverInfoEqualTo();
-  aliveChunkservers[chunkserverInfo] = true;
-  for (int blockid : blkIDs) {
+  /// it was considered dead after the diff
+  if (aliveChunkservers.find(chunkserverInfo) == aliveChunkservers.end()) {
+    return OpCode::OP_BLK_REPORT_REQUIRED;
+  }
+  auto& known = chunkserverBlks[chunkserverInfo];
+  for (int blockid : added) {
     /// all valid blocks should appear in blks
     if (blks.find(blockid) == blks.end()) {
-      LOG_INFO << chunkserverInfo.chunkserverip() << " received invalid block " << blockid;
+      deletedBlks.push_back(blockid);
       continue;
     }
-    if (blkLocs.find(blockid) == blkLocs.end()) {
-      blkLocs[blockid] = std::vector<ChunkserverInfo>();
+    /// confirm the blkLocs
+    if (known.insert(blockid).second) {
+      blkLocs[blockid].push_back(chunkserverInfo);
     }
-    int contained = false;
-    for(const auto& chunkserver : blkLocs[blockid]) {
-      if ( csEqualTo(chunkserver, chunkserverInfo) ) {
-        contained = true;
-        break;
-      }
+  }
+  for (int blockid : lost) {
+    if (known.erase(blockid) == 0) {
+      continue;
+    }
+    removeBlkLoc(blockid, chunkserverInfo);
+    if (blks.find(blockid) != blks.end()) {
+      blksToBeReplicated[blockid]++;
     }
-    if (contained == false)
-      blkLocs[blockid].push_back(chunkserverInfo);
   }
+  publishChunkserverSizes();
   return OpCode::OP_SUCCESS;
 }
 
@@ -617,10 +947,20 @@ int DFSMaster::serializeNameSystem() {
     }
 
     inode->set_isdir(false);
+    auto inlined = inlineFiles.find(dfid);
+    if (inlined != inlineFiles.end()) {
+      inode->set_inlinedata(inlined->second);
+      continue;
+    }
+    auto packed = packedFiles.find(dfid);
+    if (packed != packedFiles.end()) {
+      *inode->add_blks() = packed->second;
+      continue;
+    }
     for (const auto& blkid : inodes[dfid]) {
       /// blks
       auto blk = inode->add_blks();
-      *blk = blks[blkid];
+      *blk = getFileBlk(blkid);
     }
   }
 
@@ -676,10 +1016,19 @@ int DFSMaster::parseNameSystem() {
     }
 
     inodes[inodeID] = std::vector<int>();
+    if (inode.inlinedata().empty() == false) {
+      inlineFiles[inodeID] = inode.inlinedata();
+    }
     for (int j = 0; j < inode.blks_size(); ++j) {
       int blkID = inode.blks(j).blockid();
-      /// blks
-      blks[blkID] = inode.blks(j);
+      /// blks, or the block group and its internal blocks
+      if (inode.blks(j).has_ecschema()) {
+        addBlkGroup(inode.blks(j));
+      } else if (inode.blks(j).has_extent()) {
+        addPackedFile(inodeID, inode.blks(j));
+      } else {
+        blks[blkID] = inode.blks(j);
+      }
       /// inodes
       inodes[inodeID].push_back(blkID);
     }
@@ -711,6 +1060,10 @@ int DFSMaster::initMater() {
 
   /// chunkserver
   blkLocs.clear();
+  chunkserverBlks.clear();
+  blksToBeDeleted.clear();
+  chunkserverLoads.clear();
+  chunkserverAvailable.clear();
   //chunkservers = std::unordered_map<int, ChunkserverInfo>();
   //chunkserverIDs = std::unordered_map<ChunkserverInfo, int>();
   //currentMaxChunkserverID = 0;
@@ -726,6 +1079,8 @@ int DFSMaster::initMater() {
   if (-1 == replayEditLog()){
     return -1;
   }
+  publishNameSysSizes();
+  publishChunkserverSizes();
   return 0;
 }
 
@@ -745,6 +1100,146 @@ void DFSMaster::splitPath(const string& path, string& dir) {
   }
 }
 
+int DFSMaster::allocateBlk(const string& file, LocatedBlock* locatedBlk, const string& writerIP) {
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockInCreating(mutexInCreating, std::defer_lock);
+  std::lock(lockChunkserverBlock, lockInCreating);
+
+  auto retblock = locatedBlk->mutable_block();
+  retblock->set_blocklen(0);
+
+  auto ec = ecFilesInCreating.find(file);
+  if (ec == ecFilesInCreating.end()) {
+    int newBlkid = ++currentMaxBlkID;
+    filesInCreating[file].push_back(newBlkid);
+    blkIDsInCreating.insert(newBlkid);
+    retblock->set_blockid(newBlkid);
+
+    std::vector<ChunkserverInfo> allocatedCS;
+    if (-1 == allocateChunkservers(allocatedCS, writerIP, replicationFactor)) {
+      LOG_INFO  << "Chunkservers alive are fewer than replication factor";
+      return OpCode::OP_FAILURE;
+    }
+    for (const auto& cs : allocatedCS) {
+      *locatedBlk->add_chunkserverinfos() = cs;
+    }
+    return OpCode::OP_SUCCESS;
+  }
+
+  /// the group id, followed by the ids of its internal blocks
+  int nBlks = ec->second.ndata() + ec->second.nparity();
+  int groupID = (currentMaxBlkID += nBlks + 1) - nBlks;
+  filesInCreating[file].push_back(groupID);
+  retblock->set_blockid(groupID);
+  *retblock->mutable_ecschema() = ec->second;
+  /// the internal blocks are received by the chunkservers while the group is written
+  for (int i = 0; i < nBlks; ++i) {
+    blkIDsInCreating.insert(ECBlockGroup::internalBlkID(*retblock, i));
+  }
+
+  /// one internal block per chunkserver if there are enough of them
+  int nServers = std::min(nBlks, (int)aliveChunkservers.size());
+  std::vector<ChunkserverInfo> allocatedCS;
+  if (nServers == 0 || -1 == allocateChunkservers(allocatedCS, writerIP, nServers)) {
+    LOG_INFO  << "No chunkserver alive";
+    return OpCode::OP_FAILURE;
+  }
+  if (nServers < nBlks) {
+    LOG_WARN << "Only " << nServers << " chunkservers for the " << nBlks
+             << " internal blocks of block group " << groupID;
+  }
+  for (int i = 0; i < nBlks; ++i) {
+    *locatedBlk->add_chunkserverinfos() = allocatedCS[i % nServers];
+  }
+  return OpCode::OP_SUCCESS;
+}
+
+void DFSMaster::addBlkGroup(const Block& group) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys);
+
+  blkGroups[group.blockid()] = group;
+  for (int i = 0; i < ECBlockGroup::nBlks(group); ++i) {
+    int blkID = ECBlockGroup::internalBlkID(group, i);
+    Block& blk = blks[blkID];
+    blk.set_blockid(blkID);
+    blk.set_blocklen(ECBlockGroup::internalBlkLen(group, i));
+    blkGroupOf[blkID] = group.blockid();
+  }
+}
+
+void DFSMaster::dropBlkGroup(int groupID) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys);
+
+  auto group = blkGroups.find(groupID);
+  if (group == blkGroups.end()) {
+    return;
+  }
+  for (int i = 0; i < ECBlockGroup::nBlks(group->second); ++i) {
+    int blkID = ECBlockGroup::internalBlkID(group->second, i);
+    blks.erase(blkID);
+    blkGroupOf.erase(blkID);
+  }
+  blkGroups.erase(group);
+}
+
+const Block& DFSMaster::getFileBlk(int blkID) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys);
+
+  auto group = blkGroups.find(blkID);
+  return group != blkGroups.end() ? group->second : blks[blkID];
+}
+
+void DFSMaster::addPackedFile(int fileID, const Block& blk) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys);
+
+  packedFiles[fileID] = blk;
+  if (containerRefs[blk.blockid()]++ == 0) {
+    Block& container = blks[blk.blockid()];
+    container = blk;
+    container.clear_extent();
+  }
+}
+
+void DFSMaster::dropPackedFile(int fileID) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys);
+
+  auto packed = packedFiles.find(fileID);
+  if (packed == packedFiles.end()) {
+    return;
+  }
+  int containerID = packed->second.blockid();
+  packedFiles.erase(packed);
+  if (--containerRefs[containerID] == 0) {
+    containerRefs.erase(containerID);
+    forgetBlk(containerID);
+  }
+}
+
+void DFSMaster::forgetBlk(int blkID) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
+  std::lock(lockMemoryNameSys, lockChunkserverBlock);
+
+  blks.erase(blkID);
+  /// forget the replicas. The chunkservers will be told to delete
+  /// them in the response to their next heartbeat.
+  auto locs = blkLocs.find(blkID);
+  if (locs != blkLocs.end()) {
+    for (const auto& cs : locs->second) {
+      chunkserverBlks[cs].erase(blkID);
+      blksToBeDeleted[cs].push_back(blkID);
+    }
+    blkLocs.erase(locs);
+  }
+  blksToBeReplicated.erase(blkID);
+}
+
+int DFSMaster::nTargetReplicas(int blkID) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys);
+
+  return blkGroupOf.find(blkID) != blkGroupOf.end() ? 1 : replicationFactor;
+}
+
 /*
 int DFSMaster::getChunkserverID(const ChunkserverInfo& chunkserverInfo) {
   int id = -1;
@@ -763,16 +1258,100 @@ int DFSMaster::getChunkserverID(const ChunkserverInfo& chunkserverInfo) {
 void DFSMaster::findBlksToBeReplicated(const ChunkserverInfo& chunkserver) {
   std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock);
 
+  auto known = chunkserverBlks.find(chunkserver);
+  if (known == chunkserverBlks.end()) {
+    return;
+  }
+  for (int b : known->second) {
+    removeBlkLoc(b, chunkserver);
+    blksToBeReplicated[b]++;
+  }
+  chunkserverBlks.erase(known);
+}
+
+void DFSMaster::removeBlkLoc(int blkID, const ChunkserverInfo& chunkserver) {
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock);
+
+  auto locs = blkLocs.find(blkID);
+  if (locs == blkLocs.end()) {
+    return;
+  }
   auto csEqualTo = ChunkserverInfoEqualTo();
-  for (auto& bl : blkLocs) {
-    for (const auto& blChunkserver : bl.second) {
-      if ( csEqualTo(blChunkserver, chunkserver) ) {
-        if (blksToBeReplicated.find(bl.first) == blksToBeReplicated.end()) {
-          blksToBeReplicated[bl.first] = 0;
-        }
-        blksToBeReplicated[bl.first]++;
-        break;
+  for (auto ite = locs->second.begin(); ite != locs->second.end(); ++ite) {
+    if ( csEqualTo(*ite, chunkserver) ) {
+      locs->second.erase(ite);
+      break;
+    }
+  }
+  if (locs->second.empty()) {
+    blkLocs.erase(locs);
+  }
+}
+
+void DFSMaster::addRecvedBlks(const ChunkserverInfo& chunkserver, const Heartbeat& heartbeat) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockInCreating(mutexInCreating, std::defer_lock);
+  std::lock(lockMemoryNameSys, lockChunkserverBlock, lockInCreating);
+
+  auto& known = chunkserverBlks[chunkserver];
+  for (int blockid : heartbeat.recvedblkids()) {
+    /// all valid blocks should appear in blks, once their files are complete
+    if (blks.find(blockid) == blks.end()) {
+      if (blkIDsInCreating.find(blockid) != blkIDsInCreating.end()) {
+        continue;
+      }
+      LOG_INFO << chunkserver.chunkserverip() << " received invalid block " << blockid;
+      blksToBeDeleted[chunkserver].push_back(blockid);
+      continue;
+    }
+    if (known.insert(blockid).second) {
+      blkLocs[blockid].push_back(chunkserver);
+    }
+  }
+}
+
+void DFSMaster::assignBlkTasks(const ChunkserverInfo& chunkserver, bool acceptCopyTasks, BlockTasks* blkTasks) {
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock);
+
+  /// replicas to delete. A lost response is fine: the block is not in
+  /// chunkserverBlks any more, so the next full report deletes it again.
+  auto deleted = blksToBeDeleted.find(chunkserver);
+  if (deleted != blksToBeDeleted.end()) {
+    for (int b : deleted->second) {
+      BlockTask* blkTask = blkTasks->add_blktasks();
+      blkTask->set_operation(OpCode::OP_DELETE);
+      blkTask->mutable_locatedblk()->mutable_block()->set_blockid(b);
+    }
+    LOG_INFO << "Ask " << chunkserver.chunkserverip() << ":" << chunkserver.chunkserverport()
+             << " to delete " << (int)deleted->second.size() << " blocks";
+    blksToBeDeleted.erase(deleted);
+  }
+
+  if (acceptCopyTasks == false || blksToBeReplicated.empty()) {
+    return;
+  }
+  const auto& known = chunkserverBlks[chunkserver];
+  LOG_INFO << "Number of blks to be rep: " << blksToBeReplicated.size();
+  for (auto b = blksToBeReplicated.begin(); b != blksToBeReplicated.end();) {
+    if (blkGroupOf.find(b->first) != blkGroupOf.end()) {
+      BlockTask blkTask;
+      if (blkLocs.find(b->first) != blkLocs.end()) {
+        /// located again, e.g. reported by a chunkserver back from the dead
+        b = blksToBeReplicated.erase(b);
+      } else if (known.find(b->first) == known.end() && 0 == reconstructBlkTask(b->first, &blkTask)) {
+        /// an internal block is rebuilt by any chunkserver from the others
+        *blkTasks->add_blktasks() = blkTask;
+        b = blksToBeReplicated.erase(b);
+      } else {
+        ++b;
       }
+    } else if (known.find(b->first) != known.end()) {
+      /// the chunkserver has a replica to copy from
+      distributeBlkTask(b->first, b->second, blkTasks->add_blktasks());
+      b = blksToBeReplicated.erase(b);
+    } else {
+      ++b;
     }
   }
 }
@@ -808,14 +1387,42 @@ void DFSMaster::distributeBlkTask(int blockID, int repFactor, BlockTask* blkTask
     LOG_ERROR << "Required " << repFactor << " repair nodes; "
          << "but only " << numFound << " found";
   }
-  LOG_INFO << "Assigned block task: " << locatedBlk->DebugString();
+  LOG_DEBUG << "Assigned block task: " << locatedBlk->DebugString();
+}
+
+int DFSMaster::reconstructBlkTask(int blockID, BlockTask* blkTask) {
+  std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys, std::defer_lock);
+  std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock, std::defer_lock);
+  std::lock(lockMemoryNameSys, lockChunkserverBlock);
+
+  const Block& group = blkGroups[blkGroupOf[blockID]];
+  LocatedBlock* lbGroup = blkTask->mutable_blkgroup();
+  *lbGroup->mutable_block() = group;
+  int nLocated = 0;
+  for (int i = 0; i < ECBlockGroup::nBlks(group); ++i) {
+    auto chunkserverinfo = lbGroup->add_chunkserverinfos();
+    auto locs = blkLocs.find(ECBlockGroup::internalBlkID(group, i));
+    if (locs != blkLocs.end() && locs->second.empty() == false) {
+      *chunkserverinfo = locs->second.front();
+      ++nLocated;
+    }
+  }
+  if (nLocated < group.ecschema().ndata()) {
+    LOG_WARN << "Block " << blockID << " cannot be reconstructed: only " << nLocated
+             << " internal blocks of block group " << group.blockid() << " are located";
+    return -1;
+  }
+  blkTask->set_operation(OpCode::OP_RECONSTRUCT);
+  *blkTask->mutable_locatedblk()->mutable_block() = blks[blockID];
+  LOG_INFO << "Assigned reconstruction of block " << blockID;
+  return 0;
 }
 
-int DFSMaster::allocateChunkservers(std::vector<ChunkserverInfo>& cs) {
+int DFSMaster::allocateChunkservers(std::vector<ChunkserverInfo>& cs, const string& writerIP, int nRequired) {
   std::unique_lock<std::recursive_mutex> lockChunkserverBlock(mutexChunkserverBlock);
 
   int nServers = aliveChunkservers.size();
-  if (nServers < replicationFactor) {
+  if (nServers < nRequired) {
     return -1;
   }
   std::vector<ChunkserverInfo> shuffleVec(nServers);
@@ -825,29 +1432,83 @@ int DFSMaster::allocateChunkservers(std::vector<ChunkserverInfo>& cs) {
     shuffleVec[i] = ics->first;
   }
   std::random_shuffle(shuffleVec.begin(), shuffleVec.end());
-  for (int i = 0; i < replicationFactor; ++i) {
+
+  /// move the overloaded chunkservers behind the others
+  long long totalLoad = 0;
+  for (const auto& l : chunkserverLoads) {
+    totalLoad += l.second;
+  }
+  if (totalLoad > 0) {
+    double maxLoad = 2.0 * totalLoad / nServers;
+    std::stable_partition(shuffleVec.begin(), shuffleVec.end(),
+        [this, maxLoad](const ChunkserverInfo& c) {
+          auto l = chunkserverLoads.find(c);
+          return l == chunkserverLoads.end() || l->second <= maxLoad;
+        });
+  }
+  /// and the full ones behind all
+  auto full = std::stable_partition(shuffleVec.begin(), shuffleVec.end(),
+      [this](const ChunkserverInfo& c) {
+        auto a = chunkserverAvailable.find(c);
+        return a == chunkserverAvailable.end() || a->second > 0;
+      });
+  int nWithSpace = full - shuffleVec.begin();
+
+  /// the writer runs on a chunkserver host: write the 1st replica locally
+  if (writerIP.empty() == false) {
+    for (int i = 0; i < nWithSpace; ++i) {
+      if (shuffleVec[i].chunkserverip() == writerIP) {
+        std::swap(shuffleVec[0], shuffleVec[i]);
+        LOG_DEBUG << "Writer-local chunkserver: " << writerIP << ":" << shuffleVec[0].chunkserverport();
+        break;
+      }
+    }
+  }
+  for (int i = 0; i < nRequired; ++i) {
     cs.emplace_back(shuffleVec[i]);
   }
   return 0;
 }
 
+void DFSMaster::publishNameSysSizes() {
+  nFiles.store(dfIDs.size(), std::memory_order_relaxed);
+  nBlks.store(blks.size(), std::memory_order_relaxed);
+}
+
+void DFSMaster::publishChunkserverSizes() {
+  nChunkservers.store(aliveChunkservers.size(), std::memory_order_relaxed);
+  nBlksToBeReplicated.store(blksToBeReplicated.size(), std::memory_order_relaxed);
+}
+
 long long DFSMaster::getFileLength(int fileID) {
   std::unique_lock<std::recursive_mutex> lockMemoryNameSys(mutexMemoryNameSys);
   if (inodes.find(fileID) == inodes.end()) {
     return -1;
   }
 
+  auto inlined = inlineFiles.find(fileID);
+  if (inlined != inlineFiles.end()) {
+    return inlined->second.size();
+  }
+
+  auto packed = packedFiles.find(fileID);
+  if (packed != packedFiles.end()) {
+    return packed->second.extent().len();
+  }
+
   const auto& blkVec = inodes[fileID];
   long long len = 0;
   for (int b : blkVec) {
-    len += blks[b].blocklen();
+    len += getFileBlk(b).blocklen();
   }
 
   return len;
 }
 
 int DFSMaster::logEdit(const string& editString) {
-  LOG_INFO << editString;
+  LOG_DEBUG << editString;
+  metrics::ScopedTimer timer(editLatency);
+  editBytes->add(editString.size());
   std::unique_lock<std::recursive_mutex> lockEdit(mutexFileNameSys);
   int fd = ::open(editLogFile.c_str(), O_WRONLY | O_APPEND);
   if (fd < 0) {
@@ -900,31 +1561,10 @@ int DFSMaster::replayEditLog(){
       EditLog editlog;
       editlog.ParseFromArray(buf.data(), len);
       if (editlog.op() == OpCode::OP_CREATE) {
-        int newDfID = editlog.dfid();
-        if (currentMaxDfID < newDfID){
-          currentMaxDfID = newDfID;
-        }
-        string file = editlog.src();
-        
-        /// add an entry to dfIDs
-        dfIDs[file] = newDfID;
-        /// add it dfNames at the same time
-        dfNames[newDfID] = file;
-
-        /// add it to dentries
-        string dir;
-        splitPath(file, dir);
-        int dirID = dfIDs[dir];
-        dentries[dirID].push_back(newDfID);
-
-        /// add it to inode
-        for (int i = 0; i < editlog.blks_size(); ++i) {
-          int newBlkID = editlog.blks(i).blockid();
-          if (currentMaxBlkID < newBlkID) {
-            currentMaxBlkID = newBlkID;
-          }
-          inodes[newDfID].push_back(newBlkID);
-          blks[newBlkID] = editlog.blks(i);
+        applyCreate(editlog);
+      } else if (editlog.op() == OpCode::OP_CREATE_PACK) {
+        for (const auto& create : editlog.creates()) {
+          applyCreate(create);
         }
       } else if (editlog.op() == OpCode::OP_MKDIR) {
         string dirName = editlog.src();
@@ -974,9 +1614,18 @@ int DFSMaster::replayEditLog(){
         }
 
         /// delete the corresponding inode
+        inlineFiles.erase(dfid);
         auto& blockvec = inodes[dfid];
+        if (packedFiles.find(dfid) != packedFiles.end()) {
+          dropPackedFile(dfid);
+          blockvec.clear();
+        }
         for (int b : blockvec) {
-          blks.erase(b);
+          if (blkGroups.find(b) != blkGroups.end()) {
+            dropBlkGroup(b);
+          } else {
+            blks.erase(b);
+          }
         }
         inodes.erase(dfid);
       } else{
@@ -992,4 +1641,46 @@ int DFSMaster::replayEditLog(){
   return 0;
 }
 
+void DFSMaster::applyCreate(const EditLog& editlog) {
+  int newDfID = editlog.dfid();
+  if (currentMaxDfID < newDfID){
+    currentMaxDfID = newDfID;
+  }
+  string file = editlog.src();
+  
+  /// add an entry to dfIDs
+  dfIDs[file] = newDfID;
+  /// add it dfNames at the same time
+  dfNames[newDfID] = file;
+
+  /// add it to dentries
+  string dir;
+  splitPath(file, dir);
+  int dirID = dfIDs[dir];
+  dentries[dirID].push_back(newDfID);
+
+  /// add it to inode
+  inodes[newDfID] = std::vector<int>();
+  if (editlog.inlinedata().empty() == false) {
+    inlineFiles[newDfID] = editlog.inlinedata();
+  }
+  for (int i = 0; i < editlog.blks_size(); ++i) {
+    const Block& blk = editlog.blks(i);
+    int newBlkID = blk.blockid();
+    /// the ids of the internal blocks follow the group id
+    int maxBlkID = blk.has_ecschema() ? newBlkID + ECBlockGroup::nBlks(blk) : newBlkID;
+    if (currentMaxBlkID < maxBlkID) {
+      currentMaxBlkID = maxBlkID;
+    }
+    inodes[newDfID].push_back(newBlkID);
+    if (blk.has_ecschema()) {
+      addBlkGroup(blk);
+    } else if (blk.has_extent()) {
+      addPackedFile(newDfID, blk);
+    } else {
+      blks[newBlkID] = blk;
+    }
+  }
+}
+
 } // namespace minidfs
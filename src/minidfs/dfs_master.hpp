@@ -14,6 +14,10 @@
 #include <fstream>
 #include <random>
 #include <atomic>
+#include <set>
+#include <unordered_set>
+#include <algorithm>
+#include <iterator>
 
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
@@ -119,9 +123,32 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// The max block ID that has been allocated
   std::atomic<int> currentMaxBlkID;
 
-  /// \brief Maps from block id to blocks.
+  /// \brief Maps from block id to blocks. These are the blocks stored by the chunkservers:
+  /// replicated blocks, and the internal blocks of block groups.
   std::unordered_map<int, Block> blks;
 
+  /// \brief Maps from block group id to block groups of erasure-coded files.
+  /// The inodes refer to them, and their internal blocks are in blks.
+  std::unordered_map<int, Block> blkGroups;
+
+  /// Maps from internal block id to the id of its block group
+  std::unordered_map<int, int> blkGroupOf;
+
+  /// \brief Maps from file id to the extent of its container block, for the small
+  /// files packed into shared container blocks. Their inodes refer to the container
+  /// block, which is in blks.
+  std::unordered_map<int, Block> packedFiles;
+
+  /// Maps from container block id to the number of files packed into it.
+  /// The block is deleted with the last of them.
+  std::unordered_map<int, int> containerRefs;
+
+  /// \brief Maps from file id to the contents of the tiny files stored inline.
+  /// Their inodes have no blocks.
+  ///
+  /// This will be serialized to local disk.
+  std::unordered_map<int, string> inlineFiles;
+
   ///#3 mutex for chunkserver-block related information
   std::recursive_mutex mutexChunkserverBlock;
 
@@ -131,8 +158,23 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// alive chunkservers
   std::unordered_map<ChunkserverInfo, bool, ChunkserverInfoHasher, ChunkserverInfoEqualTo> aliveChunkservers;
 
+  /// Maps from chunkserver to the ids of the valid blocks it stores.
+  /// It is the inversion of blkLocs. Full block reports are diffed against it.
+  std::unordered_map<ChunkserverInfo, std::set<int>, ChunkserverInfoHasher, ChunkserverInfoEqualTo> chunkserverBlks;
+
+  /// Replicas to be deleted on each chunkserver, e.g. blocks of removed files.
+  /// They are sent with the response to the next heartbeat.
+  std::unordered_map<ChunkserverInfo, std::vector<int>, ChunkserverInfoHasher, ChunkserverInfoEqualTo> blksToBeDeleted;
+
+  /// Number of block transfers in progress on each chunkserver, from heartbeats.
+  std::unordered_map<ChunkserverInfo, int, ChunkserverInfoHasher, ChunkserverInfoEqualTo> chunkserverLoads;
+
+  /// Bytes available for new blocks on each chunkserver, summed over its volumes, from heartbeats.
+  std::unordered_map<ChunkserverInfo, long long, ChunkserverInfoHasher, ChunkserverInfoEqualTo> chunkserverAvailable;
+
   /// blks that need to be replicated.
   /// The 1st is block id; the 2nd is replication factor.
+  /// Lost internal blocks are reconstructed instead.
   std::unordered_map<int, int> blksToBeReplicated;
 
   ///#4 mutex for files/blocks in creating status
@@ -142,15 +184,30 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// the 1st element is file name, the 2nd is a list of block ids
   std::unordered_map<string, std::vector<int>> filesInCreating;
 
+  /// schemas of the erasure-coded files in filesInCreating
+  std::unordered_map<string, ECSchema> ecFilesInCreating;
+
+  /// Maps from container block id to the packed small files being written into it.
+  /// Their names are in filesInCreating.
+  std::unordered_map<int, Pack> packsInCreating;
+
   /// record the set of blocks still in creating process, not finish yet.
   /// The associated chunkserver info is included
   /// (block id, located block) pair
   std::unordered_map<int, LocatedBlock> blocksInCreating;
 
+  /// ids of the blocks, the internal blocks of the groups and the container
+  /// blocks allocated to the files in creating, acked or not. Their replicas
+  /// are not deleted when received.
+  std::unordered_set<int> blkIDsInCreating;
+
  private:
   /// number of replicas
   int replicationFactor;
 
+  /// max length of a file stored inline, 0 to disable inline files
+  int maxInlineSize;
+
   /// magic code of edit log
   const int editlogMagicCode = 1234;
 
@@ -160,6 +217,21 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// status checking interval, in ms
   const int STATUS_CHECK_INTERVAL = 7000;
 
+  /// bytes appended to the edit log, and the time to append an edit
+  metrics::Counter* editBytes;
+  metrics::Histogram* editLatency;
+
+  /// heartbeats and block reports received
+  metrics::Counter* nHeartbeats;
+  metrics::Counter* nBlkReports;
+
+  /// sizes of dfIDs, blks, aliveChunkservers and blksToBeReplicated, published
+  /// for the gauges as they change
+  std::atomic<int64_t> nFiles;
+  std::atomic<int64_t> nBlks;
+  std::atomic<int64_t> nChunkservers;
+  std::atomic<int64_t> nBlksToBeReplicated;
+
 
  public:
   /// \brief Construct the Master.
@@ -169,9 +241,20 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// \param serverPort Master's serving port
   /// \param maxConns maximum number of connections
   /// \param replicationFactor number of replicas for every block
-  /// \param nThread number of threads in the thread pool
+  /// \param nThread number of threads handling the client calls
+  /// \param nChunkserverThread number of threads reserved for the chunkserver calls
+  /// \param maxInlineSize max length of a file stored inline in the master
+  /// \param maxQueuedCalls max calls waiting in each lane, 0 for no limit
+  /// \param busyRetryMs how long a shed caller is told to wait before retrying
+  /// \param maxThread max number of threads handling the client calls, nThread or
+  ///        less for a fixed number
+  /// \param maxQueueDelayMs more threads handle the client calls when they wait longer than it
+  /// \param nReaderThread number of threads receiving the requests
   DFSMaster(const string& nameSysFile, const string& editLogFile,
-            int serverPort, int maxConns, int replicationFactor, size_t nThread);
+            int serverPort, int maxConns, int replicationFactor, size_t nThread,
+            size_t nChunkserverThread, int maxInlineSize = 0, int maxQueuedCalls = 0,
+            int busyRetryMs = 0, size_t maxThread = 0, int maxQueueDelayMs = 0,
+            size_t nReaderThread = 2);
 
   ~DFSMaster();
 
@@ -236,6 +319,42 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// \return return OpCode.
   virtual int create(const string& file, LocatedBlock* locatedBlk) override;
 
+  /// \brief Create a file on behalf of a client running at writerIP.
+  ///
+  /// Same as create(file, locatedBlk). If writerIP is the host of an alive
+  /// chunkserver, that chunkserver is chosen as the head of the pipeline so that
+  /// the first replica is written locally.
+  ///
+  /// \param file the file name stored in minidfs.
+  /// \param locatedBlk contains chunkservers' information.
+  ///        It is the returning parameter. 
+  /// \param writerIP IP address of the client, empty if unknown
+  /// \return return OpCode.
+  int create(const string& file, LocatedBlock* locatedBlk, const string& writerIP);
+
+  /// \brief Create an erasure-coded file. MethodID = 6.
+  ///
+  /// Same as create(), but each block of the file is a block group laid out by schema.
+  /// k + m block ids are reserved after the group id for its internal blocks.
+  ///
+  /// \param file the file name stored in minidfs.
+  /// \param schema the layout of the block groups
+  /// \param locatedBlk contains chunkservers' information.
+  ///        It is the returning parameter. 
+  /// \return return OpCode.
+  virtual int createEC(const string& file, const ECSchema& schema, LocatedBlock* locatedBlk) override;
+
+  /// \brief Create an erasure-coded file on behalf of a client running at writerIP.
+  ///
+  /// \param file the file name stored in minidfs.
+  /// \param schema the layout of the block groups
+  /// \param locatedBlk contains chunkservers' information.
+  ///        It is the returning parameter. 
+  /// \param writerIP IP address of the client, empty if unknown
+  /// \return return OpCode.
+  int createEC(const string& file, const ECSchema& schema, LocatedBlock* locatedBlk,
+               const string& writerIP);
+
   /// \brief Add a block when the client has finished the previous block. MethodID = 3.
   ///
   /// When the client create() a file and finishes the 1st block, it calls addBlock()
@@ -247,11 +366,23 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// \return return OpCode.
   virtual int addBlock(const string& file, LocatedBlock* locatedBlk) override;
 
+  /// \brief Add a block on behalf of a client running at writerIP.
+  /// See create(file, locatedBlk, writerIP) for the placement of the first replica.
+  ///
+  /// \param file the file name stored in minidfs.
+  /// \param locatedBlk contains chunkservers' information.
+  ///        It is the returning parameter. 
+  /// \param writerIP IP address of the client, empty if unknown
+  /// \return return OpCode.
+  int addBlock(const string& file, LocatedBlock* locatedBlk, const string& writerIP);
+
   /// \brief Confirm that a block has been written successfully. MethodID = 4.
   ///
   /// When the client create()/addBlock() successfully, it should send ack to
   /// inform the master. This request will let the master know how much data the
   /// client has written.
+  /// For a block group, the i-th chunkserver is the location of the i-th internal block,
+  /// empty if it failed to be written.
   ///
   /// \param file the file name stored in minidfs.
   /// \param locatedBlk contains chunkservers' information. It contains
@@ -269,6 +400,49 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// \return return OpCode.
   virtual int complete(const string& file) override;
 
+  /// \brief Create small files packed one after another into a shared container
+  /// block. MethodID = 7.
+  ///
+  /// calling order: createPack() -> completePack()
+  /// The names of the files are reserved in filesInCreating, and the container
+  /// block is allocated like the first block of a file.
+  ///
+  /// \param pack the names and lengths of the files
+  /// \param locatedBlk the container block and its chunkservers.
+  ///        It is the returning parameter.
+  /// \return return OpCode.
+  virtual int createPack(const Pack& pack, LocatedBlock* locatedBlk) override;
+
+  /// \brief Create packed small files on behalf of a client running at writerIP.
+  ///
+  /// \param pack the names and lengths of the files
+  /// \param locatedBlk the container block and its chunkservers.
+  ///        It is the returning parameter.
+  /// \param writerIP IP address of the client, empty if unknown
+  /// \return return OpCode.
+  int createPack(const Pack& pack, LocatedBlock* locatedBlk, const string& writerIP);
+
+  /// \brief Complete writing packed small files. MethodID = 8.
+  ///
+  /// Each file is created with an inode referring to its extent of the container
+  /// block, and logged to the edit log. The container is a single block for the
+  /// master and the chunkservers, however many files it holds.
+  ///
+  /// \param pack the files of createPack(), and the written container block
+  ///        with the chunkservers storing it
+  /// \return return OpCode.
+  virtual int completePack(const Pack& pack) override;
+
+  /// \brief Create a tiny file with its contents stored inline. MethodID = 9.
+  ///
+  /// The file is created and logged to the edit log at once, with its contents
+  /// in the edit log entry. It has an inode with no blocks.
+  ///
+  /// \param file the name and the contents of the file
+  /// \return return OpCode. OpCode::OP_FAILURE if the contents are longer than
+  ///         maxInlineSize.
+  virtual int createInline(const InlineFile& file) override;
+
 
   /////////////////////////////// Name system operations
 
@@ -298,6 +472,17 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   ///        It is the returning parameter.
   /// \return return OpCode.
   virtual int listDir(const string& dirName, FileInfos& items) override;
+
+
+  /////////////////////////////// Administration
+
+
+  /// \brief Get the statistics of the RPC server. MethodID = 21.
+  ///
+  /// \param stats the queue depth and the calls handled of each lane.
+  ///        It is the returning parameter.
+  /// \return return OpCode.
+  virtual int getServerStats(ServerStats* stats) override;
   
   
   ////////////////////////
@@ -307,35 +492,28 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
 
   /// \brief Send heartbeat information to Master. MethodID = 101.
   ///
-  /// \param chunkserverInfo containing the ip and port of the chunkserver
-  /// \return return OpCode.
-  virtual int heartBeat(const ChunkserverInfo& chunkserverInfo) override;
+  /// The received blocks in the heartbeat are added to blkLocs, and the corrupt
+  /// replicas are removed from it and re-replicated. The response
+  /// carries the replication tasks the chunkserver has a source replica for,
+  /// and the replicas it should delete.
+  /// \param heartbeat containing the chunkserver info, load and received blocks
+  /// \param blkTasks block tasks for the chunkserver.
+  ///        It is the returning parameter.
+  /// \return return OpCode. OpCode::OP_BLK_REPORT_REQUIRED if the chunkserver
+  ///         is unknown, e.g. master restarted or it was considered dead.
+  virtual int heartBeat(const Heartbeat& heartbeat, BlockTasks* blkTasks) override;
 
   /// \brief Send block report to Master. MethodID = 102.
   ///
-  /// The chunkserver informs Master about all the blocks it has
+  /// The chunkserver informs Master about all the blocks it has.
+  /// The report is diffed against chunkserverBlks, so only the blocks
+  /// added or lost since the last report touch blkLocs.
   /// \param chunkserverInfo containing the ip and port of the chunkserver
   /// \param blkIDs all the block ids it has
   /// \param deletedBlks all the blocks it should delete
   ///        It is the returning parameter. 
   /// \return return OpCode.
   virtual int blkReport(const ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs, std::vector<int>& deletedBlks) override;
-  
-  /// \brief Get block task from Master. MethodID = 103.
-  ///
-  /// \param chunkserverInfo containing the ip and port of the chunkserver
-  /// \param blkTasks block tasks from master. 
-  ///        It is the returning parameter.      
-  /// \return return OpCode.
-  virtual int getBlkTask(const ChunkserverInfo& chunkserverInfo, BlockTasks* blkTasks) override;
-  
-  /// \brief Inform Master about the received blocks. MethodID = 104.
-  ///
-  /// The chunkserver informs Master about all the blocks it received
-  /// \param chunkserverInfo containing the ip and port of the chunkserver
-  /// \param blkIDs all the block ids it received
-  /// \return return OpCode.
-  virtual int recvedBlks(const ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs) override;
  
  private:
   /// \brief Serialize the fdIDs/inodes/dentries to local disk.
@@ -353,20 +531,72 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// Split the path to get the parent dir
   void splitPath(const string& path, string& dir);
 
+  /// Create a file, erasure-coded if schema is not null. See create() and createEC().
+  int createFile(const string& file, const ECSchema* schema, LocatedBlock* locatedBlk,
+                 const string& writerIP);
+
+  /// Allocate the next block of a file in creating, a block group for an erasure-coded file.
+  /// Its internal blocks are spread over as many chunkservers as possible.
+  ///
+  /// \return return OpCode.
+  int allocateBlk(const string& file, LocatedBlock* locatedBlk, const string& writerIP);
+
+  /// Add a block group and its internal blocks to blkGroups and blks
+  void addBlkGroup(const Block& group);
+
+  /// Drop a block group and its internal blocks from blkGroups and blks
+  void dropBlkGroup(int groupID);
+
+  /// Get a block of a file by its id in the inode: a block or a block group
+  const Block& getFileBlk(int blkID);
+
+  /// Add a small file packed into a container block, blk with its extent
+  void addPackedFile(int fileID, const Block& blk);
+
+  /// Drop a packed small file, and its container block with the last file in it
+  void dropPackedFile(int fileID);
+
+  /// Forget a block and its replicas. The chunkservers will be told to delete them.
+  void forgetBlk(int blkID);
+
+  /// Number of replicas a block should have: 1 for an internal block
+  int nTargetReplicas(int blkID);
+
   /// tranform chunkserverinfo into chunkserver id
   //int getChunkserverID(const ChunkserverInfo& chunkserverInfo);
 
-  /// find blocks to be replicated
+  /// find blocks to be replicated, and forget the block locations of a dead chunkserver
   void findBlksToBeReplicated(const ChunkserverInfo& chunkserver);
 
+  /// Remove chunkserver from the locations of block blkID
+  void removeBlkLoc(int blkID, const ChunkserverInfo& chunkserver);
+
+  /// Add the blocks received by a chunkserver to blkLocs
+  void addRecvedBlks(const ChunkserverInfo& chunkserver, const Heartbeat& heartbeat);
+
+  /// Fill in the replication and deletion tasks for a chunkserver
+  void assignBlkTasks(const ChunkserverInfo& chunkserver, bool acceptCopyTasks, BlockTasks* blkTasks);
+
   /// distribute the blkTask
   void distributeBlkTask(int blockID, int repFactor, BlockTask* blkTask);
 
-  /// Allocate chunkservers for a block
+  /// Fill in the task to reconstruct a lost internal block, if enough of the others
+  /// are located
+  ///
+  /// \return return 0 on success, -1 if it cannot be reconstructed now
+  int reconstructBlkTask(int blockID, BlockTask* blkTask);
+
+  /// Allocate chunkservers for a block. Chunkservers busier than twice the
+  /// average load are only picked when there are not enough others, and
+  /// the ones without space for another block come last.
+  /// If an alive chunkserver with space runs on the writer's host, it is put
+  /// at the head of the returned servers anyway.
   ///
   /// \param cs the returned servers
+  /// \param writerIP IP address of the writer, empty if unknown
+  /// \param nRequired number of servers
   /// \return return 0 on success, -1 for errors
-  int allocateChunkservers(std::vector<ChunkserverInfo>& cs);
+  int allocateChunkservers(std::vector<ChunkserverInfo>& cs, const string& writerIP, int nRequired);
 
   /// Get the length of a given file
   ///
@@ -374,6 +604,13 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   /// \return the total length of the given file; otherwise it returns -1
   long long getFileLength(int fileID);
 
+  /// Publish the numbers of files and blocks to the gauges. Requires mutexMemoryNameSys.
+  void publishNameSysSizes();
+
+  /// Publish the numbers of chunkservers and of blocks to be replicated to the
+  /// gauges. Requires mutexChunkserverBlock.
+  void publishChunkserverSizes();
+
   /// Log the edit into logeditFile.
   ///
   /// \param editString serialized EditLog
@@ -384,6 +621,11 @@ class DFSMaster: public ClientProtocol, public ChunkserverProtocol{
   ///
   /// \return return 0 on success, -1 for errors
   int replayEditLog();
+
+  /// Apply a create, logged or replayed from the edit logs, to the name system.
+  ///
+  /// \param editlog the OP_CREATE edit
+  void applyCreate(const EditLog& editlog);
 };
 
 
@@ -0,0 +1,100 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for DFSMaster
+
+#include <minidfs/dfs_master.hpp>
+#include <minidfs/ec_block_group.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+namespace {
+
+const string kDir = "/tmp/dfs_master_unittest";
+
+minidfs::ChunkserverInfo Chunkserver() {
+  minidfs::ChunkserverInfo cs;
+  cs.set_chunkserverip("127.0.0.1");
+  cs.set_chunkserverport(9000);
+  return cs;
+}
+
+/// Send a heartbeat with the blocks received, and return the blocks the
+/// master asks to delete.
+std::vector<int> RecvBlks(minidfs::DFSMaster* master, const std::vector<int>& blkIDs) {
+  minidfs::Heartbeat heartbeat;
+  *heartbeat.mutable_chunkserverinfo() = Chunkserver();
+  for (int b : blkIDs) {
+    heartbeat.add_recvedblkids(b);
+  }
+  minidfs::BlockTasks tasks;
+  assert(master->heartBeat(heartbeat, &tasks) == minidfs::OpCode::OP_SUCCESS);
+  std::vector<int> deleted;
+  for (const auto& task : tasks.blktasks()) {
+    if (task.operation() == minidfs::OpCode::OP_DELETE) {
+      deleted.push_back(task.locatedblk().block().blockid());
+    }
+  }
+  return deleted;
+}
+
+void TestRecvedInCreating() {
+  ::mkdir(kDir.c_str(), 0755);
+  minidfs::DFSMaster master(kDir + "/namesys", kDir + "/editlog", 0, 1, 1, 1, 1);
+  assert(master.format() == 0);
+  std::vector<int> deleted;
+  assert(master.blkReport(Chunkserver(), std::vector<int>(), deleted) == minidfs::OpCode::OP_SUCCESS);
+
+  /// a block of a file being written is received before the file is complete
+  minidfs::LocatedBlock lb;
+  assert(master.create("/f", &lb) == minidfs::OpCode::OP_SUCCESS);
+  int blkID = lb.block().blockid();
+  assert(RecvBlks(&master, {blkID}).empty());
+
+  /// a block the master doesn't know is deleted
+  assert(RecvBlks(&master, {blkID + 100}) == std::vector<int>{blkID + 100});
+  ::printf("recved in creating pass ...\n");
+}
+
+void TestRecvedECInCreating() {
+  minidfs::DFSMaster master(kDir + "/namesys", kDir + "/editlog", 0, 1, 1, 1, 1);
+  assert(master.format() == 0);
+  std::vector<int> deleted;
+  assert(master.blkReport(Chunkserver(), std::vector<int>(), deleted) == minidfs::OpCode::OP_SUCCESS);
+
+  /// the internal blocks are received while the group is written
+  minidfs::ECSchema schema;
+  schema.set_ndata(2);
+  schema.set_nparity(1);
+  schema.set_cellsize(1024);
+  minidfs::LocatedBlock lb;
+  assert(master.createEC("/ec", schema, &lb) == minidfs::OpCode::OP_SUCCESS);
+  std::vector<int> internal;
+  for (int i = 0; i < minidfs::ECBlockGroup::nBlks(lb.block()); ++i) {
+    internal.push_back(minidfs::ECBlockGroup::internalBlkID(lb.block(), i));
+  }
+  assert(internal.size() == 3 && RecvBlks(&master, internal).empty());
+
+  /// and after the file is complete
+  assert(master.blockAck(lb) == minidfs::OpCode::OP_SUCCESS);
+  assert(master.complete("/ec") == minidfs::OpCode::OP_SUCCESS);
+  assert(RecvBlks(&master, internal).empty());
+  assert(RecvBlks(&master, {internal.back() + 1}) == std::vector<int>{internal.back() + 1});
+  ::printf("recved ec in creating pass ...\n");
+}
+
+} // namespace
+
+void TestDFSMaster() {
+  ::printf("Test DFSMaster...\n");
+
+  TestRecvedInCreating();
+  TestRecvedECInCreating();
+
+  ::printf("\n");
+}
@@ -0,0 +1,229 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include <minidfs/ec_block_group.hpp>
+#include <minidfs/op_code.hpp>
+#include "checksum/chunked_checksum.h"
+#include "logging/logger.h"
+
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+namespace minidfs {
+
+ECBlockGroup::ECBlockGroup(const LocatedBlock& lbGroup)
+    : lbGroup(lbGroup), schema(lbGroup.block().ecschema()),
+      rs(schema.ndata(), schema.nparity()) {
+}
+
+bool ECBlockGroup::isValidSchema(const ECSchema& schema) {
+  return schema.ndata() >= 1 && schema.ndata() <= 32
+         && schema.nparity() >= 1 && schema.nparity() <= 32
+         && schema.cellsize() > 0;
+}
+
+int ECBlockGroup::nBlks(const Block& group) {
+  return group.ecschema().ndata() + group.ecschema().nparity();
+}
+
+int ECBlockGroup::internalBlkID(const Block& group, int index) {
+  return group.blockid() + 1 + index;
+}
+
+long long ECBlockGroup::internalBlkLen(const Block& group, int index) {
+  const ECSchema& schema = group.ecschema();
+  long long cellSize = schema.cellsize();
+  long long stripeLen = cellSize * schema.ndata();
+  long long nStripes = group.blocklen() / stripeLen;
+  long long tail = group.blocklen() - nStripes * stripeLen;
+  /// the parity blocks are as long as the first data block
+  if (index >= schema.ndata()) {
+    index = 0;
+  }
+  long long tailLen = std::min(cellSize, std::max(0LL, tail - index * cellSize));
+  return nStripes * cellSize + tailLen;
+}
+
+void ECBlockGroup::encode(const char* data, std::vector<string>* blks) const {
+  const Block& group = lbGroup.block();
+  int nData = schema.ndata();
+  long long cellSize = schema.cellsize();
+  long long shardLen = internalBlkLen(group, 0);
+
+  blks->assign(nBlks(group), string(shardLen, 0));
+  long long dataLen = group.blocklen();
+  for (long long off = 0, c = 0; off < dataLen; off += cellSize, ++c) {
+    long long n = std::min(cellSize, dataLen - off);
+    memcpy(&(*blks)[c % nData][(c / nData) * cellSize], data + off, n);
+  }
+
+  std::vector<const uint8_t*> dataShards;
+  std::vector<uint8_t*> parityShards;
+  for (int i = 0; i < nBlks(group); ++i) {
+    uint8_t* shard = reinterpret_cast<uint8_t*>(&(*blks)[i][0]);
+    if (i < nData) {
+      dataShards.push_back(shard);
+    } else {
+      parityShards.push_back(shard);
+    }
+  }
+  if (shardLen > 0) {
+    rs.encode(dataShards.data(), parityShards.data(), shardLen);
+  }
+  /// drop the padding
+  for (int i = 1; i < nData; ++i) {
+    (*blks)[i].resize(internalBlkLen(group, i));
+  }
+}
+
+int ECBlockGroup::read(string* data) const {
+  std::vector<string> shards;
+  if (-1 == fetchAndDecode(-1, &shards)) {
+    return -1;
+  }
+  const Block& group = lbGroup.block();
+  int nData = schema.ndata();
+  long long cellSize = schema.cellsize();
+  long long dataLen = group.blocklen();
+  data->resize(dataLen);
+  for (long long off = 0, c = 0; off < dataLen; off += cellSize, ++c) {
+    long long n = std::min(cellSize, dataLen - off);
+    memcpy(&(*data)[off], &shards[c % nData][(c / nData) * cellSize], n);
+  }
+  return 0;
+}
+
+int ECBlockGroup::reconstruct(int index, string* blk) const {
+  std::vector<string> shards;
+  if (-1 == fetchAndDecode(index, &shards)) {
+    return -1;
+  }
+  blk->swap(shards[index]);
+  blk->resize(internalBlkLen(lbGroup.block(), index));
+  return 0;
+}
+
+int ECBlockGroup::fetchAndDecode(int skip, std::vector<string>* shards) const {
+  const Block& group = lbGroup.block();
+  int nData = schema.ndata();
+  int n = nBlks(group);
+  long long shardLen = internalBlkLen(group, 0);
+
+  shards->assign(n, string());
+  std::vector<bool> present(n, false);
+  int nPresent = 0;
+  for (int i = 0; i < n && nPresent < nData; ++i) {
+    if (i == skip || i >= lbGroup.chunkserverinfos_size()
+        || lbGroup.chunkserverinfos(i).chunkserverip().empty()) {
+      continue;
+    }
+    Block blk;
+    blk.set_blockid(internalBlkID(group, i));
+    blk.set_blocklen(internalBlkLen(group, i));
+    if (-1 == fetchBlk(blk, lbGroup.chunkserverinfos(i), &(*shards)[i])) {
+      LOG_WARN << "Failed to read internal block " << blk.blockid() << " of block group "
+               << group.blockid();
+      continue;
+    }
+    present[i] = true;
+    ++nPresent;
+  }
+  if (nPresent < nData) {
+    LOG_ERROR << "Only " << nPresent << " internal blocks of block group " << group.blockid()
+              << " are readable, " << nData << " required";
+    return -1;
+  }
+
+  bool missingData = false;
+  for (int i = 0; i < n; ++i) {
+    (*shards)[i].resize(shardLen, 0);
+    missingData |= (i < nData && present[i] == false);
+  }
+  /// all the data is read, and no parity block is to be rebuilt
+  if (missingData == false && skip < nData) {
+    return 0;
+  }
+  std::vector<uint8_t*> ptrs(n);
+  for (int i = 0; i < n; ++i) {
+    ptrs[i] = reinterpret_cast<uint8_t*>(&(*shards)[i][0]);
+  }
+  if (shardLen > 0 && -1 == rs.decode(ptrs.data(), present, shardLen)) {
+    return -1;
+  }
+  return 0;
+}
+
+int ECBlockGroup::fetchBlk(const Block& blk, const ChunkserverInfo& cs, string* data) {
+  struct sockaddr_in serverAddr;
+  memset(&serverAddr, 0, sizeof(serverAddr));
+  serverAddr.sin_family = AF_INET;
+  serverAddr.sin_port = htons(cs.chunkserverport());
+  if (inet_pton(AF_INET, cs.chunkserverip().c_str(), &serverAddr.sin_addr) <= 0) {
+    LOG_ERROR << "inet_pton() error for: " << cs.chunkserverip();
+    return -1;
+  }
+  int sockfd = socket(AF_INET, SOCK_STREAM, 0);
+  if (sockfd < 0) {
+    LOG_ERROR << "Failed to create socket: " << strerror(errno);
+    return -1;
+  }
+  if (connect(sockfd, (sockaddr*)&serverAddr, sizeof(serverAddr)) < 0) {
+    LOG_ERROR << "Cannot connect to " << cs.chunkserverip() << ":" << cs.chunkserverport();
+    close(sockfd);
+    return -1;
+  }
+
+  /// OP_READ : len(Block) : Block
+  char op = OpCode::OP_READ;
+  string blkInfo = blk.SerializeAsString();
+  uint16_t infoLen = htons(blkInfo.size());
+  if (send(sockfd, &op, 1, 0) != 1 || send(sockfd, &infoLen, 2, 0) != 2
+      || send(sockfd, blkInfo.data(), blkInfo.size(), 0) != (ssize_t)blkInfo.size()) {
+    close(sockfd);
+    return -1;
+  }
+
+  /// op : len(data), in two halves : data : crcs
+  char opRet = OpCode::OP_FAILURE;
+  uint32_t halfLen[2] = {0, 0};
+  if (recv(sockfd, &opRet, 1, 0) != 1 || opRet != OpCode::OP_SUCCESS
+      || recv(sockfd, halfLen, 8, MSG_WAITALL) != 8) {
+    close(sockfd);
+    return -1;
+  }
+  uint64_t dataLen = ((uint64_t)ntohl(halfLen[0]) << 32) + ntohl(halfLen[1]);
+  if ((long long)dataLen != blk.blocklen()) {
+    LOG_ERROR << "Internal block " << blk.blockid() << " is " << (int64_t)dataLen
+              << " bytes, " << (int64_t)blk.blocklen() << " expected";
+    close(sockfd);
+    return -1;
+  }
+  data->resize(dataLen);
+  size_t nChunks = checksum::ChunkedChecksum::nChunks(dataLen);
+  string crcBytes(nChunks * 4, 0);
+  if ((dataLen > 0 && recv(sockfd, &(*data)[0], dataLen, MSG_WAITALL) != (ssize_t)dataLen)
+      || (nChunks > 0 && recv(sockfd, &crcBytes[0], crcBytes.size(), MSG_WAITALL) != (ssize_t)crcBytes.size())) {
+    close(sockfd);
+    return -1;
+  }
+  close(sockfd);
+
+  checksum::ChunkedChecksum dataChecksum;
+  dataChecksum.update(data->data(), data->size());
+  std::vector<uint32_t> recvedCrcs;
+  checksum::ChunkedChecksum::getCrcs(crcBytes.data(), nChunks, &recvedCrcs);
+  if (recvedCrcs != dataChecksum.finish()) {
+    LOG_ERROR << "Checksum mismatch of internal block " << blk.blockid() << " from "
+              << cs.chunkserverip() << ":" << cs.chunkserverport();
+    return -1;
+  }
+  return 0;
+}
+
+} // namespace minidfs
@@ -0,0 +1,89 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Header file for class ECBlockGroup.
+
+#ifndef EC_BLOCK_GROUP_H_
+#define EC_BLOCK_GROUP_H_
+
+#include <string>
+#include <vector>
+
+#include <proto/minidfs.pb.h>
+#include "erasure/reed_solomon.h"
+
+using std::string;
+
+namespace minidfs {
+
+/// \brief ECBlockGroup lays out the data of a block group of an erasure-coded
+/// file over its internal blocks, and fetches them back from the chunkservers.
+///
+/// The data is cut into cells of cellSize bytes. Cell c is stored in data block
+/// c % nData, at offset (c / nData) * cellSize, so a stripe is nData consecutive
+/// cells. Parity block i holds the Reed-Solomon parity of the data blocks, which
+/// are zero-padded to the length of the first one.
+/// Internal block i is block blockID + 1 + i of a group, see Block.ecSchema.
+class ECBlockGroup {
+ private:
+  /// the group, with the location of each internal block, empty if unknown
+  const LocatedBlock lbGroup;
+
+  const ECSchema schema;
+
+  const erasure::ReedSolomon rs;
+
+ public:
+  explicit ECBlockGroup(const LocatedBlock& lbGroup);
+
+  /// \brief Whether a schema can be used: 1 to 32 data and parity blocks each,
+  /// and a positive cell size.
+  static bool isValidSchema(const ECSchema& schema);
+
+  /// \brief Get the number of internal blocks of a group.
+  static int nBlks(const Block& group);
+
+  /// \brief Get the id of internal block index of a group.
+  static int internalBlkID(const Block& group, int index);
+
+  /// \brief Get the length of internal block index of a group.
+  static long long internalBlkLen(const Block& group, int index);
+
+  /// \brief Split the data of the group into its internal blocks.
+  ///
+  /// \param data blockLen bytes of file data
+  /// \param blks the returning internal blocks
+  void encode(const char* data, std::vector<string>* blks) const;
+
+  /// \brief Read the data of the group. The data blocks are read first, and the
+  /// missing ones are reconstructed from the parity blocks.
+  ///
+  /// \param data the returning data, blockLen bytes
+  /// \return return 0 on success, -1 if fewer than nData internal blocks are read
+  int read(string* data) const;
+
+  /// \brief Rebuild an internal block from the others.
+  ///
+  /// \param index index of the internal block
+  /// \param blk the returning block
+  /// \return return 0 on success, -1 if fewer than nData internal blocks are read
+  int reconstruct(int index, string* blk) const;
+
+ private:
+  /// \brief Fetch nData internal blocks other than skip, data blocks first,
+  /// and decode the missing ones. The data blocks are padded to the length of
+  /// the first one.
+  ///
+  /// \return return 0 on success, -1 for errors
+  int fetchAndDecode(int skip, std::vector<string>* shards) const;
+
+  /// \brief Fetch an internal block from a chunkserver, verifying its checksums.
+  ///
+  /// \return return 0 on success, -1 for errors
+  static int fetchBlk(const Block& blk, const ChunkserverInfo& cs, string* data);
+};
+
+} // namespace minidfs
+
+#endif
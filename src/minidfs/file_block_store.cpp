@@ -0,0 +1,301 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include <minidfs/file_block_store.hpp>
+#include "checksum/chunked_checksum.h"
+#include "logging/logger.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+namespace minidfs {
+
+/// \brief Writes a block to dir/tmp/blk_<id>.<n>, preallocated to its length,
+/// and renames it into place on commit.
+class FileBlockWriter : public BlockWriter {
+ private:
+  FileBlockStore* store;
+  int bID;
+  long long len;
+  string tmpFile;
+  int fd;
+  BlockSyncer syncer;
+  long long written;
+  bool committed;
+
+ public:
+  FileBlockWriter(FileBlockStore* store, int bID, long long len, const string& tmpFile)
+      : store(store), bID(bID), len(len), tmpFile(tmpFile),
+        fd(::open(tmpFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)),
+        syncer(fd, store->syncPolicy, 0), written(0), committed(false) {
+    /// contiguous on disk, and no ENOSPC halfway
+    if (fd != -1 && len > 0 && posix_fallocate(fd, 0, len) != 0) {
+      LOG_WARN << "Failed to preallocate " << tmpFile;
+    }
+  }
+
+  ~FileBlockWriter() {
+    if (fd != -1) {
+      ::close(fd);
+    }
+    if (committed == false) {
+      ::remove(tmpFile.c_str());
+    }
+  }
+
+  bool isOpen() const {
+    return fd != -1;
+  }
+
+  virtual int write(const char* data, size_t n) override {
+    if (written + (long long)n > len) {
+      return -1;
+    }
+    while (n > 0) {
+      ssize_t ret = ::write(fd, data, n);
+      if (ret <= 0) {
+        return -1;
+      }
+      syncer.wrote(ret);
+      written += ret;
+      data += ret;
+      n -= ret;
+    }
+    return 0;
+  }
+
+  virtual int commit(const std::vector<uint32_t>& crcs) override {
+    if (written != len || -1 == syncer.sync()) {
+      LOG_ERROR << "Failed to write " << tmpFile;
+      return -1;
+    }
+    ::close(fd);
+    fd = -1;
+    /// the checksums first
+    string blkFile = store->blkIndex.blkFilePath(bID);
+    if (-1 == FileBlockStore::writeBlkMeta(tmpFile + ".meta", crcs, store->syncPolicy)
+        || -1 == ::rename((tmpFile + ".meta").c_str(), (blkFile + ".meta").c_str())) {
+      LOG_ERROR << "Failed to write checksums of block " << bID;
+      ::remove((tmpFile + ".meta").c_str());
+    }
+    {
+      std::lock_guard<std::mutex> lockBlks(store->mutexBlks);
+      if (::rename(tmpFile.c_str(), blkFile.c_str()) == -1) {
+        LOG_ERROR << "Failed to move block " << bID << " into " << store->dir
+                  << ": " << strerror(errno);
+        return -1;
+      }
+      committed = true;
+      store->blks.insert(bID);
+    }
+    /// the renames
+    if (-1 == syncer.syncDir(blkFile.substr(0, blkFile.rfind('/')))) {
+      LOG_ERROR << "Failed to sync the folder of block " << bID;
+      return -1;
+    }
+    return 0;
+  }
+};
+
+/// \brief Reads a block file.
+class FileBlockReader : public BlockReader {
+ private:
+  string blkFile;
+  int fd;
+  long long len;
+
+ public:
+  FileBlockReader(const string& blkFile, int fd, long long len)
+      : blkFile(blkFile), fd(fd), len(len) {
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+  }
+
+  ~FileBlockReader() {
+    ::close(fd);
+  }
+
+  virtual long long length() const override {
+    return len;
+  }
+
+  virtual int read(char* buf, size_t n) override {
+    return ::read(fd, buf, n);
+  }
+
+  virtual int seek(long long offset) override {
+    return ::lseek(fd, offset, SEEK_SET) == -1 ? -1 : 0;
+  }
+
+  virtual int readCrcs(std::vector<uint32_t>* crcs) override {
+    std::ifstream fIn(blkFile + ".meta", std::ios::in | std::ios::binary);
+    if (fIn.is_open() == false) {
+      return -1;
+    }
+    uint32_t bytesPerChecksum = 0;
+    fIn.read(reinterpret_cast<char*>(&bytesPerChecksum), 4);
+    if (!fIn || ntohl(bytesPerChecksum) != checksum::ChunkedChecksum::kBytesPerChecksum) {
+      return -1;
+    }
+    size_t nChunks = checksum::ChunkedChecksum::nChunks(len);
+    string buf(nChunks * 4, 0);
+    fIn.read(&buf[0], buf.size());
+    if (fIn.gcount() != (std::streamsize)buf.size()) {
+      LOG_ERROR << "Truncated checksums of " << blkFile;
+      return -1;
+    }
+    checksum::ChunkedChecksum::getCrcs(buf.data(), nChunks, crcs);
+    return 0;
+  }
+
+  virtual void dropCache() override {
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+  }
+};
+
+FileBlockStore::FileBlockStore(const string& dir, const StoreOptions& options)
+    : dir(dir), stagingDir(dir + "/tmp"), syncPolicy(options.syncPolicy), nextStaging(0),
+      blkIndex(dir, dir + "/block_index", std::thread::hardware_concurrency()),
+      blkDeleter(dir + "/pending_deletes",
+                 std::bind(&BlockIndex::blkFilePath, &blkIndex, std::placeholders::_1),
+                 options.blkDeleteBatch, options.blkDeleteInterval) {
+}
+
+int FileBlockStore::start(std::vector<int>* blkIDs) {
+  /// finish the deletions before the last shutdown
+  blkDeleter.start();
+
+  if (::mkdir(stagingDir.c_str(), 0755) == -1 && errno != EEXIST) {
+    LOG_ERROR << "Failed to create " << stagingDir << ": " << strerror(errno);
+    return -1;
+  }
+  /// the blocks being written before the last shutdown
+  if (auto d = opendir(stagingDir.c_str())) {
+    while (struct dirent* entry = readdir(d)) {
+      if (entry->d_name[0] != '.') {
+        ::unlink((stagingDir + "/" + entry->d_name).c_str());
+      }
+    }
+    closedir(d);
+  }
+
+  std::set<int> stored;
+  if (-1 == blkIndex.prepare() || -1 == blkIndex.load(&stored)) {
+    return -1;
+  }
+  {
+    std::lock_guard<std::mutex> lockBlks(mutexBlks);
+    for (int blkid : stored) {
+      /// it was deleted, but the file is not unlinked yet
+      if (blkDeleter.isPending(blkid) == false) {
+        blks.emplace_hint(blks.end(), blkid);
+      }
+    }
+    blkIDs->assign(blks.begin(), blks.end());
+  }
+  checkpoint();
+  return 0;
+}
+
+std::unique_ptr<BlockWriter> FileBlockStore::create(int bID, long long len) {
+  /// unique, the same block may be received twice at once
+  string tmpFile = stagingDir + "/blk_" + std::to_string(bID) + "." + std::to_string(nextStaging++);
+  std::unique_ptr<FileBlockWriter> writer(new FileBlockWriter(this, bID, len, tmpFile));
+  if (writer->isOpen() == false) {
+    LOG_ERROR << "Failed to open " << tmpFile << ": " << strerror(errno);
+    return nullptr;
+  }
+  return writer;
+}
+
+std::unique_ptr<BlockReader> FileBlockStore::open(int bID) {
+  string blkFile = blkIndex.blkFilePath(bID);
+  int fd = ::open(blkFile.c_str(), O_RDONLY);
+  if (fd == -1) {
+    LOG_ERROR << "Failed to open " << blkFile;
+    return nullptr;
+  }
+  struct stat st;
+  if (fstat(fd, &st) == -1) {
+    ::close(fd);
+    return nullptr;
+  }
+  return std::unique_ptr<BlockReader>(new FileBlockReader(blkFile, fd, st.st_size));
+}
+
+int FileBlockStore::remove(const std::vector<int>& blkIDs) {
+  std::vector<int> removed;
+  {
+    std::lock_guard<std::mutex> lockBlks(mutexBlks);
+    for (int bID : blkIDs) {
+      if (blks.erase(bID) > 0) {
+        removed.push_back(bID);
+      }
+    }
+  }
+  return blkDeleter.remove(removed);
+}
+
+int FileBlockStore::removeCorrupt(int bID) {
+  {
+    std::lock_guard<std::mutex> lockBlks(mutexBlks);
+    blks.erase(bID);
+  }
+  /// not through blkDeleter: the block may be received again before it unlinks
+  /// the files. Readers having it open are not affected.
+  string blkFile = blkIndex.blkFilePath(bID);
+  ::unlink((blkFile + ".meta").c_str());
+  return ::unlink(blkFile.c_str());
+}
+
+int FileBlockStore::setCrcs(int bID, const std::vector<uint32_t>& crcs) {
+  string metaFile = blkIndex.blkFilePath(bID) + ".meta";
+  if (-1 == writeBlkMeta(metaFile + ".tmp", crcs, syncPolicy)) {
+    return -1;
+  }
+  return ::rename((metaFile + ".tmp").c_str(), metaFile.c_str());
+}
+
+int FileBlockStore::checkpoint() {
+  std::vector<int64_t> mtimes;
+  std::vector<int> ids;
+  {
+    /// no block is moved into the subdirs in between
+    std::lock_guard<std::mutex> lockBlks(mutexBlks);
+    if (-1 == blkIndex.stampSubdirs(&mtimes)) {
+      return -1;
+    }
+    ids.assign(blks.begin(), blks.end());
+  }
+  if (-1 == blkIndex.save(ids, mtimes)) {
+    LOG_ERROR << "Failed to save the block index of " << dir;
+    return -1;
+  }
+  return 0;
+}
+
+int FileBlockStore::writeBlkMeta(const string& metaFile, const std::vector<uint32_t>& crcs,
+                                 const string& syncPolicy) {
+  int fd = ::open(metaFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    return -1;
+  }
+  uint32_t bytesPerChecksum = htonl(checksum::ChunkedChecksum::kBytesPerChecksum);
+  string buf(reinterpret_cast<char*>(&bytesPerChecksum), 4);
+  checksum::ChunkedChecksum::putCrcs(crcs, &buf);
+  BlockSyncer syncer(fd, syncPolicy, 0);
+  int ret = (::write(fd, buf.data(), buf.size()) == (ssize_t)buf.size()) ? syncer.sync() : -1;
+  ::close(fd);
+  return ret;
+}
+
+} // namespace minidfs
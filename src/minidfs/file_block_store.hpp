@@ -0,0 +1,86 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Header file for class FileBlockStore.
+
+#ifndef FILE_BLOCK_STORE_H_
+#define FILE_BLOCK_STORE_H_
+
+#include <set>
+#include <mutex>
+#include <atomic>
+
+#include <minidfs/block_store.hpp>
+#include <minidfs/block_index.hpp>
+#include <minidfs/block_deleter.hpp>
+
+namespace minidfs {
+
+/// \brief FileBlockStore stores each block in its own file, laid out by a BlockIndex:
+/// dir/subdir<xx>/blk_<id>. The checksums are stored in blk_<id>.meta next to it.
+///
+/// .meta file format:
+/// bytesPerChecksum : crc of each chunk
+/// 4 bytes          : 4 bytes each
+///
+/// A block is written to dir/tmp first, on the same filesystem, preallocated to
+/// its length. It is synced by syncPolicy, then renamed into place on commit.
+/// Removed blocks are unlinked in the background by a BlockDeleter.
+class FileBlockStore : public BlockStore {
+  friend class FileBlockWriter;
+
+ private:
+  /// folder that stores the blocks
+  const string dir;
+
+  /// folder of the blocks being written, emptied by start()
+  const string stagingDir;
+
+  /// when the data of a new block reaches the disk, see BlockSyncer
+  const string syncPolicy;
+
+  /// makes the names in stagingDir unique
+  std::atomic<unsigned long> nextStaging;
+
+  /// lays out the block files in subdirs, and snapshots them for the restart
+  BlockIndex blkIndex;
+
+  /// unlinks the files of removed blocks in the background
+  BlockDeleter blkDeleter;
+
+  /// ids of the stored blocks
+  std::set<int> blks;
+  /// a mutex for blks. Block files are renamed into the subdirs under it,
+  /// so that checkpoint() sees them either in blks or in the subdir mtimes.
+  std::mutex mutexBlks;
+
+ public:
+  /// \brief Create a FileBlockStore. Nothing is done until start().
+  FileBlockStore(const string& dir, const StoreOptions& options);
+
+  virtual int start(std::vector<int>* blkIDs) override;
+
+  virtual std::unique_ptr<BlockWriter> create(int bID, long long len) override;
+
+  virtual std::unique_ptr<BlockReader> open(int bID) override;
+
+  virtual int remove(const std::vector<int>& blkIDs) override;
+
+  virtual int removeCorrupt(int bID) override;
+
+  virtual int setCrcs(int bID, const std::vector<uint32_t>& crcs) override;
+
+  virtual int checkpoint() override;
+
+ private:
+  /// \brief Write the checksums of a block to a .meta file, synced by syncPolicy.
+  ///
+  /// \return return 0 on success, -1 for errors.
+  static int writeBlkMeta(const string& metaFile, const std::vector<uint32_t>& crcs,
+                          const string& syncPolicy);
+};
+
+} // namespace minidfs
+
+#endif
@@ -5,12 +5,17 @@
 /// \brief A simple program to interact with master and chunk_server to write/read data.
 
 
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
 #include <iostream>
 #include <string>
 
 #include <minidfs/dfs_client.hpp>
 #include "logging/logger.h"
 #include "config/config.h"
+#include "metrics/registry.h"
 
 using std::string;
 using std::cout;
@@ -23,6 +28,14 @@ int masterPort;
 int bufferSize;
 string bufferBlkName;
 long long blockSize;
+/// the schema of -put-ec
+int ecDataBlks;
+int ecParityBlks;
+int ecCellSize;
+/// the codec of -put-compressed
+string compressionCodec;
+/// -put stores files up to this length inline in the master
+long long inlineThreshold;
 
 void configure() {
   config::Config c(config_file);
@@ -33,16 +46,25 @@ void configure() {
   c.get("bufferSize", &bufferSize);
   c.get("bufferBlkName", &bufferBlkName);
   c.get("blockSize", &blockSize);
+  c.get("ecDataBlks", &ecDataBlks);
+  c.get("ecParityBlks", &ecParityBlks);
+  c.get("ecCellSize", &ecCellSize);
+  c.get("compressionCodec", &compressionCodec);
+  c.get("inlineThreshold", &inlineThreshold);
 }
 
 void usage() {
   cout << "Usage: ./bin/dfs_shell"
        << " [-ls <path>] \n"
        << " [-put <src> <dst>]\n"
+       << " [-put-ec <src> <dst>]\n"
+       << " [-put-compressed <src> <dst>]\n"
+       << " [-put-small <srcdir> <dstdir>]\n"
        << " [-get <src> <dst>]\n"
        << " [-rm <filename>]\n"
        << " [-exists <file>]\n"
        << " [-mkdir <path>]\n"
+       << " [-stats]\n"
        << std::endl;
 }
 
@@ -51,7 +73,31 @@ int main(int argc, char const *argv[]) {
   logging::Logger::set_log_level(logging::INFO);
 
   configure();
-  minidfs::DFSClient client(masterIP, masterPort, bufferSize, bufferBlkName, blockSize);
+  minidfs::DFSClient client(masterIP, masterPort, bufferSize, bufferBlkName, blockSize,
+                            inlineThreshold);
+  if (argc == 2 && strcmp("-stats", argv[1]) == 0) {
+    minidfs::ServerStats stats;
+    if (-1 == client.serverStats(stats)) {
+      return 0;
+    }
+    cout << "Lane \t Threads \t Active \t Queued \t Handled \t Rejected \t Wait(us) \t Run(us)\n";
+    for (const auto& lane : stats.lanes()) {
+      long long completed = std::max<long long>(lane.completed(), 1);
+      cout << lane.name() << "\t" << lane.nthread() << "/" << lane.maxthread() << "\t"
+           << lane.active() << "\t" << lane.queued() << "\t" << lane.handled() << "\t"
+           << lane.rejected() << "\t" << lane.waitus() / completed << "\t"
+           << lane.runus() / completed << std::endl;
+    }
+    cout << "\nCaller \t Queued \t Handled \t Rejected \t Calls/s\n";
+    for (const auto& caller : stats.callers()) {
+      cout << caller.caller() << "\t" << caller.queued() << "\t" << caller.handled()
+           << "\t" << caller.rejected() << "\t" << caller.rate() << std::endl;
+    }
+    string metrics;
+    metrics::Registry::format_text(stats.metrics(), &metrics);
+    cout << "\nMetrics\n" << metrics;
+    return 0;
+  }
   if (argc < 3 || argc > 4) {
      LOG_ERROR << "Wrong number of arguments.";
     usage();
@@ -78,6 +124,67 @@ int main(int argc, char const *argv[]) {
       return 0;
     }
      LOG_INFO << "Succeed to put a file";
+  } else if (strcmp("-put-ec", argv[1]) == 0) {
+    if (argc != 4) {
+       LOG_ERROR << "Wrong number of arguments.";
+      usage();
+      return 0;
+    }
+    string src(argv[2]), dst(argv[3]);
+    minidfs::ECSchema schema;
+    schema.set_ndata(ecDataBlks);
+    schema.set_nparity(ecParityBlks);
+    schema.set_cellsize(ecCellSize);
+    if (-1 == client.putFileEC(src, dst, schema)) {
+       LOG_ERROR << "Failed to put an erasure-coded file";
+      return 0;
+    }
+     LOG_INFO << "Succeed to put an erasure-coded file";
+  } else if (strcmp("-put-compressed", argv[1]) == 0) {
+    if (argc != 4) {
+       LOG_ERROR << "Wrong number of arguments.";
+      usage();
+      return 0;
+    }
+    string src(argv[2]), dst(argv[3]);
+    compression::Codec codec;
+    if (-1 == compression::parseCodec(compressionCodec, &codec)) {
+       LOG_ERROR << "Unknown compression codec: " << compressionCodec;
+      return 0;
+    }
+    if (-1 == client.putFileCompressed(src, dst, codec)) {
+       LOG_ERROR << "Failed to put a compressed file";
+      return 0;
+    }
+     LOG_INFO << "Succeed to put a compressed file";
+  } else if (strcmp("-put-small", argv[1]) == 0) {
+    if (argc != 4) {
+       LOG_ERROR << "Wrong number of arguments.";
+      usage();
+      return 0;
+    }
+    string srcDir(argv[2]), dstDir(argv[3]);
+    /// the regular files in srcDir
+    std::vector<string> srcs;
+    DIR* dir = opendir(srcDir.c_str());
+    if (dir == nullptr) {
+       LOG_ERROR << "Failed to open " << srcDir;
+      return 0;
+    }
+    while (struct dirent* entry = readdir(dir)) {
+      string src = srcDir + "/" + entry->d_name;
+      struct stat st;
+      if (stat(src.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+        srcs.push_back(src);
+      }
+    }
+    closedir(dir);
+    std::sort(srcs.begin(), srcs.end());
+    if (-1 == client.putSmallFiles(srcs, dstDir)) {
+       LOG_ERROR << "Failed to put small files";
+      return 0;
+    }
+     LOG_INFO << "Succeed to put " << (int)srcs.size() << " files";
   } else if (strcmp("-get", argv[1]) == 0) {
     if (argc != 4) {
        LOG_ERROR << "Wrong number of arguments.";
@@ -8,6 +8,10 @@
 #include <minidfs/dfs_master.hpp>
 #include "logging/logger.h"
 #include "config/config.h"
+#include "logging/async_logging.h"
+#include "metrics/reporter.h"
+
+#include <memory>
 
 const char* config_file = "./config/master.txt";
 
@@ -17,6 +21,18 @@ int serverPort = 12345;
 int maxConn = 3;
 int replicationFactor = 1;
 int nThread = 2;
+int nChunkserverThread = 1;
+int maxInlineSize = 4096;
+int maxQueuedCalls = 1024;
+int busyRetryMs = 50;
+int maxThread = 0;
+int maxQueueDelayMs = 10;
+int nReaderThread = 2;
+string logLevel = "INFO";
+string logFile = "";
+int logFlushInterval = 1000;
+string logOverflow = "block";
+int metricsInterval = 60000;
 
 void configure() {
   config::Config c(config_file);
@@ -27,15 +43,47 @@ void configure() {
   c.get("maxConn", &maxConn);
   c.get("replicationFactor", &replicationFactor);
   c.get("nThread", &nThread);
+  c.get("nChunkserverThread", &nChunkserverThread);
+  c.get("maxInlineSize", &maxInlineSize);
+  c.get("maxQueuedCalls", &maxQueuedCalls);
+  c.get("busyRetryMs", &busyRetryMs);
+  c.get("maxThread", &maxThread);
+  c.get("maxQueueDelayMs", &maxQueueDelayMs);
+  c.get("nReaderThread", &nReaderThread);
+  c.get("logLevel", &logLevel);
+  c.get("logFile", &logFile);
+  c.get("logFlushInterval", &logFlushInterval);
+  c.get("logOverflow", &logOverflow);
+  c.get("metricsInterval", &metricsInterval);
 }
 
 /// Start Master and provide services endlessly.
 int main(int argc, char const *argv[])
 {
   configure();
-  logging::Logger::set_log_level(logging::INFO);
+  logging::LogLevel level = logging::INFO;
+  if (logging::Logger::parse_log_level(logLevel, &level) == false) {
+    LOG_ERROR << "Unknown log level: " << logLevel;
+    return 1;
+  }
+  logging::Logger::set_log_level(level);
+  std::unique_ptr<logging::AsyncLogging> asyncLogging;
+  if (logFile.empty() == false) {
+    asyncLogging.reset(new logging::AsyncLogging(logFile, logFlushInterval,
+                                                 logOverflow == "drop" ? logging::DROP : logging::BLOCK));
+    if (asyncLogging->start() == 0) {
+      asyncLogging->attach();
+    }
+  }
+  std::unique_ptr<metrics::Reporter> reporter;
+  if (metricsInterval > 0) {
+    reporter.reset(new metrics::Reporter(metrics::Registry::global(), metricsInterval));
+    reporter->start();
+  }
   LOG_INFO << "Start Master...";
-  minidfs::DFSMaster master(nameSysFile, editLogFile,serverPort, maxConn, replicationFactor, nThread);
+  minidfs::DFSMaster master(nameSysFile, editLogFile,serverPort, maxConn, replicationFactor, nThread,
+                            nChunkserverThread, maxInlineSize, maxQueuedCalls, busyRetryMs,
+                            maxThread, maxQueueDelayMs, nReaderThread);
   
   if (argc == 2 && 0 == strcmp(argv[1], "-format")) {
     master.format();
@@ -28,6 +28,9 @@ class OpCode {
   static constexpr char OP_EXIST = 23;
   static constexpr char OP_NOT_EXIST = 24;
   static constexpr char OP_SAFE_MODE = 30;
+  /// the call is shed because the master is overloaded. The response is a
+  /// serialized ServerBusy telling when to retry.
+  static constexpr char OP_SERVER_BUSY = 31;
 
   /////////////////////////////////
   /// Op code for chunkserver protocol
@@ -35,6 +38,11 @@ class OpCode {
 
   static constexpr char OP_COPY = 40;
   static constexpr char OP_NO_BLK_TASK = 41;
+  /// master doesn't know the blocks of the chunkserver, e.g. after master restarts
+  static constexpr char OP_BLK_REPORT_REQUIRED = 42;
+  static constexpr char OP_DELETE = 43;
+  /// rebuild a lost internal block of a block group from the others
+  static constexpr char OP_RECONSTRUCT = 44;
 
   /////////////////////////////////
   /// Op code for data transfer
@@ -50,6 +58,7 @@ class OpCode {
   static constexpr char OP_CREATE = 80;
   static constexpr char OP_MKDIR = 81;
   static constexpr char OP_REMOVE = 82;
+  static constexpr char OP_CREATE_PACK = 83;
   static constexpr char OP_LOG_FAILURE = 90;
 };
 
@@ -5,8 +5,11 @@
 
 
 #include <minidfs/remote_reader.hpp>
+#include <minidfs/ec_block_group.hpp>
 #include "logging/logger.h"
 
+#include <sstream>
+
 
 namespace minidfs {
 
@@ -42,10 +45,26 @@ int RemoteReader::open() {
               << "Error code "  << retOp;
     return -1;
   }
+  /// a file stored inline, or an empty file, has no blocks
+  if (lbs.locatedblks_size() == 0) {
+    return 0;
+  }
   return remoteSeek(pos);
 }
 
 int64_t RemoteReader::read(void* buffer, uint64_t size) {
+  /// a file stored inline is served from the response of the master
+  const string& inlineData = lbs.inlinedata();
+  if (inlineData.empty() == false) {
+    if (pos >= (uint64_t)inlineData.size()) {
+      return -1;
+    }
+    uint64_t nRead = std::min<uint64_t>(size, inlineData.size() - pos);
+    memcpy(buffer, inlineData.data() + pos, nRead);
+    pos += nRead;
+    return nRead;
+  }
+
   long long byteLeft = size;
   long long byteWritten = 0;
   while (byteLeft > 0) {
@@ -53,9 +72,22 @@ int64_t RemoteReader::read(void* buffer, uint64_t size) {
       if (-1 == remoteSeek(pos)) {
         return -1;
       }
-      bufferOneBlk(currentLB);
+      if (-1 == bufferOneBlk(currentLB)) {
+        return -1;
+      }
     }
     long long nRead = byteLeft < (bufferedEnd-pos+1) ? byteLeft : (bufferedEnd-pos+1);
+
+    if (currentLB.block().codec() != compression::kCodecNone) {
+      if (-1 == bufferedCompressedBlk.read(pos - bufferedStart, nRead, (char*)buffer+byteWritten)) {
+        LOG_ERROR << "Failed to decompress block " << currentLB.block().blockid();
+        return -1;
+      }
+      pos += nRead;
+      byteLeft -= nRead;
+      byteWritten += nRead;
+      continue;
+    }
     
     std::ifstream fIn(bufferBlkName, std::ios::in | std::ios::binary);
     if (fIn.is_open() == false) {
@@ -81,6 +113,14 @@ int64_t RemoteReader::read(void* buffer, uint64_t size) {
 }
 
 int64_t RemoteReader::readAll(std::ofstream& f) {
+  const string& inlineData = lbs.inlinedata();
+  if (inlineData.empty() == false) {
+    f.write(inlineData.data() + pos, inlineData.size() - pos);
+    int64_t nRead = inlineData.size() - pos;
+    pos = inlineData.size();
+    return nRead;
+  }
+
   long long nRead = 0;
   while (-1 != remoteSeek(pos)) {
     long long newRead = readBlk(f, currentLB);
@@ -102,6 +142,14 @@ int RemoteReader::remoteSeek(uint64_t offset) {
 }
 
 int RemoteReader::bufferOneBlk(const LocatedBlock& lb) {
+  if (lb.block().codec() != compression::kCodecNone) {
+    if (-1 == fetchCompressedBlk(lb, &bufferedCompressedBlk)) {
+      return -1;
+    }
+    bufferedStart = bufferedEnd + 1;
+    bufferedEnd += bufferedCompressedBlk.length();
+    return 0;
+  }
   std::ofstream f(bufferBlkName, std::ios::out | std::ios::binary | std::ios::trunc);
   if (f.is_open() == false) {
     LOG_ERROR << "Failed to open " << bufferBlkName;
@@ -127,16 +175,66 @@ int RemoteReader::bufferOneBlk(const LocatedBlock& lb) {
 }
 
 int64_t RemoteReader::readBlk(std::ofstream& f, const LocatedBlock& lb) const {
-  int sockfd = connChunkserver(lb);
+  if (lb.block().has_ecschema()) {
+    string data;
+    if (-1 == ECBlockGroup(lb).read(&data)) {
+      LOG_ERROR << "Failed to read block group " << lb.block().blockid();
+      return -1;
+    }
+    f.write(data.data(), data.size());
+    return data.size();
+  }
+  if (lb.block().codec() != compression::kCodecNone) {
+    compression::CompressedBlock blk;
+    string data;
+    if (-1 == fetchCompressedBlk(lb, &blk) || -1 == blk.readAll(&data)) {
+      LOG_ERROR << "Failed to decompress block " << lb.block().blockid();
+      return -1;
+    }
+    f.write(data.data(), data.size());
+    return data.size();
+  }
+  return fetchBlk(f, lb);
+}
+
+int64_t RemoteReader::fetchBlk(std::ostream& f, const LocatedBlock& lb) const {
+  auto start = f.tellp();
+  for (int i = 0; i < lb.chunkserverinfos_size(); ++i) {
+    int64_t ret = readBlkFrom(f, lb.block(), lb.chunkserverinfos(i));
+    if (ret != -1) {
+      return ret;
+    }
+    /// drop the partial data and try the next replica
+    f.clear();
+    f.seekp(start);
+  }
+  LOG_ERROR << "Failed to read block from chunkservers " << lb.DebugString();
+  return -1;
+}
+
+int RemoteReader::fetchCompressedBlk(const LocatedBlock& lb,
+                                     compression::CompressedBlock* blk) const {
+  std::ostringstream out;
+  if (-1 == fetchBlk(out, lb)) {
+    return -1;
+  }
+  string stored = out.str();
+  if (-1 == blk->open(&stored) || blk->length() != lb.block().blocklen()) {
+    LOG_ERROR << "Malformed compressed block " << lb.block().blockid();
+    return -1;
+  }
+  return 0;
+}
+
+int64_t RemoteReader::readBlkFrom(std::ostream& f, const Block& blk, const ChunkserverInfo& cs) const {
+  int sockfd = connChunkserver(cs);
 
   if (sockfd == -1) {
-    LOG_ERROR << "Failed to connect to chunkservers " << lb.DebugString();
-    close(sockfd);
     return -1;
   }
 
   /// send read request
-  if (-1 == blkReadRequest(sockfd, lb.block())) {
+  if (-1 == blkReadRequest(sockfd, blk)) {
     LOG_ERROR << "Failed to send block reading request";
     close(sockfd);
     return -1;
@@ -144,14 +242,14 @@ int64_t RemoteReader::readBlk(std::ofstream& f, const LocatedBlock& lb) const {
   
   /// recv opcode
   char opRet = 0;
-  if (recv(sockfd, &opRet, 1, 0) == -1) {
+  if (recv(sockfd, &opRet, 1, 0) <= 0) {
     close(sockfd);
     return -1;
   }
 
   if (opRet != OpCode::OP_SUCCESS) {
     LOG_ERROR << "Failed to open " << filename << ' '
-              << "Error code "  << opRet;
+              << "Error code "  << (int)opRet;
     close(sockfd);
     return -1;
   }
@@ -164,75 +262,100 @@ int64_t RemoteReader::readBlk(std::ofstream& f, const LocatedBlock& lb) const {
   uint64_t dataLen = 0;
   uint32_t halfLen = 0;
   /// read the first half
-  if (recv(sockfd, &halfLen, 4, 0) < 0) {
+  if (recv(sockfd, &halfLen, 4, MSG_WAITALL) != 4) {
     close(sockfd);
     return -1;
   }
   dataLen = ntohl(halfLen);
   dataLen <<= 32;
   /// the second half
-  if (recv(sockfd, &halfLen, 4, 0) < 0) {
+  if (recv(sockfd, &halfLen, 4, MSG_WAITALL) != 4) {
     close(sockfd);
     return -1;
   }
   dataLen += ntohl(halfLen);
 
+  /// a range is sent in whole checksum chunks, [skip, skip + keep) of it is asked for
+  long long skip = 0;
+  long long keep = dataLen;
+  if (blk.has_extent()) {
+    skip = blk.extent().offset() % checksum::ChunkedChecksum::kBytesPerChecksum;
+    keep = blk.extent().len();
+    if (skip + keep > (long long)dataLen) {
+      close(sockfd);
+      return -1;
+    }
+  }
+
   std::vector<char> dataBuffer(BUFFER_SIZE);
+  checksum::ChunkedChecksum dataChecksum;
   long long byteLeft = dataLen;
   while (byteLeft > 0) {
     int nRead = byteLeft < BUFFER_SIZE ? byteLeft : BUFFER_SIZE;
-    if ((nRead = recv(sockfd, dataBuffer.data(), nRead, 0)) == -1) {
+    if ((nRead = recv(sockfd, dataBuffer.data(), nRead, 0)) <= 0) {
       close(sockfd);
       return -1;
     }
     /// write to file stream
-    f.write(dataBuffer.data(), nRead);
+    long long recved = dataLen - byteLeft;
+    long long from = std::max(skip, recved);
+    long long to = std::min(skip + keep, recved + nRead);
+    if (from < to) {
+      f.write(dataBuffer.data() + (from - recved), to - from);
+    }
+    dataChecksum.update(dataBuffer.data(), nRead);
     byteLeft -= nRead;
   }
 
+  /// verify the checksums following the data
+  const auto& crcs = dataChecksum.finish();
+  string crcBytes(crcs.size() * 4, 0);
+  if (crcBytes.empty() == false
+      && recv(sockfd, &crcBytes[0], crcBytes.size(), MSG_WAITALL) != (ssize_t)crcBytes.size()) {
+    close(sockfd);
+    return -1;
+  }
   close(sockfd);
-  return dataLen;
+
+  std::vector<uint32_t> recvedCrcs;
+  checksum::ChunkedChecksum::getCrcs(crcBytes.data(), crcs.size(), &recvedCrcs);
+  for (size_t i = 0; i < crcs.size(); ++i) {
+    if (crcs[i] != recvedCrcs[i]) {
+      LOG_ERROR << "Checksum mismatch of block " << blk.blockid() << " at offset "
+                << (int64_t)i * checksum::ChunkedChecksum::kBytesPerChecksum
+                << " from " << cs.chunkserverip() << ":" << cs.chunkserverport();
+      return -1;
+    }
+  }
+  return keep;
 }
 
-int RemoteReader::connChunkserver(const LocatedBlock& lb) const {
+int RemoteReader::connChunkserver(const ChunkserverInfo& cs) const {
   /// chunkserver IP
-  string serverIP;
+  string serverIP = cs.chunkserverip();
   /// chunkserver port
-  int serverPort;
-  struct sockaddr_in serverAddr;
+  int serverPort = cs.chunkserverport();
 
-  int sockfd;
-  int i = -1;
-  for (i = 0; i < lb.chunkserverinfos_size(); ++i) {
-    serverIP = lb.chunkserverinfos(i).chunkserverip();
-    serverPort = lb.chunkserverinfos(i).chunkserverport();
-
-    /// set the chunkserver struct
-    memset(&serverAddr, 0, sizeof(serverAddr));
-    serverAddr.sin_family = AF_INET;
-    serverAddr.sin_port = htons(serverPort);
-    if (inet_pton(AF_INET, serverIP.c_str(), &serverAddr.sin_addr) < 0) {
-      LOG_ERROR << "inet_pton() error for: " << serverIP;
-      continue;
-    }
-    sockfd = socket(AF_INET, SOCK_STREAM, 0);
-    if (sockfd < 0) {
-      LOG_ERROR << "Failed to create socket: " << strerror(errno) << " errno: " << errno; 
-      continue;
-    }
-    if (connect(sockfd, (sockaddr*)&serverAddr, sizeof(serverAddr)) < 0) {
-      LOG_ERROR << "Cannot connect to " << serverIP;
-      continue;
-    }
-    LOG_INFO << "Succeed to connect chunkserver: " << serverIP << ":" << serverPort;
-    break;
+  /// set the chunkserver struct
+  struct sockaddr_in serverAddr;
+  memset(&serverAddr, 0, sizeof(serverAddr));
+  serverAddr.sin_family = AF_INET;
+  serverAddr.sin_port = htons(serverPort);
+  if (inet_pton(AF_INET, serverIP.c_str(), &serverAddr.sin_addr) < 0) {
+    LOG_ERROR << "inet_pton() error for: " << serverIP;
+    return -1;
   }
-
-  /// not even one chunkserver is connectable
-  if (i == -1 || i == lb.chunkserverinfos_size()) {
+  int sockfd = socket(AF_INET, SOCK_STREAM, 0);
+  if (sockfd < 0) {
+    LOG_ERROR << "Failed to create socket: " << strerror(errno) << " errno: " << errno; 
     return -1;
   }
-
+  if (connect(sockfd, (sockaddr*)&serverAddr, sizeof(serverAddr)) < 0) {
+    LOG_ERROR << "Cannot connect to " << serverIP << ":" << serverPort;
+    close(sockfd);
+    return -1;
+  }
+  LOG_INFO << "Succeed to connect chunkserver: " << serverIP << ":" << serverPort;
   return sockfd;
 }
 
@@ -262,7 +385,9 @@ int RemoteReader::blkReadRequest(int sockfd, const Block& blk) const {
 int RemoteReader::setLocatedBlk(int64_t offset, LocatedBlock& lb){
   int64_t totalLength = 0;
   for (int i = 0; i < lbs.locatedblks_size(); ++i) {
-    int64_t blkLen = lbs.locatedblks(i).block().blocklen();
+    const Block& blk = lbs.locatedblks(i).block();
+    /// a packed small file is a range of its container block
+    int64_t blkLen = blk.has_extent() ? blk.extent().len() : blk.blocklen();
     if (totalLength + blkLen > offset) {
       lb = lbs.locatedblks(i);
       return 0;
@@ -19,6 +19,8 @@
 
 #include <minidfs/client_protocol.hpp>
 #include <rpc/client_protocol_proxy.hpp>
+#include "checksum/chunked_checksum.h"
+#include "compression/compressed_block.h"
 
 using std::string;
 
@@ -35,7 +37,7 @@ class RemoteReader {
   /// each reader serves for only one file
   const string filename;
 
-  /// file related blocks
+  /// file related blocks, or the contents of a file stored inline
   LocatedBlocks lbs;
 
   /// keep track of the file pointer. It is the position to be read next.
@@ -53,6 +55,9 @@ class RemoteReader {
   int64_t bufferedEnd;
   /// filename used as the buffer of remote block data
   const string bufferBlkName;
+  /// the buffered block if it is stored compressed. It is kept compressed
+  /// in memory, and only the frames read are decompressed.
+  compression::CompressedBlock bufferedCompressedBlk;
 
   
 
@@ -105,18 +110,42 @@ class RemoteReader {
   /// \return return 0 on success, -1 for errors.
   int bufferOneBlk(const LocatedBlock& lb);
 
-  /// \brief Read a whole block into a output file stream
-  /// from a remote chunkserver.
+  /// \brief Read the file data of a whole block into a output file stream.
+  /// A block group is decoded, and a compressed block is decompressed.
   ///
   /// \param f output file stream
   /// \param lb block to be read
   /// \return size of data read  
   int64_t readBlk(std::ofstream& f, const LocatedBlock& lb) const;
 
-  /// \brief Connect with remote chunkservers.
-  /// \return return the connected socket fd with one of chunkservers.
+  /// \brief Fetch a whole block as stored from a remote chunkserver.
+  /// The replicas are tried in order until one of them is read and
+  /// matches its checksums.
+  ///
+  /// \param f output stream
+  /// \param lb block to be read
+  /// \return size of data fetched, -1 for errors
+  int64_t fetchBlk(std::ostream& f, const LocatedBlock& lb) const;
+
+  /// \brief Fetch a compressed block and parse its index.
+  ///
+  /// \param lb block to be read
+  /// \param blk the returning block
+  /// \return return 0 on success, -1 for errors
+  int fetchCompressedBlk(const LocatedBlock& lb, compression::CompressedBlock* blk) const;
+
+  /// \brief Read a whole block from one chunkserver, and verify the checksums.
+  ///
+  /// \param f output stream
+  /// \param blk block to be read
+  /// \param cs the chunkserver to read from
+  /// \return size of data read, -1 for errors or checksum mismatch.
+  int64_t readBlkFrom(std::ostream& f, const Block& blk, const ChunkserverInfo& cs) const;
+
+  /// \brief Connect with a remote chunkserver.
+  /// \return return the connected socket fd.
   /// return -1 for errors.
-  int connChunkserver(const LocatedBlock& lb) const;
+  int connChunkserver(const ChunkserverInfo& cs) const;
 
   /// \brief Send block reading request.
   ///
@@ -5,8 +5,11 @@
 
 
 #include <minidfs/remote_writer.hpp>
+#include <minidfs/ec_block_group.hpp>
 #include "logging/logger.h"
 
+#include <sstream>
+
 namespace minidfs {
 
 
@@ -16,7 +19,7 @@ RemoteWriter::RemoteWriter(const string& serverIP, int serverPort, const string&
                            const string& bufferBlkName)
     : master(new rpc::ClientProtocolProxy(serverIP, serverPort)),
       filename(file), BUFFER_SIZE(bufferSize), nTrial(nTrial), BLOCK_SIZE(blockSize),
-      bufferBlkName(bufferBlkName) {
+      bufferBlkName(bufferBlkName), codec(compression::kCodecNone) {
   pos = 0;
   blockStart = 0;
   blockPos = 0;
@@ -25,7 +28,7 @@ RemoteWriter::RemoteWriter(const string& serverIP, int serverPort, const string&
 RemoteWriter::RemoteWriter(RemoteWriter&& writer)
     : master(std::move(writer.master)), filename(writer.filename),
       BUFFER_SIZE(writer.BUFFER_SIZE), nTrial(writer.nTrial), BLOCK_SIZE(writer.BLOCK_SIZE),
-      bufferBlkName(writer.bufferBlkName) {
+      bufferBlkName(writer.bufferBlkName), codec(writer.codec) {
   pos = 0;
   blockStart = 0;
   blockPos = 0;
@@ -47,11 +50,66 @@ int RemoteWriter::open() {
   return 0;
 }
 
+int RemoteWriter::open(const ECSchema& schema) {
+  int retOp = master->createEC(filename, schema, &currentLB);
+  if (retOp != OpCode::OP_SUCCESS) {
+    LOG_ERROR << "Failed to create erasure-coded file: " << filename << '\t'
+              << "Error code: "  << retOp;
+    return -1;
+  }
+  pos = 0;
+  blockStart = 0;
+  blockPos = 0;
+  return 0;
+}
+
+int RemoteWriter::open(compression::Codec codec) {
+  if (-1 == open()) {
+    return -1;
+  }
+  this->codec = codec;
+  return 0;
+}
+
+int RemoteWriter::writePack(const Pack& files, const string& data) {
+  Pack pack(files);
+  LocatedBlock lb;
+  int retOp = master->createPack(pack, &lb);
+  if (retOp != OpCode::OP_SUCCESS) {
+    LOG_ERROR << "Failed to create " << pack.files_size() << " packed files, "
+              << "Error code: " << retOp;
+    return -1;
+  }
+  lb.mutable_block()->set_blocklen(data.size());
+  std::istringstream in(data);
+  int ret = sendBlk(in, lb);
+  if (ret <= 0) {
+    LOG_ERROR << "Failed to write container block " << lb.block().blockid();
+    return -1;
+  }
+
+  /// the chunkservers storing the container
+  LocatedBlock* container = pack.mutable_container();
+  *container->mutable_block() = lb.block();
+  for (int i = 0; i < ret; ++i) {
+    *container->add_chunkserverinfos() = lb.chunkserverinfos(i);
+  }
+  retOp = master->completePack(pack);
+  if (retOp != OpCode::OP_SUCCESS) {
+    LOG_ERROR << "Failed to complete container block " << lb.block().blockid()
+              << ", Error code: " << retOp;
+    return -1;
+  }
+  LOG_INFO << "Succeed writing " << pack.files_size() << " files in container block "
+           << lb.block().blockid();
+  return 0;
+}
+
 int64_t RemoteWriter::write(const void* buffer, uint64_t size) {
   long long byteLeft = size;
   while (byteLeft > 0) {
     /// the buffer in local fs is full
-    if (blockPos >= BLOCK_SIZE) {
+    if (blockPos >= blkCapacity()) {
       /// set block size befor sending it to chunkserver
       currentLB.mutable_block()->set_blocklen(blockPos);
 
@@ -81,7 +139,7 @@ int64_t RemoteWriter::write(const void* buffer, uint64_t size) {
       }
     }
 
-    long long nWrite = std::min(byteLeft, (long long)BLOCK_SIZE - blockPos);
+    long long nWrite = std::min(byteLeft, (long long)blkCapacity() - blockPos);
     std::ofstream fOut(bufferBlkName, std::ios::out | std::ios::binary | std::ios::trunc);
     if (fOut.is_open() == false) {
       LOG_ERROR << "Failed to open " << bufferBlkName;
@@ -112,7 +170,7 @@ int64_t RemoteWriter::writeAll(std::ifstream& f) {
   
   long long nLeft = fileLen;
   while (nLeft > 0) {
-    long long nWrite = std::min((long long)BLOCK_SIZE, nLeft);
+    long long nWrite = std::min((long long)blkCapacity(), nLeft);
     /// set block size befor sending it to chunkserver
     currentLB.mutable_block()->set_blocklen(nWrite);
     if (-1 == writeBlk(f, currentLB)){
@@ -148,6 +206,103 @@ int RemoteWriter::remoteClose() {
 }
 
 int64_t RemoteWriter::writeBlk(std::ifstream& f, const LocatedBlock& lb) const {
+  if (lb.block().has_ecschema()) {
+    return writeBlkGroup(f, lb);
+  }
+  /// the chunkservers store what they receive, the compressed block
+  LocatedBlock storedLB(lb);
+  std::istringstream compressed;
+  std::istream* in = &f;
+  if (codec != compression::kCodecNone) {
+    string data(lb.block().blocklen(), 0);
+    f.read(&data[0], data.size());
+    if (f.gcount() != (std::streamsize)data.size()) {
+      LOG_ERROR << "Failed to read the data of block " << lb.block().blockid();
+      return -1;
+    }
+    string stored;
+    compression::CompressedBlock::compress(codec, data.data(), data.size(), &stored);
+    storedLB.mutable_block()->set_blocklen(stored.size());
+    storedLB.mutable_block()->set_codec(codec);
+    compressed.str(stored);
+    in = &compressed;
+  }
+  int ret = sendBlk(*in, storedLB);
+  if (ret <= 0) {
+    LOG_ERROR << "Failed to write block " << lb.DebugString();
+    return -1;
+  }
+
+  /// send ack to master, with the length of the data before compression
+  LocatedBlock ackLB(lb);
+  ackLB.mutable_block()->set_codec(codec);
+  ackLB.clear_chunkserverinfos();
+  for (int i = 0; i < ret; ++i) {
+    *ackLB.add_chunkserverinfos() = lb.chunkserverinfos(i);
+  }
+
+  int opFromMaster = master->blockAck(ackLB);
+  if (opFromMaster != OpCode::OP_SUCCESS) {
+    LOG_ERROR << "Failed to send ack of block " << ackLB.DebugString();
+    return -1;
+  }
+
+  LOG_INFO << "Succeed sending block: " << lb.DebugString() << " stored in "
+           << (int64_t)storedLB.block().blocklen() << " bytes";
+  return lb.block().blocklen();
+}
+
+int64_t RemoteWriter::writeBlkGroup(std::ifstream& f, const LocatedBlock& lb) const {
+  const Block& group = lb.block();
+  int nBlks = ECBlockGroup::nBlks(group);
+  if (lb.chunkserverinfos_size() < nBlks) {
+    return -1;
+  }
+  string data(group.blocklen(), 0);
+  f.read(&data[0], data.size());
+  if (f.gcount() != (std::streamsize)data.size()) {
+    LOG_ERROR << "Failed to read the data of block group " << group.blockid();
+    return -1;
+  }
+  std::vector<string> internalBlks;
+  ECBlockGroup(lb).encode(data.data(), &internalBlks);
+
+  /// the i-th chunkserver of the ack stores the i-th internal block, empty if it failed
+  LocatedBlock ackLB;
+  *ackLB.mutable_block() = group;
+  int nWritten = 0;
+  for (int i = 0; i < nBlks; ++i) {
+    LocatedBlock internalLB;
+    internalLB.mutable_block()->set_blockid(ECBlockGroup::internalBlkID(group, i));
+    internalLB.mutable_block()->set_blocklen(internalBlks[i].size());
+    *internalLB.add_chunkserverinfos() = lb.chunkserverinfos(i);
+
+    std::istringstream in(internalBlks[i]);
+    auto ackCS = ackLB.add_chunkserverinfos();
+    if (sendBlk(in, internalLB) > 0) {
+      *ackCS = lb.chunkserverinfos(i);
+      ++nWritten;
+    } else {
+      LOG_WARN << "Failed to write internal block " << internalLB.block().blockid();
+    }
+  }
+  if (nWritten < group.ecschema().ndata()) {
+    LOG_ERROR << "Only " << nWritten << " internal blocks of block group "
+              << group.blockid() << " are written";
+    return -1;
+  }
+
+  int opFromMaster = master->blockAck(ackLB);
+  if (opFromMaster != OpCode::OP_SUCCESS) {
+    LOG_ERROR << "Failed to send ack of block group " << group.blockid();
+    return -1;
+  }
+  LOG_INFO << "Succeed sending block group " << group.blockid() << ": "
+           << nWritten << " of " << nBlks << " internal blocks";
+  return group.blocklen();
+}
+
+int RemoteWriter::sendBlk(std::istream& f, const LocatedBlock& lb) const {
   if (lb.chunkserverinfos_size() < 1) {
     return -1;
   }
@@ -188,13 +343,15 @@ int64_t RemoteWriter::writeBlk(std::ifstream& f, const LocatedBlock& lb) const {
     return -1;
   }
   LOG_INFO << "Succeed to send block writing request and block len";
-  /// send data
+  /// send data, checksummed while streaming
   std::vector<char> dataBuffer(BUFFER_SIZE);
+  checksum::ChunkedChecksum dataChecksum;
   long long byteLeft = dataLen;
   while (byteLeft > 0) {
     int nRead = byteLeft < BUFFER_SIZE ? byteLeft : BUFFER_SIZE;
     /// read from file
     f.read(dataBuffer.data(), nRead);
+    dataChecksum.update(dataBuffer.data(), nRead);
     if (send(sockfd, dataBuffer.data(), nRead, 0) == -1) {
       close(sockfd);
       return -1;
@@ -202,35 +359,29 @@ int64_t RemoteWriter::writeBlk(std::ifstream& f, const LocatedBlock& lb) const {
     byteLeft -= nRead;
   }
 
-  /// wait for response from chunkserver
-  char ret =0;
-  if (recv(sockfd, &ret, 1, 0) == -1) {
+  /// send checksums
+  string crcBytes;
+  checksum::ChunkedChecksum::putCrcs(dataChecksum.finish(), &crcBytes);
+  if (crcBytes.empty() == false && send(sockfd, crcBytes.data(), crcBytes.size(), 0) == -1) {
     close(sockfd);
     return -1;
   }
-  if (ret == 0) {
-    LOG_ERROR << "Failed to write block " << lb.DebugString();
-    close(sockfd);
-    return -1;
-  }
-
-  /// send ack to master
-  LocatedBlock ackLB(lb);
-  ackLB.clear_chunkserverinfos();
-  for (int i = 0; i < ret; ++i) {
-    *ackLB.add_chunkserverinfos() = lb.chunkserverinfos(i);
-  }
 
-  int opFromMaster = master->blockAck(ackLB);
-  if (opFromMaster != OpCode::OP_SUCCESS) {
-    LOG_ERROR << "Failed to send ack of block " << ackLB.DebugString();
+  /// wait for response from chunkserver
+  char ret = 0;
+  if (recv(sockfd, &ret, 1, 0) == -1) {
     close(sockfd);
     return -1;
   }
-
-  LOG_INFO << "Succeed sending block: " << lb.DebugString();
   close(sockfd);
-  return dataLen;
+  return ret;
+}
+
+int64_t RemoteWriter::blkCapacity() const {
+  if (currentLB.block().has_ecschema()) {
+    return BLOCK_SIZE * currentLB.block().ecschema().ndata();
+  }
+  return BLOCK_SIZE;
 }
 
 int RemoteWriter::connChunkserver(const ChunkserverInfo& cs) const {
@@ -293,7 +444,7 @@ int RemoteWriter::blkWriteRequest(int sockfd, const LocatedBlock& lb) const {
     return -1;
   }
 
-  LOG_INFO << "Succeed to send request of block: " << lb.DebugString();
+  LOG_DEBUG << "Succeed to send request of block: " << lb.DebugString();
   return 0;
 }
 
@@ -14,6 +14,8 @@
 
 #include <minidfs/client_protocol.hpp>
 #include <rpc/client_protocol_proxy.hpp>
+#include "checksum/chunked_checksum.h"
+#include "compression/compressed_block.h"
 
 using std::string;
 
@@ -24,6 +26,11 @@ namespace minidfs {
 /// When writing data to dfs, client caches the data in a local file
 /// firstly. When the file size reaches BLOCK_SIZE or the write is done,
 /// send the whole block to remote chunkserver. 
+/// An erasure-coded file is written in block groups of up to nData * BLOCK_SIZE
+/// bytes, encoded into their internal blocks by ECBlockGroup.
+/// A compressed file is sent block by block in the CompressedBlock format.
+/// Small files can be packed into a shared container block with writePack(),
+/// the file name of the writer is not used then.
 /// TODO: xiw, don't use write() and writeAll() together!!! Some bugs are
 /// remained to be solved, e.g. pos pointer.
 class RemoteWriter {
@@ -65,6 +72,9 @@ class RemoteWriter {
   /// number of times to try connecting the remote before giving up
   const int nTrial;
 
+  /// codec of the blocks of a compressed file
+  compression::Codec codec;
+
  public:
   RemoteWriter(const string& serverIP, int serverPort, const string& file,
                int bufferSize, int nTrial, long long blockSize,
@@ -78,6 +88,27 @@ class RemoteWriter {
   /// \return return 0 on success, -1 for errors
   int open();
 
+  /// \brief Same as open(), but create an erasure-coded file.
+  ///
+  /// \param schema the layout of the block groups
+  /// \return return 0 on success, -1 for errors
+  int open(const ECSchema& schema);
+
+  /// \brief Same as open(), but the blocks are compressed before they are
+  /// sent, and stored and replicated compressed.
+  ///
+  /// \param codec the codec of the blocks
+  /// \return return 0 on success, -1 for errors
+  int open(compression::Codec codec);
+
+  /// \brief Write small files packed one after another into a shared container
+  /// block: createPack(), send the block, then completePack().
+  ///
+  /// \param files the names and lengths of the files
+  /// \param data the data of the files, one after another
+  /// \return return 0 on success, -1 for errors
+  int writePack(const Pack& files, const string& data);
+
   /// \brief Write size bytes of data with offset from buffer into the file in dfs.
   /// The default offset means to append data to the file. Call open() first and remoteClose() at last!
   ///
@@ -101,14 +132,34 @@ class RemoteWriter {
 
  private:
 
-  /// \brief Write a whole block from an input file stream
-  /// to remote chunkservers
+  /// \brief Write a whole block or block group from an input file stream
+  /// to remote chunkservers, and send the ack to master.
   ///
   /// \param f output file stream
   /// \param lb block to be written
   /// \return size of data written  
   int64_t writeBlk(std::ifstream& f, const LocatedBlock& lb) const;
 
+  /// \brief Encode the data of a block group and write each internal block
+  /// to its chunkserver. At least nData of them must be written.
+  ///
+  /// \param f output file stream
+  /// \param lb block group to be written
+  /// \return size of data written
+  int64_t writeBlkGroup(std::ifstream& f, const LocatedBlock& lb) const;
+
+  /// \brief Send a block to the pipeline of chunkservers in lb.
+  /// The CRC32C of each chunk is sent after the data.
+  ///
+  /// \param f stream of the block data
+  /// \param lb block to be written
+  /// \return number of replicas written, -1 for errors
+  int sendBlk(std::istream& f, const LocatedBlock& lb) const;
+
+  /// \brief Get the bytes of file data in currentLB: BLOCK_SIZE, or nData
+  /// times it for a block group.
+  int64_t blkCapacity() const;
+
   /// \brief Connect with remote chunkservers. Wait 2s if the first
   /// trial is failed. Try at most twice.
   ///
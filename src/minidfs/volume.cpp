@@ -0,0 +1,90 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include <minidfs/volume.hpp>
+
+#include <algorithm>
+#include <sys/statvfs.h>
+
+namespace minidfs {
+
+Volume::Volume(const string& dir, size_t nIOThread, const StoreOptions& options)
+    : dir(dir), store(BlockStore::newBlockStore(dir, options)),
+      nPendingIO(0), ioPool(nIOThread > 0 ? nIOThread : 1) {
+}
+
+const string& Volume::getDir() const {
+  return dir;
+}
+
+BlockStore& Volume::getStore() {
+  return *store;
+}
+
+void Volume::submit(std::function<void()> task) {
+  ++nPendingIO;
+  ioPool.post([this, task]() {
+    task();
+    --nPendingIO;
+  });
+}
+
+void Volume::exportMetrics(const string& name) {
+  ioPool.exportMetrics(name);
+}
+
+int Volume::getNPendingIO() const {
+  return nPendingIO;
+}
+
+int Volume::getSpace(long long* capacity, long long* available) const {
+  struct statvfs st;
+  if (::statvfs(dir.c_str(), &st) == -1) {
+    return -1;
+  }
+  *capacity = (long long)st.f_blocks * st.f_frsize;
+  *available = (long long)st.f_bavail * st.f_frsize;
+  return 0;
+}
+
+std::vector<string> Volume::splitDirs(const string& dataDir) {
+  std::vector<string> ret;
+  size_t start = 0;
+  while (start <= dataDir.size()) {
+    size_t end = dataDir.find(',', start);
+    if (end == string::npos) {
+      end = dataDir.size();
+    }
+    string dir = dataDir.substr(start, end - start);
+    dir.erase(0, dir.find_first_not_of(" \t"));
+    dir.erase(dir.find_last_not_of(" \t") + 1);
+    if (dir.empty() == false) {
+      ret.push_back(dir);
+    }
+    start = end + 1;
+  }
+  return ret;
+}
+
+int Volume::choose(const std::vector<long long>& available, long long blockSize,
+                   const string& policy, std::atomic<unsigned>* next) {
+  if (available.empty()) {
+    return -1;
+  }
+  if (policy == "available-space") {
+    auto most = std::max_element(available.begin(), available.end());
+    return *most >= blockSize ? most - available.begin() : -1;
+  }
+  /// round-robin over the volumes with space for a block
+  for (size_t i = 0; i < available.size(); ++i) {
+    int v = (*next)++ % available.size();
+    if (available[v] >= blockSize) {
+      return v;
+    }
+  }
+  return -1;
+}
+
+} // namespace minidfs
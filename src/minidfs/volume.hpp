@@ -0,0 +1,94 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Header file for class Volume.
+
+#ifndef VOLUME_H_
+#define VOLUME_H_
+
+#include <string>
+#include <functional>
+#include <atomic>
+#include <vector>
+
+#include <minidfs/block_store.hpp>
+#include <threadpool/thread_pool.hpp>
+
+using std::string;
+
+namespace minidfs {
+
+/// \brief Volume is a data directory of a chunkserver, usually a whole disk.
+///
+/// Each volume has its own block store, and its own I/O workers. Block
+/// transfers are run by the workers of the volume holding the block, so a
+/// slow or failing disk only holds up its own requests.
+class Volume {
+ private:
+  /// folder that stores the blocks
+  const string dir;
+
+  /// stores the blocks of the volume
+  std::unique_ptr<BlockStore> store;
+
+  /// number of I/O tasks queued or running
+  std::atomic<int> nPendingIO;
+
+  /// the I/O workers
+  ThreadPool ioPool;
+
+ public:
+  /// \brief Create a Volume.
+  ///
+  /// \param dir folder that stores the blocks
+  /// \param nIOThread number of I/O workers
+  /// \param options options of the block store
+  Volume(const string& dir, size_t nIOThread, const StoreOptions& options);
+
+  /// \brief Get the folder of the volume.
+  const string& getDir() const;
+
+  /// \brief Get the block store of the volume.
+  BlockStore& getStore();
+
+  /// \brief Run an I/O task on the workers of the volume.
+  void submit(std::function<void()> task);
+
+  /// \brief Export the statistics of the I/O workers to the metrics registry.
+  ///
+  /// \param name prefix of the metrics
+  void exportMetrics(const string& name);
+
+  /// \brief Get the number of I/O tasks queued or running.
+  int getNPendingIO() const;
+
+  /// \brief Get the size of the filesystem holding the volume.
+  ///
+  /// \param capacity the returning total bytes
+  /// \param available the returning bytes available to the chunkserver
+  /// \return return 0 on success, -1 for errors
+  int getSpace(long long* capacity, long long* available) const;
+
+  /// \brief Split the dataDir config, a comma separated list of volumes,
+  /// e.g. /data1,/data2. Blanks around the dirs and empty entries are dropped.
+  ///
+  /// \param dataDir the list of volumes
+  /// \return return the dirs of the volumes
+  static std::vector<string> splitDirs(const string& dataDir);
+
+  /// \brief Choose a volume with space for a new block.
+  ///
+  /// \param available the bytes available on each volume
+  /// \param blockSize the bytes a new block needs
+  /// \param policy "available-space" for the volume with the most space,
+  ///        round-robin over the volumes with space otherwise
+  /// \param next the next volume of the round-robin, advanced by it
+  /// \return return the index of the volume, -1 if all of them are full
+  static int choose(const std::vector<long long>& available, long long blockSize,
+                    const string& policy, std::atomic<unsigned>* next);
+};
+
+} // namespace minidfs
+
+#endif
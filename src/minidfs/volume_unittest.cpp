@@ -0,0 +1,82 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for Volume
+
+#include <minidfs/volume.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+void TestSplitDirs() {
+  using minidfs::Volume;
+  assert(Volume::splitDirs("/data1") == std::vector<string>{"/data1"});
+  assert((Volume::splitDirs("/data1,/data2") == std::vector<string>{"/data1", "/data2"}));
+
+  /// blanks around the dirs are dropped
+  assert((Volume::splitDirs(" /data1 ,\t/data2\t") == std::vector<string>{"/data1", "/data2"}));
+  assert(Volume::splitDirs("/my data") == std::vector<string>{"/my data"});
+
+  /// and the empty entries
+  assert((Volume::splitDirs(",/data1,, ,/data2,") == std::vector<string>{"/data1", "/data2"}));
+  assert(Volume::splitDirs("").empty());
+  assert(Volume::splitDirs(" , ").empty());
+  ::printf("split dirs pass ...\n");
+}
+
+void TestRoundRobin() {
+  using minidfs::Volume;
+  std::atomic<unsigned> next(0);
+  std::vector<long long> available{100, 10, 100};
+  std::vector<int> chosen;
+  for (int i = 0; i < 4; ++i) {
+    chosen.push_back(Volume::choose(available, 50, "round-robin", &next));
+  }
+  /// the full volume is skipped
+  assert((chosen == std::vector<int>{0, 2, 0, 2}));
+
+  /// no matter how much space the others have
+  available = {1000, 100};
+  next = 0;
+  assert(Volume::choose(available, 50, "round-robin", &next) == 0);
+  assert(Volume::choose(available, 50, "round-robin", &next) == 1);
+
+  available = {10, 10};
+  assert(Volume::choose(available, 50, "round-robin", &next) == -1);
+  assert(Volume::choose(std::vector<long long>(), 50, "round-robin", &next) == -1);
+  ::printf("round-robin pass ...\n");
+}
+
+void TestAvailableSpace() {
+  using minidfs::Volume;
+  std::atomic<unsigned> next(0);
+  std::vector<long long> available{100, 300, 200};
+  assert(Volume::choose(available, 50, "available-space", &next) == 1);
+  assert(Volume::choose(available, 50, "available-space", &next) == 1);
+  available[2] = 400;
+  assert(Volume::choose(available, 50, "available-space", &next) == 2);
+  assert(next == 0);
+
+  available = {10, 20};
+  assert(Volume::choose(available, 50, "available-space", &next) == -1);
+  assert(Volume::choose(std::vector<long long>(), 50, "available-space", &next) == -1);
+  ::printf("available-space pass ...\n");
+}
+
+} // namespace
+
+void TestVolume() {
+  ::printf("Test Volume...\n");
+
+  TestSplitDirs();
+  TestRoundRobin();
+  TestAvailableSpace();
+
+  ::printf("\n");
+}
@@ -5,7 +5,6 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/extension_set.h>
 #include <google/protobuf/wire_format_lite.h>
@@ -15,5662 +14,9201 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_minidfs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Block_minidfs_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_minidfs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BlockTask_minidfs_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_minidfs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ChunkserverInfo_minidfs_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_minidfs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Dentry_minidfs_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_minidfs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DentrySection_minidfs_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_minidfs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FileInfo_minidfs_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_minidfs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Inode_minidfs_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_minidfs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_InodeSection_minidfs_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_minidfs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_LocatedBlock_minidfs_2eproto;
-namespace minidfs {
-class BlockDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Block> _instance;
-} _Block_default_instance_;
-class ChunkserverInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ChunkserverInfo> _instance;
-} _ChunkserverInfo_default_instance_;
-class LocatedBlockDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<LocatedBlock> _instance;
-} _LocatedBlock_default_instance_;
-class LocatedBlocksDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<LocatedBlocks> _instance;
-} _LocatedBlocks_default_instance_;
-class BlkIDsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BlkIDs> _instance;
-} _BlkIDs_default_instance_;
-class BlockReportDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BlockReport> _instance;
-} _BlockReport_default_instance_;
-class BlockTaskDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BlockTask> _instance;
-} _BlockTask_default_instance_;
-class BlockTasksDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BlockTasks> _instance;
-} _BlockTasks_default_instance_;
-class InodeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Inode> _instance;
-} _Inode_default_instance_;
-class InodeSectionDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InodeSection> _instance;
-} _InodeSection_default_instance_;
-class DentryDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Dentry> _instance;
-} _Dentry_default_instance_;
-class DentrySectionDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DentrySection> _instance;
-} _DentrySection_default_instance_;
-class NameSystemDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NameSystem> _instance;
-} _NameSystem_default_instance_;
-class EditLogDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<EditLog> _instance;
-} _EditLog_default_instance_;
-class FileInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<FileInfo> _instance;
-} _FileInfo_default_instance_;
-class FileInfosDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<FileInfos> _instance;
-} _FileInfos_default_instance_;
-}  // namespace minidfs
-static void InitDefaultsscc_info_BlkIDs_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_BlkIDs_default_instance_;
-    new (ptr) ::minidfs::BlkIDs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::BlkIDs::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BlkIDs_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_BlkIDs_minidfs_2eproto}, {}};
-
-static void InitDefaultsscc_info_Block_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_Block_default_instance_;
-    new (ptr) ::minidfs::Block();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::Block::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Block_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_Block_minidfs_2eproto}, {}};
-
-static void InitDefaultsscc_info_BlockReport_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_BlockReport_default_instance_;
-    new (ptr) ::minidfs::BlockReport();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::BlockReport::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BlockReport_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_BlockReport_minidfs_2eproto}, {
-      &scc_info_ChunkserverInfo_minidfs_2eproto.base,}};
-
-static void InitDefaultsscc_info_BlockTask_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_BlockTask_default_instance_;
-    new (ptr) ::minidfs::BlockTask();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::BlockTask::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BlockTask_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_BlockTask_minidfs_2eproto}, {
-      &scc_info_LocatedBlock_minidfs_2eproto.base,}};
-
-static void InitDefaultsscc_info_BlockTasks_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_BlockTasks_default_instance_;
-    new (ptr) ::minidfs::BlockTasks();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::BlockTasks::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BlockTasks_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_BlockTasks_minidfs_2eproto}, {
-      &scc_info_BlockTask_minidfs_2eproto.base,}};
-
-static void InitDefaultsscc_info_ChunkserverInfo_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_ChunkserverInfo_default_instance_;
-    new (ptr) ::minidfs::ChunkserverInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::ChunkserverInfo::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ChunkserverInfo_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_ChunkserverInfo_minidfs_2eproto}, {}};
-
-static void InitDefaultsscc_info_Dentry_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_Dentry_default_instance_;
-    new (ptr) ::minidfs::Dentry();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::Dentry::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Dentry_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_Dentry_minidfs_2eproto}, {}};
-
-static void InitDefaultsscc_info_DentrySection_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_DentrySection_default_instance_;
-    new (ptr) ::minidfs::DentrySection();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::DentrySection::InitAsDefaultInstance();
-}
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DentrySection_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_DentrySection_minidfs_2eproto}, {
-      &scc_info_Dentry_minidfs_2eproto.base,}};
+PROTOBUF_PRAGMA_INIT_SEG
 
-static void InitDefaultsscc_info_EditLog_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-  {
-    void* ptr = &::minidfs::_EditLog_default_instance_;
-    new (ptr) ::minidfs::EditLog();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::EditLog::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_EditLog_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_EditLog_minidfs_2eproto}, {
-      &scc_info_Block_minidfs_2eproto.base,}};
-
-static void InitDefaultsscc_info_FileInfo_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_FileInfo_default_instance_;
-    new (ptr) ::minidfs::FileInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::FileInfo::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FileInfo_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_FileInfo_minidfs_2eproto}, {}};
-
-static void InitDefaultsscc_info_FileInfos_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_FileInfos_default_instance_;
-    new (ptr) ::minidfs::FileInfos();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::FileInfos::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_FileInfos_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_FileInfos_minidfs_2eproto}, {
-      &scc_info_FileInfo_minidfs_2eproto.base,}};
-
-static void InitDefaultsscc_info_Inode_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_Inode_default_instance_;
-    new (ptr) ::minidfs::Inode();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::Inode::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Inode_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_Inode_minidfs_2eproto}, {
-      &scc_info_Block_minidfs_2eproto.base,}};
-
-static void InitDefaultsscc_info_InodeSection_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_InodeSection_default_instance_;
-    new (ptr) ::minidfs::InodeSection();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::InodeSection::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_InodeSection_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_InodeSection_minidfs_2eproto}, {
-      &scc_info_Inode_minidfs_2eproto.base,}};
-
-static void InitDefaultsscc_info_LocatedBlock_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_LocatedBlock_default_instance_;
-    new (ptr) ::minidfs::LocatedBlock();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::LocatedBlock::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_LocatedBlock_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_LocatedBlock_minidfs_2eproto}, {
-      &scc_info_Block_minidfs_2eproto.base,
-      &scc_info_ChunkserverInfo_minidfs_2eproto.base,}};
-
-static void InitDefaultsscc_info_LocatedBlocks_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_LocatedBlocks_default_instance_;
-    new (ptr) ::minidfs::LocatedBlocks();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::LocatedBlocks::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_LocatedBlocks_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_LocatedBlocks_minidfs_2eproto}, {
-      &scc_info_LocatedBlock_minidfs_2eproto.base,}};
-
-static void InitDefaultsscc_info_NameSystem_minidfs_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::minidfs::_NameSystem_default_instance_;
-    new (ptr) ::minidfs::NameSystem();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::minidfs::NameSystem::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_NameSystem_minidfs_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_NameSystem_minidfs_2eproto}, {
-      &scc_info_InodeSection_minidfs_2eproto.base,
-      &scc_info_DentrySection_minidfs_2eproto.base,}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_minidfs_2eproto[16];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_minidfs_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_minidfs_2eproto = nullptr;
+namespace minidfs {
+PROTOBUF_CONSTEXPR ECSchema::ECSchema(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ndata_)*/0
+  , /*decltype(_impl_.nparity_)*/0
+  , /*decltype(_impl_.cellsize_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ECSchemaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ECSchemaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ECSchemaDefaultTypeInternal() {}
+  union {
+    ECSchema _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ECSchemaDefaultTypeInternal _ECSchema_default_instance_;
+PROTOBUF_CONSTEXPR Extent::Extent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.offset_)*/int64_t{0}
+  , /*decltype(_impl_.len_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExtentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExtentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExtentDefaultTypeInternal() {}
+  union {
+    Extent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExtentDefaultTypeInternal _Extent_default_instance_;
+PROTOBUF_CONSTEXPR Block::Block(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ecschema_)*/nullptr
+  , /*decltype(_impl_.extent_)*/nullptr
+  , /*decltype(_impl_.blocklen_)*/int64_t{0}
+  , /*decltype(_impl_.blockid_)*/0
+  , /*decltype(_impl_.codec_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockDefaultTypeInternal() {}
+  union {
+    Block _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockDefaultTypeInternal _Block_default_instance_;
+PROTOBUF_CONSTEXPR ChunkserverInfo::ChunkserverInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.chunkserverip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.chunkserverport_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChunkserverInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChunkserverInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChunkserverInfoDefaultTypeInternal() {}
+  union {
+    ChunkserverInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChunkserverInfoDefaultTypeInternal _ChunkserverInfo_default_instance_;
+PROTOBUF_CONSTEXPR LocatedBlock::LocatedBlock(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.chunkserverinfos_)*/{}
+  , /*decltype(_impl_.block_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LocatedBlockDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LocatedBlockDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LocatedBlockDefaultTypeInternal() {}
+  union {
+    LocatedBlock _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LocatedBlockDefaultTypeInternal _LocatedBlock_default_instance_;
+PROTOBUF_CONSTEXPR ECFile::ECFile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ecschema_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ECFileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ECFileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ECFileDefaultTypeInternal() {}
+  union {
+    ECFile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ECFileDefaultTypeInternal _ECFile_default_instance_;
+PROTOBUF_CONSTEXPR PackedFile::PackedFile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.len_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackedFileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackedFileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackedFileDefaultTypeInternal() {}
+  union {
+    PackedFile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackedFileDefaultTypeInternal _PackedFile_default_instance_;
+PROTOBUF_CONSTEXPR Pack::Pack(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.files_)*/{}
+  , /*decltype(_impl_.container_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackDefaultTypeInternal() {}
+  union {
+    Pack _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackDefaultTypeInternal _Pack_default_instance_;
+PROTOBUF_CONSTEXPR InlineFile::InlineFile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InlineFileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InlineFileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InlineFileDefaultTypeInternal() {}
+  union {
+    InlineFile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InlineFileDefaultTypeInternal _InlineFile_default_instance_;
+PROTOBUF_CONSTEXPR LocatedBlocks::LocatedBlocks(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.locatedblks_)*/{}
+  , /*decltype(_impl_.inlinedata_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LocatedBlocksDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LocatedBlocksDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LocatedBlocksDefaultTypeInternal() {}
+  union {
+    LocatedBlocks _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LocatedBlocksDefaultTypeInternal _LocatedBlocks_default_instance_;
+PROTOBUF_CONSTEXPR BlkIDs::BlkIDs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.blkids_)*/{}
+  , /*decltype(_impl_._blkids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlkIDsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlkIDsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlkIDsDefaultTypeInternal() {}
+  union {
+    BlkIDs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlkIDsDefaultTypeInternal _BlkIDs_default_instance_;
+PROTOBUF_CONSTEXPR BlockReport::BlockReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.blkids_)*/{}
+  , /*decltype(_impl_._blkids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.encodedblkids_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.chunkserverinfo_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockReportDefaultTypeInternal() {}
+  union {
+    BlockReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockReportDefaultTypeInternal _BlockReport_default_instance_;
+PROTOBUF_CONSTEXPR VolumeInfo::VolumeInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dir_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.capacity_)*/int64_t{0}
+  , /*decltype(_impl_.available_)*/int64_t{0}
+  , /*decltype(_impl_.npendingio_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VolumeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VolumeInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VolumeInfoDefaultTypeInternal() {}
+  union {
+    VolumeInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VolumeInfoDefaultTypeInternal _VolumeInfo_default_instance_;
+PROTOBUF_CONSTEXPR Heartbeat::Heartbeat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.recvedblkids_)*/{}
+  , /*decltype(_impl_._recvedblkids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.failedblkids_)*/{}
+  , /*decltype(_impl_._failedblkids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.corruptblkids_)*/{}
+  , /*decltype(_impl_._corruptblkids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.volumes_)*/{}
+  , /*decltype(_impl_.chunkserverinfo_)*/nullptr
+  , /*decltype(_impl_.nactivexfers_)*/0
+  , /*decltype(_impl_.acceptblktasks_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HeartbeatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeartbeatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeartbeatDefaultTypeInternal() {}
+  union {
+    Heartbeat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeartbeatDefaultTypeInternal _Heartbeat_default_instance_;
+PROTOBUF_CONSTEXPR BlockTask::BlockTask(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.locatedblk_)*/nullptr
+  , /*decltype(_impl_.blkgroup_)*/nullptr
+  , /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockTaskDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockTaskDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockTaskDefaultTypeInternal() {}
+  union {
+    BlockTask _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockTaskDefaultTypeInternal _BlockTask_default_instance_;
+PROTOBUF_CONSTEXPR BlockTasks::BlockTasks(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.blktasks_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockTasksDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockTasksDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockTasksDefaultTypeInternal() {}
+  union {
+    BlockTasks _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockTasksDefaultTypeInternal _BlockTasks_default_instance_;
+PROTOBUF_CONSTEXPR Inode::Inode(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.blks_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.inlinedata_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.isdir_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InodeDefaultTypeInternal() {}
+  union {
+    Inode _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InodeDefaultTypeInternal _Inode_default_instance_;
+PROTOBUF_CONSTEXPR InodeSection::InodeSection(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.inodes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InodeSectionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InodeSectionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InodeSectionDefaultTypeInternal() {}
+  union {
+    InodeSection _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InodeSectionDefaultTypeInternal _InodeSection_default_instance_;
+PROTOBUF_CONSTEXPR Dentry::Dentry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.subdentries_)*/{}
+  , /*decltype(_impl_._subdentries_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DentryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DentryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DentryDefaultTypeInternal() {}
+  union {
+    Dentry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DentryDefaultTypeInternal _Dentry_default_instance_;
+PROTOBUF_CONSTEXPR DentrySection::DentrySection(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dentries_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DentrySectionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DentrySectionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DentrySectionDefaultTypeInternal() {}
+  union {
+    DentrySection _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DentrySectionDefaultTypeInternal _DentrySection_default_instance_;
+PROTOBUF_CONSTEXPR NameSystem::NameSystem(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.inodesection_)*/nullptr
+  , /*decltype(_impl_.dentrysection_)*/nullptr
+  , /*decltype(_impl_.maxdfid_)*/0
+  , /*decltype(_impl_.maxblkid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NameSystemDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NameSystemDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NameSystemDefaultTypeInternal() {}
+  union {
+    NameSystem _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NameSystemDefaultTypeInternal _NameSystem_default_instance_;
+PROTOBUF_CONSTEXPR EditLog::EditLog(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.blks_)*/{}
+  , /*decltype(_impl_.creates_)*/{}
+  , /*decltype(_impl_.src_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.inlinedata_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_)*/0
+  , /*decltype(_impl_.dfid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EditLogDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EditLogDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EditLogDefaultTypeInternal() {}
+  union {
+    EditLog _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EditLogDefaultTypeInternal _EditLog_default_instance_;
+PROTOBUF_CONSTEXPR FileInfo::FileInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.filelen_)*/int64_t{0}
+  , /*decltype(_impl_.isdir_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileInfoDefaultTypeInternal() {}
+  union {
+    FileInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileInfoDefaultTypeInternal _FileInfo_default_instance_;
+PROTOBUF_CONSTEXPR FileInfos::FileInfos(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.fileinfos_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileInfosDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileInfosDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileInfosDefaultTypeInternal() {}
+  union {
+    FileInfos _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileInfosDefaultTypeInternal _FileInfos_default_instance_;
+PROTOBUF_CONSTEXPR LaneStats::LaneStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queued_)*/int64_t{0}
+  , /*decltype(_impl_.handled_)*/int64_t{0}
+  , /*decltype(_impl_.nthread_)*/0
+  , /*decltype(_impl_.active_)*/0
+  , /*decltype(_impl_.rejected_)*/int64_t{0}
+  , /*decltype(_impl_.completed_)*/int64_t{0}
+  , /*decltype(_impl_.waitus_)*/int64_t{0}
+  , /*decltype(_impl_.runus_)*/int64_t{0}
+  , /*decltype(_impl_.maxthread_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LaneStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LaneStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LaneStatsDefaultTypeInternal() {}
+  union {
+    LaneStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LaneStatsDefaultTypeInternal _LaneStats_default_instance_;
+PROTOBUF_CONSTEXPR ServerStats::ServerStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.lanes_)*/{}
+  , /*decltype(_impl_.callers_)*/{}
+  , /*decltype(_impl_.metrics_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatsDefaultTypeInternal() {}
+  union {
+    ServerStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatsDefaultTypeInternal _ServerStats_default_instance_;
+PROTOBUF_CONSTEXPR Metric::Metric(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/int64_t{0}
+  , /*decltype(_impl_.count_)*/int64_t{0}
+  , /*decltype(_impl_.sum_)*/int64_t{0}
+  , /*decltype(_impl_.max_)*/int64_t{0}
+  , /*decltype(_impl_.p50_)*/int64_t{0}
+  , /*decltype(_impl_.p90_)*/int64_t{0}
+  , /*decltype(_impl_.p99_)*/int64_t{0}
+  , /*decltype(_impl_.p999_)*/int64_t{0}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricDefaultTypeInternal() {}
+  union {
+    Metric _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricDefaultTypeInternal _Metric_default_instance_;
+PROTOBUF_CONSTEXPR Metrics::Metrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.metrics_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricsDefaultTypeInternal() {}
+  union {
+    Metrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricsDefaultTypeInternal _Metrics_default_instance_;
+PROTOBUF_CONSTEXPR CallerStats::CallerStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.caller_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queued_)*/int64_t{0}
+  , /*decltype(_impl_.handled_)*/int64_t{0}
+  , /*decltype(_impl_.rejected_)*/int64_t{0}
+  , /*decltype(_impl_.rate_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CallerStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallerStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallerStatsDefaultTypeInternal() {}
+  union {
+    CallerStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallerStatsDefaultTypeInternal _CallerStats_default_instance_;
+PROTOBUF_CONSTEXPR ServerBusy::ServerBusy(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.retryafterms_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerBusyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerBusyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerBusyDefaultTypeInternal() {}
+  union {
+    ServerBusy _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerBusyDefaultTypeInternal _ServerBusy_default_instance_;
+PROTOBUF_CONSTEXPR BlockIndexSnapshot::BlockIndexSnapshot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.subdirmtimes_)*/{}
+  , /*decltype(_impl_._subdirmtimes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.encodedblkids_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockIndexSnapshotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockIndexSnapshotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockIndexSnapshotDefaultTypeInternal() {}
+  union {
+    BlockIndexSnapshot _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockIndexSnapshotDefaultTypeInternal _BlockIndexSnapshot_default_instance_;
+}  // namespace minidfs
+static ::_pb::Metadata file_level_metadata_minidfs_2eproto[31];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_minidfs_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_minidfs_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_minidfs_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_minidfs_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::ECSchema, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::ECSchema, _impl_.ndata_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::ECSchema, _impl_.nparity_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::ECSchema, _impl_.cellsize_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Extent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Extent, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Extent, _impl_.len_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::Block, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::Block, blockid_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::Block, blocklen_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Block, _impl_.blockid_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Block, _impl_.blocklen_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Block, _impl_.ecschema_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Block, _impl_.codec_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Block, _impl_.extent_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::ChunkserverInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::ChunkserverInfo, chunkserverip_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::ChunkserverInfo, chunkserverport_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::ChunkserverInfo, _impl_.chunkserverip_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::ChunkserverInfo, _impl_.chunkserverport_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::LocatedBlock, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::LocatedBlock, block_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::LocatedBlock, chunkserverinfos_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::LocatedBlock, _impl_.block_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LocatedBlock, _impl_.chunkserverinfos_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::ECFile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::ECFile, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::ECFile, _impl_.ecschema_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::PackedFile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::PackedFile, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::PackedFile, _impl_.len_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Pack, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Pack, _impl_.files_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Pack, _impl_.container_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::InlineFile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::InlineFile, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::InlineFile, _impl_.data_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::LocatedBlocks, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::LocatedBlocks, locatedblks_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::LocatedBlocks, _impl_.locatedblks_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LocatedBlocks, _impl_.inlinedata_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::BlkIDs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::BlkIDs, blkids_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlkIDs, _impl_.blkids_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::BlockReport, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::BlockReport, chunkserverinfo_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::BlockReport, blkids_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockReport, _impl_.chunkserverinfo_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockReport, _impl_.blkids_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockReport, _impl_.encodedblkids_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::VolumeInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::VolumeInfo, _impl_.dir_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::VolumeInfo, _impl_.capacity_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::VolumeInfo, _impl_.available_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::VolumeInfo, _impl_.npendingio_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Heartbeat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Heartbeat, _impl_.chunkserverinfo_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Heartbeat, _impl_.nactivexfers_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Heartbeat, _impl_.recvedblkids_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Heartbeat, _impl_.acceptblktasks_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Heartbeat, _impl_.failedblkids_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Heartbeat, _impl_.corruptblkids_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Heartbeat, _impl_.volumes_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::BlockTask, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::BlockTask, operation_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::BlockTask, locatedblk_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockTask, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockTask, _impl_.locatedblk_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockTask, _impl_.blkgroup_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::BlockTasks, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::BlockTasks, blktasks_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockTasks, _impl_.blktasks_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::Inode, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::Inode, id_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::Inode, name_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::Inode, isdir_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::Inode, blks_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Inode, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Inode, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Inode, _impl_.isdir_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Inode, _impl_.blks_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Inode, _impl_.inlinedata_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::InodeSection, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::InodeSection, inodes_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::InodeSection, _impl_.inodes_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::Dentry, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::Dentry, id_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::Dentry, subdentries_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Dentry, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Dentry, _impl_.subdentries_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::DentrySection, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::DentrySection, dentries_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::DentrySection, _impl_.dentries_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::NameSystem, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::NameSystem, maxdfid_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::NameSystem, maxblkid_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::NameSystem, inodesection_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::NameSystem, dentrysection_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::NameSystem, _impl_.maxdfid_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::NameSystem, _impl_.maxblkid_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::NameSystem, _impl_.inodesection_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::NameSystem, _impl_.dentrysection_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, op_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, src_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, dfid_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, blks_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, _impl_.src_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, _impl_.dfid_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, _impl_.blks_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, _impl_.inlinedata_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::EditLog, _impl_.creates_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::FileInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::FileInfo, name_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::FileInfo, isdir_),
-  PROTOBUF_FIELD_OFFSET(::minidfs::FileInfo, filelen_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::FileInfo, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::FileInfo, _impl_.isdir_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::FileInfo, _impl_.filelen_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::minidfs::FileInfos, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::minidfs::FileInfos, fileinfos_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::FileInfos, _impl_.fileinfos_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.nthread_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.queued_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.handled_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.rejected_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.active_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.maxthread_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.completed_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.waitus_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::LaneStats, _impl_.runus_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::ServerStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::ServerStats, _impl_.lanes_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::ServerStats, _impl_.callers_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::ServerStats, _impl_.metrics_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.sum_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.p50_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.p90_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.p99_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metric, _impl_.p999_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::Metrics, _impl_.metrics_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::CallerStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::CallerStats, _impl_.caller_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::CallerStats, _impl_.queued_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::CallerStats, _impl_.handled_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::CallerStats, _impl_.rejected_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::CallerStats, _impl_.rate_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::ServerBusy, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::ServerBusy, _impl_.retryafterms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockIndexSnapshot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockIndexSnapshot, _impl_.subdirmtimes_),
+  PROTOBUF_FIELD_OFFSET(::minidfs::BlockIndexSnapshot, _impl_.encodedblkids_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::minidfs::Block)},
-  { 7, -1, sizeof(::minidfs::ChunkserverInfo)},
-  { 14, -1, sizeof(::minidfs::LocatedBlock)},
-  { 21, -1, sizeof(::minidfs::LocatedBlocks)},
-  { 27, -1, sizeof(::minidfs::BlkIDs)},
-  { 33, -1, sizeof(::minidfs::BlockReport)},
-  { 40, -1, sizeof(::minidfs::BlockTask)},
-  { 47, -1, sizeof(::minidfs::BlockTasks)},
-  { 53, -1, sizeof(::minidfs::Inode)},
-  { 62, -1, sizeof(::minidfs::InodeSection)},
-  { 68, -1, sizeof(::minidfs::Dentry)},
-  { 75, -1, sizeof(::minidfs::DentrySection)},
-  { 81, -1, sizeof(::minidfs::NameSystem)},
-  { 90, -1, sizeof(::minidfs::EditLog)},
-  { 99, -1, sizeof(::minidfs::FileInfo)},
-  { 107, -1, sizeof(::minidfs::FileInfos)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::minidfs::ECSchema)},
+  { 9, -1, -1, sizeof(::minidfs::Extent)},
+  { 17, -1, -1, sizeof(::minidfs::Block)},
+  { 28, -1, -1, sizeof(::minidfs::ChunkserverInfo)},
+  { 36, -1, -1, sizeof(::minidfs::LocatedBlock)},
+  { 44, -1, -1, sizeof(::minidfs::ECFile)},
+  { 52, -1, -1, sizeof(::minidfs::PackedFile)},
+  { 60, -1, -1, sizeof(::minidfs::Pack)},
+  { 68, -1, -1, sizeof(::minidfs::InlineFile)},
+  { 76, -1, -1, sizeof(::minidfs::LocatedBlocks)},
+  { 84, -1, -1, sizeof(::minidfs::BlkIDs)},
+  { 91, -1, -1, sizeof(::minidfs::BlockReport)},
+  { 100, -1, -1, sizeof(::minidfs::VolumeInfo)},
+  { 110, -1, -1, sizeof(::minidfs::Heartbeat)},
+  { 123, -1, -1, sizeof(::minidfs::BlockTask)},
+  { 132, -1, -1, sizeof(::minidfs::BlockTasks)},
+  { 139, -1, -1, sizeof(::minidfs::Inode)},
+  { 150, -1, -1, sizeof(::minidfs::InodeSection)},
+  { 157, -1, -1, sizeof(::minidfs::Dentry)},
+  { 165, -1, -1, sizeof(::minidfs::DentrySection)},
+  { 172, -1, -1, sizeof(::minidfs::NameSystem)},
+  { 182, -1, -1, sizeof(::minidfs::EditLog)},
+  { 194, -1, -1, sizeof(::minidfs::FileInfo)},
+  { 203, -1, -1, sizeof(::minidfs::FileInfos)},
+  { 210, -1, -1, sizeof(::minidfs::LaneStats)},
+  { 226, -1, -1, sizeof(::minidfs::ServerStats)},
+  { 235, -1, -1, sizeof(::minidfs::Metric)},
+  { 251, -1, -1, sizeof(::minidfs::Metrics)},
+  { 258, -1, -1, sizeof(::minidfs::CallerStats)},
+  { 269, -1, -1, sizeof(::minidfs::ServerBusy)},
+  { 276, -1, -1, sizeof(::minidfs::BlockIndexSnapshot)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_Block_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_ChunkserverInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_LocatedBlock_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_LocatedBlocks_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_BlkIDs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_BlockReport_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_BlockTask_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_BlockTasks_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_Inode_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_InodeSection_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_Dentry_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_DentrySection_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_NameSystem_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_EditLog_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_FileInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::minidfs::_FileInfos_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::minidfs::_ECSchema_default_instance_._instance,
+  &::minidfs::_Extent_default_instance_._instance,
+  &::minidfs::_Block_default_instance_._instance,
+  &::minidfs::_ChunkserverInfo_default_instance_._instance,
+  &::minidfs::_LocatedBlock_default_instance_._instance,
+  &::minidfs::_ECFile_default_instance_._instance,
+  &::minidfs::_PackedFile_default_instance_._instance,
+  &::minidfs::_Pack_default_instance_._instance,
+  &::minidfs::_InlineFile_default_instance_._instance,
+  &::minidfs::_LocatedBlocks_default_instance_._instance,
+  &::minidfs::_BlkIDs_default_instance_._instance,
+  &::minidfs::_BlockReport_default_instance_._instance,
+  &::minidfs::_VolumeInfo_default_instance_._instance,
+  &::minidfs::_Heartbeat_default_instance_._instance,
+  &::minidfs::_BlockTask_default_instance_._instance,
+  &::minidfs::_BlockTasks_default_instance_._instance,
+  &::minidfs::_Inode_default_instance_._instance,
+  &::minidfs::_InodeSection_default_instance_._instance,
+  &::minidfs::_Dentry_default_instance_._instance,
+  &::minidfs::_DentrySection_default_instance_._instance,
+  &::minidfs::_NameSystem_default_instance_._instance,
+  &::minidfs::_EditLog_default_instance_._instance,
+  &::minidfs::_FileInfo_default_instance_._instance,
+  &::minidfs::_FileInfos_default_instance_._instance,
+  &::minidfs::_LaneStats_default_instance_._instance,
+  &::minidfs::_ServerStats_default_instance_._instance,
+  &::minidfs::_Metric_default_instance_._instance,
+  &::minidfs::_Metrics_default_instance_._instance,
+  &::minidfs::_CallerStats_default_instance_._instance,
+  &::minidfs::_ServerBusy_default_instance_._instance,
+  &::minidfs::_BlockIndexSnapshot_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_minidfs_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\rminidfs.proto\022\007minidfs\"*\n\005Block\022\017\n\007blo"
-  "ckID\030\001 \001(\005\022\020\n\010blockLen\030\002 \001(\003\"A\n\017Chunkser"
-  "verInfo\022\025\n\rchunkserverIP\030\001 \001(\t\022\027\n\017chunks"
-  "erverPort\030\002 \001(\005\"a\n\014LocatedBlock\022\035\n\005block"
-  "\030\001 \001(\0132\016.minidfs.Block\0222\n\020chunkserverInf"
-  "os\030\002 \003(\0132\030.minidfs.ChunkserverInfo\";\n\rLo"
-  "catedBlocks\022*\n\013locatedBlks\030\001 \003(\0132\025.minid"
-  "fs.LocatedBlock\"\030\n\006BlkIDs\022\016\n\006blkIDs\030\001 \003("
-  "\005\"P\n\013BlockReport\0221\n\017chunkserverInfo\030\001 \001("
-  "\0132\030.minidfs.ChunkserverInfo\022\016\n\006blkIDs\030\002 "
-  "\003(\005\"I\n\tBlockTask\022\021\n\toperation\030\001 \001(\005\022)\n\nl"
-  "ocatedBlk\030\002 \001(\0132\025.minidfs.LocatedBlock\"2"
+  "\n\rminidfs.proto\022\007minidfs\"<\n\010ECSchema\022\r\n\005"
+  "nData\030\001 \001(\005\022\017\n\007nParity\030\002 \001(\005\022\020\n\010cellSize"
+  "\030\003 \001(\005\"%\n\006Extent\022\016\n\006offset\030\001 \001(\003\022\013\n\003len\030"
+  "\002 \001(\003\"\177\n\005Block\022\017\n\007blockID\030\001 \001(\005\022\020\n\010block"
+  "Len\030\002 \001(\003\022#\n\010ecSchema\030\003 \001(\0132\021.minidfs.EC"
+  "Schema\022\r\n\005codec\030\004 \001(\005\022\037\n\006extent\030\005 \001(\0132\017."
+  "minidfs.Extent\"A\n\017ChunkserverInfo\022\025\n\rchu"
+  "nkserverIP\030\001 \001(\t\022\027\n\017chunkserverPort\030\002 \001("
+  "\005\"a\n\014LocatedBlock\022\035\n\005block\030\001 \001(\0132\016.minid"
+  "fs.Block\0222\n\020chunkserverInfos\030\002 \003(\0132\030.min"
+  "idfs.ChunkserverInfo\";\n\006ECFile\022\014\n\004name\030\001"
+  " \001(\t\022#\n\010ecSchema\030\002 \001(\0132\021.minidfs.ECSchem"
+  "a\"\'\n\nPackedFile\022\014\n\004name\030\001 \001(\t\022\013\n\003len\030\002 \001"
+  "(\003\"T\n\004Pack\022\"\n\005files\030\001 \003(\0132\023.minidfs.Pack"
+  "edFile\022(\n\tcontainer\030\002 \001(\0132\025.minidfs.Loca"
+  "tedBlock\"(\n\nInlineFile\022\014\n\004name\030\001 \001(\t\022\014\n\004"
+  "data\030\002 \001(\014\"O\n\rLocatedBlocks\022*\n\013locatedBl"
+  "ks\030\001 \003(\0132\025.minidfs.LocatedBlock\022\022\n\ninlin"
+  "eData\030\002 \001(\014\"\030\n\006BlkIDs\022\016\n\006blkIDs\030\001 \003(\005\"g\n"
+  "\013BlockReport\0221\n\017chunkserverInfo\030\001 \001(\0132\030."
+  "minidfs.ChunkserverInfo\022\016\n\006blkIDs\030\002 \003(\005\022"
+  "\025\n\rencodedBlkIDs\030\003 \001(\014\"R\n\nVolumeInfo\022\013\n\003"
+  "dir\030\001 \001(\t\022\020\n\010capacity\030\002 \001(\003\022\021\n\tavailable"
+  "\030\003 \001(\003\022\022\n\nnPendingIO\030\004 \001(\005\"\325\001\n\tHeartbeat"
+  "\0221\n\017chunkserverInfo\030\001 \001(\0132\030.minidfs.Chun"
+  "kserverInfo\022\024\n\014nActiveXfers\030\002 \001(\005\022\024\n\014rec"
+  "vedBlkIDs\030\003 \003(\005\022\026\n\016acceptBlkTasks\030\004 \001(\010\022"
+  "\024\n\014failedBlkIDs\030\005 \003(\005\022\025\n\rcorruptBlkIDs\030\006"
+  " \003(\005\022$\n\007volumes\030\007 \003(\0132\023.minidfs.VolumeIn"
+  "fo\"r\n\tBlockTask\022\021\n\toperation\030\001 \001(\005\022)\n\nlo"
+  "catedBlk\030\002 \001(\0132\025.minidfs.LocatedBlock\022\'\n"
+  "\010blkGroup\030\003 \001(\0132\025.minidfs.LocatedBlock\"2"
   "\n\nBlockTasks\022$\n\010blkTasks\030\001 \003(\0132\022.minidfs"
-  ".BlockTask\"N\n\005Inode\022\n\n\002id\030\001 \001(\005\022\014\n\004name\030"
+  ".BlockTask\"b\n\005Inode\022\n\n\002id\030\001 \001(\005\022\014\n\004name\030"
   "\002 \001(\t\022\r\n\005isDir\030\003 \001(\010\022\034\n\004blks\030\004 \003(\0132\016.min"
-  "idfs.Block\".\n\014InodeSection\022\036\n\006inodes\030\001 \003"
-  "(\0132\016.minidfs.Inode\")\n\006Dentry\022\n\n\002id\030\001 \001(\005"
-  "\022\023\n\013subDentries\030\002 \003(\005\"2\n\rDentrySection\022!"
-  "\n\010dentries\030\001 \003(\0132\017.minidfs.Dentry\"\213\001\n\nNa"
-  "meSystem\022\017\n\007maxDfID\030\001 \001(\005\022\020\n\010maxBlkID\030\002 "
-  "\001(\005\022+\n\014inodeSection\030\003 \001(\0132\025.minidfs.Inod"
-  "eSection\022-\n\rdentrySection\030\004 \001(\0132\026.minidf"
-  "s.DentrySection\"N\n\007EditLog\022\n\n\002op\030\001 \001(\005\022\013"
-  "\n\003src\030\002 \001(\t\022\014\n\004dfID\030\003 \001(\005\022\034\n\004blks\030\006 \003(\0132"
-  "\016.minidfs.Block\"8\n\010FileInfo\022\014\n\004name\030\001 \001("
-  "\t\022\r\n\005isDir\030\002 \001(\010\022\017\n\007fileLen\030\003 \001(\003\"1\n\tFil"
-  "eInfos\022$\n\tfileInfos\030\001 \003(\0132\021.minidfs.File"
-  "Infob\006proto3"
+  "idfs.Block\022\022\n\ninlineData\030\005 \001(\014\".\n\014InodeS"
+  "ection\022\036\n\006inodes\030\001 \003(\0132\016.minidfs.Inode\")"
+  "\n\006Dentry\022\n\n\002id\030\001 \001(\005\022\023\n\013subDentries\030\002 \003("
+  "\005\"2\n\rDentrySection\022!\n\010dentries\030\001 \003(\0132\017.m"
+  "inidfs.Dentry\"\213\001\n\nNameSystem\022\017\n\007maxDfID\030"
+  "\001 \001(\005\022\020\n\010maxBlkID\030\002 \001(\005\022+\n\014inodeSection\030"
+  "\003 \001(\0132\025.minidfs.InodeSection\022-\n\rdentrySe"
+  "ction\030\004 \001(\0132\026.minidfs.DentrySection\"\205\001\n\007"
+  "EditLog\022\n\n\002op\030\001 \001(\005\022\013\n\003src\030\002 \001(\t\022\014\n\004dfID"
+  "\030\003 \001(\005\022\034\n\004blks\030\006 \003(\0132\016.minidfs.Block\022\022\n\n"
+  "inlineData\030\007 \001(\014\022!\n\007creates\030\010 \003(\0132\020.mini"
+  "dfs.EditLog\"8\n\010FileInfo\022\014\n\004name\030\001 \001(\t\022\r\n"
+  "\005isDir\030\002 \001(\010\022\017\n\007fileLen\030\003 \001(\003\"1\n\tFileInf"
+  "os\022$\n\tfileInfos\030\001 \003(\0132\021.minidfs.FileInfo"
+  "\"\262\001\n\tLaneStats\022\014\n\004name\030\001 \001(\t\022\017\n\007nThread\030"
+  "\002 \001(\005\022\016\n\006queued\030\003 \001(\003\022\017\n\007handled\030\004 \001(\003\022\020"
+  "\n\010rejected\030\005 \001(\003\022\016\n\006active\030\006 \001(\005\022\021\n\tmaxT"
+  "hread\030\007 \001(\005\022\021\n\tcompleted\030\010 \001(\003\022\016\n\006waitUs"
+  "\030\t \001(\003\022\r\n\005runUs\030\n \001(\003\"z\n\013ServerStats\022!\n\005"
+  "lanes\030\001 \003(\0132\022.minidfs.LaneStats\022%\n\007calle"
+  "rs\030\002 \003(\0132\024.minidfs.CallerStats\022!\n\007metric"
+  "s\030\003 \001(\0132\020.minidfs.Metrics\"\326\001\n\006Metric\022\014\n\004"
+  "name\030\001 \001(\t\022\"\n\004type\030\002 \001(\0162\024.minidfs.Metri"
+  "c.Type\022\r\n\005value\030\003 \001(\003\022\r\n\005count\030\004 \001(\003\022\013\n\003"
+  "sum\030\005 \001(\003\022\013\n\003max\030\006 \001(\003\022\013\n\003p50\030\007 \001(\003\022\013\n\003p"
+  "90\030\010 \001(\003\022\013\n\003p99\030\t \001(\003\022\014\n\004p999\030\n \001(\003\"-\n\004T"
+  "ype\022\013\n\007COUNTER\020\000\022\t\n\005GAUGE\020\001\022\r\n\tHISTOGRAM"
+  "\020\002\"+\n\007Metrics\022 \n\007metrics\030\001 \003(\0132\017.minidfs"
+  ".Metric\"^\n\013CallerStats\022\016\n\006caller\030\001 \001(\t\022\016"
+  "\n\006queued\030\002 \001(\003\022\017\n\007handled\030\003 \001(\003\022\020\n\010rejec"
+  "ted\030\004 \001(\003\022\014\n\004rate\030\005 \001(\003\"\"\n\nServerBusy\022\024\n"
+  "\014retryAfterMs\030\001 \001(\005\"A\n\022BlockIndexSnapsho"
+  "t\022\024\n\014subdirMtimes\030\001 \003(\003\022\025\n\rencodedBlkIDs"
+  "\030\002 \001(\014b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_minidfs_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_minidfs_2eproto_sccs[16] = {
-  &scc_info_BlkIDs_minidfs_2eproto.base,
-  &scc_info_Block_minidfs_2eproto.base,
-  &scc_info_BlockReport_minidfs_2eproto.base,
-  &scc_info_BlockTask_minidfs_2eproto.base,
-  &scc_info_BlockTasks_minidfs_2eproto.base,
-  &scc_info_ChunkserverInfo_minidfs_2eproto.base,
-  &scc_info_Dentry_minidfs_2eproto.base,
-  &scc_info_DentrySection_minidfs_2eproto.base,
-  &scc_info_EditLog_minidfs_2eproto.base,
-  &scc_info_FileInfo_minidfs_2eproto.base,
-  &scc_info_FileInfos_minidfs_2eproto.base,
-  &scc_info_Inode_minidfs_2eproto.base,
-  &scc_info_InodeSection_minidfs_2eproto.base,
-  &scc_info_LocatedBlock_minidfs_2eproto.base,
-  &scc_info_LocatedBlocks_minidfs_2eproto.base,
-  &scc_info_NameSystem_minidfs_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_minidfs_2eproto_once;
-static bool descriptor_table_minidfs_2eproto_initialized = false;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_minidfs_2eproto = {
-  &descriptor_table_minidfs_2eproto_initialized, descriptor_table_protodef_minidfs_2eproto, "minidfs.proto", 1092,
-  &descriptor_table_minidfs_2eproto_once, descriptor_table_minidfs_2eproto_sccs, descriptor_table_minidfs_2eproto_deps, 16, 0,
-  schemas, file_default_instances, TableStruct_minidfs_2eproto::offsets,
-  file_level_metadata_minidfs_2eproto, 16, file_level_enum_descriptors_minidfs_2eproto, file_level_service_descriptors_minidfs_2eproto,
+static ::_pbi::once_flag descriptor_table_minidfs_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_minidfs_2eproto = {
+    false, false, 2734, descriptor_table_protodef_minidfs_2eproto,
+    "minidfs.proto",
+    &descriptor_table_minidfs_2eproto_once, nullptr, 0, 31,
+    schemas, file_default_instances, TableStruct_minidfs_2eproto::offsets,
+    file_level_metadata_minidfs_2eproto, file_level_enum_descriptors_minidfs_2eproto,
+    file_level_service_descriptors_minidfs_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_minidfs_2eproto_getter() {
+  return &descriptor_table_minidfs_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_minidfs_2eproto = (  ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_minidfs_2eproto), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_minidfs_2eproto(&descriptor_table_minidfs_2eproto);
 namespace minidfs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Metric_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_minidfs_2eproto);
+  return file_level_enum_descriptors_minidfs_2eproto[0];
+}
+bool Metric_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Metric_Type Metric::COUNTER;
+constexpr Metric_Type Metric::GAUGE;
+constexpr Metric_Type Metric::HISTOGRAM;
+constexpr Metric_Type Metric::Type_MIN;
+constexpr Metric_Type Metric::Type_MAX;
+constexpr int Metric::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class ECSchema::_Internal {
+ public:
+};
+
+ECSchema::ECSchema(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.ECSchema)
+}
+ECSchema::ECSchema(const ECSchema& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ECSchema* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ndata_){}
+    , decltype(_impl_.nparity_){}
+    , decltype(_impl_.cellsize_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ndata_, &from._impl_.ndata_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cellsize_) -
+    reinterpret_cast<char*>(&_impl_.ndata_)) + sizeof(_impl_.cellsize_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.ECSchema)
+}
+
+inline void ECSchema::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ndata_){0}
+    , decltype(_impl_.nparity_){0}
+    , decltype(_impl_.cellsize_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ECSchema::~ECSchema() {
+  // @@protoc_insertion_point(destructor:minidfs.ECSchema)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ECSchema::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ECSchema::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ECSchema::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.ECSchema)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.ndata_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cellsize_) -
+      reinterpret_cast<char*>(&_impl_.ndata_)) + sizeof(_impl_.cellsize_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ECSchema::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 nData = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ndata_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 nParity = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.nparity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 cellSize = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.cellsize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ECSchema::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.ECSchema)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 nData = 1;
+  if (this->_internal_ndata() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_ndata(), target);
+  }
+
+  // int32 nParity = 2;
+  if (this->_internal_nparity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_nparity(), target);
+  }
+
+  // int32 cellSize = 3;
+  if (this->_internal_cellsize() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_cellsize(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.ECSchema)
+  return target;
+}
+
+size_t ECSchema::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.ECSchema)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 nData = 1;
+  if (this->_internal_ndata() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_ndata());
+  }
+
+  // int32 nParity = 2;
+  if (this->_internal_nparity() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nparity());
+  }
+
+  // int32 cellSize = 3;
+  if (this->_internal_cellsize() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_cellsize());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ECSchema::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ECSchema::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ECSchema::GetClassData() const { return &_class_data_; }
+
+
+void ECSchema::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ECSchema*>(&to_msg);
+  auto& from = static_cast<const ECSchema&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.ECSchema)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_ndata() != 0) {
+    _this->_internal_set_ndata(from._internal_ndata());
+  }
+  if (from._internal_nparity() != 0) {
+    _this->_internal_set_nparity(from._internal_nparity());
+  }
+  if (from._internal_cellsize() != 0) {
+    _this->_internal_set_cellsize(from._internal_cellsize());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ECSchema::CopyFrom(const ECSchema& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.ECSchema)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ECSchema::IsInitialized() const {
+  return true;
+}
+
+void ECSchema::InternalSwap(ECSchema* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ECSchema, _impl_.cellsize_)
+      + sizeof(ECSchema::_impl_.cellsize_)
+      - PROTOBUF_FIELD_OFFSET(ECSchema, _impl_.ndata_)>(
+          reinterpret_cast<char*>(&_impl_.ndata_),
+          reinterpret_cast<char*>(&other->_impl_.ndata_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ECSchema::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[0]);
+}
+
+// ===================================================================
+
+class Extent::_Internal {
+ public:
+};
+
+Extent::Extent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.Extent)
+}
+Extent::Extent(const Extent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Extent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offset_){}
+    , decltype(_impl_.len_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.len_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.len_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.Extent)
+}
+
+inline void Extent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offset_){int64_t{0}}
+    , decltype(_impl_.len_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Extent::~Extent() {
+  // @@protoc_insertion_point(destructor:minidfs.Extent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Extent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Extent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Extent::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.Extent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.len_) -
+      reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.len_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Extent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 offset = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 len = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Extent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Extent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 offset = 1;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_offset(), target);
+  }
+
+  // int64 len = 2;
+  if (this->_internal_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_len(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Extent)
+  return target;
+}
+
+size_t Extent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.Extent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 offset = 1;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_offset());
+  }
+
+  // int64 len = 2;
+  if (this->_internal_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_len());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Extent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Extent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Extent::GetClassData() const { return &_class_data_; }
+
+
+void Extent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Extent*>(&to_msg);
+  auto& from = static_cast<const Extent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Extent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_len() != 0) {
+    _this->_internal_set_len(from._internal_len());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Extent::CopyFrom(const Extent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Extent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Extent::IsInitialized() const {
+  return true;
+}
+
+void Extent::InternalSwap(Extent* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Extent, _impl_.len_)
+      + sizeof(Extent::_impl_.len_)
+      - PROTOBUF_FIELD_OFFSET(Extent, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Extent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[1]);
+}
+
+// ===================================================================
+
+class Block::_Internal {
+ public:
+  static const ::minidfs::ECSchema& ecschema(const Block* msg);
+  static const ::minidfs::Extent& extent(const Block* msg);
+};
+
+const ::minidfs::ECSchema&
+Block::_Internal::ecschema(const Block* msg) {
+  return *msg->_impl_.ecschema_;
+}
+const ::minidfs::Extent&
+Block::_Internal::extent(const Block* msg) {
+  return *msg->_impl_.extent_;
+}
+Block::Block(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.Block)
+}
+Block::Block(const Block& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Block* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ecschema_){nullptr}
+    , decltype(_impl_.extent_){nullptr}
+    , decltype(_impl_.blocklen_){}
+    , decltype(_impl_.blockid_){}
+    , decltype(_impl_.codec_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_ecschema()) {
+    _this->_impl_.ecschema_ = new ::minidfs::ECSchema(*from._impl_.ecschema_);
+  }
+  if (from._internal_has_extent()) {
+    _this->_impl_.extent_ = new ::minidfs::Extent(*from._impl_.extent_);
+  }
+  ::memcpy(&_impl_.blocklen_, &from._impl_.blocklen_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.codec_) -
+    reinterpret_cast<char*>(&_impl_.blocklen_)) + sizeof(_impl_.codec_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.Block)
+}
+
+inline void Block::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ecschema_){nullptr}
+    , decltype(_impl_.extent_){nullptr}
+    , decltype(_impl_.blocklen_){int64_t{0}}
+    , decltype(_impl_.blockid_){0}
+    , decltype(_impl_.codec_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Block::~Block() {
+  // @@protoc_insertion_point(destructor:minidfs.Block)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Block::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.ecschema_;
+  if (this != internal_default_instance()) delete _impl_.extent_;
+}
+
+void Block::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Block::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.Block)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.ecschema_ != nullptr) {
+    delete _impl_.ecschema_;
+  }
+  _impl_.ecschema_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.extent_ != nullptr) {
+    delete _impl_.extent_;
+  }
+  _impl_.extent_ = nullptr;
+  ::memset(&_impl_.blocklen_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.codec_) -
+      reinterpret_cast<char*>(&_impl_.blocklen_)) + sizeof(_impl_.codec_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Block::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 blockID = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.blockid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 blockLen = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.blocklen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .minidfs.ECSchema ecSchema = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ecschema(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 codec = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.codec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .minidfs.Extent extent = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_extent(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Block::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Block)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 blockID = 1;
+  if (this->_internal_blockid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_blockid(), target);
+  }
+
+  // int64 blockLen = 2;
+  if (this->_internal_blocklen() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_blocklen(), target);
+  }
+
+  // .minidfs.ECSchema ecSchema = 3;
+  if (this->_internal_has_ecschema()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::ecschema(this),
+        _Internal::ecschema(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 codec = 4;
+  if (this->_internal_codec() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_codec(), target);
+  }
+
+  // .minidfs.Extent extent = 5;
+  if (this->_internal_has_extent()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::extent(this),
+        _Internal::extent(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Block)
+  return target;
+}
+
+size_t Block::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.Block)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .minidfs.ECSchema ecSchema = 3;
+  if (this->_internal_has_ecschema()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.ecschema_);
+  }
+
+  // .minidfs.Extent extent = 5;
+  if (this->_internal_has_extent()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.extent_);
+  }
+
+  // int64 blockLen = 2;
+  if (this->_internal_blocklen() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_blocklen());
+  }
+
+  // int32 blockID = 1;
+  if (this->_internal_blockid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_blockid());
+  }
+
+  // int32 codec = 4;
+  if (this->_internal_codec() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_codec());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Block::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Block::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Block::GetClassData() const { return &_class_data_; }
+
+
+void Block::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Block*>(&to_msg);
+  auto& from = static_cast<const Block&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Block)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_ecschema()) {
+    _this->_internal_mutable_ecschema()->::minidfs::ECSchema::MergeFrom(
+        from._internal_ecschema());
+  }
+  if (from._internal_has_extent()) {
+    _this->_internal_mutable_extent()->::minidfs::Extent::MergeFrom(
+        from._internal_extent());
+  }
+  if (from._internal_blocklen() != 0) {
+    _this->_internal_set_blocklen(from._internal_blocklen());
+  }
+  if (from._internal_blockid() != 0) {
+    _this->_internal_set_blockid(from._internal_blockid());
+  }
+  if (from._internal_codec() != 0) {
+    _this->_internal_set_codec(from._internal_codec());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Block::CopyFrom(const Block& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Block)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Block::IsInitialized() const {
+  return true;
+}
+
+void Block::InternalSwap(Block* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Block, _impl_.codec_)
+      + sizeof(Block::_impl_.codec_)
+      - PROTOBUF_FIELD_OFFSET(Block, _impl_.ecschema_)>(
+          reinterpret_cast<char*>(&_impl_.ecschema_),
+          reinterpret_cast<char*>(&other->_impl_.ecschema_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Block::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[2]);
+}
+
+// ===================================================================
+
+class ChunkserverInfo::_Internal {
+ public:
+};
+
+ChunkserverInfo::ChunkserverInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.ChunkserverInfo)
+}
+ChunkserverInfo::ChunkserverInfo(const ChunkserverInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChunkserverInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.chunkserverip_){}
+    , decltype(_impl_.chunkserverport_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.chunkserverip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.chunkserverip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_chunkserverip().empty()) {
+    _this->_impl_.chunkserverip_.Set(from._internal_chunkserverip(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.chunkserverport_ = from._impl_.chunkserverport_;
+  // @@protoc_insertion_point(copy_constructor:minidfs.ChunkserverInfo)
+}
+
+inline void ChunkserverInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.chunkserverip_){}
+    , decltype(_impl_.chunkserverport_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.chunkserverip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.chunkserverip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChunkserverInfo::~ChunkserverInfo() {
+  // @@protoc_insertion_point(destructor:minidfs.ChunkserverInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChunkserverInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.chunkserverip_.Destroy();
+}
+
+void ChunkserverInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChunkserverInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.ChunkserverInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.chunkserverip_.ClearToEmpty();
+  _impl_.chunkserverport_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChunkserverInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string chunkserverIP = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_chunkserverip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.ChunkserverInfo.chunkserverIP"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 chunkserverPort = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.chunkserverport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChunkserverInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.ChunkserverInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string chunkserverIP = 1;
+  if (!this->_internal_chunkserverip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_chunkserverip().data(), static_cast<int>(this->_internal_chunkserverip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "minidfs.ChunkserverInfo.chunkserverIP");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_chunkserverip(), target);
+  }
+
+  // int32 chunkserverPort = 2;
+  if (this->_internal_chunkserverport() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_chunkserverport(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.ChunkserverInfo)
+  return target;
+}
+
+size_t ChunkserverInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.ChunkserverInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string chunkserverIP = 1;
+  if (!this->_internal_chunkserverip().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_chunkserverip());
+  }
+
+  // int32 chunkserverPort = 2;
+  if (this->_internal_chunkserverport() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_chunkserverport());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChunkserverInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChunkserverInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChunkserverInfo::GetClassData() const { return &_class_data_; }
+
+
+void ChunkserverInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChunkserverInfo*>(&to_msg);
+  auto& from = static_cast<const ChunkserverInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.ChunkserverInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_chunkserverip().empty()) {
+    _this->_internal_set_chunkserverip(from._internal_chunkserverip());
+  }
+  if (from._internal_chunkserverport() != 0) {
+    _this->_internal_set_chunkserverport(from._internal_chunkserverport());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChunkserverInfo::CopyFrom(const ChunkserverInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.ChunkserverInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChunkserverInfo::IsInitialized() const {
+  return true;
+}
+
+void ChunkserverInfo::InternalSwap(ChunkserverInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.chunkserverip_, lhs_arena,
+      &other->_impl_.chunkserverip_, rhs_arena
+  );
+  swap(_impl_.chunkserverport_, other->_impl_.chunkserverport_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChunkserverInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[3]);
+}
+
+// ===================================================================
+
+class LocatedBlock::_Internal {
+ public:
+  static const ::minidfs::Block& block(const LocatedBlock* msg);
+};
+
+const ::minidfs::Block&
+LocatedBlock::_Internal::block(const LocatedBlock* msg) {
+  return *msg->_impl_.block_;
+}
+LocatedBlock::LocatedBlock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.LocatedBlock)
+}
+LocatedBlock::LocatedBlock(const LocatedBlock& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LocatedBlock* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.chunkserverinfos_){from._impl_.chunkserverinfos_}
+    , decltype(_impl_.block_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_block()) {
+    _this->_impl_.block_ = new ::minidfs::Block(*from._impl_.block_);
+  }
+  // @@protoc_insertion_point(copy_constructor:minidfs.LocatedBlock)
+}
+
+inline void LocatedBlock::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.chunkserverinfos_){arena}
+    , decltype(_impl_.block_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LocatedBlock::~LocatedBlock() {
+  // @@protoc_insertion_point(destructor:minidfs.LocatedBlock)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LocatedBlock::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.chunkserverinfos_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.block_;
+}
+
+void LocatedBlock::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LocatedBlock::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.LocatedBlock)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.chunkserverinfos_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.block_ != nullptr) {
+    delete _impl_.block_;
+  }
+  _impl_.block_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LocatedBlock::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .minidfs.Block block = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_block(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_chunkserverinfos(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LocatedBlock::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.LocatedBlock)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .minidfs.Block block = 1;
+  if (this->_internal_has_block()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::block(this),
+        _Internal::block(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_chunkserverinfos_size()); i < n; i++) {
+    const auto& repfield = this->_internal_chunkserverinfos(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.LocatedBlock)
+  return target;
+}
+
+size_t LocatedBlock::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.LocatedBlock)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
+  total_size += 1UL * this->_internal_chunkserverinfos_size();
+  for (const auto& msg : this->_impl_.chunkserverinfos_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .minidfs.Block block = 1;
+  if (this->_internal_has_block()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.block_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LocatedBlock::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LocatedBlock::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LocatedBlock::GetClassData() const { return &_class_data_; }
+
+
+void LocatedBlock::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LocatedBlock*>(&to_msg);
+  auto& from = static_cast<const LocatedBlock&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.LocatedBlock)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.chunkserverinfos_.MergeFrom(from._impl_.chunkserverinfos_);
+  if (from._internal_has_block()) {
+    _this->_internal_mutable_block()->::minidfs::Block::MergeFrom(
+        from._internal_block());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LocatedBlock::CopyFrom(const LocatedBlock& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.LocatedBlock)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LocatedBlock::IsInitialized() const {
+  return true;
+}
+
+void LocatedBlock::InternalSwap(LocatedBlock* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.chunkserverinfos_.InternalSwap(&other->_impl_.chunkserverinfos_);
+  swap(_impl_.block_, other->_impl_.block_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LocatedBlock::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[4]);
+}
+
+// ===================================================================
+
+class ECFile::_Internal {
+ public:
+  static const ::minidfs::ECSchema& ecschema(const ECFile* msg);
+};
+
+const ::minidfs::ECSchema&
+ECFile::_Internal::ecschema(const ECFile* msg) {
+  return *msg->_impl_.ecschema_;
+}
+ECFile::ECFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.ECFile)
+}
+ECFile::ECFile(const ECFile& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ECFile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.ecschema_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_ecschema()) {
+    _this->_impl_.ecschema_ = new ::minidfs::ECSchema(*from._impl_.ecschema_);
+  }
+  // @@protoc_insertion_point(copy_constructor:minidfs.ECFile)
+}
+
+inline void ECFile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.ecschema_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ECFile::~ECFile() {
+  // @@protoc_insertion_point(destructor:minidfs.ECFile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ECFile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.ecschema_;
+}
+
+void ECFile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ECFile::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.ECFile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.ecschema_ != nullptr) {
+    delete _impl_.ecschema_;
+  }
+  _impl_.ecschema_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ECFile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.ECFile.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .minidfs.ECSchema ecSchema = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ecschema(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ECFile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.ECFile)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "minidfs.ECFile.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .minidfs.ECSchema ecSchema = 2;
+  if (this->_internal_has_ecschema()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::ecschema(this),
+        _Internal::ecschema(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.ECFile)
+  return target;
+}
+
+size_t ECFile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.ECFile)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .minidfs.ECSchema ecSchema = 2;
+  if (this->_internal_has_ecschema()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.ecschema_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ECFile::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ECFile::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ECFile::GetClassData() const { return &_class_data_; }
+
+
+void ECFile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ECFile*>(&to_msg);
+  auto& from = static_cast<const ECFile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.ECFile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_ecschema()) {
+    _this->_internal_mutable_ecschema()->::minidfs::ECSchema::MergeFrom(
+        from._internal_ecschema());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ECFile::CopyFrom(const ECFile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.ECFile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ECFile::IsInitialized() const {
+  return true;
+}
+
+void ECFile::InternalSwap(ECFile* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.ecschema_, other->_impl_.ecschema_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ECFile::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[5]);
+}
+
+// ===================================================================
+
+class PackedFile::_Internal {
+ public:
+};
+
+PackedFile::PackedFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.PackedFile)
+}
+PackedFile::PackedFile(const PackedFile& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackedFile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.len_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.len_ = from._impl_.len_;
+  // @@protoc_insertion_point(copy_constructor:minidfs.PackedFile)
+}
+
+inline void PackedFile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.len_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PackedFile::~PackedFile() {
+  // @@protoc_insertion_point(destructor:minidfs.PackedFile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PackedFile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void PackedFile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PackedFile::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.PackedFile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.len_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PackedFile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.PackedFile.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 len = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PackedFile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.PackedFile)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "minidfs.PackedFile.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // int64 len = 2;
+  if (this->_internal_len() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_len(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.PackedFile)
+  return target;
+}
+
+size_t PackedFile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.PackedFile)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // int64 len = 2;
+  if (this->_internal_len() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_len());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackedFile::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackedFile::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackedFile::GetClassData() const { return &_class_data_; }
+
+
+void PackedFile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackedFile*>(&to_msg);
+  auto& from = static_cast<const PackedFile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.PackedFile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_len() != 0) {
+    _this->_internal_set_len(from._internal_len());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PackedFile::CopyFrom(const PackedFile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.PackedFile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PackedFile::IsInitialized() const {
+  return true;
+}
+
+void PackedFile::InternalSwap(PackedFile* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.len_, other->_impl_.len_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackedFile::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[6]);
+}
+
+// ===================================================================
+
+class Pack::_Internal {
+ public:
+  static const ::minidfs::LocatedBlock& container(const Pack* msg);
+};
+
+const ::minidfs::LocatedBlock&
+Pack::_Internal::container(const Pack* msg) {
+  return *msg->_impl_.container_;
+}
+Pack::Pack(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.Pack)
+}
+Pack::Pack(const Pack& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Pack* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.files_){from._impl_.files_}
+    , decltype(_impl_.container_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_container()) {
+    _this->_impl_.container_ = new ::minidfs::LocatedBlock(*from._impl_.container_);
+  }
+  // @@protoc_insertion_point(copy_constructor:minidfs.Pack)
+}
+
+inline void Pack::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.files_){arena}
+    , decltype(_impl_.container_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Pack::~Pack() {
+  // @@protoc_insertion_point(destructor:minidfs.Pack)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Pack::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.files_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.container_;
+}
+
+void Pack::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Pack::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.Pack)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.files_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.container_ != nullptr) {
+    delete _impl_.container_;
+  }
+  _impl_.container_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Pack::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .minidfs.PackedFile files = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_files(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .minidfs.LocatedBlock container = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_container(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Pack::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Pack)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .minidfs.PackedFile files = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_files_size()); i < n; i++) {
+    const auto& repfield = this->_internal_files(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .minidfs.LocatedBlock container = 2;
+  if (this->_internal_has_container()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::container(this),
+        _Internal::container(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Pack)
+  return target;
+}
+
+size_t Pack::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.Pack)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .minidfs.PackedFile files = 1;
+  total_size += 1UL * this->_internal_files_size();
+  for (const auto& msg : this->_impl_.files_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .minidfs.LocatedBlock container = 2;
+  if (this->_internal_has_container()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.container_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Pack::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Pack::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Pack::GetClassData() const { return &_class_data_; }
+
+
+void Pack::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Pack*>(&to_msg);
+  auto& from = static_cast<const Pack&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Pack)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.files_.MergeFrom(from._impl_.files_);
+  if (from._internal_has_container()) {
+    _this->_internal_mutable_container()->::minidfs::LocatedBlock::MergeFrom(
+        from._internal_container());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Pack::CopyFrom(const Pack& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Pack)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Pack::IsInitialized() const {
+  return true;
+}
+
+void Pack::InternalSwap(Pack* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.files_.InternalSwap(&other->_impl_.files_);
+  swap(_impl_.container_, other->_impl_.container_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Pack::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[7]);
+}
+
+// ===================================================================
+
+class InlineFile::_Internal {
+ public:
+};
+
+InlineFile::InlineFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.InlineFile)
+}
+InlineFile::InlineFile(const InlineFile& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InlineFile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:minidfs.InlineFile)
+}
+
+inline void InlineFile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+InlineFile::~InlineFile() {
+  // @@protoc_insertion_point(destructor:minidfs.InlineFile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InlineFile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.data_.Destroy();
+}
+
+void InlineFile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InlineFile::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.InlineFile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InlineFile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.InlineFile.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InlineFile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.InlineFile)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "minidfs.InlineFile.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // bytes data = 2;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.InlineFile)
+  return target;
+}
+
+size_t InlineFile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.InlineFile)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // bytes data = 2;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InlineFile::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InlineFile::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InlineFile::GetClassData() const { return &_class_data_; }
+
+
+void InlineFile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InlineFile*>(&to_msg);
+  auto& from = static_cast<const InlineFile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.InlineFile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InlineFile::CopyFrom(const InlineFile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.InlineFile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InlineFile::IsInitialized() const {
+  return true;
+}
+
+void InlineFile::InternalSwap(InlineFile* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InlineFile::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[8]);
+}
+
+// ===================================================================
+
+class LocatedBlocks::_Internal {
+ public:
+};
+
+LocatedBlocks::LocatedBlocks(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.LocatedBlocks)
+}
+LocatedBlocks::LocatedBlocks(const LocatedBlocks& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LocatedBlocks* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.locatedblks_){from._impl_.locatedblks_}
+    , decltype(_impl_.inlinedata_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.inlinedata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inlinedata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_inlinedata().empty()) {
+    _this->_impl_.inlinedata_.Set(from._internal_inlinedata(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:minidfs.LocatedBlocks)
+}
+
+inline void LocatedBlocks::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.locatedblks_){arena}
+    , decltype(_impl_.inlinedata_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.inlinedata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inlinedata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LocatedBlocks::~LocatedBlocks() {
+  // @@protoc_insertion_point(destructor:minidfs.LocatedBlocks)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LocatedBlocks::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.locatedblks_.~RepeatedPtrField();
+  _impl_.inlinedata_.Destroy();
+}
+
+void LocatedBlocks::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LocatedBlocks::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.LocatedBlocks)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.locatedblks_.Clear();
+  _impl_.inlinedata_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LocatedBlocks::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .minidfs.LocatedBlock locatedBlks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_locatedblks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes inlineData = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_inlinedata();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LocatedBlocks::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.LocatedBlocks)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .minidfs.LocatedBlock locatedBlks = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_locatedblks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_locatedblks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes inlineData = 2;
+  if (!this->_internal_inlinedata().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_inlinedata(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.LocatedBlocks)
+  return target;
+}
+
+size_t LocatedBlocks::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.LocatedBlocks)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .minidfs.LocatedBlock locatedBlks = 1;
+  total_size += 1UL * this->_internal_locatedblks_size();
+  for (const auto& msg : this->_impl_.locatedblks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes inlineData = 2;
+  if (!this->_internal_inlinedata().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_inlinedata());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LocatedBlocks::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LocatedBlocks::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LocatedBlocks::GetClassData() const { return &_class_data_; }
+
+
+void LocatedBlocks::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LocatedBlocks*>(&to_msg);
+  auto& from = static_cast<const LocatedBlocks&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.LocatedBlocks)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.locatedblks_.MergeFrom(from._impl_.locatedblks_);
+  if (!from._internal_inlinedata().empty()) {
+    _this->_internal_set_inlinedata(from._internal_inlinedata());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LocatedBlocks::CopyFrom(const LocatedBlocks& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.LocatedBlocks)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LocatedBlocks::IsInitialized() const {
+  return true;
+}
+
+void LocatedBlocks::InternalSwap(LocatedBlocks* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.locatedblks_.InternalSwap(&other->_impl_.locatedblks_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.inlinedata_, lhs_arena,
+      &other->_impl_.inlinedata_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LocatedBlocks::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[9]);
+}
+
+// ===================================================================
+
+class BlkIDs::_Internal {
+ public:
+};
+
+BlkIDs::BlkIDs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.BlkIDs)
+}
+BlkIDs::BlkIDs(const BlkIDs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlkIDs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blkids_){from._impl_.blkids_}
+    , /*decltype(_impl_._blkids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:minidfs.BlkIDs)
+}
+
+inline void BlkIDs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blkids_){arena}
+    , /*decltype(_impl_._blkids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BlkIDs::~BlkIDs() {
+  // @@protoc_insertion_point(destructor:minidfs.BlkIDs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlkIDs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.blkids_.~RepeatedField();
+}
+
+void BlkIDs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlkIDs::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.BlkIDs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.blkids_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlkIDs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 blkIDs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_blkids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_blkids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlkIDs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.BlkIDs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 blkIDs = 1;
+  {
+    int byte_size = _impl_._blkids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          1, _internal_blkids(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.BlkIDs)
+  return target;
+}
+
+size_t BlkIDs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.BlkIDs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 blkIDs = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.blkids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._blkids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlkIDs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlkIDs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlkIDs::GetClassData() const { return &_class_data_; }
+
+
+void BlkIDs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlkIDs*>(&to_msg);
+  auto& from = static_cast<const BlkIDs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.BlkIDs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.blkids_.MergeFrom(from._impl_.blkids_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlkIDs::CopyFrom(const BlkIDs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.BlkIDs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlkIDs::IsInitialized() const {
+  return true;
+}
+
+void BlkIDs::InternalSwap(BlkIDs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.blkids_.InternalSwap(&other->_impl_.blkids_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlkIDs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[10]);
+}
+
+// ===================================================================
+
+class BlockReport::_Internal {
+ public:
+  static const ::minidfs::ChunkserverInfo& chunkserverinfo(const BlockReport* msg);
+};
+
+const ::minidfs::ChunkserverInfo&
+BlockReport::_Internal::chunkserverinfo(const BlockReport* msg) {
+  return *msg->_impl_.chunkserverinfo_;
+}
+BlockReport::BlockReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.BlockReport)
+}
+BlockReport::BlockReport(const BlockReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlockReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blkids_){from._impl_.blkids_}
+    , /*decltype(_impl_._blkids_cached_byte_size_)*/{0}
+    , decltype(_impl_.encodedblkids_){}
+    , decltype(_impl_.chunkserverinfo_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.encodedblkids_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.encodedblkids_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_encodedblkids().empty()) {
+    _this->_impl_.encodedblkids_.Set(from._internal_encodedblkids(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_chunkserverinfo()) {
+    _this->_impl_.chunkserverinfo_ = new ::minidfs::ChunkserverInfo(*from._impl_.chunkserverinfo_);
+  }
+  // @@protoc_insertion_point(copy_constructor:minidfs.BlockReport)
+}
+
+inline void BlockReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blkids_){arena}
+    , /*decltype(_impl_._blkids_cached_byte_size_)*/{0}
+    , decltype(_impl_.encodedblkids_){}
+    , decltype(_impl_.chunkserverinfo_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.encodedblkids_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.encodedblkids_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BlockReport::~BlockReport() {
+  // @@protoc_insertion_point(destructor:minidfs.BlockReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlockReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.blkids_.~RepeatedField();
+  _impl_.encodedblkids_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.chunkserverinfo_;
+}
+
+void BlockReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlockReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.BlockReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.blkids_.Clear();
+  _impl_.encodedblkids_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.chunkserverinfo_ != nullptr) {
+    delete _impl_.chunkserverinfo_;
+  }
+  _impl_.chunkserverinfo_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlockReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .minidfs.ChunkserverInfo chunkserverInfo = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_chunkserverinfo(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 blkIDs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_blkids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_blkids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes encodedBlkIDs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_encodedblkids();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlockReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.BlockReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
+  if (this->_internal_has_chunkserverinfo()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::chunkserverinfo(this),
+        _Internal::chunkserverinfo(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated int32 blkIDs = 2;
+  {
+    int byte_size = _impl_._blkids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_blkids(), byte_size, target);
+    }
+  }
+
+  // bytes encodedBlkIDs = 3;
+  if (!this->_internal_encodedblkids().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_encodedblkids(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.BlockReport)
+  return target;
+}
+
+size_t BlockReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.BlockReport)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 blkIDs = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.blkids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._blkids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // bytes encodedBlkIDs = 3;
+  if (!this->_internal_encodedblkids().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_encodedblkids());
+  }
+
+  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
+  if (this->_internal_has_chunkserverinfo()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.chunkserverinfo_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlockReport::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlockReport::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlockReport::GetClassData() const { return &_class_data_; }
+
+
+void BlockReport::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlockReport*>(&to_msg);
+  auto& from = static_cast<const BlockReport&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.BlockReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.blkids_.MergeFrom(from._impl_.blkids_);
+  if (!from._internal_encodedblkids().empty()) {
+    _this->_internal_set_encodedblkids(from._internal_encodedblkids());
+  }
+  if (from._internal_has_chunkserverinfo()) {
+    _this->_internal_mutable_chunkserverinfo()->::minidfs::ChunkserverInfo::MergeFrom(
+        from._internal_chunkserverinfo());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlockReport::CopyFrom(const BlockReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.BlockReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlockReport::IsInitialized() const {
+  return true;
+}
+
+void BlockReport::InternalSwap(BlockReport* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.blkids_.InternalSwap(&other->_impl_.blkids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.encodedblkids_, lhs_arena,
+      &other->_impl_.encodedblkids_, rhs_arena
+  );
+  swap(_impl_.chunkserverinfo_, other->_impl_.chunkserverinfo_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlockReport::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[11]);
+}
+
+// ===================================================================
+
+class VolumeInfo::_Internal {
+ public:
+};
+
+VolumeInfo::VolumeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.VolumeInfo)
+}
+VolumeInfo::VolumeInfo(const VolumeInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VolumeInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dir_){}
+    , decltype(_impl_.capacity_){}
+    , decltype(_impl_.available_){}
+    , decltype(_impl_.npendingio_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_dir().empty()) {
+    _this->_impl_.dir_.Set(from._internal_dir(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.capacity_, &from._impl_.capacity_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.npendingio_) -
+    reinterpret_cast<char*>(&_impl_.capacity_)) + sizeof(_impl_.npendingio_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.VolumeInfo)
+}
+
+inline void VolumeInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dir_){}
+    , decltype(_impl_.capacity_){int64_t{0}}
+    , decltype(_impl_.available_){int64_t{0}}
+    , decltype(_impl_.npendingio_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+VolumeInfo::~VolumeInfo() {
+  // @@protoc_insertion_point(destructor:minidfs.VolumeInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VolumeInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dir_.Destroy();
+}
+
+void VolumeInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VolumeInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.VolumeInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dir_.ClearToEmpty();
+  ::memset(&_impl_.capacity_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.npendingio_) -
+      reinterpret_cast<char*>(&_impl_.capacity_)) + sizeof(_impl_.npendingio_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VolumeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string dir = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_dir();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.VolumeInfo.dir"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 capacity = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 available = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.available_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 nPendingIO = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.npendingio_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VolumeInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.VolumeInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string dir = 1;
+  if (!this->_internal_dir().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_dir().data(), static_cast<int>(this->_internal_dir().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "minidfs.VolumeInfo.dir");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_dir(), target);
+  }
+
+  // int64 capacity = 2;
+  if (this->_internal_capacity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_capacity(), target);
+  }
+
+  // int64 available = 3;
+  if (this->_internal_available() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_available(), target);
+  }
+
+  // int32 nPendingIO = 4;
+  if (this->_internal_npendingio() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_npendingio(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.VolumeInfo)
+  return target;
+}
+
+size_t VolumeInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.VolumeInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string dir = 1;
+  if (!this->_internal_dir().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_dir());
+  }
+
+  // int64 capacity = 2;
+  if (this->_internal_capacity() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_capacity());
+  }
+
+  // int64 available = 3;
+  if (this->_internal_available() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_available());
+  }
+
+  // int32 nPendingIO = 4;
+  if (this->_internal_npendingio() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_npendingio());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VolumeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VolumeInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VolumeInfo::GetClassData() const { return &_class_data_; }
+
+
+void VolumeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VolumeInfo*>(&to_msg);
+  auto& from = static_cast<const VolumeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.VolumeInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_dir().empty()) {
+    _this->_internal_set_dir(from._internal_dir());
+  }
+  if (from._internal_capacity() != 0) {
+    _this->_internal_set_capacity(from._internal_capacity());
+  }
+  if (from._internal_available() != 0) {
+    _this->_internal_set_available(from._internal_available());
+  }
+  if (from._internal_npendingio() != 0) {
+    _this->_internal_set_npendingio(from._internal_npendingio());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VolumeInfo::CopyFrom(const VolumeInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.VolumeInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VolumeInfo::IsInitialized() const {
+  return true;
+}
+
+void VolumeInfo::InternalSwap(VolumeInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.dir_, lhs_arena,
+      &other->_impl_.dir_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VolumeInfo, _impl_.npendingio_)
+      + sizeof(VolumeInfo::_impl_.npendingio_)
+      - PROTOBUF_FIELD_OFFSET(VolumeInfo, _impl_.capacity_)>(
+          reinterpret_cast<char*>(&_impl_.capacity_),
+          reinterpret_cast<char*>(&other->_impl_.capacity_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VolumeInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[12]);
+}
+
+// ===================================================================
+
+class Heartbeat::_Internal {
+ public:
+  static const ::minidfs::ChunkserverInfo& chunkserverinfo(const Heartbeat* msg);
+};
+
+const ::minidfs::ChunkserverInfo&
+Heartbeat::_Internal::chunkserverinfo(const Heartbeat* msg) {
+  return *msg->_impl_.chunkserverinfo_;
+}
+Heartbeat::Heartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.Heartbeat)
+}
+Heartbeat::Heartbeat(const Heartbeat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Heartbeat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recvedblkids_){from._impl_.recvedblkids_}
+    , /*decltype(_impl_._recvedblkids_cached_byte_size_)*/{0}
+    , decltype(_impl_.failedblkids_){from._impl_.failedblkids_}
+    , /*decltype(_impl_._failedblkids_cached_byte_size_)*/{0}
+    , decltype(_impl_.corruptblkids_){from._impl_.corruptblkids_}
+    , /*decltype(_impl_._corruptblkids_cached_byte_size_)*/{0}
+    , decltype(_impl_.volumes_){from._impl_.volumes_}
+    , decltype(_impl_.chunkserverinfo_){nullptr}
+    , decltype(_impl_.nactivexfers_){}
+    , decltype(_impl_.acceptblktasks_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_chunkserverinfo()) {
+    _this->_impl_.chunkserverinfo_ = new ::minidfs::ChunkserverInfo(*from._impl_.chunkserverinfo_);
+  }
+  ::memcpy(&_impl_.nactivexfers_, &from._impl_.nactivexfers_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.acceptblktasks_) -
+    reinterpret_cast<char*>(&_impl_.nactivexfers_)) + sizeof(_impl_.acceptblktasks_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.Heartbeat)
+}
+
+inline void Heartbeat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recvedblkids_){arena}
+    , /*decltype(_impl_._recvedblkids_cached_byte_size_)*/{0}
+    , decltype(_impl_.failedblkids_){arena}
+    , /*decltype(_impl_._failedblkids_cached_byte_size_)*/{0}
+    , decltype(_impl_.corruptblkids_){arena}
+    , /*decltype(_impl_._corruptblkids_cached_byte_size_)*/{0}
+    , decltype(_impl_.volumes_){arena}
+    , decltype(_impl_.chunkserverinfo_){nullptr}
+    , decltype(_impl_.nactivexfers_){0}
+    , decltype(_impl_.acceptblktasks_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Heartbeat::~Heartbeat() {
+  // @@protoc_insertion_point(destructor:minidfs.Heartbeat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Heartbeat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.recvedblkids_.~RepeatedField();
+  _impl_.failedblkids_.~RepeatedField();
+  _impl_.corruptblkids_.~RepeatedField();
+  _impl_.volumes_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.chunkserverinfo_;
+}
+
+void Heartbeat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Heartbeat::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.Heartbeat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.recvedblkids_.Clear();
+  _impl_.failedblkids_.Clear();
+  _impl_.corruptblkids_.Clear();
+  _impl_.volumes_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.chunkserverinfo_ != nullptr) {
+    delete _impl_.chunkserverinfo_;
+  }
+  _impl_.chunkserverinfo_ = nullptr;
+  ::memset(&_impl_.nactivexfers_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.acceptblktasks_) -
+      reinterpret_cast<char*>(&_impl_.nactivexfers_)) + sizeof(_impl_.acceptblktasks_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Heartbeat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .minidfs.ChunkserverInfo chunkserverInfo = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_chunkserverinfo(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 nActiveXfers = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.nactivexfers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 recvedBlkIDs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_recvedblkids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_recvedblkids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool acceptBlkTasks = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.acceptblktasks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 failedBlkIDs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_failedblkids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_failedblkids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 corruptBlkIDs = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_corruptblkids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_corruptblkids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .minidfs.VolumeInfo volumes = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_volumes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Heartbeat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Heartbeat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
+  if (this->_internal_has_chunkserverinfo()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::chunkserverinfo(this),
+        _Internal::chunkserverinfo(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 nActiveXfers = 2;
+  if (this->_internal_nactivexfers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_nactivexfers(), target);
+  }
+
+  // repeated int32 recvedBlkIDs = 3;
+  {
+    int byte_size = _impl_._recvedblkids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          3, _internal_recvedblkids(), byte_size, target);
+    }
+  }
+
+  // bool acceptBlkTasks = 4;
+  if (this->_internal_acceptblktasks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_acceptblktasks(), target);
+  }
+
+  // repeated int32 failedBlkIDs = 5;
+  {
+    int byte_size = _impl_._failedblkids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          5, _internal_failedblkids(), byte_size, target);
+    }
+  }
+
+  // repeated int32 corruptBlkIDs = 6;
+  {
+    int byte_size = _impl_._corruptblkids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          6, _internal_corruptblkids(), byte_size, target);
+    }
+  }
+
+  // repeated .minidfs.VolumeInfo volumes = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_volumes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_volumes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Heartbeat)
+  return target;
+}
+
+size_t Heartbeat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.Heartbeat)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 recvedBlkIDs = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.recvedblkids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._recvedblkids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 failedBlkIDs = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.failedblkids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._failedblkids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 corruptBlkIDs = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.corruptblkids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._corruptblkids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .minidfs.VolumeInfo volumes = 7;
+  total_size += 1UL * this->_internal_volumes_size();
+  for (const auto& msg : this->_impl_.volumes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
+  if (this->_internal_has_chunkserverinfo()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.chunkserverinfo_);
+  }
+
+  // int32 nActiveXfers = 2;
+  if (this->_internal_nactivexfers() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nactivexfers());
+  }
+
+  // bool acceptBlkTasks = 4;
+  if (this->_internal_acceptblktasks() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Heartbeat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Heartbeat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Heartbeat::GetClassData() const { return &_class_data_; }
+
+
+void Heartbeat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Heartbeat*>(&to_msg);
+  auto& from = static_cast<const Heartbeat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Heartbeat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.recvedblkids_.MergeFrom(from._impl_.recvedblkids_);
+  _this->_impl_.failedblkids_.MergeFrom(from._impl_.failedblkids_);
+  _this->_impl_.corruptblkids_.MergeFrom(from._impl_.corruptblkids_);
+  _this->_impl_.volumes_.MergeFrom(from._impl_.volumes_);
+  if (from._internal_has_chunkserverinfo()) {
+    _this->_internal_mutable_chunkserverinfo()->::minidfs::ChunkserverInfo::MergeFrom(
+        from._internal_chunkserverinfo());
+  }
+  if (from._internal_nactivexfers() != 0) {
+    _this->_internal_set_nactivexfers(from._internal_nactivexfers());
+  }
+  if (from._internal_acceptblktasks() != 0) {
+    _this->_internal_set_acceptblktasks(from._internal_acceptblktasks());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Heartbeat::CopyFrom(const Heartbeat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Heartbeat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Heartbeat::IsInitialized() const {
+  return true;
+}
+
+void Heartbeat::InternalSwap(Heartbeat* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.recvedblkids_.InternalSwap(&other->_impl_.recvedblkids_);
+  _impl_.failedblkids_.InternalSwap(&other->_impl_.failedblkids_);
+  _impl_.corruptblkids_.InternalSwap(&other->_impl_.corruptblkids_);
+  _impl_.volumes_.InternalSwap(&other->_impl_.volumes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Heartbeat, _impl_.acceptblktasks_)
+      + sizeof(Heartbeat::_impl_.acceptblktasks_)
+      - PROTOBUF_FIELD_OFFSET(Heartbeat, _impl_.chunkserverinfo_)>(
+          reinterpret_cast<char*>(&_impl_.chunkserverinfo_),
+          reinterpret_cast<char*>(&other->_impl_.chunkserverinfo_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Heartbeat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[13]);
+}
 
 // ===================================================================
 
-void Block::InitAsDefaultInstance() {
-}
-class Block::_Internal {
+class BlockTask::_Internal {
  public:
+  static const ::minidfs::LocatedBlock& locatedblk(const BlockTask* msg);
+  static const ::minidfs::LocatedBlock& blkgroup(const BlockTask* msg);
 };
 
-Block::Block()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.Block)
+const ::minidfs::LocatedBlock&
+BlockTask::_Internal::locatedblk(const BlockTask* msg) {
+  return *msg->_impl_.locatedblk_;
 }
-Block::Block(const Block& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&blocklen_, &from.blocklen_,
-    static_cast<size_t>(reinterpret_cast<char*>(&blockid_) -
-    reinterpret_cast<char*>(&blocklen_)) + sizeof(blockid_));
-  // @@protoc_insertion_point(copy_constructor:minidfs.Block)
+const ::minidfs::LocatedBlock&
+BlockTask::_Internal::blkgroup(const BlockTask* msg) {
+  return *msg->_impl_.blkgroup_;
+}
+BlockTask::BlockTask(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.BlockTask)
+}
+BlockTask::BlockTask(const BlockTask& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlockTask* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.locatedblk_){nullptr}
+    , decltype(_impl_.blkgroup_){nullptr}
+    , decltype(_impl_.operation_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_locatedblk()) {
+    _this->_impl_.locatedblk_ = new ::minidfs::LocatedBlock(*from._impl_.locatedblk_);
+  }
+  if (from._internal_has_blkgroup()) {
+    _this->_impl_.blkgroup_ = new ::minidfs::LocatedBlock(*from._impl_.blkgroup_);
+  }
+  _this->_impl_.operation_ = from._impl_.operation_;
+  // @@protoc_insertion_point(copy_constructor:minidfs.BlockTask)
 }
 
-void Block::SharedCtor() {
-  ::memset(&blocklen_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&blockid_) -
-      reinterpret_cast<char*>(&blocklen_)) + sizeof(blockid_));
+inline void BlockTask::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.locatedblk_){nullptr}
+    , decltype(_impl_.blkgroup_){nullptr}
+    , decltype(_impl_.operation_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-Block::~Block() {
-  // @@protoc_insertion_point(destructor:minidfs.Block)
+BlockTask::~BlockTask() {
+  // @@protoc_insertion_point(destructor:minidfs.BlockTask)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Block::SharedDtor() {
+inline void BlockTask::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.locatedblk_;
+  if (this != internal_default_instance()) delete _impl_.blkgroup_;
 }
 
-void Block::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Block& Block::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Block_minidfs_2eproto.base);
-  return *internal_default_instance();
+void BlockTask::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Block::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.Block)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void BlockTask::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.BlockTask)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&blocklen_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&blockid_) -
-      reinterpret_cast<char*>(&blocklen_)) + sizeof(blockid_));
-  _internal_metadata_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.locatedblk_ != nullptr) {
+    delete _impl_.locatedblk_;
+  }
+  _impl_.locatedblk_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.blkgroup_ != nullptr) {
+    delete _impl_.blkgroup_;
+  }
+  _impl_.blkgroup_ = nullptr;
+  _impl_.operation_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* Block::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BlockTask::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 blockID = 1;
+      // int32 operation = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          blockid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.operation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int64 blockLen = 2;
+      // .minidfs.LocatedBlock locatedBlk = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          blocklen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_locatedblk(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .minidfs.LocatedBlock blkGroup = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_blkgroup(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool Block::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.Block)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 blockID = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &blockid_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 blockLen = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
-                 input, &blocklen_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.Block)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.Block)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void Block::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.Block)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* BlockTask::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.BlockTask)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 blockID = 1;
-  if (this->blockid() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->blockid(), output);
-  }
-
-  // int64 blockLen = 2;
-  if (this->blocklen() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(2, this->blocklen(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // int32 operation = 1;
+  if (this->_internal_operation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_operation(), target);
   }
-  // @@protoc_insertion_point(serialize_end:minidfs.Block)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Block::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Block)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // int32 blockID = 1;
-  if (this->blockid() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->blockid(), target);
+  // .minidfs.LocatedBlock locatedBlk = 2;
+  if (this->_internal_has_locatedblk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::locatedblk(this),
+        _Internal::locatedblk(this).GetCachedSize(), target, stream);
   }
 
-  // int64 blockLen = 2;
-  if (this->blocklen() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(2, this->blocklen(), target);
+  // .minidfs.LocatedBlock blkGroup = 3;
+  if (this->_internal_has_blkgroup()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::blkgroup(this),
+        _Internal::blkgroup(this).GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Block)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.BlockTask)
   return target;
 }
 
-size_t Block::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.Block)
+size_t BlockTask::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.BlockTask)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int64 blockLen = 2;
-  if (this->blocklen() != 0) {
+  // .minidfs.LocatedBlock locatedBlk = 2;
+  if (this->_internal_has_locatedblk()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
-        this->blocklen());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.locatedblk_);
   }
 
-  // int32 blockID = 1;
-  if (this->blockid() != 0) {
+  // .minidfs.LocatedBlock blkGroup = 3;
+  if (this->_internal_has_blkgroup()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->blockid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.blkgroup_);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Block::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.Block)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Block* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Block>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.Block)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.Block)
-    MergeFrom(*source);
+  // int32 operation = 1;
+  if (this->_internal_operation() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_operation());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Block::MergeFrom(const Block& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Block)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlockTask::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlockTask::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlockTask::GetClassData() const { return &_class_data_; }
+
+
+void BlockTask::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlockTask*>(&to_msg);
+  auto& from = static_cast<const BlockTask&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.BlockTask)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.blocklen() != 0) {
-    set_blocklen(from.blocklen());
+  if (from._internal_has_locatedblk()) {
+    _this->_internal_mutable_locatedblk()->::minidfs::LocatedBlock::MergeFrom(
+        from._internal_locatedblk());
   }
-  if (from.blockid() != 0) {
-    set_blockid(from.blockid());
+  if (from._internal_has_blkgroup()) {
+    _this->_internal_mutable_blkgroup()->::minidfs::LocatedBlock::MergeFrom(
+        from._internal_blkgroup());
   }
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Block::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.Block)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Block::CopyFrom(const Block& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Block)
+void BlockTask::CopyFrom(const BlockTask& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.BlockTask)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Block::IsInitialized() const {
+bool BlockTask::IsInitialized() const {
   return true;
 }
 
-void Block::InternalSwap(Block* other) {
+void BlockTask::InternalSwap(BlockTask* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(blocklen_, other->blocklen_);
-  swap(blockid_, other->blockid_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BlockTask, _impl_.operation_)
+      + sizeof(BlockTask::_impl_.operation_)
+      - PROTOBUF_FIELD_OFFSET(BlockTask, _impl_.locatedblk_)>(
+          reinterpret_cast<char*>(&_impl_.locatedblk_),
+          reinterpret_cast<char*>(&other->_impl_.locatedblk_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Block::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata BlockTask::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[14]);
 }
 
-
 // ===================================================================
 
-void ChunkserverInfo::InitAsDefaultInstance() {
-}
-class ChunkserverInfo::_Internal {
+class BlockTasks::_Internal {
  public:
 };
 
-ChunkserverInfo::ChunkserverInfo()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.ChunkserverInfo)
+BlockTasks::BlockTasks(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.BlockTasks)
 }
-ChunkserverInfo::ChunkserverInfo(const ChunkserverInfo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  chunkserverip_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from.chunkserverip().empty()) {
-    chunkserverip_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.chunkserverip_);
-  }
-  chunkserverport_ = from.chunkserverport_;
-  // @@protoc_insertion_point(copy_constructor:minidfs.ChunkserverInfo)
+BlockTasks::BlockTasks(const BlockTasks& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlockTasks* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blktasks_){from._impl_.blktasks_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:minidfs.BlockTasks)
 }
 
-void ChunkserverInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ChunkserverInfo_minidfs_2eproto.base);
-  chunkserverip_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  chunkserverport_ = 0;
+inline void BlockTasks::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blktasks_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-ChunkserverInfo::~ChunkserverInfo() {
-  // @@protoc_insertion_point(destructor:minidfs.ChunkserverInfo)
+BlockTasks::~BlockTasks() {
+  // @@protoc_insertion_point(destructor:minidfs.BlockTasks)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ChunkserverInfo::SharedDtor() {
-  chunkserverip_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void BlockTasks::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.blktasks_.~RepeatedPtrField();
 }
 
-void ChunkserverInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ChunkserverInfo& ChunkserverInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ChunkserverInfo_minidfs_2eproto.base);
-  return *internal_default_instance();
+void BlockTasks::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void ChunkserverInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.ChunkserverInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void BlockTasks::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.BlockTasks)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  chunkserverip_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  chunkserverport_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.blktasks_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* ChunkserverInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BlockTasks::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string chunkserverIP = 1;
+      // repeated .minidfs.BlockTask blkTasks = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_chunkserverip(), ptr, ctx, "minidfs.ChunkserverInfo.chunkserverIP");
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 chunkserverPort = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          chunkserverport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_blktasks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool ChunkserverInfo::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.ChunkserverInfo)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string chunkserverIP = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_chunkserverip()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->chunkserverip().data(), static_cast<int>(this->chunkserverip().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "minidfs.ChunkserverInfo.chunkserverIP"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 chunkserverPort = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &chunkserverport_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.ChunkserverInfo)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.ChunkserverInfo)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void ChunkserverInfo::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.ChunkserverInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string chunkserverIP = 1;
-  if (this->chunkserverip().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->chunkserverip().data(), static_cast<int>(this->chunkserverip().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "minidfs.ChunkserverInfo.chunkserverIP");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->chunkserverip(), output);
-  }
-
-  // int32 chunkserverPort = 2;
-  if (this->chunkserverport() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(2, this->chunkserverport(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:minidfs.ChunkserverInfo)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* ChunkserverInfo::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.ChunkserverInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* BlockTasks::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.BlockTasks)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string chunkserverIP = 1;
-  if (this->chunkserverip().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->chunkserverip().data(), static_cast<int>(this->chunkserverip().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "minidfs.ChunkserverInfo.chunkserverIP");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        1, this->chunkserverip(), target);
-  }
-
-  // int32 chunkserverPort = 2;
-  if (this->chunkserverport() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->chunkserverport(), target);
+  // repeated .minidfs.BlockTask blkTasks = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blktasks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blktasks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.ChunkserverInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.BlockTasks)
   return target;
 }
 
-size_t ChunkserverInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.ChunkserverInfo)
+size_t BlockTasks::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.BlockTasks)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string chunkserverIP = 1;
-  if (this->chunkserverip().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->chunkserverip());
-  }
-
-  // int32 chunkserverPort = 2;
-  if (this->chunkserverport() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->chunkserverport());
+  // repeated .minidfs.BlockTask blkTasks = 1;
+  total_size += 1UL * this->_internal_blktasks_size();
+  for (const auto& msg : this->_impl_.blktasks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void ChunkserverInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.ChunkserverInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ChunkserverInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ChunkserverInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.ChunkserverInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.ChunkserverInfo)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ChunkserverInfo::MergeFrom(const ChunkserverInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.ChunkserverInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlockTasks::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlockTasks::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlockTasks::GetClassData() const { return &_class_data_; }
 
-  if (from.chunkserverip().size() > 0) {
 
-    chunkserverip_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.chunkserverip_);
-  }
-  if (from.chunkserverport() != 0) {
-    set_chunkserverport(from.chunkserverport());
-  }
-}
+void BlockTasks::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlockTasks*>(&to_msg);
+  auto& from = static_cast<const BlockTasks&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.BlockTasks)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void ChunkserverInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.ChunkserverInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.blktasks_.MergeFrom(from._impl_.blktasks_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ChunkserverInfo::CopyFrom(const ChunkserverInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.ChunkserverInfo)
+void BlockTasks::CopyFrom(const BlockTasks& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.BlockTasks)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ChunkserverInfo::IsInitialized() const {
+bool BlockTasks::IsInitialized() const {
   return true;
 }
 
-void ChunkserverInfo::InternalSwap(ChunkserverInfo* other) {
+void BlockTasks::InternalSwap(BlockTasks* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  chunkserverip_.Swap(&other->chunkserverip_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(chunkserverport_, other->chunkserverport_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.blktasks_.InternalSwap(&other->_impl_.blktasks_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ChunkserverInfo::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata BlockTasks::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[15]);
 }
 
-
 // ===================================================================
 
-void LocatedBlock::InitAsDefaultInstance() {
-  ::minidfs::_LocatedBlock_default_instance_._instance.get_mutable()->block_ = const_cast< ::minidfs::Block*>(
-      ::minidfs::Block::internal_default_instance());
-}
-class LocatedBlock::_Internal {
+class Inode::_Internal {
  public:
-  static const ::minidfs::Block& block(const LocatedBlock* msg);
 };
 
-const ::minidfs::Block&
-LocatedBlock::_Internal::block(const LocatedBlock* msg) {
-  return *msg->block_;
+Inode::Inode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.Inode)
 }
-LocatedBlock::LocatedBlock()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.LocatedBlock)
-}
-LocatedBlock::LocatedBlock(const LocatedBlock& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      chunkserverinfos_(from.chunkserverinfos_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_block()) {
-    block_ = new ::minidfs::Block(*from.block_);
-  } else {
-    block_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:minidfs.LocatedBlock)
+Inode::Inode(const Inode& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Inode* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blks_){from._impl_.blks_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.inlinedata_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.isdir_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.inlinedata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inlinedata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_inlinedata().empty()) {
+    _this->_impl_.inlinedata_.Set(from._internal_inlinedata(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.isdir_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.isdir_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.Inode)
 }
 
-void LocatedBlock::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LocatedBlock_minidfs_2eproto.base);
-  block_ = nullptr;
+inline void Inode::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blks_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.inlinedata_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.isdir_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.inlinedata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inlinedata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-LocatedBlock::~LocatedBlock() {
-  // @@protoc_insertion_point(destructor:minidfs.LocatedBlock)
+Inode::~Inode() {
+  // @@protoc_insertion_point(destructor:minidfs.Inode)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void LocatedBlock::SharedDtor() {
-  if (this != internal_default_instance()) delete block_;
+inline void Inode::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.blks_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.inlinedata_.Destroy();
 }
 
-void LocatedBlock::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const LocatedBlock& LocatedBlock::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LocatedBlock_minidfs_2eproto.base);
-  return *internal_default_instance();
+void Inode::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void LocatedBlock::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.LocatedBlock)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Inode::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.Inode)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  chunkserverinfos_.Clear();
-  if (GetArenaNoVirtual() == nullptr && block_ != nullptr) {
-    delete block_;
-  }
-  block_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.blks_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.inlinedata_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.isdir_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.isdir_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* LocatedBlock::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Inode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .minidfs.Block block = 1;
+      // int32 id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_block(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
+      // string name = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.Inode.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool isDir = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.isdir_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .minidfs.Block blks = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_chunkserverinfos(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_blks(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 18);
-        } else goto handle_unusual;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // bytes inlineData = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_inlinedata();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool LocatedBlock::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.LocatedBlock)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .minidfs.Block block = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_block()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_chunkserverinfos()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.LocatedBlock)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.LocatedBlock)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void LocatedBlock::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.LocatedBlock)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Inode::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Inode)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .minidfs.Block block = 1;
-  if (this->has_block()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, _Internal::block(this), output);
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
   }
 
-  // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->chunkserverinfos_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->chunkserverinfos(static_cast<int>(i)),
-      output);
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "minidfs.Inode.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // bool isDir = 3;
+  if (this->_internal_isdir() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_isdir(), target);
   }
-  // @@protoc_insertion_point(serialize_end:minidfs.LocatedBlock)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* LocatedBlock::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.LocatedBlock)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // .minidfs.Block block = 1;
-  if (this->has_block()) {
+  // repeated .minidfs.Block blks = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blks(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, _Internal::block(this), target);
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->chunkserverinfos_size()); i < n; i++) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->chunkserverinfos(static_cast<int>(i)), target);
+  // bytes inlineData = 5;
+  if (!this->_internal_inlinedata().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_inlinedata(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.LocatedBlock)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Inode)
   return target;
 }
 
-size_t LocatedBlock::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.LocatedBlock)
+size_t Inode::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.Inode)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->chunkserverinfos_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->chunkserverinfos(static_cast<int>(i)));
-    }
+  // repeated .minidfs.Block blks = 4;
+  total_size += 1UL * this->_internal_blks_size();
+  for (const auto& msg : this->_impl_.blks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .minidfs.Block block = 1;
-  if (this->has_block()) {
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *block_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // bytes inlineData = 5;
+  if (!this->_internal_inlinedata().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_inlinedata());
+  }
+
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+  }
 
-void LocatedBlock::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.LocatedBlock)
-  GOOGLE_DCHECK_NE(&from, this);
-  const LocatedBlock* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LocatedBlock>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.LocatedBlock)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.LocatedBlock)
-    MergeFrom(*source);
+  // bool isDir = 3;
+  if (this->_internal_isdir() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LocatedBlock::MergeFrom(const LocatedBlock& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.LocatedBlock)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Inode::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Inode::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Inode::GetClassData() const { return &_class_data_; }
+
+
+void Inode::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Inode*>(&to_msg);
+  auto& from = static_cast<const Inode&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Inode)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  chunkserverinfos_.MergeFrom(from.chunkserverinfos_);
-  if (from.has_block()) {
-    mutable_block()->::minidfs::Block::MergeFrom(from.block());
+  _this->_impl_.blks_.MergeFrom(from._impl_.blks_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
+  if (!from._internal_inlinedata().empty()) {
+    _this->_internal_set_inlinedata(from._internal_inlinedata());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_isdir() != 0) {
+    _this->_internal_set_isdir(from._internal_isdir());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void LocatedBlock::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.LocatedBlock)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void LocatedBlock::CopyFrom(const LocatedBlock& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.LocatedBlock)
+void Inode::CopyFrom(const Inode& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Inode)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LocatedBlock::IsInitialized() const {
+bool Inode::IsInitialized() const {
   return true;
 }
 
-void LocatedBlock::InternalSwap(LocatedBlock* other) {
+void Inode::InternalSwap(Inode* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&chunkserverinfos_)->InternalSwap(CastToBase(&other->chunkserverinfos_));
-  swap(block_, other->block_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.blks_.InternalSwap(&other->_impl_.blks_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.inlinedata_, lhs_arena,
+      &other->_impl_.inlinedata_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Inode, _impl_.isdir_)
+      + sizeof(Inode::_impl_.isdir_)
+      - PROTOBUF_FIELD_OFFSET(Inode, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata LocatedBlock::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Inode::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[16]);
 }
 
-
 // ===================================================================
 
-void LocatedBlocks::InitAsDefaultInstance() {
-}
-class LocatedBlocks::_Internal {
+class InodeSection::_Internal {
  public:
 };
 
-LocatedBlocks::LocatedBlocks()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.LocatedBlocks)
+InodeSection::InodeSection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.InodeSection)
 }
-LocatedBlocks::LocatedBlocks(const LocatedBlocks& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      locatedblks_(from.locatedblks_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:minidfs.LocatedBlocks)
+InodeSection::InodeSection(const InodeSection& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InodeSection* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.inodes_){from._impl_.inodes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:minidfs.InodeSection)
 }
 
-void LocatedBlocks::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LocatedBlocks_minidfs_2eproto.base);
+inline void InodeSection::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.inodes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-LocatedBlocks::~LocatedBlocks() {
-  // @@protoc_insertion_point(destructor:minidfs.LocatedBlocks)
+InodeSection::~InodeSection() {
+  // @@protoc_insertion_point(destructor:minidfs.InodeSection)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void LocatedBlocks::SharedDtor() {
+inline void InodeSection::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.inodes_.~RepeatedPtrField();
 }
 
-void LocatedBlocks::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const LocatedBlocks& LocatedBlocks::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LocatedBlocks_minidfs_2eproto.base);
-  return *internal_default_instance();
+void InodeSection::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void LocatedBlocks::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.LocatedBlocks)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void InodeSection::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.InodeSection)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  locatedblks_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.inodes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* LocatedBlocks::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* InodeSection::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .minidfs.LocatedBlock locatedBlks = 1;
+      // repeated .minidfs.Inode inodes = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_locatedblks(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_inodes(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 10);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool LocatedBlocks::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.LocatedBlocks)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .minidfs.LocatedBlock locatedBlks = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_locatedblks()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.LocatedBlocks)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.LocatedBlocks)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void LocatedBlocks::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.LocatedBlocks)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .minidfs.LocatedBlock locatedBlks = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->locatedblks_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->locatedblks(static_cast<int>(i)),
-      output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:minidfs.LocatedBlocks)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* LocatedBlocks::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.LocatedBlocks)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* InodeSection::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.InodeSection)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .minidfs.LocatedBlock locatedBlks = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->locatedblks_size()); i < n; i++) {
+  // repeated .minidfs.Inode inodes = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_inodes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_inodes(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->locatedblks(static_cast<int>(i)), target);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.LocatedBlocks)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.InodeSection)
   return target;
 }
 
-size_t LocatedBlocks::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.LocatedBlocks)
+size_t InodeSection::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.InodeSection)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .minidfs.LocatedBlock locatedBlks = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->locatedblks_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->locatedblks(static_cast<int>(i)));
-    }
+  // repeated .minidfs.Inode inodes = 1;
+  total_size += 1UL * this->_internal_inodes_size();
+  for (const auto& msg : this->_impl_.inodes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LocatedBlocks::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.LocatedBlocks)
-  GOOGLE_DCHECK_NE(&from, this);
-  const LocatedBlocks* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LocatedBlocks>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.LocatedBlocks)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.LocatedBlocks)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InodeSection::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InodeSection::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InodeSection::GetClassData() const { return &_class_data_; }
 
-void LocatedBlocks::MergeFrom(const LocatedBlocks& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.LocatedBlocks)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  locatedblks_.MergeFrom(from.locatedblks_);
-}
+void InodeSection::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InodeSection*>(&to_msg);
+  auto& from = static_cast<const InodeSection&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.InodeSection)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void LocatedBlocks::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.LocatedBlocks)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.inodes_.MergeFrom(from._impl_.inodes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void LocatedBlocks::CopyFrom(const LocatedBlocks& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.LocatedBlocks)
+void InodeSection::CopyFrom(const InodeSection& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.InodeSection)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LocatedBlocks::IsInitialized() const {
+bool InodeSection::IsInitialized() const {
   return true;
 }
 
-void LocatedBlocks::InternalSwap(LocatedBlocks* other) {
+void InodeSection::InternalSwap(InodeSection* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&locatedblks_)->InternalSwap(CastToBase(&other->locatedblks_));
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.inodes_.InternalSwap(&other->_impl_.inodes_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata LocatedBlocks::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata InodeSection::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[17]);
 }
 
-
 // ===================================================================
 
-void BlkIDs::InitAsDefaultInstance() {
-}
-class BlkIDs::_Internal {
+class Dentry::_Internal {
  public:
 };
 
-BlkIDs::BlkIDs()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.BlkIDs)
+Dentry::Dentry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.Dentry)
 }
-BlkIDs::BlkIDs(const BlkIDs& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      blkids_(from.blkids_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:minidfs.BlkIDs)
+Dentry::Dentry(const Dentry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Dentry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subdentries_){from._impl_.subdentries_}
+    , /*decltype(_impl_._subdentries_cached_byte_size_)*/{0}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:minidfs.Dentry)
 }
 
-void BlkIDs::SharedCtor() {
+inline void Dentry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subdentries_){arena}
+    , /*decltype(_impl_._subdentries_cached_byte_size_)*/{0}
+    , decltype(_impl_.id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-BlkIDs::~BlkIDs() {
-  // @@protoc_insertion_point(destructor:minidfs.BlkIDs)
+Dentry::~Dentry() {
+  // @@protoc_insertion_point(destructor:minidfs.Dentry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void BlkIDs::SharedDtor() {
+inline void Dentry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.subdentries_.~RepeatedField();
 }
 
-void BlkIDs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const BlkIDs& BlkIDs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BlkIDs_minidfs_2eproto.base);
-  return *internal_default_instance();
+void Dentry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void BlkIDs::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.BlkIDs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Dentry::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.Dentry)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  blkids_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.subdentries_.Clear();
+  _impl_.id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* BlkIDs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Dentry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated int32 blkIDs = 1;
+      // int32 id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(mutable_blkids(), ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8) {
-          add_blkids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
-          CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // repeated int32 subDentries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_subdentries(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_subdentries(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool BlkIDs::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.BlkIDs)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated int32 blkIDs = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, this->mutable_blkids())));
-        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 1, 10u, input, this->mutable_blkids())));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.BlkIDs)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.BlkIDs)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void BlkIDs::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.BlkIDs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Dentry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Dentry)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated int32 blkIDs = 1;
-  if (this->blkids_size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(1, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_blkids_cached_byte_size_.load(
-        std::memory_order_relaxed));
-  }
-  for (int i = 0, n = this->blkids_size(); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32NoTag(
-      this->blkids(i), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
   }
-  // @@protoc_insertion_point(serialize_end:minidfs.BlkIDs)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* BlkIDs::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.BlkIDs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated int32 blkIDs = 1;
-  if (this->blkids_size() > 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
-      1,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
-        _blkids_cached_byte_size_.load(std::memory_order_relaxed),
-         target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      WriteInt32NoTagToArray(this->blkids_, target);
+  // repeated int32 subDentries = 2;
+  {
+    int byte_size = _impl_._subdentries_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_subdentries(), byte_size, target);
+    }
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.BlkIDs)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Dentry)
   return target;
 }
 
-size_t BlkIDs::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.BlkIDs)
+size_t Dentry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.Dentry)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated int32 blkIDs = 1;
+  // repeated int32 subDentries = 2;
   {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      Int32Size(this->blkids_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.subdentries_);
     if (data_size > 0) {
       total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _blkids_cached_byte_size_.store(cached_size,
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._subdentries_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void BlkIDs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.BlkIDs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const BlkIDs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BlkIDs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.BlkIDs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.BlkIDs)
-    MergeFrom(*source);
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BlkIDs::MergeFrom(const BlkIDs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.BlkIDs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Dentry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Dentry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Dentry::GetClassData() const { return &_class_data_; }
 
-  blkids_.MergeFrom(from.blkids_);
-}
 
-void BlkIDs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.BlkIDs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void Dentry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Dentry*>(&to_msg);
+  auto& from = static_cast<const Dentry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Dentry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.subdentries_.MergeFrom(from._impl_.subdentries_);
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BlkIDs::CopyFrom(const BlkIDs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.BlkIDs)
+void Dentry::CopyFrom(const Dentry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Dentry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BlkIDs::IsInitialized() const {
+bool Dentry::IsInitialized() const {
   return true;
 }
 
-void BlkIDs::InternalSwap(BlkIDs* other) {
+void Dentry::InternalSwap(Dentry* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  blkids_.InternalSwap(&other->blkids_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.subdentries_.InternalSwap(&other->_impl_.subdentries_);
+  swap(_impl_.id_, other->_impl_.id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BlkIDs::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Dentry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[18]);
 }
 
-
 // ===================================================================
 
-void BlockReport::InitAsDefaultInstance() {
-  ::minidfs::_BlockReport_default_instance_._instance.get_mutable()->chunkserverinfo_ = const_cast< ::minidfs::ChunkserverInfo*>(
-      ::minidfs::ChunkserverInfo::internal_default_instance());
-}
-class BlockReport::_Internal {
+class DentrySection::_Internal {
  public:
-  static const ::minidfs::ChunkserverInfo& chunkserverinfo(const BlockReport* msg);
 };
 
-const ::minidfs::ChunkserverInfo&
-BlockReport::_Internal::chunkserverinfo(const BlockReport* msg) {
-  return *msg->chunkserverinfo_;
+DentrySection::DentrySection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.DentrySection)
 }
-BlockReport::BlockReport()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.BlockReport)
-}
-BlockReport::BlockReport(const BlockReport& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      blkids_(from.blkids_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_chunkserverinfo()) {
-    chunkserverinfo_ = new ::minidfs::ChunkserverInfo(*from.chunkserverinfo_);
-  } else {
-    chunkserverinfo_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:minidfs.BlockReport)
+DentrySection::DentrySection(const DentrySection& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DentrySection* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dentries_){from._impl_.dentries_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:minidfs.DentrySection)
 }
 
-void BlockReport::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BlockReport_minidfs_2eproto.base);
-  chunkserverinfo_ = nullptr;
+inline void DentrySection::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dentries_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-BlockReport::~BlockReport() {
-  // @@protoc_insertion_point(destructor:minidfs.BlockReport)
+DentrySection::~DentrySection() {
+  // @@protoc_insertion_point(destructor:minidfs.DentrySection)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void BlockReport::SharedDtor() {
-  if (this != internal_default_instance()) delete chunkserverinfo_;
+inline void DentrySection::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dentries_.~RepeatedPtrField();
 }
 
-void BlockReport::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const BlockReport& BlockReport::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BlockReport_minidfs_2eproto.base);
-  return *internal_default_instance();
+void DentrySection::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void BlockReport::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.BlockReport)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void DentrySection::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.DentrySection)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  blkids_.Clear();
-  if (GetArenaNoVirtual() == nullptr && chunkserverinfo_ != nullptr) {
-    delete chunkserverinfo_;
-  }
-  chunkserverinfo_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.dentries_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* BlockReport::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DentrySection::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .minidfs.ChunkserverInfo chunkserverInfo = 1;
+      // repeated .minidfs.Dentry dentries = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_chunkserverinfo(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // repeated int32 blkIDs = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(mutable_blkids(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16) {
-          add_blkids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dentries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool BlockReport::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.BlockReport)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .minidfs.ChunkserverInfo chunkserverInfo = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_chunkserverinfo()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated int32 blkIDs = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, this->mutable_blkids())));
-        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 1, 18u, input, this->mutable_blkids())));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.BlockReport)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.BlockReport)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void BlockReport::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.BlockReport)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
-  if (this->has_chunkserverinfo()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, _Internal::chunkserverinfo(this), output);
-  }
-
-  // repeated int32 blkIDs = 2;
-  if (this->blkids_size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(2, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_blkids_cached_byte_size_.load(
-        std::memory_order_relaxed));
-  }
-  for (int i = 0, n = this->blkids_size(); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32NoTag(
-      this->blkids(i), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:minidfs.BlockReport)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* BlockReport::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.BlockReport)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* DentrySection::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.DentrySection)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
-  if (this->has_chunkserverinfo()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, _Internal::chunkserverinfo(this), target);
-  }
-
-  // repeated int32 blkIDs = 2;
-  if (this->blkids_size() > 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
-      2,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
-        _blkids_cached_byte_size_.load(std::memory_order_relaxed),
-         target);
+  // repeated .minidfs.Dentry dentries = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dentries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dentries(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      WriteInt32NoTagToArray(this->blkids_, target);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.BlockReport)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.DentrySection)
   return target;
 }
 
-size_t BlockReport::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.BlockReport)
+size_t DentrySection::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.DentrySection)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated int32 blkIDs = 2;
-  {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      Int32Size(this->blkids_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
-    }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _blkids_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
-    total_size += data_size;
-  }
-
-  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
-  if (this->has_chunkserverinfo()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *chunkserverinfo_);
+  // repeated .minidfs.Dentry dentries = 1;
+  total_size += 1UL * this->_internal_dentries_size();
+  for (const auto& msg : this->_impl_.dentries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BlockReport::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.BlockReport)
-  GOOGLE_DCHECK_NE(&from, this);
-  const BlockReport* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BlockReport>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.BlockReport)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.BlockReport)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DentrySection::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DentrySection::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DentrySection::GetClassData() const { return &_class_data_; }
 
-void BlockReport::MergeFrom(const BlockReport& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.BlockReport)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  blkids_.MergeFrom(from.blkids_);
-  if (from.has_chunkserverinfo()) {
-    mutable_chunkserverinfo()->::minidfs::ChunkserverInfo::MergeFrom(from.chunkserverinfo());
-  }
-}
+void DentrySection::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DentrySection*>(&to_msg);
+  auto& from = static_cast<const DentrySection&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.DentrySection)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void BlockReport::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.BlockReport)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.dentries_.MergeFrom(from._impl_.dentries_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BlockReport::CopyFrom(const BlockReport& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.BlockReport)
+void DentrySection::CopyFrom(const DentrySection& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.DentrySection)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BlockReport::IsInitialized() const {
+bool DentrySection::IsInitialized() const {
   return true;
 }
 
-void BlockReport::InternalSwap(BlockReport* other) {
+void DentrySection::InternalSwap(DentrySection* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  blkids_.InternalSwap(&other->blkids_);
-  swap(chunkserverinfo_, other->chunkserverinfo_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.dentries_.InternalSwap(&other->_impl_.dentries_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BlockReport::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata DentrySection::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[19]);
 }
 
-
 // ===================================================================
 
-void BlockTask::InitAsDefaultInstance() {
-  ::minidfs::_BlockTask_default_instance_._instance.get_mutable()->locatedblk_ = const_cast< ::minidfs::LocatedBlock*>(
-      ::minidfs::LocatedBlock::internal_default_instance());
-}
-class BlockTask::_Internal {
+class NameSystem::_Internal {
  public:
-  static const ::minidfs::LocatedBlock& locatedblk(const BlockTask* msg);
+  static const ::minidfs::InodeSection& inodesection(const NameSystem* msg);
+  static const ::minidfs::DentrySection& dentrysection(const NameSystem* msg);
 };
 
-const ::minidfs::LocatedBlock&
-BlockTask::_Internal::locatedblk(const BlockTask* msg) {
-  return *msg->locatedblk_;
+const ::minidfs::InodeSection&
+NameSystem::_Internal::inodesection(const NameSystem* msg) {
+  return *msg->_impl_.inodesection_;
 }
-BlockTask::BlockTask()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.BlockTask)
+const ::minidfs::DentrySection&
+NameSystem::_Internal::dentrysection(const NameSystem* msg) {
+  return *msg->_impl_.dentrysection_;
 }
-BlockTask::BlockTask(const BlockTask& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_locatedblk()) {
-    locatedblk_ = new ::minidfs::LocatedBlock(*from.locatedblk_);
-  } else {
-    locatedblk_ = nullptr;
-  }
-  operation_ = from.operation_;
-  // @@protoc_insertion_point(copy_constructor:minidfs.BlockTask)
+NameSystem::NameSystem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.NameSystem)
+}
+NameSystem::NameSystem(const NameSystem& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NameSystem* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.inodesection_){nullptr}
+    , decltype(_impl_.dentrysection_){nullptr}
+    , decltype(_impl_.maxdfid_){}
+    , decltype(_impl_.maxblkid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_inodesection()) {
+    _this->_impl_.inodesection_ = new ::minidfs::InodeSection(*from._impl_.inodesection_);
+  }
+  if (from._internal_has_dentrysection()) {
+    _this->_impl_.dentrysection_ = new ::minidfs::DentrySection(*from._impl_.dentrysection_);
+  }
+  ::memcpy(&_impl_.maxdfid_, &from._impl_.maxdfid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.maxblkid_) -
+    reinterpret_cast<char*>(&_impl_.maxdfid_)) + sizeof(_impl_.maxblkid_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.NameSystem)
 }
 
-void BlockTask::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BlockTask_minidfs_2eproto.base);
-  ::memset(&locatedblk_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&operation_) -
-      reinterpret_cast<char*>(&locatedblk_)) + sizeof(operation_));
+inline void NameSystem::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.inodesection_){nullptr}
+    , decltype(_impl_.dentrysection_){nullptr}
+    , decltype(_impl_.maxdfid_){0}
+    , decltype(_impl_.maxblkid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-BlockTask::~BlockTask() {
-  // @@protoc_insertion_point(destructor:minidfs.BlockTask)
+NameSystem::~NameSystem() {
+  // @@protoc_insertion_point(destructor:minidfs.NameSystem)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void BlockTask::SharedDtor() {
-  if (this != internal_default_instance()) delete locatedblk_;
+inline void NameSystem::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.inodesection_;
+  if (this != internal_default_instance()) delete _impl_.dentrysection_;
 }
 
-void BlockTask::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const BlockTask& BlockTask::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BlockTask_minidfs_2eproto.base);
-  return *internal_default_instance();
+void NameSystem::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void BlockTask::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.BlockTask)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void NameSystem::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.NameSystem)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == nullptr && locatedblk_ != nullptr) {
-    delete locatedblk_;
+  if (GetArenaForAllocation() == nullptr && _impl_.inodesection_ != nullptr) {
+    delete _impl_.inodesection_;
   }
-  locatedblk_ = nullptr;
-  operation_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.inodesection_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.dentrysection_ != nullptr) {
+    delete _impl_.dentrysection_;
+  }
+  _impl_.dentrysection_ = nullptr;
+  ::memset(&_impl_.maxdfid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.maxblkid_) -
+      reinterpret_cast<char*>(&_impl_.maxdfid_)) + sizeof(_impl_.maxblkid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* BlockTask::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* NameSystem::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 operation = 1;
+      // int32 maxDfID = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          operation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.maxdfid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .minidfs.LocatedBlock locatedBlk = 2;
+      // int32 maxBlkID = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(mutable_locatedblk(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.maxblkid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .minidfs.InodeSection inodeSection = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_inodesection(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .minidfs.DentrySection dentrySection = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_dentrysection(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool BlockTask::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.BlockTask)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 operation = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &operation_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .minidfs.LocatedBlock locatedBlk = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_locatedblk()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.BlockTask)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.BlockTask)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void BlockTask::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.BlockTask)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* NameSystem::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.NameSystem)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 operation = 1;
-  if (this->operation() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->operation(), output);
-  }
-
-  // .minidfs.LocatedBlock locatedBlk = 2;
-  if (this->has_locatedblk()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, _Internal::locatedblk(this), output);
+  // int32 maxDfID = 1;
+  if (this->_internal_maxdfid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_maxdfid(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // int32 maxBlkID = 2;
+  if (this->_internal_maxblkid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_maxblkid(), target);
   }
-  // @@protoc_insertion_point(serialize_end:minidfs.BlockTask)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* BlockTask::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.BlockTask)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 operation = 1;
-  if (this->operation() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->operation(), target);
+  // .minidfs.InodeSection inodeSection = 3;
+  if (this->_internal_has_inodesection()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::inodesection(this),
+        _Internal::inodesection(this).GetCachedSize(), target, stream);
   }
 
-  // .minidfs.LocatedBlock locatedBlk = 2;
-  if (this->has_locatedblk()) {
+  // .minidfs.DentrySection dentrySection = 4;
+  if (this->_internal_has_dentrysection()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, _Internal::locatedblk(this), target);
+      InternalWriteMessage(4, _Internal::dentrysection(this),
+        _Internal::dentrysection(this).GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.BlockTask)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.NameSystem)
   return target;
 }
 
-size_t BlockTask::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.BlockTask)
+size_t NameSystem::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.NameSystem)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .minidfs.LocatedBlock locatedBlk = 2;
-  if (this->has_locatedblk()) {
+  // .minidfs.InodeSection inodeSection = 3;
+  if (this->_internal_has_inodesection()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *locatedblk_);
+        *_impl_.inodesection_);
   }
 
-  // int32 operation = 1;
-  if (this->operation() != 0) {
+  // .minidfs.DentrySection dentrySection = 4;
+  if (this->_internal_has_dentrysection()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->operation());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.dentrysection_);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // int32 maxDfID = 1;
+  if (this->_internal_maxdfid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_maxdfid());
+  }
 
-void BlockTask::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.BlockTask)
-  GOOGLE_DCHECK_NE(&from, this);
-  const BlockTask* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BlockTask>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.BlockTask)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.BlockTask)
-    MergeFrom(*source);
+  // int32 maxBlkID = 2;
+  if (this->_internal_maxblkid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_maxblkid());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BlockTask::MergeFrom(const BlockTask& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.BlockTask)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NameSystem::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NameSystem::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NameSystem::GetClassData() const { return &_class_data_; }
+
+
+void NameSystem::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NameSystem*>(&to_msg);
+  auto& from = static_cast<const NameSystem&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.NameSystem)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_locatedblk()) {
-    mutable_locatedblk()->::minidfs::LocatedBlock::MergeFrom(from.locatedblk());
+  if (from._internal_has_inodesection()) {
+    _this->_internal_mutable_inodesection()->::minidfs::InodeSection::MergeFrom(
+        from._internal_inodesection());
   }
-  if (from.operation() != 0) {
-    set_operation(from.operation());
+  if (from._internal_has_dentrysection()) {
+    _this->_internal_mutable_dentrysection()->::minidfs::DentrySection::MergeFrom(
+        from._internal_dentrysection());
   }
+  if (from._internal_maxdfid() != 0) {
+    _this->_internal_set_maxdfid(from._internal_maxdfid());
+  }
+  if (from._internal_maxblkid() != 0) {
+    _this->_internal_set_maxblkid(from._internal_maxblkid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BlockTask::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.BlockTask)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void BlockTask::CopyFrom(const BlockTask& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.BlockTask)
+void NameSystem::CopyFrom(const NameSystem& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.NameSystem)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BlockTask::IsInitialized() const {
+bool NameSystem::IsInitialized() const {
   return true;
 }
 
-void BlockTask::InternalSwap(BlockTask* other) {
+void NameSystem::InternalSwap(NameSystem* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(locatedblk_, other->locatedblk_);
-  swap(operation_, other->operation_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NameSystem, _impl_.maxblkid_)
+      + sizeof(NameSystem::_impl_.maxblkid_)
+      - PROTOBUF_FIELD_OFFSET(NameSystem, _impl_.inodesection_)>(
+          reinterpret_cast<char*>(&_impl_.inodesection_),
+          reinterpret_cast<char*>(&other->_impl_.inodesection_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BlockTask::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata NameSystem::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[20]);
 }
 
-
 // ===================================================================
 
-void BlockTasks::InitAsDefaultInstance() {
-}
-class BlockTasks::_Internal {
+class EditLog::_Internal {
  public:
 };
 
-BlockTasks::BlockTasks()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.BlockTasks)
+EditLog::EditLog(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.EditLog)
 }
-BlockTasks::BlockTasks(const BlockTasks& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      blktasks_(from.blktasks_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:minidfs.BlockTasks)
+EditLog::EditLog(const EditLog& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EditLog* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blks_){from._impl_.blks_}
+    , decltype(_impl_.creates_){from._impl_.creates_}
+    , decltype(_impl_.src_){}
+    , decltype(_impl_.inlinedata_){}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.dfid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.src_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.src_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_src().empty()) {
+    _this->_impl_.src_.Set(from._internal_src(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.inlinedata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inlinedata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_inlinedata().empty()) {
+    _this->_impl_.inlinedata_.Set(from._internal_inlinedata(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.op_, &from._impl_.op_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dfid_) -
+    reinterpret_cast<char*>(&_impl_.op_)) + sizeof(_impl_.dfid_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.EditLog)
 }
 
-void BlockTasks::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BlockTasks_minidfs_2eproto.base);
+inline void EditLog::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blks_){arena}
+    , decltype(_impl_.creates_){arena}
+    , decltype(_impl_.src_){}
+    , decltype(_impl_.inlinedata_){}
+    , decltype(_impl_.op_){0}
+    , decltype(_impl_.dfid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.src_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.src_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.inlinedata_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inlinedata_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-BlockTasks::~BlockTasks() {
-  // @@protoc_insertion_point(destructor:minidfs.BlockTasks)
+EditLog::~EditLog() {
+  // @@protoc_insertion_point(destructor:minidfs.EditLog)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void BlockTasks::SharedDtor() {
+inline void EditLog::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.blks_.~RepeatedPtrField();
+  _impl_.creates_.~RepeatedPtrField();
+  _impl_.src_.Destroy();
+  _impl_.inlinedata_.Destroy();
 }
 
-void BlockTasks::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const BlockTasks& BlockTasks::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BlockTasks_minidfs_2eproto.base);
-  return *internal_default_instance();
+void EditLog::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void BlockTasks::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.BlockTasks)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void EditLog::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.EditLog)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  blktasks_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.blks_.Clear();
+  _impl_.creates_.Clear();
+  _impl_.src_.ClearToEmpty();
+  _impl_.inlinedata_.ClearToEmpty();
+  ::memset(&_impl_.op_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dfid_) -
+      reinterpret_cast<char*>(&_impl_.op_)) + sizeof(_impl_.dfid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* BlockTasks::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* EditLog::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .minidfs.BlockTask blkTasks = 1;
+      // int32 op = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.op_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string src = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_src();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.EditLog.src"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 dfID = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.dfid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .minidfs.Block blks = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_blktasks(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_blks(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 10);
-        } else goto handle_unusual;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes inlineData = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_inlinedata();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // repeated .minidfs.EditLog creates = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_creates(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool BlockTasks::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.BlockTasks)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .minidfs.BlockTask blkTasks = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_blktasks()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.BlockTasks)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.BlockTasks)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void BlockTasks::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.BlockTasks)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* EditLog::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.EditLog)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .minidfs.BlockTask blkTasks = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->blktasks_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->blktasks(static_cast<int>(i)),
-      output);
+  // int32 op = 1;
+  if (this->_internal_op() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_op(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // string src = 2;
+  if (!this->_internal_src().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_src().data(), static_cast<int>(this->_internal_src().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "minidfs.EditLog.src");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_src(), target);
   }
-  // @@protoc_insertion_point(serialize_end:minidfs.BlockTasks)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* BlockTasks::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.BlockTasks)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // int32 dfID = 3;
+  if (this->_internal_dfid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_dfid(), target);
+  }
 
-  // repeated .minidfs.BlockTask blkTasks = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->blktasks_size()); i < n; i++) {
+  // repeated .minidfs.Block blks = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blks(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->blktasks(static_cast<int>(i)), target);
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  // bytes inlineData = 7;
+  if (!this->_internal_inlinedata().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_inlinedata(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.BlockTasks)
+
+  // repeated .minidfs.EditLog creates = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_creates_size()); i < n; i++) {
+    const auto& repfield = this->_internal_creates(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.EditLog)
   return target;
 }
 
-size_t BlockTasks::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.BlockTasks)
+size_t EditLog::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.EditLog)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .minidfs.BlockTask blkTasks = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->blktasks_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->blktasks(static_cast<int>(i)));
-    }
+  // repeated .minidfs.Block blks = 6;
+  total_size += 1UL * this->_internal_blks_size();
+  for (const auto& msg : this->_impl_.blks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // repeated .minidfs.EditLog creates = 8;
+  total_size += 1UL * this->_internal_creates_size();
+  for (const auto& msg : this->_impl_.creates_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string src = 2;
+  if (!this->_internal_src().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_src());
+  }
 
-void BlockTasks::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.BlockTasks)
-  GOOGLE_DCHECK_NE(&from, this);
-  const BlockTasks* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BlockTasks>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.BlockTasks)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.BlockTasks)
-    MergeFrom(*source);
+  // bytes inlineData = 7;
+  if (!this->_internal_inlinedata().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_inlinedata());
   }
-}
 
-void BlockTasks::MergeFrom(const BlockTasks& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.BlockTasks)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // int32 op = 1;
+  if (this->_internal_op() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_op());
+  }
+
+  // int32 dfID = 3;
+  if (this->_internal_dfid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_dfid());
+  }
 
-  blktasks_.MergeFrom(from.blktasks_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BlockTasks::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.BlockTasks)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EditLog::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EditLog::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EditLog::GetClassData() const { return &_class_data_; }
+
+
+void EditLog::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EditLog*>(&to_msg);
+  auto& from = static_cast<const EditLog&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.EditLog)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.blks_.MergeFrom(from._impl_.blks_);
+  _this->_impl_.creates_.MergeFrom(from._impl_.creates_);
+  if (!from._internal_src().empty()) {
+    _this->_internal_set_src(from._internal_src());
+  }
+  if (!from._internal_inlinedata().empty()) {
+    _this->_internal_set_inlinedata(from._internal_inlinedata());
+  }
+  if (from._internal_op() != 0) {
+    _this->_internal_set_op(from._internal_op());
+  }
+  if (from._internal_dfid() != 0) {
+    _this->_internal_set_dfid(from._internal_dfid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BlockTasks::CopyFrom(const BlockTasks& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.BlockTasks)
+void EditLog::CopyFrom(const EditLog& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.EditLog)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BlockTasks::IsInitialized() const {
+bool EditLog::IsInitialized() const {
   return true;
 }
 
-void BlockTasks::InternalSwap(BlockTasks* other) {
+void EditLog::InternalSwap(EditLog* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&blktasks_)->InternalSwap(CastToBase(&other->blktasks_));
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.blks_.InternalSwap(&other->_impl_.blks_);
+  _impl_.creates_.InternalSwap(&other->_impl_.creates_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.src_, lhs_arena,
+      &other->_impl_.src_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.inlinedata_, lhs_arena,
+      &other->_impl_.inlinedata_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EditLog, _impl_.dfid_)
+      + sizeof(EditLog::_impl_.dfid_)
+      - PROTOBUF_FIELD_OFFSET(EditLog, _impl_.op_)>(
+          reinterpret_cast<char*>(&_impl_.op_),
+          reinterpret_cast<char*>(&other->_impl_.op_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BlockTasks::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata EditLog::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[21]);
 }
 
-
 // ===================================================================
 
-void Inode::InitAsDefaultInstance() {
-}
-class Inode::_Internal {
+class FileInfo::_Internal {
  public:
 };
 
-Inode::Inode()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.Inode)
+FileInfo::FileInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.FileInfo)
 }
-Inode::Inode(const Inode& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      blks_(from.blks_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from.name().empty()) {
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&isdir_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(isdir_));
-  // @@protoc_insertion_point(copy_constructor:minidfs.Inode)
+FileInfo::FileInfo(const FileInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FileInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.filelen_){}
+    , decltype(_impl_.isdir_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.filelen_, &from._impl_.filelen_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.isdir_) -
+    reinterpret_cast<char*>(&_impl_.filelen_)) + sizeof(_impl_.isdir_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.FileInfo)
 }
 
-void Inode::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Inode_minidfs_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&isdir_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(isdir_));
+inline void FileInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.filelen_){int64_t{0}}
+    , decltype(_impl_.isdir_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Inode::~Inode() {
-  // @@protoc_insertion_point(destructor:minidfs.Inode)
+FileInfo::~FileInfo() {
+  // @@protoc_insertion_point(destructor:minidfs.FileInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Inode::SharedDtor() {
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void FileInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void Inode::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Inode& Inode::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Inode_minidfs_2eproto.base);
-  return *internal_default_instance();
+void FileInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Inode::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.Inode)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void FileInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.FileInfo)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  blks_.Clear();
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&isdir_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(isdir_));
-  _internal_metadata_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.filelen_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.isdir_) -
+      reinterpret_cast<char*>(&_impl_.filelen_)) + sizeof(_impl_.isdir_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* Inode::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* FileInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 id = 1;
+      // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.FileInfo.name"));
+        } else
+          goto handle_unusual;
         continue;
-      // string name = 2;
+      // bool isDir = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_name(), ptr, ctx, "minidfs.Inode.name");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.isdir_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bool isDir = 3;
+      // int64 fileLen = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          isdir_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.filelen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // repeated .minidfs.Block blks = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(add_blks(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 34);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool Inode::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.Inode)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 id = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &id_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string name = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "minidfs.Inode.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool isDir = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &isdir_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .minidfs.Block blks = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_blks()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.Inode)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.Inode)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void Inode::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.Inode)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 id = 1;
-  if (this->id() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->id(), output);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "minidfs.Inode.name");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->name(), output);
-  }
-
-  // bool isDir = 3;
-  if (this->isdir() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(3, this->isdir(), output);
-  }
 
-  // repeated .minidfs.Block blks = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->blks_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4,
-      this->blks(static_cast<int>(i)),
-      output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:minidfs.Inode)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Inode::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Inode)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* FileInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.FileInfo)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 id = 1;
-  if (this->id() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->id(), target);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "minidfs.Inode.name");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
+      "minidfs.FileInfo.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
-  // bool isDir = 3;
-  if (this->isdir() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->isdir(), target);
+  // bool isDir = 2;
+  if (this->_internal_isdir() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_isdir(), target);
   }
 
-  // repeated .minidfs.Block blks = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->blks_size()); i < n; i++) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        4, this->blks(static_cast<int>(i)), target);
+  // int64 fileLen = 3;
+  if (this->_internal_filelen() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_filelen(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Inode)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.FileInfo)
   return target;
 }
 
-size_t Inode::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.Inode)
+size_t FileInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.FileInfo)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .minidfs.Block blks = 4;
-  {
-    unsigned int count = static_cast<unsigned int>(this->blks_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->blks(static_cast<int>(i)));
-    }
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->name());
+        this->_internal_name());
   }
 
-  // int32 id = 1;
-  if (this->id() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->id());
+  // int64 fileLen = 3;
+  if (this->_internal_filelen() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_filelen());
   }
 
-  // bool isDir = 3;
-  if (this->isdir() != 0) {
+  // bool isDir = 2;
+  if (this->_internal_isdir() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Inode::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.Inode)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Inode* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Inode>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.Inode)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.Inode)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FileInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FileInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FileInfo::GetClassData() const { return &_class_data_; }
 
-void Inode::MergeFrom(const Inode& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Inode)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  blks_.MergeFrom(from.blks_);
-  if (from.name().size() > 0) {
+void FileInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FileInfo*>(&to_msg);
+  auto& from = static_cast<const FileInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.FileInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.id() != 0) {
-    set_id(from.id());
+  if (from._internal_filelen() != 0) {
+    _this->_internal_set_filelen(from._internal_filelen());
   }
-  if (from.isdir() != 0) {
-    set_isdir(from.isdir());
+  if (from._internal_isdir() != 0) {
+    _this->_internal_set_isdir(from._internal_isdir());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Inode::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.Inode)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Inode::CopyFrom(const Inode& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Inode)
+void FileInfo::CopyFrom(const FileInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.FileInfo)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Inode::IsInitialized() const {
+bool FileInfo::IsInitialized() const {
   return true;
 }
 
-void Inode::InternalSwap(Inode* other) {
+void FileInfo::InternalSwap(FileInfo* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&blks_)->InternalSwap(CastToBase(&other->blks_));
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(id_, other->id_);
-  swap(isdir_, other->isdir_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FileInfo, _impl_.isdir_)
+      + sizeof(FileInfo::_impl_.isdir_)
+      - PROTOBUF_FIELD_OFFSET(FileInfo, _impl_.filelen_)>(
+          reinterpret_cast<char*>(&_impl_.filelen_),
+          reinterpret_cast<char*>(&other->_impl_.filelen_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Inode::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata FileInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[22]);
 }
 
-
 // ===================================================================
 
-void InodeSection::InitAsDefaultInstance() {
-}
-class InodeSection::_Internal {
+class FileInfos::_Internal {
  public:
 };
 
-InodeSection::InodeSection()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.InodeSection)
+FileInfos::FileInfos(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.FileInfos)
 }
-InodeSection::InodeSection(const InodeSection& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      inodes_(from.inodes_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:minidfs.InodeSection)
+FileInfos::FileInfos(const FileInfos& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FileInfos* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.fileinfos_){from._impl_.fileinfos_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:minidfs.FileInfos)
 }
 
-void InodeSection::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_InodeSection_minidfs_2eproto.base);
+inline void FileInfos::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.fileinfos_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-InodeSection::~InodeSection() {
-  // @@protoc_insertion_point(destructor:minidfs.InodeSection)
+FileInfos::~FileInfos() {
+  // @@protoc_insertion_point(destructor:minidfs.FileInfos)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void InodeSection::SharedDtor() {
+inline void FileInfos::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.fileinfos_.~RepeatedPtrField();
 }
 
-void InodeSection::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const InodeSection& InodeSection::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InodeSection_minidfs_2eproto.base);
-  return *internal_default_instance();
+void FileInfos::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void InodeSection::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.InodeSection)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void FileInfos::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.FileInfos)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  inodes_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.fileinfos_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* InodeSection::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* FileInfos::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .minidfs.Inode inodes = 1;
+      // repeated .minidfs.FileInfo fileInfos = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_inodes(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_fileinfos(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 10);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool InodeSection::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.InodeSection)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .minidfs.Inode inodes = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_inodes()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.InodeSection)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.InodeSection)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void InodeSection::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.InodeSection)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .minidfs.Inode inodes = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->inodes_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->inodes(static_cast<int>(i)),
-      output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:minidfs.InodeSection)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* InodeSection::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.InodeSection)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* FileInfos::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.FileInfos)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .minidfs.Inode inodes = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->inodes_size()); i < n; i++) {
+  // repeated .minidfs.FileInfo fileInfos = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_fileinfos_size()); i < n; i++) {
+    const auto& repfield = this->_internal_fileinfos(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->inodes(static_cast<int>(i)), target);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.InodeSection)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.FileInfos)
   return target;
 }
 
-size_t InodeSection::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.InodeSection)
+size_t FileInfos::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.FileInfos)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .minidfs.Inode inodes = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->inodes_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->inodes(static_cast<int>(i)));
-    }
+  // repeated .minidfs.FileInfo fileInfos = 1;
+  total_size += 1UL * this->_internal_fileinfos_size();
+  for (const auto& msg : this->_impl_.fileinfos_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void InodeSection::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.InodeSection)
-  GOOGLE_DCHECK_NE(&from, this);
-  const InodeSection* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InodeSection>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.InodeSection)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.InodeSection)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FileInfos::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FileInfos::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FileInfos::GetClassData() const { return &_class_data_; }
 
-void InodeSection::MergeFrom(const InodeSection& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.InodeSection)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  inodes_.MergeFrom(from.inodes_);
-}
+void FileInfos::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FileInfos*>(&to_msg);
+  auto& from = static_cast<const FileInfos&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.FileInfos)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void InodeSection::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.InodeSection)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.fileinfos_.MergeFrom(from._impl_.fileinfos_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InodeSection::CopyFrom(const InodeSection& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.InodeSection)
+void FileInfos::CopyFrom(const FileInfos& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.FileInfos)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InodeSection::IsInitialized() const {
+bool FileInfos::IsInitialized() const {
   return true;
 }
 
-void InodeSection::InternalSwap(InodeSection* other) {
+void FileInfos::InternalSwap(FileInfos* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&inodes_)->InternalSwap(CastToBase(&other->inodes_));
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.fileinfos_.InternalSwap(&other->_impl_.fileinfos_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InodeSection::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata FileInfos::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[23]);
 }
 
-
 // ===================================================================
 
-void Dentry::InitAsDefaultInstance() {
-}
-class Dentry::_Internal {
+class LaneStats::_Internal {
  public:
 };
 
-Dentry::Dentry()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.Dentry)
-}
-Dentry::Dentry(const Dentry& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      subdentries_(from.subdentries_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  id_ = from.id_;
-  // @@protoc_insertion_point(copy_constructor:minidfs.Dentry)
-}
-
-void Dentry::SharedCtor() {
-  id_ = 0;
-}
-
-Dentry::~Dentry() {
-  // @@protoc_insertion_point(destructor:minidfs.Dentry)
+LaneStats::LaneStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.LaneStats)
+}
+LaneStats::LaneStats(const LaneStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LaneStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.queued_){}
+    , decltype(_impl_.handled_){}
+    , decltype(_impl_.nthread_){}
+    , decltype(_impl_.active_){}
+    , decltype(_impl_.rejected_){}
+    , decltype(_impl_.completed_){}
+    , decltype(_impl_.waitus_){}
+    , decltype(_impl_.runus_){}
+    , decltype(_impl_.maxthread_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.queued_, &from._impl_.queued_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.maxthread_) -
+    reinterpret_cast<char*>(&_impl_.queued_)) + sizeof(_impl_.maxthread_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.LaneStats)
+}
+
+inline void LaneStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.queued_){int64_t{0}}
+    , decltype(_impl_.handled_){int64_t{0}}
+    , decltype(_impl_.nthread_){0}
+    , decltype(_impl_.active_){0}
+    , decltype(_impl_.rejected_){int64_t{0}}
+    , decltype(_impl_.completed_){int64_t{0}}
+    , decltype(_impl_.waitus_){int64_t{0}}
+    , decltype(_impl_.runus_){int64_t{0}}
+    , decltype(_impl_.maxthread_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LaneStats::~LaneStats() {
+  // @@protoc_insertion_point(destructor:minidfs.LaneStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Dentry::SharedDtor() {
+inline void LaneStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void Dentry::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void LaneStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const Dentry& Dentry::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Dentry_minidfs_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void Dentry::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.Dentry)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void LaneStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.LaneStats)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  subdentries_.Clear();
-  id_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.queued_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.maxthread_) -
+      reinterpret_cast<char*>(&_impl_.queued_)) + sizeof(_impl_.maxthread_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* Dentry::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* LaneStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 id = 1;
+      // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.LaneStats.name"));
+        } else
+          goto handle_unusual;
         continue;
-      // repeated int32 subDentries = 2;
+      // int32 nThread = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(mutable_subdentries(), ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.nthread_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 queued = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.queued_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 handled = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.handled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 rejected = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.rejected_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 active = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.active_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 maxThread = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.maxthread_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 completed = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.completed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16) {
-          add_subdentries(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 waitUs = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.waitus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // int64 runUs = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.runus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool Dentry::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.Dentry)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 id = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &id_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+uint8_t* LaneStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.LaneStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // repeated int32 subDentries = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, this->mutable_subdentries())));
-        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 1, 18u, input, this->mutable_subdentries())));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "minidfs.LaneStats.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.Dentry)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.Dentry)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void Dentry::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.Dentry)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // int32 nThread = 2;
+  if (this->_internal_nthread() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_nthread(), target);
+  }
 
-  // int32 id = 1;
-  if (this->id() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->id(), output);
+  // int64 queued = 3;
+  if (this->_internal_queued() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_queued(), target);
   }
 
-  // repeated int32 subDentries = 2;
-  if (this->subdentries_size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(2, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_subdentries_cached_byte_size_.load(
-        std::memory_order_relaxed));
+  // int64 handled = 4;
+  if (this->_internal_handled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_handled(), target);
+  }
+
+  // int64 rejected = 5;
+  if (this->_internal_rejected() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_rejected(), target);
   }
-  for (int i = 0, n = this->subdentries_size(); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32NoTag(
-      this->subdentries(i), output);
+
+  // int32 active = 6;
+  if (this->_internal_active() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_active(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // int32 maxThread = 7;
+  if (this->_internal_maxthread() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_maxthread(), target);
   }
-  // @@protoc_insertion_point(serialize_end:minidfs.Dentry)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* Dentry::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Dentry)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // int64 completed = 8;
+  if (this->_internal_completed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_completed(), target);
+  }
 
-  // int32 id = 1;
-  if (this->id() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->id(), target);
+  // int64 waitUs = 9;
+  if (this->_internal_waitus() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_waitus(), target);
   }
 
-  // repeated int32 subDentries = 2;
-  if (this->subdentries_size() > 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
-      2,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
-        _subdentries_cached_byte_size_.load(std::memory_order_relaxed),
-         target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      WriteInt32NoTagToArray(this->subdentries_, target);
+  // int64 runUs = 10;
+  if (this->_internal_runus() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_runus(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Dentry)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.LaneStats)
   return target;
 }
 
-size_t Dentry::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.Dentry)
+size_t LaneStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.LaneStats)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated int32 subDentries = 2;
-  {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      Int32Size(this->subdentries_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
-    }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _subdentries_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
-    total_size += data_size;
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  // int32 id = 1;
-  if (this->id() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->id());
+  // int64 queued = 3;
+  if (this->_internal_queued() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_queued());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // int64 handled = 4;
+  if (this->_internal_handled() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_handled());
+  }
 
-void Dentry::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.Dentry)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Dentry* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Dentry>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.Dentry)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.Dentry)
-    MergeFrom(*source);
+  // int32 nThread = 2;
+  if (this->_internal_nthread() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nthread());
   }
-}
 
-void Dentry::MergeFrom(const Dentry& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Dentry)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // int32 active = 6;
+  if (this->_internal_active() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_active());
+  }
+
+  // int64 rejected = 5;
+  if (this->_internal_rejected() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_rejected());
+  }
+
+  // int64 completed = 8;
+  if (this->_internal_completed() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_completed());
+  }
+
+  // int64 waitUs = 9;
+  if (this->_internal_waitus() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_waitus());
+  }
+
+  // int64 runUs = 10;
+  if (this->_internal_runus() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_runus());
+  }
 
-  subdentries_.MergeFrom(from.subdentries_);
-  if (from.id() != 0) {
-    set_id(from.id());
+  // int32 maxThread = 7;
+  if (this->_internal_maxthread() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_maxthread());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Dentry::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.Dentry)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LaneStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LaneStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LaneStats::GetClassData() const { return &_class_data_; }
+
+
+void LaneStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LaneStats*>(&to_msg);
+  auto& from = static_cast<const LaneStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.LaneStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_queued() != 0) {
+    _this->_internal_set_queued(from._internal_queued());
+  }
+  if (from._internal_handled() != 0) {
+    _this->_internal_set_handled(from._internal_handled());
+  }
+  if (from._internal_nthread() != 0) {
+    _this->_internal_set_nthread(from._internal_nthread());
+  }
+  if (from._internal_active() != 0) {
+    _this->_internal_set_active(from._internal_active());
+  }
+  if (from._internal_rejected() != 0) {
+    _this->_internal_set_rejected(from._internal_rejected());
+  }
+  if (from._internal_completed() != 0) {
+    _this->_internal_set_completed(from._internal_completed());
+  }
+  if (from._internal_waitus() != 0) {
+    _this->_internal_set_waitus(from._internal_waitus());
+  }
+  if (from._internal_runus() != 0) {
+    _this->_internal_set_runus(from._internal_runus());
+  }
+  if (from._internal_maxthread() != 0) {
+    _this->_internal_set_maxthread(from._internal_maxthread());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Dentry::CopyFrom(const Dentry& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Dentry)
+void LaneStats::CopyFrom(const LaneStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.LaneStats)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Dentry::IsInitialized() const {
+bool LaneStats::IsInitialized() const {
   return true;
 }
 
-void Dentry::InternalSwap(Dentry* other) {
+void LaneStats::InternalSwap(LaneStats* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  subdentries_.InternalSwap(&other->subdentries_);
-  swap(id_, other->id_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Dentry::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LaneStats, _impl_.maxthread_)
+      + sizeof(LaneStats::_impl_.maxthread_)
+      - PROTOBUF_FIELD_OFFSET(LaneStats, _impl_.queued_)>(
+          reinterpret_cast<char*>(&_impl_.queued_),
+          reinterpret_cast<char*>(&other->_impl_.queued_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LaneStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[24]);
 }
 
-
 // ===================================================================
 
-void DentrySection::InitAsDefaultInstance() {
-}
-class DentrySection::_Internal {
+class ServerStats::_Internal {
  public:
+  static const ::minidfs::Metrics& metrics(const ServerStats* msg);
 };
 
-DentrySection::DentrySection()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.DentrySection)
-}
-DentrySection::DentrySection(const DentrySection& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      dentries_(from.dentries_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:minidfs.DentrySection)
-}
-
-void DentrySection::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DentrySection_minidfs_2eproto.base);
-}
-
-DentrySection::~DentrySection() {
-  // @@protoc_insertion_point(destructor:minidfs.DentrySection)
+const ::minidfs::Metrics&
+ServerStats::_Internal::metrics(const ServerStats* msg) {
+  return *msg->_impl_.metrics_;
+}
+ServerStats::ServerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.ServerStats)
+}
+ServerStats::ServerStats(const ServerStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lanes_){from._impl_.lanes_}
+    , decltype(_impl_.callers_){from._impl_.callers_}
+    , decltype(_impl_.metrics_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_metrics()) {
+    _this->_impl_.metrics_ = new ::minidfs::Metrics(*from._impl_.metrics_);
+  }
+  // @@protoc_insertion_point(copy_constructor:minidfs.ServerStats)
+}
+
+inline void ServerStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lanes_){arena}
+    , decltype(_impl_.callers_){arena}
+    , decltype(_impl_.metrics_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ServerStats::~ServerStats() {
+  // @@protoc_insertion_point(destructor:minidfs.ServerStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DentrySection::SharedDtor() {
+inline void ServerStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lanes_.~RepeatedPtrField();
+  _impl_.callers_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.metrics_;
 }
 
-void DentrySection::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const DentrySection& DentrySection::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DentrySection_minidfs_2eproto.base);
-  return *internal_default_instance();
+void ServerStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void DentrySection::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.DentrySection)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ServerStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.ServerStats)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  dentries_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.lanes_.Clear();
+  _impl_.callers_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.metrics_ != nullptr) {
+    delete _impl_.metrics_;
+  }
+  _impl_.metrics_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* DentrySection::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ServerStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .minidfs.Dentry dentries = 1;
+      // repeated .minidfs.LaneStats lanes = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_lanes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .minidfs.CallerStats callers = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_dentries(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_callers(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 10);
-        } else goto handle_unusual;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .minidfs.Metrics metrics = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_metrics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool DentrySection::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.DentrySection)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .minidfs.Dentry dentries = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_dentries()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.DentrySection)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.DentrySection)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void DentrySection::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.DentrySection)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ServerStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.ServerStats)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .minidfs.Dentry dentries = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->dentries_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->dentries(static_cast<int>(i)),
-      output);
+  // repeated .minidfs.LaneStats lanes = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_lanes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_lanes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // repeated .minidfs.CallerStats callers = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_callers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_callers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:minidfs.DentrySection)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* DentrySection::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.DentrySection)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // repeated .minidfs.Dentry dentries = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->dentries_size()); i < n; i++) {
+  // .minidfs.Metrics metrics = 3;
+  if (this->_internal_has_metrics()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->dentries(static_cast<int>(i)), target);
+      InternalWriteMessage(3, _Internal::metrics(this),
+        _Internal::metrics(this).GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.DentrySection)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.ServerStats)
   return target;
 }
 
-size_t DentrySection::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.DentrySection)
+size_t ServerStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.ServerStats)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .minidfs.Dentry dentries = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->dentries_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->dentries(static_cast<int>(i)));
-    }
+  // repeated .minidfs.LaneStats lanes = 1;
+  total_size += 1UL * this->_internal_lanes_size();
+  for (const auto& msg : this->_impl_.lanes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // repeated .minidfs.CallerStats callers = 2;
+  total_size += 1UL * this->_internal_callers_size();
+  for (const auto& msg : this->_impl_.callers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
-void DentrySection::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.DentrySection)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DentrySection* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DentrySection>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.DentrySection)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.DentrySection)
-    MergeFrom(*source);
+  // .minidfs.Metrics metrics = 3;
+  if (this->_internal_has_metrics()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.metrics_);
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DentrySection::MergeFrom(const DentrySection& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.DentrySection)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStats::GetClassData() const { return &_class_data_; }
 
-  dentries_.MergeFrom(from.dentries_);
-}
 
-void DentrySection::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.DentrySection)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void ServerStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStats*>(&to_msg);
+  auto& from = static_cast<const ServerStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.ServerStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.lanes_.MergeFrom(from._impl_.lanes_);
+  _this->_impl_.callers_.MergeFrom(from._impl_.callers_);
+  if (from._internal_has_metrics()) {
+    _this->_internal_mutable_metrics()->::minidfs::Metrics::MergeFrom(
+        from._internal_metrics());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void DentrySection::CopyFrom(const DentrySection& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.DentrySection)
+void ServerStats::CopyFrom(const ServerStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.ServerStats)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DentrySection::IsInitialized() const {
+bool ServerStats::IsInitialized() const {
   return true;
 }
 
-void DentrySection::InternalSwap(DentrySection* other) {
+void ServerStats::InternalSwap(ServerStats* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&dentries_)->InternalSwap(CastToBase(&other->dentries_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata DentrySection::GetMetadata() const {
-  return GetMetadataStatic();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.lanes_.InternalSwap(&other->_impl_.lanes_);
+  _impl_.callers_.InternalSwap(&other->_impl_.callers_);
+  swap(_impl_.metrics_, other->_impl_.metrics_);
 }
 
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[25]);
+}
 
 // ===================================================================
 
-void NameSystem::InitAsDefaultInstance() {
-  ::minidfs::_NameSystem_default_instance_._instance.get_mutable()->inodesection_ = const_cast< ::minidfs::InodeSection*>(
-      ::minidfs::InodeSection::internal_default_instance());
-  ::minidfs::_NameSystem_default_instance_._instance.get_mutable()->dentrysection_ = const_cast< ::minidfs::DentrySection*>(
-      ::minidfs::DentrySection::internal_default_instance());
-}
-class NameSystem::_Internal {
+class Metric::_Internal {
  public:
-  static const ::minidfs::InodeSection& inodesection(const NameSystem* msg);
-  static const ::minidfs::DentrySection& dentrysection(const NameSystem* msg);
 };
 
-const ::minidfs::InodeSection&
-NameSystem::_Internal::inodesection(const NameSystem* msg) {
-  return *msg->inodesection_;
-}
-const ::minidfs::DentrySection&
-NameSystem::_Internal::dentrysection(const NameSystem* msg) {
-  return *msg->dentrysection_;
-}
-NameSystem::NameSystem()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.NameSystem)
-}
-NameSystem::NameSystem(const NameSystem& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_inodesection()) {
-    inodesection_ = new ::minidfs::InodeSection(*from.inodesection_);
-  } else {
-    inodesection_ = nullptr;
-  }
-  if (from.has_dentrysection()) {
-    dentrysection_ = new ::minidfs::DentrySection(*from.dentrysection_);
-  } else {
-    dentrysection_ = nullptr;
-  }
-  ::memcpy(&maxdfid_, &from.maxdfid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&maxblkid_) -
-    reinterpret_cast<char*>(&maxdfid_)) + sizeof(maxblkid_));
-  // @@protoc_insertion_point(copy_constructor:minidfs.NameSystem)
-}
-
-void NameSystem::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_NameSystem_minidfs_2eproto.base);
-  ::memset(&inodesection_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&maxblkid_) -
-      reinterpret_cast<char*>(&inodesection_)) + sizeof(maxblkid_));
-}
-
-NameSystem::~NameSystem() {
-  // @@protoc_insertion_point(destructor:minidfs.NameSystem)
+Metric::Metric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.Metric)
+}
+Metric::Metric(const Metric& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Metric* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.sum_){}
+    , decltype(_impl_.max_){}
+    , decltype(_impl_.p50_){}
+    , decltype(_impl_.p90_){}
+    , decltype(_impl_.p99_){}
+    , decltype(_impl_.p999_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.value_, &from._impl_.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.Metric)
+}
+
+inline void Metric::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){int64_t{0}}
+    , decltype(_impl_.count_){int64_t{0}}
+    , decltype(_impl_.sum_){int64_t{0}}
+    , decltype(_impl_.max_){int64_t{0}}
+    , decltype(_impl_.p50_){int64_t{0}}
+    , decltype(_impl_.p90_){int64_t{0}}
+    , decltype(_impl_.p99_){int64_t{0}}
+    , decltype(_impl_.p999_){int64_t{0}}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Metric::~Metric() {
+  // @@protoc_insertion_point(destructor:minidfs.Metric)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void NameSystem::SharedDtor() {
-  if (this != internal_default_instance()) delete inodesection_;
-  if (this != internal_default_instance()) delete dentrysection_;
+inline void Metric::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void NameSystem::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void Metric::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const NameSystem& NameSystem::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NameSystem_minidfs_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void NameSystem::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.NameSystem)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Metric::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.Metric)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == nullptr && inodesection_ != nullptr) {
-    delete inodesection_;
-  }
-  inodesection_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && dentrysection_ != nullptr) {
-    delete dentrysection_;
-  }
-  dentrysection_ = nullptr;
-  ::memset(&maxdfid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&maxblkid_) -
-      reinterpret_cast<char*>(&maxdfid_)) + sizeof(maxblkid_));
-  _internal_metadata_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* NameSystem::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Metric::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 maxDfID = 1;
+      // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          maxdfid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.Metric.name"));
+        } else
+          goto handle_unusual;
         continue;
-      // int32 maxBlkID = 2;
+      // .minidfs.Metric.Type type = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          maxblkid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+          _internal_set_type(static_cast<::minidfs::Metric_Type>(val));
+        } else
+          goto handle_unusual;
         continue;
-      // .minidfs.InodeSection inodeSection = 3;
+      // int64 value = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(mutable_inodesection(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .minidfs.DentrySection dentrySection = 4;
+      // int64 count = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ctx->ParseMessage(mutable_dentrysection(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 sum = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.sum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 max = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 p50 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.p50_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 p90 = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.p90_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 p99 = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.p99_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // int64 p999 = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.p999_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool NameSystem::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.NameSystem)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 maxDfID = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &maxdfid_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+uint8_t* Metric::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Metric)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // int32 maxBlkID = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "minidfs.Metric.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &maxblkid_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // .minidfs.Metric.Type type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
 
-      // .minidfs.InodeSection inodeSection = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_inodesection()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // int64 value = 3;
+  if (this->_internal_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_value(), target);
+  }
 
-      // .minidfs.DentrySection dentrySection = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_dentrysection()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
+  // int64 count = 4;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_count(), target);
   }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.NameSystem)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.NameSystem)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void NameSystem::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.NameSystem)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // int64 sum = 5;
+  if (this->_internal_sum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_sum(), target);
+  }
 
-  // int32 maxDfID = 1;
-  if (this->maxdfid() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->maxdfid(), output);
+  // int64 max = 6;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_max(), target);
   }
 
-  // int32 maxBlkID = 2;
-  if (this->maxblkid() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(2, this->maxblkid(), output);
+  // int64 p50 = 7;
+  if (this->_internal_p50() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_p50(), target);
   }
 
-  // .minidfs.InodeSection inodeSection = 3;
-  if (this->has_inodesection()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, _Internal::inodesection(this), output);
+  // int64 p90 = 8;
+  if (this->_internal_p90() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_p90(), target);
   }
 
-  // .minidfs.DentrySection dentrySection = 4;
-  if (this->has_dentrysection()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, _Internal::dentrysection(this), output);
+  // int64 p99 = 9;
+  if (this->_internal_p99() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_p99(), target);
+  }
+
+  // int64 p999 = 10;
+  if (this->_internal_p999() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_p999(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:minidfs.NameSystem)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Metric)
+  return target;
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* NameSystem::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.NameSystem)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+size_t Metric::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.Metric)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 maxDfID = 1;
-  if (this->maxdfid() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->maxdfid(), target);
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  // int32 maxBlkID = 2;
-  if (this->maxblkid() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->maxblkid(), target);
+  // int64 value = 3;
+  if (this->_internal_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_value());
   }
 
-  // .minidfs.InodeSection inodeSection = 3;
-  if (this->has_inodesection()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, _Internal::inodesection(this), target);
+  // int64 count = 4;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_count());
   }
 
-  // .minidfs.DentrySection dentrySection = 4;
-  if (this->has_dentrysection()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        4, _Internal::dentrysection(this), target);
+  // int64 sum = 5;
+  if (this->_internal_sum() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_sum());
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  // int64 max = 6;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_max());
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.NameSystem)
-  return target;
-}
-
-size_t NameSystem::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.NameSystem)
-  size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
+  // int64 p50 = 7;
+  if (this->_internal_p50() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_p50());
   }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
 
-  // .minidfs.InodeSection inodeSection = 3;
-  if (this->has_inodesection()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *inodesection_);
+  // int64 p90 = 8;
+  if (this->_internal_p90() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_p90());
   }
 
-  // .minidfs.DentrySection dentrySection = 4;
-  if (this->has_dentrysection()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *dentrysection_);
+  // int64 p99 = 9;
+  if (this->_internal_p99() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_p99());
   }
 
-  // int32 maxDfID = 1;
-  if (this->maxdfid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->maxdfid());
+  // int64 p999 = 10;
+  if (this->_internal_p999() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_p999());
   }
 
-  // int32 maxBlkID = 2;
-  if (this->maxblkid() != 0) {
+  // .minidfs.Metric.Type type = 2;
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->maxblkid());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NameSystem::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.NameSystem)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NameSystem* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<NameSystem>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.NameSystem)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.NameSystem)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Metric::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Metric::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Metric::GetClassData() const { return &_class_data_; }
+
 
-void NameSystem::MergeFrom(const NameSystem& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.NameSystem)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Metric::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Metric*>(&to_msg);
+  auto& from = static_cast<const Metric&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Metric)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_inodesection()) {
-    mutable_inodesection()->::minidfs::InodeSection::MergeFrom(from.inodesection());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.has_dentrysection()) {
-    mutable_dentrysection()->::minidfs::DentrySection::MergeFrom(from.dentrysection());
+  if (from._internal_value() != 0) {
+    _this->_internal_set_value(from._internal_value());
   }
-  if (from.maxdfid() != 0) {
-    set_maxdfid(from.maxdfid());
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
   }
-  if (from.maxblkid() != 0) {
-    set_maxblkid(from.maxblkid());
+  if (from._internal_sum() != 0) {
+    _this->_internal_set_sum(from._internal_sum());
   }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  if (from._internal_p50() != 0) {
+    _this->_internal_set_p50(from._internal_p50());
+  }
+  if (from._internal_p90() != 0) {
+    _this->_internal_set_p90(from._internal_p90());
+  }
+  if (from._internal_p99() != 0) {
+    _this->_internal_set_p99(from._internal_p99());
+  }
+  if (from._internal_p999() != 0) {
+    _this->_internal_set_p999(from._internal_p999());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void NameSystem::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.NameSystem)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void NameSystem::CopyFrom(const NameSystem& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.NameSystem)
+void Metric::CopyFrom(const Metric& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Metric)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool NameSystem::IsInitialized() const {
+bool Metric::IsInitialized() const {
   return true;
 }
 
-void NameSystem::InternalSwap(NameSystem* other) {
+void Metric::InternalSwap(Metric* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(inodesection_, other->inodesection_);
-  swap(dentrysection_, other->dentrysection_);
-  swap(maxdfid_, other->maxdfid_);
-  swap(maxblkid_, other->maxblkid_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata NameSystem::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Metric, _impl_.type_)
+      + sizeof(Metric::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(Metric, _impl_.value_)>(
+          reinterpret_cast<char*>(&_impl_.value_),
+          reinterpret_cast<char*>(&other->_impl_.value_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Metric::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[26]);
 }
 
-
 // ===================================================================
 
-void EditLog::InitAsDefaultInstance() {
-}
-class EditLog::_Internal {
+class Metrics::_Internal {
  public:
 };
 
-EditLog::EditLog()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.EditLog)
+Metrics::Metrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.Metrics)
 }
-EditLog::EditLog(const EditLog& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      blks_(from.blks_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  src_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from.src().empty()) {
-    src_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.src_);
-  }
-  ::memcpy(&op_, &from.op_,
-    static_cast<size_t>(reinterpret_cast<char*>(&dfid_) -
-    reinterpret_cast<char*>(&op_)) + sizeof(dfid_));
-  // @@protoc_insertion_point(copy_constructor:minidfs.EditLog)
+Metrics::Metrics(const Metrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Metrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metrics_){from._impl_.metrics_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:minidfs.Metrics)
 }
 
-void EditLog::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_EditLog_minidfs_2eproto.base);
-  src_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&op_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&dfid_) -
-      reinterpret_cast<char*>(&op_)) + sizeof(dfid_));
+inline void Metrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metrics_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-EditLog::~EditLog() {
-  // @@protoc_insertion_point(destructor:minidfs.EditLog)
+Metrics::~Metrics() {
+  // @@protoc_insertion_point(destructor:minidfs.Metrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void EditLog::SharedDtor() {
-  src_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Metrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.metrics_.~RepeatedPtrField();
 }
 
-void EditLog::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void Metrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const EditLog& EditLog::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_EditLog_minidfs_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void EditLog::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.EditLog)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Metrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.Metrics)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  blks_.Clear();
-  src_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&op_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&dfid_) -
-      reinterpret_cast<char*>(&op_)) + sizeof(dfid_));
-  _internal_metadata_.Clear();
+  _impl_.metrics_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* EditLog::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Metrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 op = 1;
+      // repeated .minidfs.Metric metrics = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          op_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string src = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_src(), ptr, ctx, "minidfs.EditLog.src");
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 dfID = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          dfid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // repeated .minidfs.Block blks = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_blks(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_metrics(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 50);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool EditLog::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.EditLog)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 op = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &op_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+uint8_t* Metrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.Metrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // string src = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_src()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->src().data(), static_cast<int>(this->src().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "minidfs.EditLog.src"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // repeated .minidfs.Metric metrics = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_metrics_size()); i < n; i++) {
+    const auto& repfield = this->_internal_metrics(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
 
-      // int32 dfID = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.Metrics)
+  return target;
+}
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &dfid_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+size_t Metrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.Metrics)
+  size_t total_size = 0;
 
-      // repeated .minidfs.Block blks = 6;
-      case 6: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_blks()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .minidfs.Metric metrics = 1;
+  total_size += 1UL * this->_internal_metrics_size();
+  for (const auto& msg : this->_impl_.metrics_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.EditLog)
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Metrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Metrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Metrics::GetClassData() const { return &_class_data_; }
+
+
+void Metrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Metrics*>(&to_msg);
+  auto& from = static_cast<const Metrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.Metrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.metrics_.MergeFrom(from._impl_.metrics_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Metrics::CopyFrom(const Metrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.Metrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Metrics::IsInitialized() const {
   return true;
+}
+
+void Metrics::InternalSwap(Metrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.metrics_.InternalSwap(&other->_impl_.metrics_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Metrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[27]);
+}
+
+// ===================================================================
+
+class CallerStats::_Internal {
+ public:
+};
+
+CallerStats::CallerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.CallerStats)
+}
+CallerStats::CallerStats(const CallerStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CallerStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.caller_){}
+    , decltype(_impl_.queued_){}
+    , decltype(_impl_.handled_){}
+    , decltype(_impl_.rejected_){}
+    , decltype(_impl_.rate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.caller_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.caller_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_caller().empty()) {
+    _this->_impl_.caller_.Set(from._internal_caller(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.queued_, &from._impl_.queued_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rate_) -
+    reinterpret_cast<char*>(&_impl_.queued_)) + sizeof(_impl_.rate_));
+  // @@protoc_insertion_point(copy_constructor:minidfs.CallerStats)
+}
+
+inline void CallerStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.caller_){}
+    , decltype(_impl_.queued_){int64_t{0}}
+    , decltype(_impl_.handled_){int64_t{0}}
+    , decltype(_impl_.rejected_){int64_t{0}}
+    , decltype(_impl_.rate_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.caller_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.caller_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CallerStats::~CallerStats() {
+  // @@protoc_insertion_point(destructor:minidfs.CallerStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CallerStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.caller_.Destroy();
+}
+
+void CallerStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CallerStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.CallerStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.caller_.ClearToEmpty();
+  ::memset(&_impl_.queued_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.rate_) -
+      reinterpret_cast<char*>(&_impl_.queued_)) + sizeof(_impl_.rate_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CallerStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string caller = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_caller();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "minidfs.CallerStats.caller"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 queued = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.queued_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 handled = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.handled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 rejected = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.rejected_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 rate = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.rate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.EditLog)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void EditLog::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.EditLog)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* CallerStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.CallerStats)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 op = 1;
-  if (this->op() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(1, this->op(), output);
-  }
-
-  // string src = 2;
-  if (this->src().size() > 0) {
+  // string caller = 1;
+  if (!this->_internal_caller().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->src().data(), static_cast<int>(this->src().length()),
+      this->_internal_caller().data(), static_cast<int>(this->_internal_caller().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "minidfs.EditLog.src");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->src(), output);
-  }
-
-  // int32 dfID = 3;
-  if (this->dfid() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(3, this->dfid(), output);
+      "minidfs.CallerStats.caller");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_caller(), target);
   }
 
-  // repeated .minidfs.Block blks = 6;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->blks_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6,
-      this->blks(static_cast<int>(i)),
-      output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:minidfs.EditLog)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* EditLog::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.EditLog)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 op = 1;
-  if (this->op() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->op(), target);
+  // int64 queued = 2;
+  if (this->_internal_queued() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_queued(), target);
   }
 
-  // string src = 2;
-  if (this->src().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->src().data(), static_cast<int>(this->src().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "minidfs.EditLog.src");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->src(), target);
+  // int64 handled = 3;
+  if (this->_internal_handled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_handled(), target);
   }
 
-  // int32 dfID = 3;
-  if (this->dfid() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->dfid(), target);
+  // int64 rejected = 4;
+  if (this->_internal_rejected() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_rejected(), target);
   }
 
-  // repeated .minidfs.Block blks = 6;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->blks_size()); i < n; i++) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        6, this->blks(static_cast<int>(i)), target);
+  // int64 rate = 5;
+  if (this->_internal_rate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_rate(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.EditLog)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.CallerStats)
   return target;
 }
 
-size_t EditLog::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.EditLog)
+size_t CallerStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.CallerStats)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .minidfs.Block blks = 6;
-  {
-    unsigned int count = static_cast<unsigned int>(this->blks_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->blks(static_cast<int>(i)));
-    }
-  }
-
-  // string src = 2;
-  if (this->src().size() > 0) {
+  // string caller = 1;
+  if (!this->_internal_caller().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->src());
+        this->_internal_caller());
   }
 
-  // int32 op = 1;
-  if (this->op() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->op());
+  // int64 queued = 2;
+  if (this->_internal_queued() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_queued());
   }
 
-  // int32 dfID = 3;
-  if (this->dfid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->dfid());
+  // int64 handled = 3;
+  if (this->_internal_handled() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_handled());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // int64 rejected = 4;
+  if (this->_internal_rejected() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_rejected());
+  }
 
-void EditLog::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.EditLog)
-  GOOGLE_DCHECK_NE(&from, this);
-  const EditLog* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<EditLog>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.EditLog)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.EditLog)
-    MergeFrom(*source);
+  // int64 rate = 5;
+  if (this->_internal_rate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_rate());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void EditLog::MergeFrom(const EditLog& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.EditLog)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CallerStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CallerStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CallerStats::GetClassData() const { return &_class_data_; }
+
 
-  blks_.MergeFrom(from.blks_);
-  if (from.src().size() > 0) {
+void CallerStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CallerStats*>(&to_msg);
+  auto& from = static_cast<const CallerStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.CallerStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    src_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.src_);
+  if (!from._internal_caller().empty()) {
+    _this->_internal_set_caller(from._internal_caller());
   }
-  if (from.op() != 0) {
-    set_op(from.op());
+  if (from._internal_queued() != 0) {
+    _this->_internal_set_queued(from._internal_queued());
   }
-  if (from.dfid() != 0) {
-    set_dfid(from.dfid());
+  if (from._internal_handled() != 0) {
+    _this->_internal_set_handled(from._internal_handled());
   }
+  if (from._internal_rejected() != 0) {
+    _this->_internal_set_rejected(from._internal_rejected());
+  }
+  if (from._internal_rate() != 0) {
+    _this->_internal_set_rate(from._internal_rate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void EditLog::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.EditLog)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void EditLog::CopyFrom(const EditLog& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.EditLog)
+void CallerStats::CopyFrom(const CallerStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.CallerStats)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool EditLog::IsInitialized() const {
+bool CallerStats::IsInitialized() const {
   return true;
 }
 
-void EditLog::InternalSwap(EditLog* other) {
+void CallerStats::InternalSwap(CallerStats* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&blks_)->InternalSwap(CastToBase(&other->blks_));
-  src_.Swap(&other->src_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(op_, other->op_);
-  swap(dfid_, other->dfid_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata EditLog::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.caller_, lhs_arena,
+      &other->_impl_.caller_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CallerStats, _impl_.rate_)
+      + sizeof(CallerStats::_impl_.rate_)
+      - PROTOBUF_FIELD_OFFSET(CallerStats, _impl_.queued_)>(
+          reinterpret_cast<char*>(&_impl_.queued_),
+          reinterpret_cast<char*>(&other->_impl_.queued_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CallerStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[28]);
 }
 
-
 // ===================================================================
 
-void FileInfo::InitAsDefaultInstance() {
-}
-class FileInfo::_Internal {
+class ServerBusy::_Internal {
  public:
 };
 
-FileInfo::FileInfo()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.FileInfo)
+ServerBusy::ServerBusy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.ServerBusy)
 }
-FileInfo::FileInfo(const FileInfo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from.name().empty()) {
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  ::memcpy(&filelen_, &from.filelen_,
-    static_cast<size_t>(reinterpret_cast<char*>(&isdir_) -
-    reinterpret_cast<char*>(&filelen_)) + sizeof(isdir_));
-  // @@protoc_insertion_point(copy_constructor:minidfs.FileInfo)
+ServerBusy::ServerBusy(const ServerBusy& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerBusy* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.retryafterms_ = from._impl_.retryafterms_;
+  // @@protoc_insertion_point(copy_constructor:minidfs.ServerBusy)
 }
 
-void FileInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FileInfo_minidfs_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&filelen_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&isdir_) -
-      reinterpret_cast<char*>(&filelen_)) + sizeof(isdir_));
+inline void ServerBusy::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.retryafterms_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-FileInfo::~FileInfo() {
-  // @@protoc_insertion_point(destructor:minidfs.FileInfo)
+ServerBusy::~ServerBusy() {
+  // @@protoc_insertion_point(destructor:minidfs.ServerBusy)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void FileInfo::SharedDtor() {
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ServerBusy::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void FileInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const FileInfo& FileInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FileInfo_minidfs_2eproto.base);
-  return *internal_default_instance();
+void ServerBusy::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void FileInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ServerBusy::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.ServerBusy)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&filelen_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&isdir_) -
-      reinterpret_cast<char*>(&filelen_)) + sizeof(isdir_));
-  _internal_metadata_.Clear();
+  _impl_.retryafterms_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* FileInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ServerBusy::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string name = 1;
+      // int32 retryAfterMs = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_name(), ptr, ctx, "minidfs.FileInfo.name");
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bool isDir = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          isdir_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int64 fileLen = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          filelen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool FileInfo::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.FileInfo)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string name = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "minidfs.FileInfo.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool isDir = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &isdir_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 fileLen = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
-                 input, &filelen_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.FileInfo)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.FileInfo)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void FileInfo::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "minidfs.FileInfo.name");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // bool isDir = 2;
-  if (this->isdir() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(2, this->isdir(), output);
-  }
-
-  // int64 fileLen = 3;
-  if (this->filelen() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(3, this->filelen(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:minidfs.FileInfo)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* FileInfo::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ServerBusy::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.ServerBusy)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "minidfs.FileInfo.name");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-
-  // bool isDir = 2;
-  if (this->isdir() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->isdir(), target);
-  }
-
-  // int64 fileLen = 3;
-  if (this->filelen() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(3, this->filelen(), target);
+  // int32 retryAfterMs = 1;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_retryafterms(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.FileInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.ServerBusy)
   return target;
 }
 
-size_t FileInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.FileInfo)
+size_t ServerBusy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.ServerBusy)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->name());
-  }
-
-  // int64 fileLen = 3;
-  if (this->filelen() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
-        this->filelen());
-  }
-
-  // bool isDir = 2;
-  if (this->isdir() != 0) {
-    total_size += 1 + 1;
+  // int32 retryAfterMs = 1;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_retryafterms());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void FileInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.FileInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const FileInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FileInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.FileInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.FileInfo)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerBusy::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerBusy::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerBusy::GetClassData() const { return &_class_data_; }
 
-void FileInfo::MergeFrom(const FileInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.FileInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
+void ServerBusy::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerBusy*>(&to_msg);
+  auto& from = static_cast<const ServerBusy&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.ServerBusy)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.filelen() != 0) {
-    set_filelen(from.filelen());
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
   }
-  if (from.isdir() != 0) {
-    set_isdir(from.isdir());
-  }
-}
-
-void FileInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.FileInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void FileInfo::CopyFrom(const FileInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.FileInfo)
+void ServerBusy::CopyFrom(const ServerBusy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.ServerBusy)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool FileInfo::IsInitialized() const {
+bool ServerBusy::IsInitialized() const {
   return true;
 }
 
-void FileInfo::InternalSwap(FileInfo* other) {
+void ServerBusy::InternalSwap(ServerBusy* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(filelen_, other->filelen_);
-  swap(isdir_, other->isdir_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.retryafterms_, other->_impl_.retryafterms_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata FileInfo::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ServerBusy::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[29]);
 }
 
-
 // ===================================================================
 
-void FileInfos::InitAsDefaultInstance() {
-}
-class FileInfos::_Internal {
+class BlockIndexSnapshot::_Internal {
  public:
 };
 
-FileInfos::FileInfos()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:minidfs.FileInfos)
-}
-FileInfos::FileInfos(const FileInfos& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      fileinfos_(from.fileinfos_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:minidfs.FileInfos)
-}
-
-void FileInfos::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FileInfos_minidfs_2eproto.base);
-}
-
-FileInfos::~FileInfos() {
-  // @@protoc_insertion_point(destructor:minidfs.FileInfos)
+BlockIndexSnapshot::BlockIndexSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:minidfs.BlockIndexSnapshot)
+}
+BlockIndexSnapshot::BlockIndexSnapshot(const BlockIndexSnapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlockIndexSnapshot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subdirmtimes_){from._impl_.subdirmtimes_}
+    , /*decltype(_impl_._subdirmtimes_cached_byte_size_)*/{0}
+    , decltype(_impl_.encodedblkids_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.encodedblkids_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.encodedblkids_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_encodedblkids().empty()) {
+    _this->_impl_.encodedblkids_.Set(from._internal_encodedblkids(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:minidfs.BlockIndexSnapshot)
+}
+
+inline void BlockIndexSnapshot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subdirmtimes_){arena}
+    , /*decltype(_impl_._subdirmtimes_cached_byte_size_)*/{0}
+    , decltype(_impl_.encodedblkids_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.encodedblkids_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.encodedblkids_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BlockIndexSnapshot::~BlockIndexSnapshot() {
+  // @@protoc_insertion_point(destructor:minidfs.BlockIndexSnapshot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void FileInfos::SharedDtor() {
+inline void BlockIndexSnapshot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.subdirmtimes_.~RepeatedField();
+  _impl_.encodedblkids_.Destroy();
 }
 
-void FileInfos::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const FileInfos& FileInfos::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FileInfos_minidfs_2eproto.base);
-  return *internal_default_instance();
+void BlockIndexSnapshot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void FileInfos::Clear() {
-// @@protoc_insertion_point(message_clear_start:minidfs.FileInfos)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void BlockIndexSnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:minidfs.BlockIndexSnapshot)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  fileinfos_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.subdirmtimes_.Clear();
+  _impl_.encodedblkids_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* FileInfos::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BlockIndexSnapshot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .minidfs.FileInfo fileInfos = 1;
+      // repeated int64 subdirMtimes = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(add_fileinfos(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 10);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_subdirmtimes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_subdirmtimes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // bytes encodedBlkIDs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_encodedblkids();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool FileInfos::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:minidfs.FileInfos)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .minidfs.FileInfo fileInfos = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_fileinfos()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:minidfs.FileInfos)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:minidfs.FileInfos)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void FileInfos::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:minidfs.FileInfos)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* BlockIndexSnapshot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:minidfs.BlockIndexSnapshot)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .minidfs.FileInfo fileInfos = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->fileinfos_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->fileinfos(static_cast<int>(i)),
-      output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // repeated int64 subdirMtimes = 1;
+  {
+    int byte_size = _impl_._subdirmtimes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          1, _internal_subdirmtimes(), byte_size, target);
+    }
   }
-  // @@protoc_insertion_point(serialize_end:minidfs.FileInfos)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* FileInfos::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:minidfs.FileInfos)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // repeated .minidfs.FileInfo fileInfos = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->fileinfos_size()); i < n; i++) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->fileinfos(static_cast<int>(i)), target);
+  // bytes encodedBlkIDs = 2;
+  if (!this->_internal_encodedblkids().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_encodedblkids(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:minidfs.FileInfos)
+  // @@protoc_insertion_point(serialize_to_array_end:minidfs.BlockIndexSnapshot)
   return target;
 }
 
-size_t FileInfos::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:minidfs.FileInfos)
+size_t BlockIndexSnapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:minidfs.BlockIndexSnapshot)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .minidfs.FileInfo fileInfos = 1;
+  // repeated int64 subdirMtimes = 1;
   {
-    unsigned int count = static_cast<unsigned int>(this->fileinfos_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->fileinfos(static_cast<int>(i)));
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.subdirmtimes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._subdirmtimes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void FileInfos::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:minidfs.FileInfos)
-  GOOGLE_DCHECK_NE(&from, this);
-  const FileInfos* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FileInfos>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:minidfs.FileInfos)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:minidfs.FileInfos)
-    MergeFrom(*source);
+  // bytes encodedBlkIDs = 2;
+  if (!this->_internal_encodedblkids().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_encodedblkids());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void FileInfos::MergeFrom(const FileInfos& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:minidfs.FileInfos)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlockIndexSnapshot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlockIndexSnapshot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlockIndexSnapshot::GetClassData() const { return &_class_data_; }
 
-  fileinfos_.MergeFrom(from.fileinfos_);
-}
 
-void FileInfos::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:minidfs.FileInfos)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void BlockIndexSnapshot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlockIndexSnapshot*>(&to_msg);
+  auto& from = static_cast<const BlockIndexSnapshot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:minidfs.BlockIndexSnapshot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.subdirmtimes_.MergeFrom(from._impl_.subdirmtimes_);
+  if (!from._internal_encodedblkids().empty()) {
+    _this->_internal_set_encodedblkids(from._internal_encodedblkids());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void FileInfos::CopyFrom(const FileInfos& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.FileInfos)
+void BlockIndexSnapshot::CopyFrom(const BlockIndexSnapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:minidfs.BlockIndexSnapshot)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool FileInfos::IsInitialized() const {
+bool BlockIndexSnapshot::IsInitialized() const {
   return true;
 }
 
-void FileInfos::InternalSwap(FileInfos* other) {
+void BlockIndexSnapshot::InternalSwap(BlockIndexSnapshot* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&fileinfos_)->InternalSwap(CastToBase(&other->fileinfos_));
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.subdirmtimes_.InternalSwap(&other->_impl_.subdirmtimes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.encodedblkids_, lhs_arena,
+      &other->_impl_.encodedblkids_, rhs_arena
+  );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata FileInfos::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata BlockIndexSnapshot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_minidfs_2eproto_getter, &descriptor_table_minidfs_2eproto_once,
+      file_level_metadata_minidfs_2eproto[30]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace minidfs
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::minidfs::Block* Arena::CreateMaybeMessage< ::minidfs::Block >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::Block >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::ECSchema*
+Arena::CreateMaybeMessage< ::minidfs::ECSchema >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::ECSchema >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::Extent*
+Arena::CreateMaybeMessage< ::minidfs::Extent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::Extent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::Block*
+Arena::CreateMaybeMessage< ::minidfs::Block >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::Block >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::ChunkserverInfo*
+Arena::CreateMaybeMessage< ::minidfs::ChunkserverInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::ChunkserverInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::LocatedBlock*
+Arena::CreateMaybeMessage< ::minidfs::LocatedBlock >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::LocatedBlock >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::ECFile*
+Arena::CreateMaybeMessage< ::minidfs::ECFile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::ECFile >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::PackedFile*
+Arena::CreateMaybeMessage< ::minidfs::PackedFile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::PackedFile >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::Pack*
+Arena::CreateMaybeMessage< ::minidfs::Pack >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::Pack >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::InlineFile*
+Arena::CreateMaybeMessage< ::minidfs::InlineFile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::InlineFile >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::LocatedBlocks*
+Arena::CreateMaybeMessage< ::minidfs::LocatedBlocks >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::LocatedBlocks >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::BlkIDs*
+Arena::CreateMaybeMessage< ::minidfs::BlkIDs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::BlkIDs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::BlockReport*
+Arena::CreateMaybeMessage< ::minidfs::BlockReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::BlockReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::VolumeInfo*
+Arena::CreateMaybeMessage< ::minidfs::VolumeInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::VolumeInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::Heartbeat*
+Arena::CreateMaybeMessage< ::minidfs::Heartbeat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::Heartbeat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::BlockTask*
+Arena::CreateMaybeMessage< ::minidfs::BlockTask >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::BlockTask >(arena);
+}
+template<> PROTOBUF_NOINLINE ::minidfs::BlockTasks*
+Arena::CreateMaybeMessage< ::minidfs::BlockTasks >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::BlockTasks >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::ChunkserverInfo* Arena::CreateMaybeMessage< ::minidfs::ChunkserverInfo >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::ChunkserverInfo >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::Inode*
+Arena::CreateMaybeMessage< ::minidfs::Inode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::Inode >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::LocatedBlock* Arena::CreateMaybeMessage< ::minidfs::LocatedBlock >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::LocatedBlock >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::InodeSection*
+Arena::CreateMaybeMessage< ::minidfs::InodeSection >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::InodeSection >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::LocatedBlocks* Arena::CreateMaybeMessage< ::minidfs::LocatedBlocks >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::LocatedBlocks >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::Dentry*
+Arena::CreateMaybeMessage< ::minidfs::Dentry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::Dentry >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::BlkIDs* Arena::CreateMaybeMessage< ::minidfs::BlkIDs >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::BlkIDs >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::DentrySection*
+Arena::CreateMaybeMessage< ::minidfs::DentrySection >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::DentrySection >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::BlockReport* Arena::CreateMaybeMessage< ::minidfs::BlockReport >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::BlockReport >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::NameSystem*
+Arena::CreateMaybeMessage< ::minidfs::NameSystem >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::NameSystem >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::BlockTask* Arena::CreateMaybeMessage< ::minidfs::BlockTask >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::BlockTask >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::EditLog*
+Arena::CreateMaybeMessage< ::minidfs::EditLog >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::EditLog >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::BlockTasks* Arena::CreateMaybeMessage< ::minidfs::BlockTasks >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::BlockTasks >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::FileInfo*
+Arena::CreateMaybeMessage< ::minidfs::FileInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::FileInfo >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::Inode* Arena::CreateMaybeMessage< ::minidfs::Inode >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::Inode >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::FileInfos*
+Arena::CreateMaybeMessage< ::minidfs::FileInfos >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::FileInfos >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::InodeSection* Arena::CreateMaybeMessage< ::minidfs::InodeSection >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::InodeSection >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::LaneStats*
+Arena::CreateMaybeMessage< ::minidfs::LaneStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::LaneStats >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::Dentry* Arena::CreateMaybeMessage< ::minidfs::Dentry >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::Dentry >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::ServerStats*
+Arena::CreateMaybeMessage< ::minidfs::ServerStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::ServerStats >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::DentrySection* Arena::CreateMaybeMessage< ::minidfs::DentrySection >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::DentrySection >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::Metric*
+Arena::CreateMaybeMessage< ::minidfs::Metric >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::Metric >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::NameSystem* Arena::CreateMaybeMessage< ::minidfs::NameSystem >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::NameSystem >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::Metrics*
+Arena::CreateMaybeMessage< ::minidfs::Metrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::Metrics >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::EditLog* Arena::CreateMaybeMessage< ::minidfs::EditLog >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::EditLog >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::CallerStats*
+Arena::CreateMaybeMessage< ::minidfs::CallerStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::CallerStats >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::FileInfo* Arena::CreateMaybeMessage< ::minidfs::FileInfo >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::FileInfo >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::ServerBusy*
+Arena::CreateMaybeMessage< ::minidfs::ServerBusy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::ServerBusy >(arena);
 }
-template<> PROTOBUF_NOINLINE ::minidfs::FileInfos* Arena::CreateMaybeMessage< ::minidfs::FileInfos >(Arena* arena) {
-  return Arena::CreateInternal< ::minidfs::FileInfos >(arena);
+template<> PROTOBUF_NOINLINE ::minidfs::BlockIndexSnapshot*
+Arena::CreateMaybeMessage< ::minidfs::BlockIndexSnapshot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::minidfs::BlockIndexSnapshot >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
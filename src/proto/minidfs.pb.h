@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3009000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3009000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,14 +23,13 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -43,108 +42,192 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_minidfs_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[16]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_minidfs_2eproto;
 namespace minidfs {
 class BlkIDs;
-class BlkIDsDefaultTypeInternal;
+struct BlkIDsDefaultTypeInternal;
 extern BlkIDsDefaultTypeInternal _BlkIDs_default_instance_;
 class Block;
-class BlockDefaultTypeInternal;
+struct BlockDefaultTypeInternal;
 extern BlockDefaultTypeInternal _Block_default_instance_;
+class BlockIndexSnapshot;
+struct BlockIndexSnapshotDefaultTypeInternal;
+extern BlockIndexSnapshotDefaultTypeInternal _BlockIndexSnapshot_default_instance_;
 class BlockReport;
-class BlockReportDefaultTypeInternal;
+struct BlockReportDefaultTypeInternal;
 extern BlockReportDefaultTypeInternal _BlockReport_default_instance_;
 class BlockTask;
-class BlockTaskDefaultTypeInternal;
+struct BlockTaskDefaultTypeInternal;
 extern BlockTaskDefaultTypeInternal _BlockTask_default_instance_;
 class BlockTasks;
-class BlockTasksDefaultTypeInternal;
+struct BlockTasksDefaultTypeInternal;
 extern BlockTasksDefaultTypeInternal _BlockTasks_default_instance_;
+class CallerStats;
+struct CallerStatsDefaultTypeInternal;
+extern CallerStatsDefaultTypeInternal _CallerStats_default_instance_;
 class ChunkserverInfo;
-class ChunkserverInfoDefaultTypeInternal;
+struct ChunkserverInfoDefaultTypeInternal;
 extern ChunkserverInfoDefaultTypeInternal _ChunkserverInfo_default_instance_;
 class Dentry;
-class DentryDefaultTypeInternal;
+struct DentryDefaultTypeInternal;
 extern DentryDefaultTypeInternal _Dentry_default_instance_;
 class DentrySection;
-class DentrySectionDefaultTypeInternal;
+struct DentrySectionDefaultTypeInternal;
 extern DentrySectionDefaultTypeInternal _DentrySection_default_instance_;
+class ECFile;
+struct ECFileDefaultTypeInternal;
+extern ECFileDefaultTypeInternal _ECFile_default_instance_;
+class ECSchema;
+struct ECSchemaDefaultTypeInternal;
+extern ECSchemaDefaultTypeInternal _ECSchema_default_instance_;
 class EditLog;
-class EditLogDefaultTypeInternal;
+struct EditLogDefaultTypeInternal;
 extern EditLogDefaultTypeInternal _EditLog_default_instance_;
+class Extent;
+struct ExtentDefaultTypeInternal;
+extern ExtentDefaultTypeInternal _Extent_default_instance_;
 class FileInfo;
-class FileInfoDefaultTypeInternal;
+struct FileInfoDefaultTypeInternal;
 extern FileInfoDefaultTypeInternal _FileInfo_default_instance_;
 class FileInfos;
-class FileInfosDefaultTypeInternal;
+struct FileInfosDefaultTypeInternal;
 extern FileInfosDefaultTypeInternal _FileInfos_default_instance_;
+class Heartbeat;
+struct HeartbeatDefaultTypeInternal;
+extern HeartbeatDefaultTypeInternal _Heartbeat_default_instance_;
+class InlineFile;
+struct InlineFileDefaultTypeInternal;
+extern InlineFileDefaultTypeInternal _InlineFile_default_instance_;
 class Inode;
-class InodeDefaultTypeInternal;
+struct InodeDefaultTypeInternal;
 extern InodeDefaultTypeInternal _Inode_default_instance_;
 class InodeSection;
-class InodeSectionDefaultTypeInternal;
+struct InodeSectionDefaultTypeInternal;
 extern InodeSectionDefaultTypeInternal _InodeSection_default_instance_;
+class LaneStats;
+struct LaneStatsDefaultTypeInternal;
+extern LaneStatsDefaultTypeInternal _LaneStats_default_instance_;
 class LocatedBlock;
-class LocatedBlockDefaultTypeInternal;
+struct LocatedBlockDefaultTypeInternal;
 extern LocatedBlockDefaultTypeInternal _LocatedBlock_default_instance_;
 class LocatedBlocks;
-class LocatedBlocksDefaultTypeInternal;
+struct LocatedBlocksDefaultTypeInternal;
 extern LocatedBlocksDefaultTypeInternal _LocatedBlocks_default_instance_;
+class Metric;
+struct MetricDefaultTypeInternal;
+extern MetricDefaultTypeInternal _Metric_default_instance_;
+class Metrics;
+struct MetricsDefaultTypeInternal;
+extern MetricsDefaultTypeInternal _Metrics_default_instance_;
 class NameSystem;
-class NameSystemDefaultTypeInternal;
+struct NameSystemDefaultTypeInternal;
 extern NameSystemDefaultTypeInternal _NameSystem_default_instance_;
+class Pack;
+struct PackDefaultTypeInternal;
+extern PackDefaultTypeInternal _Pack_default_instance_;
+class PackedFile;
+struct PackedFileDefaultTypeInternal;
+extern PackedFileDefaultTypeInternal _PackedFile_default_instance_;
+class ServerBusy;
+struct ServerBusyDefaultTypeInternal;
+extern ServerBusyDefaultTypeInternal _ServerBusy_default_instance_;
+class ServerStats;
+struct ServerStatsDefaultTypeInternal;
+extern ServerStatsDefaultTypeInternal _ServerStats_default_instance_;
+class VolumeInfo;
+struct VolumeInfoDefaultTypeInternal;
+extern VolumeInfoDefaultTypeInternal _VolumeInfo_default_instance_;
 }  // namespace minidfs
 PROTOBUF_NAMESPACE_OPEN
 template<> ::minidfs::BlkIDs* Arena::CreateMaybeMessage<::minidfs::BlkIDs>(Arena*);
 template<> ::minidfs::Block* Arena::CreateMaybeMessage<::minidfs::Block>(Arena*);
+template<> ::minidfs::BlockIndexSnapshot* Arena::CreateMaybeMessage<::minidfs::BlockIndexSnapshot>(Arena*);
 template<> ::minidfs::BlockReport* Arena::CreateMaybeMessage<::minidfs::BlockReport>(Arena*);
 template<> ::minidfs::BlockTask* Arena::CreateMaybeMessage<::minidfs::BlockTask>(Arena*);
 template<> ::minidfs::BlockTasks* Arena::CreateMaybeMessage<::minidfs::BlockTasks>(Arena*);
+template<> ::minidfs::CallerStats* Arena::CreateMaybeMessage<::minidfs::CallerStats>(Arena*);
 template<> ::minidfs::ChunkserverInfo* Arena::CreateMaybeMessage<::minidfs::ChunkserverInfo>(Arena*);
 template<> ::minidfs::Dentry* Arena::CreateMaybeMessage<::minidfs::Dentry>(Arena*);
 template<> ::minidfs::DentrySection* Arena::CreateMaybeMessage<::minidfs::DentrySection>(Arena*);
+template<> ::minidfs::ECFile* Arena::CreateMaybeMessage<::minidfs::ECFile>(Arena*);
+template<> ::minidfs::ECSchema* Arena::CreateMaybeMessage<::minidfs::ECSchema>(Arena*);
 template<> ::minidfs::EditLog* Arena::CreateMaybeMessage<::minidfs::EditLog>(Arena*);
+template<> ::minidfs::Extent* Arena::CreateMaybeMessage<::minidfs::Extent>(Arena*);
 template<> ::minidfs::FileInfo* Arena::CreateMaybeMessage<::minidfs::FileInfo>(Arena*);
 template<> ::minidfs::FileInfos* Arena::CreateMaybeMessage<::minidfs::FileInfos>(Arena*);
+template<> ::minidfs::Heartbeat* Arena::CreateMaybeMessage<::minidfs::Heartbeat>(Arena*);
+template<> ::minidfs::InlineFile* Arena::CreateMaybeMessage<::minidfs::InlineFile>(Arena*);
 template<> ::minidfs::Inode* Arena::CreateMaybeMessage<::minidfs::Inode>(Arena*);
 template<> ::minidfs::InodeSection* Arena::CreateMaybeMessage<::minidfs::InodeSection>(Arena*);
+template<> ::minidfs::LaneStats* Arena::CreateMaybeMessage<::minidfs::LaneStats>(Arena*);
 template<> ::minidfs::LocatedBlock* Arena::CreateMaybeMessage<::minidfs::LocatedBlock>(Arena*);
 template<> ::minidfs::LocatedBlocks* Arena::CreateMaybeMessage<::minidfs::LocatedBlocks>(Arena*);
+template<> ::minidfs::Metric* Arena::CreateMaybeMessage<::minidfs::Metric>(Arena*);
+template<> ::minidfs::Metrics* Arena::CreateMaybeMessage<::minidfs::Metrics>(Arena*);
 template<> ::minidfs::NameSystem* Arena::CreateMaybeMessage<::minidfs::NameSystem>(Arena*);
+template<> ::minidfs::Pack* Arena::CreateMaybeMessage<::minidfs::Pack>(Arena*);
+template<> ::minidfs::PackedFile* Arena::CreateMaybeMessage<::minidfs::PackedFile>(Arena*);
+template<> ::minidfs::ServerBusy* Arena::CreateMaybeMessage<::minidfs::ServerBusy>(Arena*);
+template<> ::minidfs::ServerStats* Arena::CreateMaybeMessage<::minidfs::ServerStats>(Arena*);
+template<> ::minidfs::VolumeInfo* Arena::CreateMaybeMessage<::minidfs::VolumeInfo>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace minidfs {
 
+enum Metric_Type : int {
+  Metric_Type_COUNTER = 0,
+  Metric_Type_GAUGE = 1,
+  Metric_Type_HISTOGRAM = 2,
+  Metric_Type_Metric_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Metric_Type_Metric_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Metric_Type_IsValid(int value);
+constexpr Metric_Type Metric_Type_Type_MIN = Metric_Type_COUNTER;
+constexpr Metric_Type Metric_Type_Type_MAX = Metric_Type_HISTOGRAM;
+constexpr int Metric_Type_Type_ARRAYSIZE = Metric_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Metric_Type_descriptor();
+template<typename T>
+inline const std::string& Metric_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Metric_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Metric_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Metric_Type_descriptor(), enum_t_value);
+}
+inline bool Metric_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Metric_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Metric_Type>(
+    Metric_Type_descriptor(), name, value);
+}
 // ===================================================================
 
-class Block :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Block) */ {
+class ECSchema final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.ECSchema) */ {
  public:
-  Block();
-  virtual ~Block();
+  inline ECSchema() : ECSchema(nullptr) {}
+  ~ECSchema() override;
+  explicit PROTOBUF_CONSTEXPR ECSchema(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Block(const Block& from);
-  Block(Block&& from) noexcept
-    : Block() {
+  ECSchema(const ECSchema& from);
+  ECSchema(ECSchema&& from) noexcept
+    : ECSchema() {
     *this = ::std::move(from);
   }
 
-  inline Block& operator=(const Block& from) {
+  inline ECSchema& operator=(const ECSchema& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Block& operator=(Block&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ECSchema& operator=(ECSchema&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -155,134 +238,166 @@ class Block :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Block& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Block* internal_default_instance() {
-    return reinterpret_cast<const Block*>(
-               &_Block_default_instance_);
+  static const ECSchema& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ECSchema* internal_default_instance() {
+    return reinterpret_cast<const ECSchema*>(
+               &_ECSchema_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     0;
 
-  friend void swap(Block& a, Block& b) {
+  friend void swap(ECSchema& a, ECSchema& b) {
     a.Swap(&b);
   }
-  inline void Swap(Block* other) {
+  inline void Swap(ECSchema* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ECSchema* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Block* New() const final {
-    return CreateMaybeMessage<Block>(nullptr);
+  ECSchema* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ECSchema>(arena);
   }
-
-  Block* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Block>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ECSchema& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ECSchema& from) {
+    ECSchema::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Block& from);
-  void MergeFrom(const Block& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Block* other);
+  void InternalSwap(ECSchema* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.Block";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.ECSchema";
   }
+  protected:
+  explicit ECSchema(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlockLenFieldNumber = 2,
-    kBlockIDFieldNumber = 1,
+    kNDataFieldNumber = 1,
+    kNParityFieldNumber = 2,
+    kCellSizeFieldNumber = 3,
   };
-  // int64 blockLen = 2;
-  void clear_blocklen();
-  ::PROTOBUF_NAMESPACE_ID::int64 blocklen() const;
-  void set_blocklen(::PROTOBUF_NAMESPACE_ID::int64 value);
+  // int32 nData = 1;
+  void clear_ndata();
+  int32_t ndata() const;
+  void set_ndata(int32_t value);
+  private:
+  int32_t _internal_ndata() const;
+  void _internal_set_ndata(int32_t value);
+  public:
 
-  // int32 blockID = 1;
-  void clear_blockid();
-  ::PROTOBUF_NAMESPACE_ID::int32 blockid() const;
-  void set_blockid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int32 nParity = 2;
+  void clear_nparity();
+  int32_t nparity() const;
+  void set_nparity(int32_t value);
+  private:
+  int32_t _internal_nparity() const;
+  void _internal_set_nparity(int32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:minidfs.Block)
+  // int32 cellSize = 3;
+  void clear_cellsize();
+  int32_t cellsize() const;
+  void set_cellsize(int32_t value);
+  private:
+  int32_t _internal_cellsize() const;
+  void _internal_set_cellsize(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.ECSchema)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::int64 blocklen_;
-  ::PROTOBUF_NAMESPACE_ID::int32 blockid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t ndata_;
+    int32_t nparity_;
+    int32_t cellsize_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ChunkserverInfo :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.ChunkserverInfo) */ {
+class Extent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Extent) */ {
  public:
-  ChunkserverInfo();
-  virtual ~ChunkserverInfo();
+  inline Extent() : Extent(nullptr) {}
+  ~Extent() override;
+  explicit PROTOBUF_CONSTEXPR Extent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ChunkserverInfo(const ChunkserverInfo& from);
-  ChunkserverInfo(ChunkserverInfo&& from) noexcept
-    : ChunkserverInfo() {
+  Extent(const Extent& from);
+  Extent(Extent&& from) noexcept
+    : Extent() {
     *this = ::std::move(from);
   }
 
-  inline ChunkserverInfo& operator=(const ChunkserverInfo& from) {
+  inline Extent& operator=(const Extent& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ChunkserverInfo& operator=(ChunkserverInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline Extent& operator=(Extent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -293,140 +408,155 @@ class ChunkserverInfo :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const ChunkserverInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ChunkserverInfo* internal_default_instance() {
-    return reinterpret_cast<const ChunkserverInfo*>(
-               &_ChunkserverInfo_default_instance_);
+  static const Extent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Extent* internal_default_instance() {
+    return reinterpret_cast<const Extent*>(
+               &_Extent_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     1;
 
-  friend void swap(ChunkserverInfo& a, ChunkserverInfo& b) {
+  friend void swap(Extent& a, Extent& b) {
     a.Swap(&b);
   }
-  inline void Swap(ChunkserverInfo* other) {
+  inline void Swap(Extent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Extent* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ChunkserverInfo* New() const final {
-    return CreateMaybeMessage<ChunkserverInfo>(nullptr);
+  Extent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Extent>(arena);
   }
-
-  ChunkserverInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ChunkserverInfo>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Extent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Extent& from) {
+    Extent::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ChunkserverInfo& from);
-  void MergeFrom(const ChunkserverInfo& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ChunkserverInfo* other);
+  void InternalSwap(Extent* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.ChunkserverInfo";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.Extent";
   }
+  protected:
+  explicit Extent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kChunkserverIPFieldNumber = 1,
-    kChunkserverPortFieldNumber = 2,
+    kOffsetFieldNumber = 1,
+    kLenFieldNumber = 2,
   };
-  // string chunkserverIP = 1;
-  void clear_chunkserverip();
-  const std::string& chunkserverip() const;
-  void set_chunkserverip(const std::string& value);
-  void set_chunkserverip(std::string&& value);
-  void set_chunkserverip(const char* value);
-  void set_chunkserverip(const char* value, size_t size);
-  std::string* mutable_chunkserverip();
-  std::string* release_chunkserverip();
-  void set_allocated_chunkserverip(std::string* chunkserverip);
+  // int64 offset = 1;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
 
-  // int32 chunkserverPort = 2;
-  void clear_chunkserverport();
-  ::PROTOBUF_NAMESPACE_ID::int32 chunkserverport() const;
-  void set_chunkserverport(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int64 len = 2;
+  void clear_len();
+  int64_t len() const;
+  void set_len(int64_t value);
+  private:
+  int64_t _internal_len() const;
+  void _internal_set_len(int64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:minidfs.ChunkserverInfo)
+  // @@protoc_insertion_point(class_scope:minidfs.Extent)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr chunkserverip_;
-  ::PROTOBUF_NAMESPACE_ID::int32 chunkserverport_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t offset_;
+    int64_t len_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LocatedBlock :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.LocatedBlock) */ {
+class Block final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Block) */ {
  public:
-  LocatedBlock();
-  virtual ~LocatedBlock();
+  inline Block() : Block(nullptr) {}
+  ~Block() override;
+  explicit PROTOBUF_CONSTEXPR Block(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LocatedBlock(const LocatedBlock& from);
-  LocatedBlock(LocatedBlock&& from) noexcept
-    : LocatedBlock() {
+  Block(const Block& from);
+  Block(Block&& from) noexcept
+    : Block() {
     *this = ::std::move(from);
   }
 
-  inline LocatedBlock& operator=(const LocatedBlock& from) {
+  inline Block& operator=(const Block& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LocatedBlock& operator=(LocatedBlock&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline Block& operator=(Block&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -437,143 +567,206 @@ class LocatedBlock :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const LocatedBlock& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const LocatedBlock* internal_default_instance() {
-    return reinterpret_cast<const LocatedBlock*>(
-               &_LocatedBlock_default_instance_);
+  static const Block& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Block* internal_default_instance() {
+    return reinterpret_cast<const Block*>(
+               &_Block_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     2;
 
-  friend void swap(LocatedBlock& a, LocatedBlock& b) {
+  friend void swap(Block& a, Block& b) {
     a.Swap(&b);
   }
-  inline void Swap(LocatedBlock* other) {
+  inline void Swap(Block* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Block* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LocatedBlock* New() const final {
-    return CreateMaybeMessage<LocatedBlock>(nullptr);
+  Block* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Block>(arena);
   }
-
-  LocatedBlock* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<LocatedBlock>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Block& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Block& from) {
+    Block::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const LocatedBlock& from);
-  void MergeFrom(const LocatedBlock& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LocatedBlock* other);
+  void InternalSwap(Block* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.LocatedBlock";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.Block";
   }
+  protected:
+  explicit Block(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kChunkserverInfosFieldNumber = 2,
-    kBlockFieldNumber = 1,
+    kEcSchemaFieldNumber = 3,
+    kExtentFieldNumber = 5,
+    kBlockLenFieldNumber = 2,
+    kBlockIDFieldNumber = 1,
+    kCodecFieldNumber = 4,
   };
-  // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
-  int chunkserverinfos_size() const;
-  void clear_chunkserverinfos();
-  ::minidfs::ChunkserverInfo* mutable_chunkserverinfos(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo >*
-      mutable_chunkserverinfos();
-  const ::minidfs::ChunkserverInfo& chunkserverinfos(int index) const;
-  ::minidfs::ChunkserverInfo* add_chunkserverinfos();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo >&
-      chunkserverinfos() const;
+  // .minidfs.ECSchema ecSchema = 3;
+  bool has_ecschema() const;
+  private:
+  bool _internal_has_ecschema() const;
+  public:
+  void clear_ecschema();
+  const ::minidfs::ECSchema& ecschema() const;
+  PROTOBUF_NODISCARD ::minidfs::ECSchema* release_ecschema();
+  ::minidfs::ECSchema* mutable_ecschema();
+  void set_allocated_ecschema(::minidfs::ECSchema* ecschema);
+  private:
+  const ::minidfs::ECSchema& _internal_ecschema() const;
+  ::minidfs::ECSchema* _internal_mutable_ecschema();
+  public:
+  void unsafe_arena_set_allocated_ecschema(
+      ::minidfs::ECSchema* ecschema);
+  ::minidfs::ECSchema* unsafe_arena_release_ecschema();
 
-  // .minidfs.Block block = 1;
-  bool has_block() const;
-  void clear_block();
-  const ::minidfs::Block& block() const;
-  ::minidfs::Block* release_block();
-  ::minidfs::Block* mutable_block();
-  void set_allocated_block(::minidfs::Block* block);
+  // .minidfs.Extent extent = 5;
+  bool has_extent() const;
+  private:
+  bool _internal_has_extent() const;
+  public:
+  void clear_extent();
+  const ::minidfs::Extent& extent() const;
+  PROTOBUF_NODISCARD ::minidfs::Extent* release_extent();
+  ::minidfs::Extent* mutable_extent();
+  void set_allocated_extent(::minidfs::Extent* extent);
+  private:
+  const ::minidfs::Extent& _internal_extent() const;
+  ::minidfs::Extent* _internal_mutable_extent();
+  public:
+  void unsafe_arena_set_allocated_extent(
+      ::minidfs::Extent* extent);
+  ::minidfs::Extent* unsafe_arena_release_extent();
 
-  // @@protoc_insertion_point(class_scope:minidfs.LocatedBlock)
+  // int64 blockLen = 2;
+  void clear_blocklen();
+  int64_t blocklen() const;
+  void set_blocklen(int64_t value);
+  private:
+  int64_t _internal_blocklen() const;
+  void _internal_set_blocklen(int64_t value);
+  public:
+
+  // int32 blockID = 1;
+  void clear_blockid();
+  int32_t blockid() const;
+  void set_blockid(int32_t value);
+  private:
+  int32_t _internal_blockid() const;
+  void _internal_set_blockid(int32_t value);
+  public:
+
+  // int32 codec = 4;
+  void clear_codec();
+  int32_t codec() const;
+  void set_codec(int32_t value);
+  private:
+  int32_t _internal_codec() const;
+  void _internal_set_codec(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.Block)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo > chunkserverinfos_;
-  ::minidfs::Block* block_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::minidfs::ECSchema* ecschema_;
+    ::minidfs::Extent* extent_;
+    int64_t blocklen_;
+    int32_t blockid_;
+    int32_t codec_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LocatedBlocks :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.LocatedBlocks) */ {
+class ChunkserverInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.ChunkserverInfo) */ {
  public:
-  LocatedBlocks();
-  virtual ~LocatedBlocks();
+  inline ChunkserverInfo() : ChunkserverInfo(nullptr) {}
+  ~ChunkserverInfo() override;
+  explicit PROTOBUF_CONSTEXPR ChunkserverInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LocatedBlocks(const LocatedBlocks& from);
-  LocatedBlocks(LocatedBlocks&& from) noexcept
-    : LocatedBlocks() {
+  ChunkserverInfo(const ChunkserverInfo& from);
+  ChunkserverInfo(ChunkserverInfo&& from) noexcept
+    : ChunkserverInfo() {
     *this = ::std::move(from);
   }
 
-  inline LocatedBlocks& operator=(const LocatedBlocks& from) {
+  inline ChunkserverInfo& operator=(const ChunkserverInfo& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LocatedBlocks& operator=(LocatedBlocks&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ChunkserverInfo& operator=(ChunkserverInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -584,133 +777,160 @@ class LocatedBlocks :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const LocatedBlocks& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const LocatedBlocks* internal_default_instance() {
-    return reinterpret_cast<const LocatedBlocks*>(
-               &_LocatedBlocks_default_instance_);
+  static const ChunkserverInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChunkserverInfo* internal_default_instance() {
+    return reinterpret_cast<const ChunkserverInfo*>(
+               &_ChunkserverInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     3;
 
-  friend void swap(LocatedBlocks& a, LocatedBlocks& b) {
+  friend void swap(ChunkserverInfo& a, ChunkserverInfo& b) {
     a.Swap(&b);
   }
-  inline void Swap(LocatedBlocks* other) {
+  inline void Swap(ChunkserverInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChunkserverInfo* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LocatedBlocks* New() const final {
-    return CreateMaybeMessage<LocatedBlocks>(nullptr);
+  ChunkserverInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChunkserverInfo>(arena);
   }
-
-  LocatedBlocks* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<LocatedBlocks>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChunkserverInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChunkserverInfo& from) {
+    ChunkserverInfo::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const LocatedBlocks& from);
-  void MergeFrom(const LocatedBlocks& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LocatedBlocks* other);
+  void InternalSwap(ChunkserverInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.LocatedBlocks";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.ChunkserverInfo";
   }
+  protected:
+  explicit ChunkserverInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kLocatedBlksFieldNumber = 1,
+    kChunkserverIPFieldNumber = 1,
+    kChunkserverPortFieldNumber = 2,
   };
-  // repeated .minidfs.LocatedBlock locatedBlks = 1;
-  int locatedblks_size() const;
-  void clear_locatedblks();
-  ::minidfs::LocatedBlock* mutable_locatedblks(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock >*
-      mutable_locatedblks();
-  const ::minidfs::LocatedBlock& locatedblks(int index) const;
-  ::minidfs::LocatedBlock* add_locatedblks();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock >&
-      locatedblks() const;
+  // string chunkserverIP = 1;
+  void clear_chunkserverip();
+  const std::string& chunkserverip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_chunkserverip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_chunkserverip();
+  PROTOBUF_NODISCARD std::string* release_chunkserverip();
+  void set_allocated_chunkserverip(std::string* chunkserverip);
+  private:
+  const std::string& _internal_chunkserverip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_chunkserverip(const std::string& value);
+  std::string* _internal_mutable_chunkserverip();
+  public:
 
-  // @@protoc_insertion_point(class_scope:minidfs.LocatedBlocks)
+  // int32 chunkserverPort = 2;
+  void clear_chunkserverport();
+  int32_t chunkserverport() const;
+  void set_chunkserverport(int32_t value);
+  private:
+  int32_t _internal_chunkserverport() const;
+  void _internal_set_chunkserverport(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.ChunkserverInfo)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock > locatedblks_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr chunkserverip_;
+    int32_t chunkserverport_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BlkIDs :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.BlkIDs) */ {
+class LocatedBlock final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.LocatedBlock) */ {
  public:
-  BlkIDs();
-  virtual ~BlkIDs();
+  inline LocatedBlock() : LocatedBlock(nullptr) {}
+  ~LocatedBlock() override;
+  explicit PROTOBUF_CONSTEXPR LocatedBlock(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BlkIDs(const BlkIDs& from);
-  BlkIDs(BlkIDs&& from) noexcept
-    : BlkIDs() {
+  LocatedBlock(const LocatedBlock& from);
+  LocatedBlock(LocatedBlock&& from) noexcept
+    : LocatedBlock() {
     *this = ::std::move(from);
   }
 
-  inline BlkIDs& operator=(const BlkIDs& from) {
+  inline LocatedBlock& operator=(const LocatedBlock& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BlkIDs& operator=(BlkIDs&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline LocatedBlock& operator=(LocatedBlock&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -721,134 +941,173 @@ class BlkIDs :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const BlkIDs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const BlkIDs* internal_default_instance() {
-    return reinterpret_cast<const BlkIDs*>(
-               &_BlkIDs_default_instance_);
+  static const LocatedBlock& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LocatedBlock* internal_default_instance() {
+    return reinterpret_cast<const LocatedBlock*>(
+               &_LocatedBlock_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(BlkIDs& a, BlkIDs& b) {
+  friend void swap(LocatedBlock& a, LocatedBlock& b) {
     a.Swap(&b);
   }
-  inline void Swap(BlkIDs* other) {
+  inline void Swap(LocatedBlock* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LocatedBlock* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BlkIDs* New() const final {
-    return CreateMaybeMessage<BlkIDs>(nullptr);
+  LocatedBlock* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LocatedBlock>(arena);
   }
-
-  BlkIDs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<BlkIDs>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LocatedBlock& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LocatedBlock& from) {
+    LocatedBlock::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const BlkIDs& from);
-  void MergeFrom(const BlkIDs& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BlkIDs* other);
+  void InternalSwap(LocatedBlock* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.BlkIDs";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.LocatedBlock";
   }
+  protected:
+  explicit LocatedBlock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlkIDsFieldNumber = 1,
+    kChunkserverInfosFieldNumber = 2,
+    kBlockFieldNumber = 1,
   };
-  // repeated int32 blkIDs = 1;
-  int blkids_size() const;
-  void clear_blkids();
-  ::PROTOBUF_NAMESPACE_ID::int32 blkids(int index) const;
-  void set_blkids(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
-  void add_blkids(::PROTOBUF_NAMESPACE_ID::int32 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-      blkids() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-      mutable_blkids();
+  // repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
+  int chunkserverinfos_size() const;
+  private:
+  int _internal_chunkserverinfos_size() const;
+  public:
+  void clear_chunkserverinfos();
+  ::minidfs::ChunkserverInfo* mutable_chunkserverinfos(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo >*
+      mutable_chunkserverinfos();
+  private:
+  const ::minidfs::ChunkserverInfo& _internal_chunkserverinfos(int index) const;
+  ::minidfs::ChunkserverInfo* _internal_add_chunkserverinfos();
+  public:
+  const ::minidfs::ChunkserverInfo& chunkserverinfos(int index) const;
+  ::minidfs::ChunkserverInfo* add_chunkserverinfos();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo >&
+      chunkserverinfos() const;
 
-  // @@protoc_insertion_point(class_scope:minidfs.BlkIDs)
+  // .minidfs.Block block = 1;
+  bool has_block() const;
+  private:
+  bool _internal_has_block() const;
+  public:
+  void clear_block();
+  const ::minidfs::Block& block() const;
+  PROTOBUF_NODISCARD ::minidfs::Block* release_block();
+  ::minidfs::Block* mutable_block();
+  void set_allocated_block(::minidfs::Block* block);
+  private:
+  const ::minidfs::Block& _internal_block() const;
+  ::minidfs::Block* _internal_mutable_block();
+  public:
+  void unsafe_arena_set_allocated_block(
+      ::minidfs::Block* block);
+  ::minidfs::Block* unsafe_arena_release_block();
+
+  // @@protoc_insertion_point(class_scope:minidfs.LocatedBlock)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > blkids_;
-  mutable std::atomic<int> _blkids_cached_byte_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo > chunkserverinfos_;
+    ::minidfs::Block* block_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BlockReport :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.BlockReport) */ {
+class ECFile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.ECFile) */ {
  public:
-  BlockReport();
-  virtual ~BlockReport();
+  inline ECFile() : ECFile(nullptr) {}
+  ~ECFile() override;
+  explicit PROTOBUF_CONSTEXPR ECFile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BlockReport(const BlockReport& from);
-  BlockReport(BlockReport&& from) noexcept
-    : BlockReport() {
+  ECFile(const ECFile& from);
+  ECFile(ECFile&& from) noexcept
+    : ECFile() {
     *this = ::std::move(from);
   }
 
-  inline BlockReport& operator=(const BlockReport& from) {
+  inline ECFile& operator=(const ECFile& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BlockReport& operator=(BlockReport&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ECFile& operator=(ECFile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -859,144 +1118,169 @@ class BlockReport :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const BlockReport& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const BlockReport* internal_default_instance() {
-    return reinterpret_cast<const BlockReport*>(
-               &_BlockReport_default_instance_);
+  static const ECFile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ECFile* internal_default_instance() {
+    return reinterpret_cast<const ECFile*>(
+               &_ECFile_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(BlockReport& a, BlockReport& b) {
+  friend void swap(ECFile& a, ECFile& b) {
     a.Swap(&b);
   }
-  inline void Swap(BlockReport* other) {
+  inline void Swap(ECFile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ECFile* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BlockReport* New() const final {
-    return CreateMaybeMessage<BlockReport>(nullptr);
+  ECFile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ECFile>(arena);
   }
-
-  BlockReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<BlockReport>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ECFile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ECFile& from) {
+    ECFile::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const BlockReport& from);
-  void MergeFrom(const BlockReport& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BlockReport* other);
+  void InternalSwap(ECFile* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.BlockReport";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.ECFile";
   }
+  protected:
+  explicit ECFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlkIDsFieldNumber = 2,
-    kChunkserverInfoFieldNumber = 1,
+    kNameFieldNumber = 1,
+    kEcSchemaFieldNumber = 2,
   };
-  // repeated int32 blkIDs = 2;
-  int blkids_size() const;
-  void clear_blkids();
-  ::PROTOBUF_NAMESPACE_ID::int32 blkids(int index) const;
-  void set_blkids(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
-  void add_blkids(::PROTOBUF_NAMESPACE_ID::int32 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-      blkids() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-      mutable_blkids();
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
-  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
-  bool has_chunkserverinfo() const;
-  void clear_chunkserverinfo();
-  const ::minidfs::ChunkserverInfo& chunkserverinfo() const;
-  ::minidfs::ChunkserverInfo* release_chunkserverinfo();
-  ::minidfs::ChunkserverInfo* mutable_chunkserverinfo();
-  void set_allocated_chunkserverinfo(::minidfs::ChunkserverInfo* chunkserverinfo);
+  // .minidfs.ECSchema ecSchema = 2;
+  bool has_ecschema() const;
+  private:
+  bool _internal_has_ecschema() const;
+  public:
+  void clear_ecschema();
+  const ::minidfs::ECSchema& ecschema() const;
+  PROTOBUF_NODISCARD ::minidfs::ECSchema* release_ecschema();
+  ::minidfs::ECSchema* mutable_ecschema();
+  void set_allocated_ecschema(::minidfs::ECSchema* ecschema);
+  private:
+  const ::minidfs::ECSchema& _internal_ecschema() const;
+  ::minidfs::ECSchema* _internal_mutable_ecschema();
+  public:
+  void unsafe_arena_set_allocated_ecschema(
+      ::minidfs::ECSchema* ecschema);
+  ::minidfs::ECSchema* unsafe_arena_release_ecschema();
 
-  // @@protoc_insertion_point(class_scope:minidfs.BlockReport)
+  // @@protoc_insertion_point(class_scope:minidfs.ECFile)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > blkids_;
-  mutable std::atomic<int> _blkids_cached_byte_size_;
-  ::minidfs::ChunkserverInfo* chunkserverinfo_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::minidfs::ECSchema* ecschema_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BlockTask :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.BlockTask) */ {
+class PackedFile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.PackedFile) */ {
  public:
-  BlockTask();
-  virtual ~BlockTask();
+  inline PackedFile() : PackedFile(nullptr) {}
+  ~PackedFile() override;
+  explicit PROTOBUF_CONSTEXPR PackedFile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BlockTask(const BlockTask& from);
-  BlockTask(BlockTask&& from) noexcept
-    : BlockTask() {
+  PackedFile(const PackedFile& from);
+  PackedFile(PackedFile&& from) noexcept
+    : PackedFile() {
     *this = ::std::move(from);
   }
 
-  inline BlockTask& operator=(const BlockTask& from) {
+  inline PackedFile& operator=(const PackedFile& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BlockTask& operator=(BlockTask&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline PackedFile& operator=(PackedFile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1007,137 +1291,160 @@ class BlockTask :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const BlockTask& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const BlockTask* internal_default_instance() {
-    return reinterpret_cast<const BlockTask*>(
-               &_BlockTask_default_instance_);
+  static const PackedFile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PackedFile* internal_default_instance() {
+    return reinterpret_cast<const PackedFile*>(
+               &_PackedFile_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(BlockTask& a, BlockTask& b) {
+  friend void swap(PackedFile& a, PackedFile& b) {
     a.Swap(&b);
   }
-  inline void Swap(BlockTask* other) {
+  inline void Swap(PackedFile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackedFile* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BlockTask* New() const final {
-    return CreateMaybeMessage<BlockTask>(nullptr);
+  PackedFile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackedFile>(arena);
   }
-
-  BlockTask* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<BlockTask>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PackedFile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackedFile& from) {
+    PackedFile::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const BlockTask& from);
-  void MergeFrom(const BlockTask& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BlockTask* other);
+  void InternalSwap(PackedFile* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.BlockTask";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.PackedFile";
   }
+  protected:
+  explicit PackedFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kLocatedBlkFieldNumber = 2,
-    kOperationFieldNumber = 1,
+    kNameFieldNumber = 1,
+    kLenFieldNumber = 2,
   };
-  // .minidfs.LocatedBlock locatedBlk = 2;
-  bool has_locatedblk() const;
-  void clear_locatedblk();
-  const ::minidfs::LocatedBlock& locatedblk() const;
-  ::minidfs::LocatedBlock* release_locatedblk();
-  ::minidfs::LocatedBlock* mutable_locatedblk();
-  void set_allocated_locatedblk(::minidfs::LocatedBlock* locatedblk);
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
-  // int32 operation = 1;
-  void clear_operation();
-  ::PROTOBUF_NAMESPACE_ID::int32 operation() const;
-  void set_operation(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int64 len = 2;
+  void clear_len();
+  int64_t len() const;
+  void set_len(int64_t value);
+  private:
+  int64_t _internal_len() const;
+  void _internal_set_len(int64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:minidfs.BlockTask)
+  // @@protoc_insertion_point(class_scope:minidfs.PackedFile)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::minidfs::LocatedBlock* locatedblk_;
-  ::PROTOBUF_NAMESPACE_ID::int32 operation_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int64_t len_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BlockTasks :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.BlockTasks) */ {
+class Pack final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Pack) */ {
  public:
-  BlockTasks();
-  virtual ~BlockTasks();
+  inline Pack() : Pack(nullptr) {}
+  ~Pack() override;
+  explicit PROTOBUF_CONSTEXPR Pack(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BlockTasks(const BlockTasks& from);
-  BlockTasks(BlockTasks&& from) noexcept
-    : BlockTasks() {
+  Pack(const Pack& from);
+  Pack(Pack&& from) noexcept
+    : Pack() {
     *this = ::std::move(from);
   }
 
-  inline BlockTasks& operator=(const BlockTasks& from) {
+  inline Pack& operator=(const Pack& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BlockTasks& operator=(BlockTasks&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline Pack& operator=(Pack&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1148,133 +1455,173 @@ class BlockTasks :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const BlockTasks& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const BlockTasks* internal_default_instance() {
-    return reinterpret_cast<const BlockTasks*>(
-               &_BlockTasks_default_instance_);
+  static const Pack& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Pack* internal_default_instance() {
+    return reinterpret_cast<const Pack*>(
+               &_Pack_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(BlockTasks& a, BlockTasks& b) {
+  friend void swap(Pack& a, Pack& b) {
     a.Swap(&b);
   }
-  inline void Swap(BlockTasks* other) {
+  inline void Swap(Pack* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Pack* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BlockTasks* New() const final {
-    return CreateMaybeMessage<BlockTasks>(nullptr);
+  Pack* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Pack>(arena);
   }
-
-  BlockTasks* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<BlockTasks>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Pack& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Pack& from) {
+    Pack::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const BlockTasks& from);
-  void MergeFrom(const BlockTasks& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BlockTasks* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.BlockTasks";
-  }
+  void InternalSwap(Pack* other);
+
   private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.Pack";
   }
+  protected:
+  explicit Pack(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlkTasksFieldNumber = 1,
+    kFilesFieldNumber = 1,
+    kContainerFieldNumber = 2,
   };
-  // repeated .minidfs.BlockTask blkTasks = 1;
-  int blktasks_size() const;
-  void clear_blktasks();
-  ::minidfs::BlockTask* mutable_blktasks(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask >*
-      mutable_blktasks();
-  const ::minidfs::BlockTask& blktasks(int index) const;
-  ::minidfs::BlockTask* add_blktasks();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask >&
-      blktasks() const;
+  // repeated .minidfs.PackedFile files = 1;
+  int files_size() const;
+  private:
+  int _internal_files_size() const;
+  public:
+  void clear_files();
+  ::minidfs::PackedFile* mutable_files(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::PackedFile >*
+      mutable_files();
+  private:
+  const ::minidfs::PackedFile& _internal_files(int index) const;
+  ::minidfs::PackedFile* _internal_add_files();
+  public:
+  const ::minidfs::PackedFile& files(int index) const;
+  ::minidfs::PackedFile* add_files();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::PackedFile >&
+      files() const;
 
-  // @@protoc_insertion_point(class_scope:minidfs.BlockTasks)
+  // .minidfs.LocatedBlock container = 2;
+  bool has_container() const;
+  private:
+  bool _internal_has_container() const;
+  public:
+  void clear_container();
+  const ::minidfs::LocatedBlock& container() const;
+  PROTOBUF_NODISCARD ::minidfs::LocatedBlock* release_container();
+  ::minidfs::LocatedBlock* mutable_container();
+  void set_allocated_container(::minidfs::LocatedBlock* container);
+  private:
+  const ::minidfs::LocatedBlock& _internal_container() const;
+  ::minidfs::LocatedBlock* _internal_mutable_container();
+  public:
+  void unsafe_arena_set_allocated_container(
+      ::minidfs::LocatedBlock* container);
+  ::minidfs::LocatedBlock* unsafe_arena_release_container();
+
+  // @@protoc_insertion_point(class_scope:minidfs.Pack)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask > blktasks_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::PackedFile > files_;
+    ::minidfs::LocatedBlock* container_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Inode :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Inode) */ {
+class InlineFile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.InlineFile) */ {
  public:
-  Inode();
-  virtual ~Inode();
+  inline InlineFile() : InlineFile(nullptr) {}
+  ~InlineFile() override;
+  explicit PROTOBUF_CONSTEXPR InlineFile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Inode(const Inode& from);
-  Inode(Inode&& from) noexcept
-    : Inode() {
+  InlineFile(const InlineFile& from);
+  InlineFile(InlineFile&& from) noexcept
+    : InlineFile() {
     *this = ::std::move(from);
   }
 
-  inline Inode& operator=(const Inode& from) {
+  inline InlineFile& operator=(const InlineFile& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Inode& operator=(Inode&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline InlineFile& operator=(InlineFile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1285,160 +1632,165 @@ class Inode :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Inode& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Inode* internal_default_instance() {
-    return reinterpret_cast<const Inode*>(
-               &_Inode_default_instance_);
+  static const InlineFile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InlineFile* internal_default_instance() {
+    return reinterpret_cast<const InlineFile*>(
+               &_InlineFile_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(Inode& a, Inode& b) {
+  friend void swap(InlineFile& a, InlineFile& b) {
     a.Swap(&b);
   }
-  inline void Swap(Inode* other) {
+  inline void Swap(InlineFile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InlineFile* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Inode* New() const final {
-    return CreateMaybeMessage<Inode>(nullptr);
+  InlineFile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InlineFile>(arena);
   }
-
-  Inode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Inode>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InlineFile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InlineFile& from) {
+    InlineFile::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Inode& from);
-  void MergeFrom(const Inode& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Inode* other);
+  void InternalSwap(InlineFile* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.Inode";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.InlineFile";
   }
+  protected:
+  explicit InlineFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlksFieldNumber = 4,
-    kNameFieldNumber = 2,
-    kIdFieldNumber = 1,
-    kIsDirFieldNumber = 3,
+    kNameFieldNumber = 1,
+    kDataFieldNumber = 2,
   };
-  // repeated .minidfs.Block blks = 4;
-  int blks_size() const;
-  void clear_blks();
-  ::minidfs::Block* mutable_blks(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >*
-      mutable_blks();
-  const ::minidfs::Block& blks(int index) const;
-  ::minidfs::Block* add_blks();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >&
-      blks() const;
-
-  // string name = 2;
+  // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
-  // int32 id = 1;
-  void clear_id();
-  ::PROTOBUF_NAMESPACE_ID::int32 id() const;
-  void set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
-
-  // bool isDir = 3;
-  void clear_isdir();
-  bool isdir() const;
-  void set_isdir(bool value);
+  // bytes data = 2;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
-  // @@protoc_insertion_point(class_scope:minidfs.Inode)
+  // @@protoc_insertion_point(class_scope:minidfs.InlineFile)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block > blks_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::int32 id_;
-  bool isdir_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InodeSection :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.InodeSection) */ {
+class LocatedBlocks final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.LocatedBlocks) */ {
  public:
-  InodeSection();
-  virtual ~InodeSection();
+  inline LocatedBlocks() : LocatedBlocks(nullptr) {}
+  ~LocatedBlocks() override;
+  explicit PROTOBUF_CONSTEXPR LocatedBlocks(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InodeSection(const InodeSection& from);
-  InodeSection(InodeSection&& from) noexcept
-    : InodeSection() {
+  LocatedBlocks(const LocatedBlocks& from);
+  LocatedBlocks(LocatedBlocks&& from) noexcept
+    : LocatedBlocks() {
     *this = ::std::move(from);
   }
 
-  inline InodeSection& operator=(const InodeSection& from) {
+  inline LocatedBlocks& operator=(const LocatedBlocks& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InodeSection& operator=(InodeSection&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline LocatedBlocks& operator=(LocatedBlocks&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1449,133 +1801,169 @@ class InodeSection :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const InodeSection& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const InodeSection* internal_default_instance() {
-    return reinterpret_cast<const InodeSection*>(
-               &_InodeSection_default_instance_);
+  static const LocatedBlocks& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LocatedBlocks* internal_default_instance() {
+    return reinterpret_cast<const LocatedBlocks*>(
+               &_LocatedBlocks_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  friend void swap(InodeSection& a, InodeSection& b) {
+  friend void swap(LocatedBlocks& a, LocatedBlocks& b) {
     a.Swap(&b);
   }
-  inline void Swap(InodeSection* other) {
+  inline void Swap(LocatedBlocks* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LocatedBlocks* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InodeSection* New() const final {
-    return CreateMaybeMessage<InodeSection>(nullptr);
+  LocatedBlocks* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LocatedBlocks>(arena);
   }
-
-  InodeSection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<InodeSection>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LocatedBlocks& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LocatedBlocks& from) {
+    LocatedBlocks::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const InodeSection& from);
-  void MergeFrom(const InodeSection& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InodeSection* other);
+  void InternalSwap(LocatedBlocks* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.InodeSection";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.LocatedBlocks";
   }
+  protected:
+  explicit LocatedBlocks(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kInodesFieldNumber = 1,
+    kLocatedBlksFieldNumber = 1,
+    kInlineDataFieldNumber = 2,
   };
-  // repeated .minidfs.Inode inodes = 1;
-  int inodes_size() const;
-  void clear_inodes();
-  ::minidfs::Inode* mutable_inodes(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode >*
-      mutable_inodes();
-  const ::minidfs::Inode& inodes(int index) const;
-  ::minidfs::Inode* add_inodes();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode >&
-      inodes() const;
+  // repeated .minidfs.LocatedBlock locatedBlks = 1;
+  int locatedblks_size() const;
+  private:
+  int _internal_locatedblks_size() const;
+  public:
+  void clear_locatedblks();
+  ::minidfs::LocatedBlock* mutable_locatedblks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock >*
+      mutable_locatedblks();
+  private:
+  const ::minidfs::LocatedBlock& _internal_locatedblks(int index) const;
+  ::minidfs::LocatedBlock* _internal_add_locatedblks();
+  public:
+  const ::minidfs::LocatedBlock& locatedblks(int index) const;
+  ::minidfs::LocatedBlock* add_locatedblks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock >&
+      locatedblks() const;
 
-  // @@protoc_insertion_point(class_scope:minidfs.InodeSection)
+  // bytes inlineData = 2;
+  void clear_inlinedata();
+  const std::string& inlinedata() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_inlinedata(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_inlinedata();
+  PROTOBUF_NODISCARD std::string* release_inlinedata();
+  void set_allocated_inlinedata(std::string* inlinedata);
+  private:
+  const std::string& _internal_inlinedata() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_inlinedata(const std::string& value);
+  std::string* _internal_mutable_inlinedata();
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.LocatedBlocks)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode > inodes_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock > locatedblks_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr inlinedata_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Dentry :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Dentry) */ {
+class BlkIDs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.BlkIDs) */ {
  public:
-  Dentry();
-  virtual ~Dentry();
+  inline BlkIDs() : BlkIDs(nullptr) {}
+  ~BlkIDs() override;
+  explicit PROTOBUF_CONSTEXPR BlkIDs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Dentry(const Dentry& from);
-  Dentry(Dentry&& from) noexcept
-    : Dentry() {
+  BlkIDs(const BlkIDs& from);
+  BlkIDs(BlkIDs&& from) noexcept
+    : BlkIDs() {
     *this = ::std::move(from);
   }
 
-  inline Dentry& operator=(const Dentry& from) {
+  inline BlkIDs& operator=(const BlkIDs& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Dentry& operator=(Dentry&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline BlkIDs& operator=(BlkIDs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1586,141 +1974,158 @@ class Dentry :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Dentry& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Dentry* internal_default_instance() {
-    return reinterpret_cast<const Dentry*>(
-               &_Dentry_default_instance_);
+  static const BlkIDs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BlkIDs* internal_default_instance() {
+    return reinterpret_cast<const BlkIDs*>(
+               &_BlkIDs_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(Dentry& a, Dentry& b) {
+  friend void swap(BlkIDs& a, BlkIDs& b) {
     a.Swap(&b);
   }
-  inline void Swap(Dentry* other) {
+  inline void Swap(BlkIDs* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BlkIDs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Dentry* New() const final {
-    return CreateMaybeMessage<Dentry>(nullptr);
+  BlkIDs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlkIDs>(arena);
   }
-
-  Dentry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Dentry>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BlkIDs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BlkIDs& from) {
+    BlkIDs::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Dentry& from);
-  void MergeFrom(const Dentry& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Dentry* other);
+  void InternalSwap(BlkIDs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.Dentry";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.BlkIDs";
   }
+  protected:
+  explicit BlkIDs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kSubDentriesFieldNumber = 2,
-    kIdFieldNumber = 1,
+    kBlkIDsFieldNumber = 1,
   };
-  // repeated int32 subDentries = 2;
-  int subdentries_size() const;
-  void clear_subdentries();
-  ::PROTOBUF_NAMESPACE_ID::int32 subdentries(int index) const;
-  void set_subdentries(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
-  void add_subdentries(::PROTOBUF_NAMESPACE_ID::int32 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-      subdentries() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-      mutable_subdentries();
-
-  // int32 id = 1;
-  void clear_id();
-  ::PROTOBUF_NAMESPACE_ID::int32 id() const;
-  void set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // repeated int32 blkIDs = 1;
+  int blkids_size() const;
+  private:
+  int _internal_blkids_size() const;
+  public:
+  void clear_blkids();
+  private:
+  int32_t _internal_blkids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_blkids() const;
+  void _internal_add_blkids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_blkids();
+  public:
+  int32_t blkids(int index) const;
+  void set_blkids(int index, int32_t value);
+  void add_blkids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      blkids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_blkids();
 
-  // @@protoc_insertion_point(class_scope:minidfs.Dentry)
+  // @@protoc_insertion_point(class_scope:minidfs.BlkIDs)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > subdentries_;
-  mutable std::atomic<int> _subdentries_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::int32 id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > blkids_;
+    mutable std::atomic<int> _blkids_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DentrySection :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.DentrySection) */ {
+class BlockReport final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.BlockReport) */ {
  public:
-  DentrySection();
-  virtual ~DentrySection();
+  inline BlockReport() : BlockReport(nullptr) {}
+  ~BlockReport() override;
+  explicit PROTOBUF_CONSTEXPR BlockReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DentrySection(const DentrySection& from);
-  DentrySection(DentrySection&& from) noexcept
-    : DentrySection() {
+  BlockReport(const BlockReport& from);
+  BlockReport(BlockReport&& from) noexcept
+    : BlockReport() {
     *this = ::std::move(from);
   }
 
-  inline DentrySection& operator=(const DentrySection& from) {
+  inline BlockReport& operator=(const BlockReport& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DentrySection& operator=(DentrySection&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline BlockReport& operator=(BlockReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1731,133 +2136,194 @@ class DentrySection :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const DentrySection& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const DentrySection* internal_default_instance() {
-    return reinterpret_cast<const DentrySection*>(
-               &_DentrySection_default_instance_);
+  static const BlockReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BlockReport* internal_default_instance() {
+    return reinterpret_cast<const BlockReport*>(
+               &_BlockReport_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  friend void swap(DentrySection& a, DentrySection& b) {
+  friend void swap(BlockReport& a, BlockReport& b) {
     a.Swap(&b);
   }
-  inline void Swap(DentrySection* other) {
+  inline void Swap(BlockReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BlockReport* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DentrySection* New() const final {
-    return CreateMaybeMessage<DentrySection>(nullptr);
+  BlockReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlockReport>(arena);
   }
-
-  DentrySection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<DentrySection>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BlockReport& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BlockReport& from) {
+    BlockReport::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const DentrySection& from);
-  void MergeFrom(const DentrySection& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(DentrySection* other);
+  void InternalSwap(BlockReport* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.DentrySection";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.BlockReport";
   }
+  protected:
+  explicit BlockReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDentriesFieldNumber = 1,
+    kBlkIDsFieldNumber = 2,
+    kEncodedBlkIDsFieldNumber = 3,
+    kChunkserverInfoFieldNumber = 1,
   };
-  // repeated .minidfs.Dentry dentries = 1;
-  int dentries_size() const;
-  void clear_dentries();
-  ::minidfs::Dentry* mutable_dentries(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry >*
-      mutable_dentries();
-  const ::minidfs::Dentry& dentries(int index) const;
-  ::minidfs::Dentry* add_dentries();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry >&
-      dentries() const;
+  // repeated int32 blkIDs = 2;
+  int blkids_size() const;
+  private:
+  int _internal_blkids_size() const;
+  public:
+  void clear_blkids();
+  private:
+  int32_t _internal_blkids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_blkids() const;
+  void _internal_add_blkids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_blkids();
+  public:
+  int32_t blkids(int index) const;
+  void set_blkids(int index, int32_t value);
+  void add_blkids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      blkids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_blkids();
 
-  // @@protoc_insertion_point(class_scope:minidfs.DentrySection)
+  // bytes encodedBlkIDs = 3;
+  void clear_encodedblkids();
+  const std::string& encodedblkids() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_encodedblkids(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_encodedblkids();
+  PROTOBUF_NODISCARD std::string* release_encodedblkids();
+  void set_allocated_encodedblkids(std::string* encodedblkids);
+  private:
+  const std::string& _internal_encodedblkids() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_encodedblkids(const std::string& value);
+  std::string* _internal_mutable_encodedblkids();
+  public:
+
+  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
+  bool has_chunkserverinfo() const;
+  private:
+  bool _internal_has_chunkserverinfo() const;
+  public:
+  void clear_chunkserverinfo();
+  const ::minidfs::ChunkserverInfo& chunkserverinfo() const;
+  PROTOBUF_NODISCARD ::minidfs::ChunkserverInfo* release_chunkserverinfo();
+  ::minidfs::ChunkserverInfo* mutable_chunkserverinfo();
+  void set_allocated_chunkserverinfo(::minidfs::ChunkserverInfo* chunkserverinfo);
+  private:
+  const ::minidfs::ChunkserverInfo& _internal_chunkserverinfo() const;
+  ::minidfs::ChunkserverInfo* _internal_mutable_chunkserverinfo();
+  public:
+  void unsafe_arena_set_allocated_chunkserverinfo(
+      ::minidfs::ChunkserverInfo* chunkserverinfo);
+  ::minidfs::ChunkserverInfo* unsafe_arena_release_chunkserverinfo();
+
+  // @@protoc_insertion_point(class_scope:minidfs.BlockReport)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry > dentries_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > blkids_;
+    mutable std::atomic<int> _blkids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr encodedblkids_;
+    ::minidfs::ChunkserverInfo* chunkserverinfo_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NameSystem :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.NameSystem) */ {
+class VolumeInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.VolumeInfo) */ {
  public:
-  NameSystem();
-  virtual ~NameSystem();
+  inline VolumeInfo() : VolumeInfo(nullptr) {}
+  ~VolumeInfo() override;
+  explicit PROTOBUF_CONSTEXPR VolumeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  NameSystem(const NameSystem& from);
-  NameSystem(NameSystem&& from) noexcept
-    : NameSystem() {
+  VolumeInfo(const VolumeInfo& from);
+  VolumeInfo(VolumeInfo&& from) noexcept
+    : VolumeInfo() {
     *this = ::std::move(from);
   }
 
-  inline NameSystem& operator=(const NameSystem& from) {
+  inline VolumeInfo& operator=(const VolumeInfo& from) {
     CopyFrom(from);
     return *this;
   }
-  inline NameSystem& operator=(NameSystem&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline VolumeInfo& operator=(VolumeInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1868,154 +2334,182 @@ class NameSystem :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const NameSystem& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const NameSystem* internal_default_instance() {
-    return reinterpret_cast<const NameSystem*>(
-               &_NameSystem_default_instance_);
+  static const VolumeInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VolumeInfo* internal_default_instance() {
+    return reinterpret_cast<const VolumeInfo*>(
+               &_VolumeInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  friend void swap(NameSystem& a, NameSystem& b) {
+  friend void swap(VolumeInfo& a, VolumeInfo& b) {
     a.Swap(&b);
   }
-  inline void Swap(NameSystem* other) {
+  inline void Swap(VolumeInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VolumeInfo* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NameSystem* New() const final {
-    return CreateMaybeMessage<NameSystem>(nullptr);
+  VolumeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VolumeInfo>(arena);
   }
-
-  NameSystem* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<NameSystem>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VolumeInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VolumeInfo& from) {
+    VolumeInfo::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const NameSystem& from);
-  void MergeFrom(const NameSystem& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(NameSystem* other);
+  void InternalSwap(VolumeInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.NameSystem";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.VolumeInfo";
   }
+  protected:
+  explicit VolumeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kInodeSectionFieldNumber = 3,
-    kDentrySectionFieldNumber = 4,
-    kMaxDfIDFieldNumber = 1,
-    kMaxBlkIDFieldNumber = 2,
+    kDirFieldNumber = 1,
+    kCapacityFieldNumber = 2,
+    kAvailableFieldNumber = 3,
+    kNPendingIOFieldNumber = 4,
   };
-  // .minidfs.InodeSection inodeSection = 3;
-  bool has_inodesection() const;
-  void clear_inodesection();
-  const ::minidfs::InodeSection& inodesection() const;
-  ::minidfs::InodeSection* release_inodesection();
-  ::minidfs::InodeSection* mutable_inodesection();
-  void set_allocated_inodesection(::minidfs::InodeSection* inodesection);
+  // string dir = 1;
+  void clear_dir();
+  const std::string& dir() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dir(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_dir();
+  PROTOBUF_NODISCARD std::string* release_dir();
+  void set_allocated_dir(std::string* dir);
+  private:
+  const std::string& _internal_dir() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dir(const std::string& value);
+  std::string* _internal_mutable_dir();
+  public:
 
-  // .minidfs.DentrySection dentrySection = 4;
-  bool has_dentrysection() const;
-  void clear_dentrysection();
-  const ::minidfs::DentrySection& dentrysection() const;
-  ::minidfs::DentrySection* release_dentrysection();
-  ::minidfs::DentrySection* mutable_dentrysection();
-  void set_allocated_dentrysection(::minidfs::DentrySection* dentrysection);
+  // int64 capacity = 2;
+  void clear_capacity();
+  int64_t capacity() const;
+  void set_capacity(int64_t value);
+  private:
+  int64_t _internal_capacity() const;
+  void _internal_set_capacity(int64_t value);
+  public:
 
-  // int32 maxDfID = 1;
-  void clear_maxdfid();
-  ::PROTOBUF_NAMESPACE_ID::int32 maxdfid() const;
-  void set_maxdfid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int64 available = 3;
+  void clear_available();
+  int64_t available() const;
+  void set_available(int64_t value);
+  private:
+  int64_t _internal_available() const;
+  void _internal_set_available(int64_t value);
+  public:
 
-  // int32 maxBlkID = 2;
-  void clear_maxblkid();
-  ::PROTOBUF_NAMESPACE_ID::int32 maxblkid() const;
-  void set_maxblkid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int32 nPendingIO = 4;
+  void clear_npendingio();
+  int32_t npendingio() const;
+  void set_npendingio(int32_t value);
+  private:
+  int32_t _internal_npendingio() const;
+  void _internal_set_npendingio(int32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:minidfs.NameSystem)
+  // @@protoc_insertion_point(class_scope:minidfs.VolumeInfo)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::minidfs::InodeSection* inodesection_;
-  ::minidfs::DentrySection* dentrysection_;
-  ::PROTOBUF_NAMESPACE_ID::int32 maxdfid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 maxblkid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dir_;
+    int64_t capacity_;
+    int64_t available_;
+    int32_t npendingio_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EditLog :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.EditLog) */ {
+class Heartbeat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Heartbeat) */ {
  public:
-  EditLog();
-  virtual ~EditLog();
+  inline Heartbeat() : Heartbeat(nullptr) {}
+  ~Heartbeat() override;
+  explicit PROTOBUF_CONSTEXPR Heartbeat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  EditLog(const EditLog& from);
-  EditLog(EditLog&& from) noexcept
-    : EditLog() {
+  Heartbeat(const Heartbeat& from);
+  Heartbeat(Heartbeat&& from) noexcept
+    : Heartbeat() {
     *this = ::std::move(from);
   }
 
-  inline EditLog& operator=(const EditLog& from) {
+  inline Heartbeat& operator=(const Heartbeat& from) {
     CopyFrom(from);
     return *this;
   }
-  inline EditLog& operator=(EditLog&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline Heartbeat& operator=(Heartbeat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2026,160 +2520,270 @@ class EditLog :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const EditLog& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const EditLog* internal_default_instance() {
-    return reinterpret_cast<const EditLog*>(
-               &_EditLog_default_instance_);
+  static const Heartbeat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Heartbeat* internal_default_instance() {
+    return reinterpret_cast<const Heartbeat*>(
+               &_Heartbeat_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  friend void swap(EditLog& a, EditLog& b) {
+  friend void swap(Heartbeat& a, Heartbeat& b) {
     a.Swap(&b);
   }
-  inline void Swap(EditLog* other) {
+  inline void Swap(Heartbeat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Heartbeat* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline EditLog* New() const final {
-    return CreateMaybeMessage<EditLog>(nullptr);
+  Heartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Heartbeat>(arena);
   }
-
-  EditLog* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<EditLog>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Heartbeat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Heartbeat& from) {
+    Heartbeat::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const EditLog& from);
-  void MergeFrom(const EditLog& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(EditLog* other);
+  void InternalSwap(Heartbeat* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.EditLog";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.Heartbeat";
   }
+  protected:
+  explicit Heartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlksFieldNumber = 6,
-    kSrcFieldNumber = 2,
-    kOpFieldNumber = 1,
-    kDfIDFieldNumber = 3,
+    kRecvedBlkIDsFieldNumber = 3,
+    kFailedBlkIDsFieldNumber = 5,
+    kCorruptBlkIDsFieldNumber = 6,
+    kVolumesFieldNumber = 7,
+    kChunkserverInfoFieldNumber = 1,
+    kNActiveXfersFieldNumber = 2,
+    kAcceptBlkTasksFieldNumber = 4,
   };
-  // repeated .minidfs.Block blks = 6;
-  int blks_size() const;
-  void clear_blks();
-  ::minidfs::Block* mutable_blks(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >*
-      mutable_blks();
-  const ::minidfs::Block& blks(int index) const;
-  ::minidfs::Block* add_blks();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >&
-      blks() const;
-
-  // string src = 2;
-  void clear_src();
-  const std::string& src() const;
-  void set_src(const std::string& value);
-  void set_src(std::string&& value);
-  void set_src(const char* value);
-  void set_src(const char* value, size_t size);
-  std::string* mutable_src();
-  std::string* release_src();
-  void set_allocated_src(std::string* src);
+  // repeated int32 recvedBlkIDs = 3;
+  int recvedblkids_size() const;
+  private:
+  int _internal_recvedblkids_size() const;
+  public:
+  void clear_recvedblkids();
+  private:
+  int32_t _internal_recvedblkids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_recvedblkids() const;
+  void _internal_add_recvedblkids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_recvedblkids();
+  public:
+  int32_t recvedblkids(int index) const;
+  void set_recvedblkids(int index, int32_t value);
+  void add_recvedblkids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      recvedblkids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_recvedblkids();
+
+  // repeated int32 failedBlkIDs = 5;
+  int failedblkids_size() const;
+  private:
+  int _internal_failedblkids_size() const;
+  public:
+  void clear_failedblkids();
+  private:
+  int32_t _internal_failedblkids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_failedblkids() const;
+  void _internal_add_failedblkids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_failedblkids();
+  public:
+  int32_t failedblkids(int index) const;
+  void set_failedblkids(int index, int32_t value);
+  void add_failedblkids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      failedblkids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_failedblkids();
+
+  // repeated int32 corruptBlkIDs = 6;
+  int corruptblkids_size() const;
+  private:
+  int _internal_corruptblkids_size() const;
+  public:
+  void clear_corruptblkids();
+  private:
+  int32_t _internal_corruptblkids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_corruptblkids() const;
+  void _internal_add_corruptblkids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_corruptblkids();
+  public:
+  int32_t corruptblkids(int index) const;
+  void set_corruptblkids(int index, int32_t value);
+  void add_corruptblkids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      corruptblkids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_corruptblkids();
+
+  // repeated .minidfs.VolumeInfo volumes = 7;
+  int volumes_size() const;
+  private:
+  int _internal_volumes_size() const;
+  public:
+  void clear_volumes();
+  ::minidfs::VolumeInfo* mutable_volumes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::VolumeInfo >*
+      mutable_volumes();
+  private:
+  const ::minidfs::VolumeInfo& _internal_volumes(int index) const;
+  ::minidfs::VolumeInfo* _internal_add_volumes();
+  public:
+  const ::minidfs::VolumeInfo& volumes(int index) const;
+  ::minidfs::VolumeInfo* add_volumes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::VolumeInfo >&
+      volumes() const;
 
-  // int32 op = 1;
-  void clear_op();
-  ::PROTOBUF_NAMESPACE_ID::int32 op() const;
-  void set_op(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // .minidfs.ChunkserverInfo chunkserverInfo = 1;
+  bool has_chunkserverinfo() const;
+  private:
+  bool _internal_has_chunkserverinfo() const;
+  public:
+  void clear_chunkserverinfo();
+  const ::minidfs::ChunkserverInfo& chunkserverinfo() const;
+  PROTOBUF_NODISCARD ::minidfs::ChunkserverInfo* release_chunkserverinfo();
+  ::minidfs::ChunkserverInfo* mutable_chunkserverinfo();
+  void set_allocated_chunkserverinfo(::minidfs::ChunkserverInfo* chunkserverinfo);
+  private:
+  const ::minidfs::ChunkserverInfo& _internal_chunkserverinfo() const;
+  ::minidfs::ChunkserverInfo* _internal_mutable_chunkserverinfo();
+  public:
+  void unsafe_arena_set_allocated_chunkserverinfo(
+      ::minidfs::ChunkserverInfo* chunkserverinfo);
+  ::minidfs::ChunkserverInfo* unsafe_arena_release_chunkserverinfo();
+
+  // int32 nActiveXfers = 2;
+  void clear_nactivexfers();
+  int32_t nactivexfers() const;
+  void set_nactivexfers(int32_t value);
+  private:
+  int32_t _internal_nactivexfers() const;
+  void _internal_set_nactivexfers(int32_t value);
+  public:
 
-  // int32 dfID = 3;
-  void clear_dfid();
-  ::PROTOBUF_NAMESPACE_ID::int32 dfid() const;
-  void set_dfid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // bool acceptBlkTasks = 4;
+  void clear_acceptblktasks();
+  bool acceptblktasks() const;
+  void set_acceptblktasks(bool value);
+  private:
+  bool _internal_acceptblktasks() const;
+  void _internal_set_acceptblktasks(bool value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:minidfs.EditLog)
+  // @@protoc_insertion_point(class_scope:minidfs.Heartbeat)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block > blks_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr src_;
-  ::PROTOBUF_NAMESPACE_ID::int32 op_;
-  ::PROTOBUF_NAMESPACE_ID::int32 dfid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > recvedblkids_;
+    mutable std::atomic<int> _recvedblkids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > failedblkids_;
+    mutable std::atomic<int> _failedblkids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > corruptblkids_;
+    mutable std::atomic<int> _corruptblkids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::VolumeInfo > volumes_;
+    ::minidfs::ChunkserverInfo* chunkserverinfo_;
+    int32_t nactivexfers_;
+    bool acceptblktasks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FileInfo :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.FileInfo) */ {
+class BlockTask final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.BlockTask) */ {
  public:
-  FileInfo();
-  virtual ~FileInfo();
+  inline BlockTask() : BlockTask(nullptr) {}
+  ~BlockTask() override;
+  explicit PROTOBUF_CONSTEXPR BlockTask(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  FileInfo(const FileInfo& from);
-  FileInfo(FileInfo&& from) noexcept
-    : FileInfo() {
+  BlockTask(const BlockTask& from);
+  BlockTask(BlockTask&& from) noexcept
+    : BlockTask() {
     *this = ::std::move(from);
   }
 
-  inline FileInfo& operator=(const FileInfo& from) {
+  inline BlockTask& operator=(const BlockTask& from) {
     CopyFrom(from);
     return *this;
   }
-  inline FileInfo& operator=(FileInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline BlockTask& operator=(BlockTask&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2190,147 +2794,184 @@ class FileInfo :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const FileInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const FileInfo* internal_default_instance() {
-    return reinterpret_cast<const FileInfo*>(
-               &_FileInfo_default_instance_);
+  static const BlockTask& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BlockTask* internal_default_instance() {
+    return reinterpret_cast<const BlockTask*>(
+               &_BlockTask_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(FileInfo& a, FileInfo& b) {
+  friend void swap(BlockTask& a, BlockTask& b) {
     a.Swap(&b);
   }
-  inline void Swap(FileInfo* other) {
+  inline void Swap(BlockTask* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BlockTask* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline FileInfo* New() const final {
-    return CreateMaybeMessage<FileInfo>(nullptr);
+  BlockTask* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlockTask>(arena);
   }
-
-  FileInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<FileInfo>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BlockTask& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BlockTask& from) {
+    BlockTask::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const FileInfo& from);
-  void MergeFrom(const FileInfo& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(FileInfo* other);
+  void InternalSwap(BlockTask* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.FileInfo";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.BlockTask";
   }
+  protected:
+  explicit BlockTask(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kNameFieldNumber = 1,
-    kFileLenFieldNumber = 3,
-    kIsDirFieldNumber = 2,
+    kLocatedBlkFieldNumber = 2,
+    kBlkGroupFieldNumber = 3,
+    kOperationFieldNumber = 1,
   };
-  // string name = 1;
-  void clear_name();
-  const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  std::string* mutable_name();
-  std::string* release_name();
-  void set_allocated_name(std::string* name);
+  // .minidfs.LocatedBlock locatedBlk = 2;
+  bool has_locatedblk() const;
+  private:
+  bool _internal_has_locatedblk() const;
+  public:
+  void clear_locatedblk();
+  const ::minidfs::LocatedBlock& locatedblk() const;
+  PROTOBUF_NODISCARD ::minidfs::LocatedBlock* release_locatedblk();
+  ::minidfs::LocatedBlock* mutable_locatedblk();
+  void set_allocated_locatedblk(::minidfs::LocatedBlock* locatedblk);
+  private:
+  const ::minidfs::LocatedBlock& _internal_locatedblk() const;
+  ::minidfs::LocatedBlock* _internal_mutable_locatedblk();
+  public:
+  void unsafe_arena_set_allocated_locatedblk(
+      ::minidfs::LocatedBlock* locatedblk);
+  ::minidfs::LocatedBlock* unsafe_arena_release_locatedblk();
 
-  // int64 fileLen = 3;
-  void clear_filelen();
-  ::PROTOBUF_NAMESPACE_ID::int64 filelen() const;
-  void set_filelen(::PROTOBUF_NAMESPACE_ID::int64 value);
+  // .minidfs.LocatedBlock blkGroup = 3;
+  bool has_blkgroup() const;
+  private:
+  bool _internal_has_blkgroup() const;
+  public:
+  void clear_blkgroup();
+  const ::minidfs::LocatedBlock& blkgroup() const;
+  PROTOBUF_NODISCARD ::minidfs::LocatedBlock* release_blkgroup();
+  ::minidfs::LocatedBlock* mutable_blkgroup();
+  void set_allocated_blkgroup(::minidfs::LocatedBlock* blkgroup);
+  private:
+  const ::minidfs::LocatedBlock& _internal_blkgroup() const;
+  ::minidfs::LocatedBlock* _internal_mutable_blkgroup();
+  public:
+  void unsafe_arena_set_allocated_blkgroup(
+      ::minidfs::LocatedBlock* blkgroup);
+  ::minidfs::LocatedBlock* unsafe_arena_release_blkgroup();
 
-  // bool isDir = 2;
-  void clear_isdir();
-  bool isdir() const;
-  void set_isdir(bool value);
+  // int32 operation = 1;
+  void clear_operation();
+  int32_t operation() const;
+  void set_operation(int32_t value);
+  private:
+  int32_t _internal_operation() const;
+  void _internal_set_operation(int32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:minidfs.FileInfo)
+  // @@protoc_insertion_point(class_scope:minidfs.BlockTask)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::int64 filelen_;
-  bool isdir_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::minidfs::LocatedBlock* locatedblk_;
+    ::minidfs::LocatedBlock* blkgroup_;
+    int32_t operation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FileInfos :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.FileInfos) */ {
+class BlockTasks final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.BlockTasks) */ {
  public:
-  FileInfos();
-  virtual ~FileInfos();
+  inline BlockTasks() : BlockTasks(nullptr) {}
+  ~BlockTasks() override;
+  explicit PROTOBUF_CONSTEXPR BlockTasks(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  FileInfos(const FileInfos& from);
-  FileInfos(FileInfos&& from) noexcept
-    : FileInfos() {
+  BlockTasks(const BlockTasks& from);
+  BlockTasks(BlockTasks&& from) noexcept
+    : BlockTasks() {
     *this = ::std::move(from);
   }
 
-  inline FileInfos& operator=(const FileInfos& from) {
+  inline BlockTasks& operator=(const BlockTasks& from) {
     CopyFrom(from);
     return *this;
   }
-  inline FileInfos& operator=(FileInfos&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline BlockTasks& operator=(BlockTasks&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2341,1152 +2982,6907 @@ class FileInfos :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const FileInfos& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const FileInfos* internal_default_instance() {
-    return reinterpret_cast<const FileInfos*>(
-               &_FileInfos_default_instance_);
+  static const BlockTasks& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BlockTasks* internal_default_instance() {
+    return reinterpret_cast<const BlockTasks*>(
+               &_BlockTasks_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(FileInfos& a, FileInfos& b) {
+  friend void swap(BlockTasks& a, BlockTasks& b) {
     a.Swap(&b);
   }
-  inline void Swap(FileInfos* other) {
+  inline void Swap(BlockTasks* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BlockTasks* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline FileInfos* New() const final {
-    return CreateMaybeMessage<FileInfos>(nullptr);
+  BlockTasks* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlockTasks>(arena);
   }
-
-  FileInfos* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<FileInfos>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BlockTasks& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BlockTasks& from) {
+    BlockTasks::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const FileInfos& from);
-  void MergeFrom(const FileInfos& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(FileInfos* other);
+  void InternalSwap(BlockTasks* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "minidfs.FileInfos";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "minidfs.BlockTasks";
   }
+  protected:
+  explicit BlockTasks(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_minidfs_2eproto);
-    return ::descriptor_table_minidfs_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFileInfosFieldNumber = 1,
+    kBlkTasksFieldNumber = 1,
   };
-  // repeated .minidfs.FileInfo fileInfos = 1;
-  int fileinfos_size() const;
-  void clear_fileinfos();
-  ::minidfs::FileInfo* mutable_fileinfos(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo >*
-      mutable_fileinfos();
-  const ::minidfs::FileInfo& fileinfos(int index) const;
-  ::minidfs::FileInfo* add_fileinfos();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo >&
-      fileinfos() const;
+  // repeated .minidfs.BlockTask blkTasks = 1;
+  int blktasks_size() const;
+  private:
+  int _internal_blktasks_size() const;
+  public:
+  void clear_blktasks();
+  ::minidfs::BlockTask* mutable_blktasks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask >*
+      mutable_blktasks();
+  private:
+  const ::minidfs::BlockTask& _internal_blktasks(int index) const;
+  ::minidfs::BlockTask* _internal_add_blktasks();
+  public:
+  const ::minidfs::BlockTask& blktasks(int index) const;
+  ::minidfs::BlockTask* add_blktasks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask >&
+      blktasks() const;
 
-  // @@protoc_insertion_point(class_scope:minidfs.FileInfos)
+  // @@protoc_insertion_point(class_scope:minidfs.BlockTasks)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo > fileinfos_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask > blktasks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_minidfs_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class Inode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Inode) */ {
+ public:
+  inline Inode() : Inode(nullptr) {}
+  ~Inode() override;
+  explicit PROTOBUF_CONSTEXPR Inode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  Inode(const Inode& from);
+  Inode(Inode&& from) noexcept
+    : Inode() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Block
+  inline Inode& operator=(const Inode& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Inode& operator=(Inode&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// int32 blockID = 1;
-inline void Block::clear_blockid() {
-  blockid_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Block::blockid() const {
-  // @@protoc_insertion_point(field_get:minidfs.Block.blockID)
-  return blockid_;
-}
-inline void Block::set_blockid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  blockid_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.Block.blockID)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Inode& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Inode* internal_default_instance() {
+    return reinterpret_cast<const Inode*>(
+               &_Inode_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-// int64 blockLen = 2;
-inline void Block::clear_blocklen() {
-  blocklen_ = PROTOBUF_LONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::int64 Block::blocklen() const {
-  // @@protoc_insertion_point(field_get:minidfs.Block.blockLen)
-  return blocklen_;
-}
-inline void Block::set_blocklen(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  
-  blocklen_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.Block.blockLen)
-}
+  friend void swap(Inode& a, Inode& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Inode* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Inode* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// -------------------------------------------------------------------
+  // implements Message ----------------------------------------------
 
-// ChunkserverInfo
+  Inode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Inode>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Inode& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Inode& from) {
+    Inode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// string chunkserverIP = 1;
-inline void ChunkserverInfo::clear_chunkserverip() {
-  chunkserverip_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ChunkserverInfo::chunkserverip() const {
-  // @@protoc_insertion_point(field_get:minidfs.ChunkserverInfo.chunkserverIP)
-  return chunkserverip_.GetNoArena();
-}
-inline void ChunkserverInfo::set_chunkserverip(const std::string& value) {
-  
-  chunkserverip_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:minidfs.ChunkserverInfo.chunkserverIP)
-}
-inline void ChunkserverInfo::set_chunkserverip(std::string&& value) {
-  
-  chunkserverip_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:minidfs.ChunkserverInfo.chunkserverIP)
-}
-inline void ChunkserverInfo::set_chunkserverip(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  chunkserverip_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:minidfs.ChunkserverInfo.chunkserverIP)
-}
-inline void ChunkserverInfo::set_chunkserverip(const char* value, size_t size) {
-  
-  chunkserverip_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:minidfs.ChunkserverInfo.chunkserverIP)
-}
-inline std::string* ChunkserverInfo::mutable_chunkserverip() {
-  
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Inode* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.Inode";
+  }
+  protected:
+  explicit Inode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlksFieldNumber = 4,
+    kNameFieldNumber = 2,
+    kInlineDataFieldNumber = 5,
+    kIdFieldNumber = 1,
+    kIsDirFieldNumber = 3,
+  };
+  // repeated .minidfs.Block blks = 4;
+  int blks_size() const;
+  private:
+  int _internal_blks_size() const;
+  public:
+  void clear_blks();
+  ::minidfs::Block* mutable_blks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >*
+      mutable_blks();
+  private:
+  const ::minidfs::Block& _internal_blks(int index) const;
+  ::minidfs::Block* _internal_add_blks();
+  public:
+  const ::minidfs::Block& blks(int index) const;
+  ::minidfs::Block* add_blks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >&
+      blks() const;
+
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // bytes inlineData = 5;
+  void clear_inlinedata();
+  const std::string& inlinedata() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_inlinedata(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_inlinedata();
+  PROTOBUF_NODISCARD std::string* release_inlinedata();
+  void set_allocated_inlinedata(std::string* inlinedata);
+  private:
+  const std::string& _internal_inlinedata() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_inlinedata(const std::string& value);
+  std::string* _internal_mutable_inlinedata();
+  public:
+
+  // int32 id = 1;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // bool isDir = 3;
+  void clear_isdir();
+  bool isdir() const;
+  void set_isdir(bool value);
+  private:
+  bool _internal_isdir() const;
+  void _internal_set_isdir(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.Inode)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block > blks_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr inlinedata_;
+    int32_t id_;
+    bool isdir_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InodeSection final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.InodeSection) */ {
+ public:
+  inline InodeSection() : InodeSection(nullptr) {}
+  ~InodeSection() override;
+  explicit PROTOBUF_CONSTEXPR InodeSection(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InodeSection(const InodeSection& from);
+  InodeSection(InodeSection&& from) noexcept
+    : InodeSection() {
+    *this = ::std::move(from);
+  }
+
+  inline InodeSection& operator=(const InodeSection& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InodeSection& operator=(InodeSection&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InodeSection& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InodeSection* internal_default_instance() {
+    return reinterpret_cast<const InodeSection*>(
+               &_InodeSection_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(InodeSection& a, InodeSection& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InodeSection* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InodeSection* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InodeSection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InodeSection>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InodeSection& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InodeSection& from) {
+    InodeSection::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InodeSection* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.InodeSection";
+  }
+  protected:
+  explicit InodeSection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInodesFieldNumber = 1,
+  };
+  // repeated .minidfs.Inode inodes = 1;
+  int inodes_size() const;
+  private:
+  int _internal_inodes_size() const;
+  public:
+  void clear_inodes();
+  ::minidfs::Inode* mutable_inodes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode >*
+      mutable_inodes();
+  private:
+  const ::minidfs::Inode& _internal_inodes(int index) const;
+  ::minidfs::Inode* _internal_add_inodes();
+  public:
+  const ::minidfs::Inode& inodes(int index) const;
+  ::minidfs::Inode* add_inodes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode >&
+      inodes() const;
+
+  // @@protoc_insertion_point(class_scope:minidfs.InodeSection)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode > inodes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Dentry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Dentry) */ {
+ public:
+  inline Dentry() : Dentry(nullptr) {}
+  ~Dentry() override;
+  explicit PROTOBUF_CONSTEXPR Dentry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Dentry(const Dentry& from);
+  Dentry(Dentry&& from) noexcept
+    : Dentry() {
+    *this = ::std::move(from);
+  }
+
+  inline Dentry& operator=(const Dentry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Dentry& operator=(Dentry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Dentry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Dentry* internal_default_instance() {
+    return reinterpret_cast<const Dentry*>(
+               &_Dentry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(Dentry& a, Dentry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Dentry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Dentry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Dentry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Dentry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Dentry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Dentry& from) {
+    Dentry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Dentry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.Dentry";
+  }
+  protected:
+  explicit Dentry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubDentriesFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // repeated int32 subDentries = 2;
+  int subdentries_size() const;
+  private:
+  int _internal_subdentries_size() const;
+  public:
+  void clear_subdentries();
+  private:
+  int32_t _internal_subdentries(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_subdentries() const;
+  void _internal_add_subdentries(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_subdentries();
+  public:
+  int32_t subdentries(int index) const;
+  void set_subdentries(int index, int32_t value);
+  void add_subdentries(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      subdentries() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_subdentries();
+
+  // int32 id = 1;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.Dentry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > subdentries_;
+    mutable std::atomic<int> _subdentries_cached_byte_size_;
+    int32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DentrySection final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.DentrySection) */ {
+ public:
+  inline DentrySection() : DentrySection(nullptr) {}
+  ~DentrySection() override;
+  explicit PROTOBUF_CONSTEXPR DentrySection(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DentrySection(const DentrySection& from);
+  DentrySection(DentrySection&& from) noexcept
+    : DentrySection() {
+    *this = ::std::move(from);
+  }
+
+  inline DentrySection& operator=(const DentrySection& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DentrySection& operator=(DentrySection&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DentrySection& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DentrySection* internal_default_instance() {
+    return reinterpret_cast<const DentrySection*>(
+               &_DentrySection_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(DentrySection& a, DentrySection& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DentrySection* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DentrySection* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DentrySection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DentrySection>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DentrySection& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DentrySection& from) {
+    DentrySection::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DentrySection* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.DentrySection";
+  }
+  protected:
+  explicit DentrySection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDentriesFieldNumber = 1,
+  };
+  // repeated .minidfs.Dentry dentries = 1;
+  int dentries_size() const;
+  private:
+  int _internal_dentries_size() const;
+  public:
+  void clear_dentries();
+  ::minidfs::Dentry* mutable_dentries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry >*
+      mutable_dentries();
+  private:
+  const ::minidfs::Dentry& _internal_dentries(int index) const;
+  ::minidfs::Dentry* _internal_add_dentries();
+  public:
+  const ::minidfs::Dentry& dentries(int index) const;
+  ::minidfs::Dentry* add_dentries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry >&
+      dentries() const;
+
+  // @@protoc_insertion_point(class_scope:minidfs.DentrySection)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry > dentries_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NameSystem final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.NameSystem) */ {
+ public:
+  inline NameSystem() : NameSystem(nullptr) {}
+  ~NameSystem() override;
+  explicit PROTOBUF_CONSTEXPR NameSystem(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NameSystem(const NameSystem& from);
+  NameSystem(NameSystem&& from) noexcept
+    : NameSystem() {
+    *this = ::std::move(from);
+  }
+
+  inline NameSystem& operator=(const NameSystem& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NameSystem& operator=(NameSystem&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NameSystem& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NameSystem* internal_default_instance() {
+    return reinterpret_cast<const NameSystem*>(
+               &_NameSystem_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(NameSystem& a, NameSystem& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NameSystem* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NameSystem* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NameSystem* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NameSystem>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NameSystem& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NameSystem& from) {
+    NameSystem::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NameSystem* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.NameSystem";
+  }
+  protected:
+  explicit NameSystem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInodeSectionFieldNumber = 3,
+    kDentrySectionFieldNumber = 4,
+    kMaxDfIDFieldNumber = 1,
+    kMaxBlkIDFieldNumber = 2,
+  };
+  // .minidfs.InodeSection inodeSection = 3;
+  bool has_inodesection() const;
+  private:
+  bool _internal_has_inodesection() const;
+  public:
+  void clear_inodesection();
+  const ::minidfs::InodeSection& inodesection() const;
+  PROTOBUF_NODISCARD ::minidfs::InodeSection* release_inodesection();
+  ::minidfs::InodeSection* mutable_inodesection();
+  void set_allocated_inodesection(::minidfs::InodeSection* inodesection);
+  private:
+  const ::minidfs::InodeSection& _internal_inodesection() const;
+  ::minidfs::InodeSection* _internal_mutable_inodesection();
+  public:
+  void unsafe_arena_set_allocated_inodesection(
+      ::minidfs::InodeSection* inodesection);
+  ::minidfs::InodeSection* unsafe_arena_release_inodesection();
+
+  // .minidfs.DentrySection dentrySection = 4;
+  bool has_dentrysection() const;
+  private:
+  bool _internal_has_dentrysection() const;
+  public:
+  void clear_dentrysection();
+  const ::minidfs::DentrySection& dentrysection() const;
+  PROTOBUF_NODISCARD ::minidfs::DentrySection* release_dentrysection();
+  ::minidfs::DentrySection* mutable_dentrysection();
+  void set_allocated_dentrysection(::minidfs::DentrySection* dentrysection);
+  private:
+  const ::minidfs::DentrySection& _internal_dentrysection() const;
+  ::minidfs::DentrySection* _internal_mutable_dentrysection();
+  public:
+  void unsafe_arena_set_allocated_dentrysection(
+      ::minidfs::DentrySection* dentrysection);
+  ::minidfs::DentrySection* unsafe_arena_release_dentrysection();
+
+  // int32 maxDfID = 1;
+  void clear_maxdfid();
+  int32_t maxdfid() const;
+  void set_maxdfid(int32_t value);
+  private:
+  int32_t _internal_maxdfid() const;
+  void _internal_set_maxdfid(int32_t value);
+  public:
+
+  // int32 maxBlkID = 2;
+  void clear_maxblkid();
+  int32_t maxblkid() const;
+  void set_maxblkid(int32_t value);
+  private:
+  int32_t _internal_maxblkid() const;
+  void _internal_set_maxblkid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.NameSystem)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::minidfs::InodeSection* inodesection_;
+    ::minidfs::DentrySection* dentrysection_;
+    int32_t maxdfid_;
+    int32_t maxblkid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EditLog final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.EditLog) */ {
+ public:
+  inline EditLog() : EditLog(nullptr) {}
+  ~EditLog() override;
+  explicit PROTOBUF_CONSTEXPR EditLog(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EditLog(const EditLog& from);
+  EditLog(EditLog&& from) noexcept
+    : EditLog() {
+    *this = ::std::move(from);
+  }
+
+  inline EditLog& operator=(const EditLog& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EditLog& operator=(EditLog&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EditLog& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EditLog* internal_default_instance() {
+    return reinterpret_cast<const EditLog*>(
+               &_EditLog_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(EditLog& a, EditLog& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EditLog* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EditLog* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EditLog* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EditLog>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EditLog& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EditLog& from) {
+    EditLog::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EditLog* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.EditLog";
+  }
+  protected:
+  explicit EditLog(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlksFieldNumber = 6,
+    kCreatesFieldNumber = 8,
+    kSrcFieldNumber = 2,
+    kInlineDataFieldNumber = 7,
+    kOpFieldNumber = 1,
+    kDfIDFieldNumber = 3,
+  };
+  // repeated .minidfs.Block blks = 6;
+  int blks_size() const;
+  private:
+  int _internal_blks_size() const;
+  public:
+  void clear_blks();
+  ::minidfs::Block* mutable_blks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >*
+      mutable_blks();
+  private:
+  const ::minidfs::Block& _internal_blks(int index) const;
+  ::minidfs::Block* _internal_add_blks();
+  public:
+  const ::minidfs::Block& blks(int index) const;
+  ::minidfs::Block* add_blks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >&
+      blks() const;
+
+  // repeated .minidfs.EditLog creates = 8;
+  int creates_size() const;
+  private:
+  int _internal_creates_size() const;
+  public:
+  void clear_creates();
+  ::minidfs::EditLog* mutable_creates(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::EditLog >*
+      mutable_creates();
+  private:
+  const ::minidfs::EditLog& _internal_creates(int index) const;
+  ::minidfs::EditLog* _internal_add_creates();
+  public:
+  const ::minidfs::EditLog& creates(int index) const;
+  ::minidfs::EditLog* add_creates();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::EditLog >&
+      creates() const;
+
+  // string src = 2;
+  void clear_src();
+  const std::string& src() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_src(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_src();
+  PROTOBUF_NODISCARD std::string* release_src();
+  void set_allocated_src(std::string* src);
+  private:
+  const std::string& _internal_src() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_src(const std::string& value);
+  std::string* _internal_mutable_src();
+  public:
+
+  // bytes inlineData = 7;
+  void clear_inlinedata();
+  const std::string& inlinedata() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_inlinedata(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_inlinedata();
+  PROTOBUF_NODISCARD std::string* release_inlinedata();
+  void set_allocated_inlinedata(std::string* inlinedata);
+  private:
+  const std::string& _internal_inlinedata() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_inlinedata(const std::string& value);
+  std::string* _internal_mutable_inlinedata();
+  public:
+
+  // int32 op = 1;
+  void clear_op();
+  int32_t op() const;
+  void set_op(int32_t value);
+  private:
+  int32_t _internal_op() const;
+  void _internal_set_op(int32_t value);
+  public:
+
+  // int32 dfID = 3;
+  void clear_dfid();
+  int32_t dfid() const;
+  void set_dfid(int32_t value);
+  private:
+  int32_t _internal_dfid() const;
+  void _internal_set_dfid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.EditLog)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block > blks_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::EditLog > creates_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr src_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr inlinedata_;
+    int32_t op_;
+    int32_t dfid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FileInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.FileInfo) */ {
+ public:
+  inline FileInfo() : FileInfo(nullptr) {}
+  ~FileInfo() override;
+  explicit PROTOBUF_CONSTEXPR FileInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FileInfo(const FileInfo& from);
+  FileInfo(FileInfo&& from) noexcept
+    : FileInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline FileInfo& operator=(const FileInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FileInfo& operator=(FileInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FileInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FileInfo* internal_default_instance() {
+    return reinterpret_cast<const FileInfo*>(
+               &_FileInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(FileInfo& a, FileInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FileInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FileInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FileInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FileInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FileInfo& from) {
+    FileInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FileInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.FileInfo";
+  }
+  protected:
+  explicit FileInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kFileLenFieldNumber = 3,
+    kIsDirFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // int64 fileLen = 3;
+  void clear_filelen();
+  int64_t filelen() const;
+  void set_filelen(int64_t value);
+  private:
+  int64_t _internal_filelen() const;
+  void _internal_set_filelen(int64_t value);
+  public:
+
+  // bool isDir = 2;
+  void clear_isdir();
+  bool isdir() const;
+  void set_isdir(bool value);
+  private:
+  bool _internal_isdir() const;
+  void _internal_set_isdir(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.FileInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int64_t filelen_;
+    bool isdir_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FileInfos final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.FileInfos) */ {
+ public:
+  inline FileInfos() : FileInfos(nullptr) {}
+  ~FileInfos() override;
+  explicit PROTOBUF_CONSTEXPR FileInfos(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FileInfos(const FileInfos& from);
+  FileInfos(FileInfos&& from) noexcept
+    : FileInfos() {
+    *this = ::std::move(from);
+  }
+
+  inline FileInfos& operator=(const FileInfos& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FileInfos& operator=(FileInfos&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FileInfos& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FileInfos* internal_default_instance() {
+    return reinterpret_cast<const FileInfos*>(
+               &_FileInfos_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(FileInfos& a, FileInfos& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FileInfos* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileInfos* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FileInfos* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FileInfos>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FileInfos& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FileInfos& from) {
+    FileInfos::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FileInfos* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.FileInfos";
+  }
+  protected:
+  explicit FileInfos(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileInfosFieldNumber = 1,
+  };
+  // repeated .minidfs.FileInfo fileInfos = 1;
+  int fileinfos_size() const;
+  private:
+  int _internal_fileinfos_size() const;
+  public:
+  void clear_fileinfos();
+  ::minidfs::FileInfo* mutable_fileinfos(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo >*
+      mutable_fileinfos();
+  private:
+  const ::minidfs::FileInfo& _internal_fileinfos(int index) const;
+  ::minidfs::FileInfo* _internal_add_fileinfos();
+  public:
+  const ::minidfs::FileInfo& fileinfos(int index) const;
+  ::minidfs::FileInfo* add_fileinfos();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo >&
+      fileinfos() const;
+
+  // @@protoc_insertion_point(class_scope:minidfs.FileInfos)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo > fileinfos_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LaneStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.LaneStats) */ {
+ public:
+  inline LaneStats() : LaneStats(nullptr) {}
+  ~LaneStats() override;
+  explicit PROTOBUF_CONSTEXPR LaneStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LaneStats(const LaneStats& from);
+  LaneStats(LaneStats&& from) noexcept
+    : LaneStats() {
+    *this = ::std::move(from);
+  }
+
+  inline LaneStats& operator=(const LaneStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LaneStats& operator=(LaneStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LaneStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LaneStats* internal_default_instance() {
+    return reinterpret_cast<const LaneStats*>(
+               &_LaneStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(LaneStats& a, LaneStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LaneStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LaneStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LaneStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LaneStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LaneStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LaneStats& from) {
+    LaneStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LaneStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.LaneStats";
+  }
+  protected:
+  explicit LaneStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kQueuedFieldNumber = 3,
+    kHandledFieldNumber = 4,
+    kNThreadFieldNumber = 2,
+    kActiveFieldNumber = 6,
+    kRejectedFieldNumber = 5,
+    kCompletedFieldNumber = 8,
+    kWaitUsFieldNumber = 9,
+    kRunUsFieldNumber = 10,
+    kMaxThreadFieldNumber = 7,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // int64 queued = 3;
+  void clear_queued();
+  int64_t queued() const;
+  void set_queued(int64_t value);
+  private:
+  int64_t _internal_queued() const;
+  void _internal_set_queued(int64_t value);
+  public:
+
+  // int64 handled = 4;
+  void clear_handled();
+  int64_t handled() const;
+  void set_handled(int64_t value);
+  private:
+  int64_t _internal_handled() const;
+  void _internal_set_handled(int64_t value);
+  public:
+
+  // int32 nThread = 2;
+  void clear_nthread();
+  int32_t nthread() const;
+  void set_nthread(int32_t value);
+  private:
+  int32_t _internal_nthread() const;
+  void _internal_set_nthread(int32_t value);
+  public:
+
+  // int32 active = 6;
+  void clear_active();
+  int32_t active() const;
+  void set_active(int32_t value);
+  private:
+  int32_t _internal_active() const;
+  void _internal_set_active(int32_t value);
+  public:
+
+  // int64 rejected = 5;
+  void clear_rejected();
+  int64_t rejected() const;
+  void set_rejected(int64_t value);
+  private:
+  int64_t _internal_rejected() const;
+  void _internal_set_rejected(int64_t value);
+  public:
+
+  // int64 completed = 8;
+  void clear_completed();
+  int64_t completed() const;
+  void set_completed(int64_t value);
+  private:
+  int64_t _internal_completed() const;
+  void _internal_set_completed(int64_t value);
+  public:
+
+  // int64 waitUs = 9;
+  void clear_waitus();
+  int64_t waitus() const;
+  void set_waitus(int64_t value);
+  private:
+  int64_t _internal_waitus() const;
+  void _internal_set_waitus(int64_t value);
+  public:
+
+  // int64 runUs = 10;
+  void clear_runus();
+  int64_t runus() const;
+  void set_runus(int64_t value);
+  private:
+  int64_t _internal_runus() const;
+  void _internal_set_runus(int64_t value);
+  public:
+
+  // int32 maxThread = 7;
+  void clear_maxthread();
+  int32_t maxthread() const;
+  void set_maxthread(int32_t value);
+  private:
+  int32_t _internal_maxthread() const;
+  void _internal_set_maxthread(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.LaneStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int64_t queued_;
+    int64_t handled_;
+    int32_t nthread_;
+    int32_t active_;
+    int64_t rejected_;
+    int64_t completed_;
+    int64_t waitus_;
+    int64_t runus_;
+    int32_t maxthread_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.ServerStats) */ {
+ public:
+  inline ServerStats() : ServerStats(nullptr) {}
+  ~ServerStats() override;
+  explicit PROTOBUF_CONSTEXPR ServerStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStats(const ServerStats& from);
+  ServerStats(ServerStats&& from) noexcept
+    : ServerStats() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStats& operator=(const ServerStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStats& operator=(ServerStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStats* internal_default_instance() {
+    return reinterpret_cast<const ServerStats*>(
+               &_ServerStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(ServerStats& a, ServerStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStats& from) {
+    ServerStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.ServerStats";
+  }
+  protected:
+  explicit ServerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLanesFieldNumber = 1,
+    kCallersFieldNumber = 2,
+    kMetricsFieldNumber = 3,
+  };
+  // repeated .minidfs.LaneStats lanes = 1;
+  int lanes_size() const;
+  private:
+  int _internal_lanes_size() const;
+  public:
+  void clear_lanes();
+  ::minidfs::LaneStats* mutable_lanes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LaneStats >*
+      mutable_lanes();
+  private:
+  const ::minidfs::LaneStats& _internal_lanes(int index) const;
+  ::minidfs::LaneStats* _internal_add_lanes();
+  public:
+  const ::minidfs::LaneStats& lanes(int index) const;
+  ::minidfs::LaneStats* add_lanes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LaneStats >&
+      lanes() const;
+
+  // repeated .minidfs.CallerStats callers = 2;
+  int callers_size() const;
+  private:
+  int _internal_callers_size() const;
+  public:
+  void clear_callers();
+  ::minidfs::CallerStats* mutable_callers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::CallerStats >*
+      mutable_callers();
+  private:
+  const ::minidfs::CallerStats& _internal_callers(int index) const;
+  ::minidfs::CallerStats* _internal_add_callers();
+  public:
+  const ::minidfs::CallerStats& callers(int index) const;
+  ::minidfs::CallerStats* add_callers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::CallerStats >&
+      callers() const;
+
+  // .minidfs.Metrics metrics = 3;
+  bool has_metrics() const;
+  private:
+  bool _internal_has_metrics() const;
+  public:
+  void clear_metrics();
+  const ::minidfs::Metrics& metrics() const;
+  PROTOBUF_NODISCARD ::minidfs::Metrics* release_metrics();
+  ::minidfs::Metrics* mutable_metrics();
+  void set_allocated_metrics(::minidfs::Metrics* metrics);
+  private:
+  const ::minidfs::Metrics& _internal_metrics() const;
+  ::minidfs::Metrics* _internal_mutable_metrics();
+  public:
+  void unsafe_arena_set_allocated_metrics(
+      ::minidfs::Metrics* metrics);
+  ::minidfs::Metrics* unsafe_arena_release_metrics();
+
+  // @@protoc_insertion_point(class_scope:minidfs.ServerStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LaneStats > lanes_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::CallerStats > callers_;
+    ::minidfs::Metrics* metrics_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Metric final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Metric) */ {
+ public:
+  inline Metric() : Metric(nullptr) {}
+  ~Metric() override;
+  explicit PROTOBUF_CONSTEXPR Metric(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Metric(const Metric& from);
+  Metric(Metric&& from) noexcept
+    : Metric() {
+    *this = ::std::move(from);
+  }
+
+  inline Metric& operator=(const Metric& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Metric& operator=(Metric&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Metric& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Metric* internal_default_instance() {
+    return reinterpret_cast<const Metric*>(
+               &_Metric_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(Metric& a, Metric& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Metric* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Metric* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Metric* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Metric>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Metric& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Metric& from) {
+    Metric::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Metric* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.Metric";
+  }
+  protected:
+  explicit Metric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Metric_Type Type;
+  static constexpr Type COUNTER =
+    Metric_Type_COUNTER;
+  static constexpr Type GAUGE =
+    Metric_Type_GAUGE;
+  static constexpr Type HISTOGRAM =
+    Metric_Type_HISTOGRAM;
+  static inline bool Type_IsValid(int value) {
+    return Metric_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    Metric_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    Metric_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    Metric_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return Metric_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return Metric_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return Metric_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 3,
+    kCountFieldNumber = 4,
+    kSumFieldNumber = 5,
+    kMaxFieldNumber = 6,
+    kP50FieldNumber = 7,
+    kP90FieldNumber = 8,
+    kP99FieldNumber = 9,
+    kP999FieldNumber = 10,
+    kTypeFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // int64 value = 3;
+  void clear_value();
+  int64_t value() const;
+  void set_value(int64_t value);
+  private:
+  int64_t _internal_value() const;
+  void _internal_set_value(int64_t value);
+  public:
+
+  // int64 count = 4;
+  void clear_count();
+  int64_t count() const;
+  void set_count(int64_t value);
+  private:
+  int64_t _internal_count() const;
+  void _internal_set_count(int64_t value);
+  public:
+
+  // int64 sum = 5;
+  void clear_sum();
+  int64_t sum() const;
+  void set_sum(int64_t value);
+  private:
+  int64_t _internal_sum() const;
+  void _internal_set_sum(int64_t value);
+  public:
+
+  // int64 max = 6;
+  void clear_max();
+  int64_t max() const;
+  void set_max(int64_t value);
+  private:
+  int64_t _internal_max() const;
+  void _internal_set_max(int64_t value);
+  public:
+
+  // int64 p50 = 7;
+  void clear_p50();
+  int64_t p50() const;
+  void set_p50(int64_t value);
+  private:
+  int64_t _internal_p50() const;
+  void _internal_set_p50(int64_t value);
+  public:
+
+  // int64 p90 = 8;
+  void clear_p90();
+  int64_t p90() const;
+  void set_p90(int64_t value);
+  private:
+  int64_t _internal_p90() const;
+  void _internal_set_p90(int64_t value);
+  public:
+
+  // int64 p99 = 9;
+  void clear_p99();
+  int64_t p99() const;
+  void set_p99(int64_t value);
+  private:
+  int64_t _internal_p99() const;
+  void _internal_set_p99(int64_t value);
+  public:
+
+  // int64 p999 = 10;
+  void clear_p999();
+  int64_t p999() const;
+  void set_p999(int64_t value);
+  private:
+  int64_t _internal_p999() const;
+  void _internal_set_p999(int64_t value);
+  public:
+
+  // .minidfs.Metric.Type type = 2;
+  void clear_type();
+  ::minidfs::Metric_Type type() const;
+  void set_type(::minidfs::Metric_Type value);
+  private:
+  ::minidfs::Metric_Type _internal_type() const;
+  void _internal_set_type(::minidfs::Metric_Type value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.Metric)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int64_t value_;
+    int64_t count_;
+    int64_t sum_;
+    int64_t max_;
+    int64_t p50_;
+    int64_t p90_;
+    int64_t p99_;
+    int64_t p999_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Metrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.Metrics) */ {
+ public:
+  inline Metrics() : Metrics(nullptr) {}
+  ~Metrics() override;
+  explicit PROTOBUF_CONSTEXPR Metrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Metrics(const Metrics& from);
+  Metrics(Metrics&& from) noexcept
+    : Metrics() {
+    *this = ::std::move(from);
+  }
+
+  inline Metrics& operator=(const Metrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Metrics& operator=(Metrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Metrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Metrics* internal_default_instance() {
+    return reinterpret_cast<const Metrics*>(
+               &_Metrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(Metrics& a, Metrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Metrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Metrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Metrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Metrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Metrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Metrics& from) {
+    Metrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Metrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.Metrics";
+  }
+  protected:
+  explicit Metrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMetricsFieldNumber = 1,
+  };
+  // repeated .minidfs.Metric metrics = 1;
+  int metrics_size() const;
+  private:
+  int _internal_metrics_size() const;
+  public:
+  void clear_metrics();
+  ::minidfs::Metric* mutable_metrics(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Metric >*
+      mutable_metrics();
+  private:
+  const ::minidfs::Metric& _internal_metrics(int index) const;
+  ::minidfs::Metric* _internal_add_metrics();
+  public:
+  const ::minidfs::Metric& metrics(int index) const;
+  ::minidfs::Metric* add_metrics();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Metric >&
+      metrics() const;
+
+  // @@protoc_insertion_point(class_scope:minidfs.Metrics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Metric > metrics_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CallerStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.CallerStats) */ {
+ public:
+  inline CallerStats() : CallerStats(nullptr) {}
+  ~CallerStats() override;
+  explicit PROTOBUF_CONSTEXPR CallerStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CallerStats(const CallerStats& from);
+  CallerStats(CallerStats&& from) noexcept
+    : CallerStats() {
+    *this = ::std::move(from);
+  }
+
+  inline CallerStats& operator=(const CallerStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CallerStats& operator=(CallerStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CallerStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CallerStats* internal_default_instance() {
+    return reinterpret_cast<const CallerStats*>(
+               &_CallerStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(CallerStats& a, CallerStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CallerStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CallerStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CallerStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CallerStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CallerStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CallerStats& from) {
+    CallerStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CallerStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.CallerStats";
+  }
+  protected:
+  explicit CallerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCallerFieldNumber = 1,
+    kQueuedFieldNumber = 2,
+    kHandledFieldNumber = 3,
+    kRejectedFieldNumber = 4,
+    kRateFieldNumber = 5,
+  };
+  // string caller = 1;
+  void clear_caller();
+  const std::string& caller() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_caller(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_caller();
+  PROTOBUF_NODISCARD std::string* release_caller();
+  void set_allocated_caller(std::string* caller);
+  private:
+  const std::string& _internal_caller() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_caller(const std::string& value);
+  std::string* _internal_mutable_caller();
+  public:
+
+  // int64 queued = 2;
+  void clear_queued();
+  int64_t queued() const;
+  void set_queued(int64_t value);
+  private:
+  int64_t _internal_queued() const;
+  void _internal_set_queued(int64_t value);
+  public:
+
+  // int64 handled = 3;
+  void clear_handled();
+  int64_t handled() const;
+  void set_handled(int64_t value);
+  private:
+  int64_t _internal_handled() const;
+  void _internal_set_handled(int64_t value);
+  public:
+
+  // int64 rejected = 4;
+  void clear_rejected();
+  int64_t rejected() const;
+  void set_rejected(int64_t value);
+  private:
+  int64_t _internal_rejected() const;
+  void _internal_set_rejected(int64_t value);
+  public:
+
+  // int64 rate = 5;
+  void clear_rate();
+  int64_t rate() const;
+  void set_rate(int64_t value);
+  private:
+  int64_t _internal_rate() const;
+  void _internal_set_rate(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.CallerStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr caller_;
+    int64_t queued_;
+    int64_t handled_;
+    int64_t rejected_;
+    int64_t rate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerBusy final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.ServerBusy) */ {
+ public:
+  inline ServerBusy() : ServerBusy(nullptr) {}
+  ~ServerBusy() override;
+  explicit PROTOBUF_CONSTEXPR ServerBusy(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerBusy(const ServerBusy& from);
+  ServerBusy(ServerBusy&& from) noexcept
+    : ServerBusy() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerBusy& operator=(const ServerBusy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerBusy& operator=(ServerBusy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerBusy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerBusy* internal_default_instance() {
+    return reinterpret_cast<const ServerBusy*>(
+               &_ServerBusy_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(ServerBusy& a, ServerBusy& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerBusy* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerBusy* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerBusy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerBusy>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerBusy& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerBusy& from) {
+    ServerBusy::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerBusy* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.ServerBusy";
+  }
+  protected:
+  explicit ServerBusy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRetryAfterMsFieldNumber = 1,
+  };
+  // int32 retryAfterMs = 1;
+  void clear_retryafterms();
+  int32_t retryafterms() const;
+  void set_retryafterms(int32_t value);
+  private:
+  int32_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.ServerBusy)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BlockIndexSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:minidfs.BlockIndexSnapshot) */ {
+ public:
+  inline BlockIndexSnapshot() : BlockIndexSnapshot(nullptr) {}
+  ~BlockIndexSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR BlockIndexSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BlockIndexSnapshot(const BlockIndexSnapshot& from);
+  BlockIndexSnapshot(BlockIndexSnapshot&& from) noexcept
+    : BlockIndexSnapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline BlockIndexSnapshot& operator=(const BlockIndexSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BlockIndexSnapshot& operator=(BlockIndexSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BlockIndexSnapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BlockIndexSnapshot* internal_default_instance() {
+    return reinterpret_cast<const BlockIndexSnapshot*>(
+               &_BlockIndexSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(BlockIndexSnapshot& a, BlockIndexSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BlockIndexSnapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BlockIndexSnapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BlockIndexSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlockIndexSnapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BlockIndexSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BlockIndexSnapshot& from) {
+    BlockIndexSnapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BlockIndexSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "minidfs.BlockIndexSnapshot";
+  }
+  protected:
+  explicit BlockIndexSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubdirMtimesFieldNumber = 1,
+    kEncodedBlkIDsFieldNumber = 2,
+  };
+  // repeated int64 subdirMtimes = 1;
+  int subdirmtimes_size() const;
+  private:
+  int _internal_subdirmtimes_size() const;
+  public:
+  void clear_subdirmtimes();
+  private:
+  int64_t _internal_subdirmtimes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_subdirmtimes() const;
+  void _internal_add_subdirmtimes(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_subdirmtimes();
+  public:
+  int64_t subdirmtimes(int index) const;
+  void set_subdirmtimes(int index, int64_t value);
+  void add_subdirmtimes(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      subdirmtimes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_subdirmtimes();
+
+  // bytes encodedBlkIDs = 2;
+  void clear_encodedblkids();
+  const std::string& encodedblkids() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_encodedblkids(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_encodedblkids();
+  PROTOBUF_NODISCARD std::string* release_encodedblkids();
+  void set_allocated_encodedblkids(std::string* encodedblkids);
+  private:
+  const std::string& _internal_encodedblkids() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_encodedblkids(const std::string& value);
+  std::string* _internal_mutable_encodedblkids();
+  public:
+
+  // @@protoc_insertion_point(class_scope:minidfs.BlockIndexSnapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > subdirmtimes_;
+    mutable std::atomic<int> _subdirmtimes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr encodedblkids_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_minidfs_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ECSchema
+
+// int32 nData = 1;
+inline void ECSchema::clear_ndata() {
+  _impl_.ndata_ = 0;
+}
+inline int32_t ECSchema::_internal_ndata() const {
+  return _impl_.ndata_;
+}
+inline int32_t ECSchema::ndata() const {
+  // @@protoc_insertion_point(field_get:minidfs.ECSchema.nData)
+  return _internal_ndata();
+}
+inline void ECSchema::_internal_set_ndata(int32_t value) {
+  
+  _impl_.ndata_ = value;
+}
+inline void ECSchema::set_ndata(int32_t value) {
+  _internal_set_ndata(value);
+  // @@protoc_insertion_point(field_set:minidfs.ECSchema.nData)
+}
+
+// int32 nParity = 2;
+inline void ECSchema::clear_nparity() {
+  _impl_.nparity_ = 0;
+}
+inline int32_t ECSchema::_internal_nparity() const {
+  return _impl_.nparity_;
+}
+inline int32_t ECSchema::nparity() const {
+  // @@protoc_insertion_point(field_get:minidfs.ECSchema.nParity)
+  return _internal_nparity();
+}
+inline void ECSchema::_internal_set_nparity(int32_t value) {
+  
+  _impl_.nparity_ = value;
+}
+inline void ECSchema::set_nparity(int32_t value) {
+  _internal_set_nparity(value);
+  // @@protoc_insertion_point(field_set:minidfs.ECSchema.nParity)
+}
+
+// int32 cellSize = 3;
+inline void ECSchema::clear_cellsize() {
+  _impl_.cellsize_ = 0;
+}
+inline int32_t ECSchema::_internal_cellsize() const {
+  return _impl_.cellsize_;
+}
+inline int32_t ECSchema::cellsize() const {
+  // @@protoc_insertion_point(field_get:minidfs.ECSchema.cellSize)
+  return _internal_cellsize();
+}
+inline void ECSchema::_internal_set_cellsize(int32_t value) {
+  
+  _impl_.cellsize_ = value;
+}
+inline void ECSchema::set_cellsize(int32_t value) {
+  _internal_set_cellsize(value);
+  // @@protoc_insertion_point(field_set:minidfs.ECSchema.cellSize)
+}
+
+// -------------------------------------------------------------------
+
+// Extent
+
+// int64 offset = 1;
+inline void Extent::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t Extent::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t Extent::offset() const {
+  // @@protoc_insertion_point(field_get:minidfs.Extent.offset)
+  return _internal_offset();
+}
+inline void Extent::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void Extent::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:minidfs.Extent.offset)
+}
+
+// int64 len = 2;
+inline void Extent::clear_len() {
+  _impl_.len_ = int64_t{0};
+}
+inline int64_t Extent::_internal_len() const {
+  return _impl_.len_;
+}
+inline int64_t Extent::len() const {
+  // @@protoc_insertion_point(field_get:minidfs.Extent.len)
+  return _internal_len();
+}
+inline void Extent::_internal_set_len(int64_t value) {
+  
+  _impl_.len_ = value;
+}
+inline void Extent::set_len(int64_t value) {
+  _internal_set_len(value);
+  // @@protoc_insertion_point(field_set:minidfs.Extent.len)
+}
+
+// -------------------------------------------------------------------
+
+// Block
+
+// int32 blockID = 1;
+inline void Block::clear_blockid() {
+  _impl_.blockid_ = 0;
+}
+inline int32_t Block::_internal_blockid() const {
+  return _impl_.blockid_;
+}
+inline int32_t Block::blockid() const {
+  // @@protoc_insertion_point(field_get:minidfs.Block.blockID)
+  return _internal_blockid();
+}
+inline void Block::_internal_set_blockid(int32_t value) {
+  
+  _impl_.blockid_ = value;
+}
+inline void Block::set_blockid(int32_t value) {
+  _internal_set_blockid(value);
+  // @@protoc_insertion_point(field_set:minidfs.Block.blockID)
+}
+
+// int64 blockLen = 2;
+inline void Block::clear_blocklen() {
+  _impl_.blocklen_ = int64_t{0};
+}
+inline int64_t Block::_internal_blocklen() const {
+  return _impl_.blocklen_;
+}
+inline int64_t Block::blocklen() const {
+  // @@protoc_insertion_point(field_get:minidfs.Block.blockLen)
+  return _internal_blocklen();
+}
+inline void Block::_internal_set_blocklen(int64_t value) {
+  
+  _impl_.blocklen_ = value;
+}
+inline void Block::set_blocklen(int64_t value) {
+  _internal_set_blocklen(value);
+  // @@protoc_insertion_point(field_set:minidfs.Block.blockLen)
+}
+
+// .minidfs.ECSchema ecSchema = 3;
+inline bool Block::_internal_has_ecschema() const {
+  return this != internal_default_instance() && _impl_.ecschema_ != nullptr;
+}
+inline bool Block::has_ecschema() const {
+  return _internal_has_ecschema();
+}
+inline void Block::clear_ecschema() {
+  if (GetArenaForAllocation() == nullptr && _impl_.ecschema_ != nullptr) {
+    delete _impl_.ecschema_;
+  }
+  _impl_.ecschema_ = nullptr;
+}
+inline const ::minidfs::ECSchema& Block::_internal_ecschema() const {
+  const ::minidfs::ECSchema* p = _impl_.ecschema_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::ECSchema&>(
+      ::minidfs::_ECSchema_default_instance_);
+}
+inline const ::minidfs::ECSchema& Block::ecschema() const {
+  // @@protoc_insertion_point(field_get:minidfs.Block.ecSchema)
+  return _internal_ecschema();
+}
+inline void Block::unsafe_arena_set_allocated_ecschema(
+    ::minidfs::ECSchema* ecschema) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ecschema_);
+  }
+  _impl_.ecschema_ = ecschema;
+  if (ecschema) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.Block.ecSchema)
+}
+inline ::minidfs::ECSchema* Block::release_ecschema() {
+  
+  ::minidfs::ECSchema* temp = _impl_.ecschema_;
+  _impl_.ecschema_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::ECSchema* Block::unsafe_arena_release_ecschema() {
+  // @@protoc_insertion_point(field_release:minidfs.Block.ecSchema)
+  
+  ::minidfs::ECSchema* temp = _impl_.ecschema_;
+  _impl_.ecschema_ = nullptr;
+  return temp;
+}
+inline ::minidfs::ECSchema* Block::_internal_mutable_ecschema() {
+  
+  if (_impl_.ecschema_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::ECSchema>(GetArenaForAllocation());
+    _impl_.ecschema_ = p;
+  }
+  return _impl_.ecschema_;
+}
+inline ::minidfs::ECSchema* Block::mutable_ecschema() {
+  ::minidfs::ECSchema* _msg = _internal_mutable_ecschema();
+  // @@protoc_insertion_point(field_mutable:minidfs.Block.ecSchema)
+  return _msg;
+}
+inline void Block::set_allocated_ecschema(::minidfs::ECSchema* ecschema) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ecschema_;
+  }
+  if (ecschema) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ecschema);
+    if (message_arena != submessage_arena) {
+      ecschema = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ecschema, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.ecschema_ = ecschema;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.Block.ecSchema)
+}
+
+// int32 codec = 4;
+inline void Block::clear_codec() {
+  _impl_.codec_ = 0;
+}
+inline int32_t Block::_internal_codec() const {
+  return _impl_.codec_;
+}
+inline int32_t Block::codec() const {
+  // @@protoc_insertion_point(field_get:minidfs.Block.codec)
+  return _internal_codec();
+}
+inline void Block::_internal_set_codec(int32_t value) {
+  
+  _impl_.codec_ = value;
+}
+inline void Block::set_codec(int32_t value) {
+  _internal_set_codec(value);
+  // @@protoc_insertion_point(field_set:minidfs.Block.codec)
+}
+
+// .minidfs.Extent extent = 5;
+inline bool Block::_internal_has_extent() const {
+  return this != internal_default_instance() && _impl_.extent_ != nullptr;
+}
+inline bool Block::has_extent() const {
+  return _internal_has_extent();
+}
+inline void Block::clear_extent() {
+  if (GetArenaForAllocation() == nullptr && _impl_.extent_ != nullptr) {
+    delete _impl_.extent_;
+  }
+  _impl_.extent_ = nullptr;
+}
+inline const ::minidfs::Extent& Block::_internal_extent() const {
+  const ::minidfs::Extent* p = _impl_.extent_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::Extent&>(
+      ::minidfs::_Extent_default_instance_);
+}
+inline const ::minidfs::Extent& Block::extent() const {
+  // @@protoc_insertion_point(field_get:minidfs.Block.extent)
+  return _internal_extent();
+}
+inline void Block::unsafe_arena_set_allocated_extent(
+    ::minidfs::Extent* extent) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.extent_);
+  }
+  _impl_.extent_ = extent;
+  if (extent) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.Block.extent)
+}
+inline ::minidfs::Extent* Block::release_extent() {
+  
+  ::minidfs::Extent* temp = _impl_.extent_;
+  _impl_.extent_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::Extent* Block::unsafe_arena_release_extent() {
+  // @@protoc_insertion_point(field_release:minidfs.Block.extent)
+  
+  ::minidfs::Extent* temp = _impl_.extent_;
+  _impl_.extent_ = nullptr;
+  return temp;
+}
+inline ::minidfs::Extent* Block::_internal_mutable_extent() {
+  
+  if (_impl_.extent_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::Extent>(GetArenaForAllocation());
+    _impl_.extent_ = p;
+  }
+  return _impl_.extent_;
+}
+inline ::minidfs::Extent* Block::mutable_extent() {
+  ::minidfs::Extent* _msg = _internal_mutable_extent();
+  // @@protoc_insertion_point(field_mutable:minidfs.Block.extent)
+  return _msg;
+}
+inline void Block::set_allocated_extent(::minidfs::Extent* extent) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.extent_;
+  }
+  if (extent) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(extent);
+    if (message_arena != submessage_arena) {
+      extent = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, extent, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.extent_ = extent;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.Block.extent)
+}
+
+// -------------------------------------------------------------------
+
+// ChunkserverInfo
+
+// string chunkserverIP = 1;
+inline void ChunkserverInfo::clear_chunkserverip() {
+  _impl_.chunkserverip_.ClearToEmpty();
+}
+inline const std::string& ChunkserverInfo::chunkserverip() const {
+  // @@protoc_insertion_point(field_get:minidfs.ChunkserverInfo.chunkserverIP)
+  return _internal_chunkserverip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChunkserverInfo::set_chunkserverip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.chunkserverip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.ChunkserverInfo.chunkserverIP)
+}
+inline std::string* ChunkserverInfo::mutable_chunkserverip() {
+  std::string* _s = _internal_mutable_chunkserverip();
   // @@protoc_insertion_point(field_mutable:minidfs.ChunkserverInfo.chunkserverIP)
-  return chunkserverip_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _s;
+}
+inline const std::string& ChunkserverInfo::_internal_chunkserverip() const {
+  return _impl_.chunkserverip_.Get();
+}
+inline void ChunkserverInfo::_internal_set_chunkserverip(const std::string& value) {
+  
+  _impl_.chunkserverip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChunkserverInfo::_internal_mutable_chunkserverip() {
+  
+  return _impl_.chunkserverip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChunkserverInfo::release_chunkserverip() {
+  // @@protoc_insertion_point(field_release:minidfs.ChunkserverInfo.chunkserverIP)
+  return _impl_.chunkserverip_.Release();
+}
+inline void ChunkserverInfo::set_allocated_chunkserverip(std::string* chunkserverip) {
+  if (chunkserverip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.chunkserverip_.SetAllocated(chunkserverip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.chunkserverip_.IsDefault()) {
+    _impl_.chunkserverip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.ChunkserverInfo.chunkserverIP)
+}
+
+// int32 chunkserverPort = 2;
+inline void ChunkserverInfo::clear_chunkserverport() {
+  _impl_.chunkserverport_ = 0;
+}
+inline int32_t ChunkserverInfo::_internal_chunkserverport() const {
+  return _impl_.chunkserverport_;
+}
+inline int32_t ChunkserverInfo::chunkserverport() const {
+  // @@protoc_insertion_point(field_get:minidfs.ChunkserverInfo.chunkserverPort)
+  return _internal_chunkserverport();
+}
+inline void ChunkserverInfo::_internal_set_chunkserverport(int32_t value) {
+  
+  _impl_.chunkserverport_ = value;
+}
+inline void ChunkserverInfo::set_chunkserverport(int32_t value) {
+  _internal_set_chunkserverport(value);
+  // @@protoc_insertion_point(field_set:minidfs.ChunkserverInfo.chunkserverPort)
+}
+
+// -------------------------------------------------------------------
+
+// LocatedBlock
+
+// .minidfs.Block block = 1;
+inline bool LocatedBlock::_internal_has_block() const {
+  return this != internal_default_instance() && _impl_.block_ != nullptr;
+}
+inline bool LocatedBlock::has_block() const {
+  return _internal_has_block();
+}
+inline void LocatedBlock::clear_block() {
+  if (GetArenaForAllocation() == nullptr && _impl_.block_ != nullptr) {
+    delete _impl_.block_;
+  }
+  _impl_.block_ = nullptr;
+}
+inline const ::minidfs::Block& LocatedBlock::_internal_block() const {
+  const ::minidfs::Block* p = _impl_.block_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::Block&>(
+      ::minidfs::_Block_default_instance_);
+}
+inline const ::minidfs::Block& LocatedBlock::block() const {
+  // @@protoc_insertion_point(field_get:minidfs.LocatedBlock.block)
+  return _internal_block();
+}
+inline void LocatedBlock::unsafe_arena_set_allocated_block(
+    ::minidfs::Block* block) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.block_);
+  }
+  _impl_.block_ = block;
+  if (block) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.LocatedBlock.block)
+}
+inline ::minidfs::Block* LocatedBlock::release_block() {
+  
+  ::minidfs::Block* temp = _impl_.block_;
+  _impl_.block_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::Block* LocatedBlock::unsafe_arena_release_block() {
+  // @@protoc_insertion_point(field_release:minidfs.LocatedBlock.block)
+  
+  ::minidfs::Block* temp = _impl_.block_;
+  _impl_.block_ = nullptr;
+  return temp;
+}
+inline ::minidfs::Block* LocatedBlock::_internal_mutable_block() {
+  
+  if (_impl_.block_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::Block>(GetArenaForAllocation());
+    _impl_.block_ = p;
+  }
+  return _impl_.block_;
+}
+inline ::minidfs::Block* LocatedBlock::mutable_block() {
+  ::minidfs::Block* _msg = _internal_mutable_block();
+  // @@protoc_insertion_point(field_mutable:minidfs.LocatedBlock.block)
+  return _msg;
+}
+inline void LocatedBlock::set_allocated_block(::minidfs::Block* block) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.block_;
+  }
+  if (block) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(block);
+    if (message_arena != submessage_arena) {
+      block = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, block, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.block_ = block;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.LocatedBlock.block)
+}
+
+// repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
+inline int LocatedBlock::_internal_chunkserverinfos_size() const {
+  return _impl_.chunkserverinfos_.size();
+}
+inline int LocatedBlock::chunkserverinfos_size() const {
+  return _internal_chunkserverinfos_size();
+}
+inline void LocatedBlock::clear_chunkserverinfos() {
+  _impl_.chunkserverinfos_.Clear();
+}
+inline ::minidfs::ChunkserverInfo* LocatedBlock::mutable_chunkserverinfos(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.LocatedBlock.chunkserverInfos)
+  return _impl_.chunkserverinfos_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo >*
+LocatedBlock::mutable_chunkserverinfos() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.LocatedBlock.chunkserverInfos)
+  return &_impl_.chunkserverinfos_;
+}
+inline const ::minidfs::ChunkserverInfo& LocatedBlock::_internal_chunkserverinfos(int index) const {
+  return _impl_.chunkserverinfos_.Get(index);
+}
+inline const ::minidfs::ChunkserverInfo& LocatedBlock::chunkserverinfos(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.LocatedBlock.chunkserverInfos)
+  return _internal_chunkserverinfos(index);
+}
+inline ::minidfs::ChunkserverInfo* LocatedBlock::_internal_add_chunkserverinfos() {
+  return _impl_.chunkserverinfos_.Add();
+}
+inline ::minidfs::ChunkserverInfo* LocatedBlock::add_chunkserverinfos() {
+  ::minidfs::ChunkserverInfo* _add = _internal_add_chunkserverinfos();
+  // @@protoc_insertion_point(field_add:minidfs.LocatedBlock.chunkserverInfos)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo >&
+LocatedBlock::chunkserverinfos() const {
+  // @@protoc_insertion_point(field_list:minidfs.LocatedBlock.chunkserverInfos)
+  return _impl_.chunkserverinfos_;
+}
+
+// -------------------------------------------------------------------
+
+// ECFile
+
+// string name = 1;
+inline void ECFile::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& ECFile::name() const {
+  // @@protoc_insertion_point(field_get:minidfs.ECFile.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ECFile::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.ECFile.name)
+}
+inline std::string* ECFile::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:minidfs.ECFile.name)
+  return _s;
+}
+inline const std::string& ECFile::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void ECFile::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ECFile::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ECFile::release_name() {
+  // @@protoc_insertion_point(field_release:minidfs.ECFile.name)
+  return _impl_.name_.Release();
+}
+inline void ECFile::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.ECFile.name)
+}
+
+// .minidfs.ECSchema ecSchema = 2;
+inline bool ECFile::_internal_has_ecschema() const {
+  return this != internal_default_instance() && _impl_.ecschema_ != nullptr;
+}
+inline bool ECFile::has_ecschema() const {
+  return _internal_has_ecschema();
+}
+inline void ECFile::clear_ecschema() {
+  if (GetArenaForAllocation() == nullptr && _impl_.ecschema_ != nullptr) {
+    delete _impl_.ecschema_;
+  }
+  _impl_.ecschema_ = nullptr;
+}
+inline const ::minidfs::ECSchema& ECFile::_internal_ecschema() const {
+  const ::minidfs::ECSchema* p = _impl_.ecschema_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::ECSchema&>(
+      ::minidfs::_ECSchema_default_instance_);
+}
+inline const ::minidfs::ECSchema& ECFile::ecschema() const {
+  // @@protoc_insertion_point(field_get:minidfs.ECFile.ecSchema)
+  return _internal_ecschema();
+}
+inline void ECFile::unsafe_arena_set_allocated_ecschema(
+    ::minidfs::ECSchema* ecschema) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ecschema_);
+  }
+  _impl_.ecschema_ = ecschema;
+  if (ecschema) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.ECFile.ecSchema)
+}
+inline ::minidfs::ECSchema* ECFile::release_ecschema() {
+  
+  ::minidfs::ECSchema* temp = _impl_.ecschema_;
+  _impl_.ecschema_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::ECSchema* ECFile::unsafe_arena_release_ecschema() {
+  // @@protoc_insertion_point(field_release:minidfs.ECFile.ecSchema)
+  
+  ::minidfs::ECSchema* temp = _impl_.ecschema_;
+  _impl_.ecschema_ = nullptr;
+  return temp;
+}
+inline ::minidfs::ECSchema* ECFile::_internal_mutable_ecschema() {
+  
+  if (_impl_.ecschema_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::ECSchema>(GetArenaForAllocation());
+    _impl_.ecschema_ = p;
+  }
+  return _impl_.ecschema_;
+}
+inline ::minidfs::ECSchema* ECFile::mutable_ecschema() {
+  ::minidfs::ECSchema* _msg = _internal_mutable_ecschema();
+  // @@protoc_insertion_point(field_mutable:minidfs.ECFile.ecSchema)
+  return _msg;
+}
+inline void ECFile::set_allocated_ecschema(::minidfs::ECSchema* ecschema) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ecschema_;
+  }
+  if (ecschema) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ecschema);
+    if (message_arena != submessage_arena) {
+      ecschema = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ecschema, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.ecschema_ = ecschema;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.ECFile.ecSchema)
+}
+
+// -------------------------------------------------------------------
+
+// PackedFile
+
+// string name = 1;
+inline void PackedFile::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PackedFile::name() const {
+  // @@protoc_insertion_point(field_get:minidfs.PackedFile.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PackedFile::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.PackedFile.name)
+}
+inline std::string* PackedFile::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:minidfs.PackedFile.name)
+  return _s;
+}
+inline const std::string& PackedFile::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PackedFile::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PackedFile::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PackedFile::release_name() {
+  // @@protoc_insertion_point(field_release:minidfs.PackedFile.name)
+  return _impl_.name_.Release();
+}
+inline void PackedFile::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.PackedFile.name)
+}
+
+// int64 len = 2;
+inline void PackedFile::clear_len() {
+  _impl_.len_ = int64_t{0};
+}
+inline int64_t PackedFile::_internal_len() const {
+  return _impl_.len_;
+}
+inline int64_t PackedFile::len() const {
+  // @@protoc_insertion_point(field_get:minidfs.PackedFile.len)
+  return _internal_len();
+}
+inline void PackedFile::_internal_set_len(int64_t value) {
+  
+  _impl_.len_ = value;
+}
+inline void PackedFile::set_len(int64_t value) {
+  _internal_set_len(value);
+  // @@protoc_insertion_point(field_set:minidfs.PackedFile.len)
+}
+
+// -------------------------------------------------------------------
+
+// Pack
+
+// repeated .minidfs.PackedFile files = 1;
+inline int Pack::_internal_files_size() const {
+  return _impl_.files_.size();
+}
+inline int Pack::files_size() const {
+  return _internal_files_size();
+}
+inline void Pack::clear_files() {
+  _impl_.files_.Clear();
+}
+inline ::minidfs::PackedFile* Pack::mutable_files(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.Pack.files)
+  return _impl_.files_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::PackedFile >*
+Pack::mutable_files() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.Pack.files)
+  return &_impl_.files_;
+}
+inline const ::minidfs::PackedFile& Pack::_internal_files(int index) const {
+  return _impl_.files_.Get(index);
+}
+inline const ::minidfs::PackedFile& Pack::files(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.Pack.files)
+  return _internal_files(index);
+}
+inline ::minidfs::PackedFile* Pack::_internal_add_files() {
+  return _impl_.files_.Add();
+}
+inline ::minidfs::PackedFile* Pack::add_files() {
+  ::minidfs::PackedFile* _add = _internal_add_files();
+  // @@protoc_insertion_point(field_add:minidfs.Pack.files)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::PackedFile >&
+Pack::files() const {
+  // @@protoc_insertion_point(field_list:minidfs.Pack.files)
+  return _impl_.files_;
+}
+
+// .minidfs.LocatedBlock container = 2;
+inline bool Pack::_internal_has_container() const {
+  return this != internal_default_instance() && _impl_.container_ != nullptr;
+}
+inline bool Pack::has_container() const {
+  return _internal_has_container();
+}
+inline void Pack::clear_container() {
+  if (GetArenaForAllocation() == nullptr && _impl_.container_ != nullptr) {
+    delete _impl_.container_;
+  }
+  _impl_.container_ = nullptr;
+}
+inline const ::minidfs::LocatedBlock& Pack::_internal_container() const {
+  const ::minidfs::LocatedBlock* p = _impl_.container_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::LocatedBlock&>(
+      ::minidfs::_LocatedBlock_default_instance_);
+}
+inline const ::minidfs::LocatedBlock& Pack::container() const {
+  // @@protoc_insertion_point(field_get:minidfs.Pack.container)
+  return _internal_container();
+}
+inline void Pack::unsafe_arena_set_allocated_container(
+    ::minidfs::LocatedBlock* container) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.container_);
+  }
+  _impl_.container_ = container;
+  if (container) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.Pack.container)
+}
+inline ::minidfs::LocatedBlock* Pack::release_container() {
+  
+  ::minidfs::LocatedBlock* temp = _impl_.container_;
+  _impl_.container_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::LocatedBlock* Pack::unsafe_arena_release_container() {
+  // @@protoc_insertion_point(field_release:minidfs.Pack.container)
+  
+  ::minidfs::LocatedBlock* temp = _impl_.container_;
+  _impl_.container_ = nullptr;
+  return temp;
+}
+inline ::minidfs::LocatedBlock* Pack::_internal_mutable_container() {
+  
+  if (_impl_.container_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::LocatedBlock>(GetArenaForAllocation());
+    _impl_.container_ = p;
+  }
+  return _impl_.container_;
+}
+inline ::minidfs::LocatedBlock* Pack::mutable_container() {
+  ::minidfs::LocatedBlock* _msg = _internal_mutable_container();
+  // @@protoc_insertion_point(field_mutable:minidfs.Pack.container)
+  return _msg;
+}
+inline void Pack::set_allocated_container(::minidfs::LocatedBlock* container) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.container_;
+  }
+  if (container) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(container);
+    if (message_arena != submessage_arena) {
+      container = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, container, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.container_ = container;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.Pack.container)
+}
+
+// -------------------------------------------------------------------
+
+// InlineFile
+
+// string name = 1;
+inline void InlineFile::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& InlineFile::name() const {
+  // @@protoc_insertion_point(field_get:minidfs.InlineFile.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InlineFile::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.InlineFile.name)
+}
+inline std::string* InlineFile::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:minidfs.InlineFile.name)
+  return _s;
+}
+inline const std::string& InlineFile::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void InlineFile::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InlineFile::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InlineFile::release_name() {
+  // @@protoc_insertion_point(field_release:minidfs.InlineFile.name)
+  return _impl_.name_.Release();
+}
+inline void InlineFile::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.InlineFile.name)
+}
+
+// bytes data = 2;
+inline void InlineFile::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& InlineFile::data() const {
+  // @@protoc_insertion_point(field_get:minidfs.InlineFile.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InlineFile::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.InlineFile.data)
+}
+inline std::string* InlineFile::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:minidfs.InlineFile.data)
+  return _s;
+}
+inline const std::string& InlineFile::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void InlineFile::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InlineFile::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InlineFile::release_data() {
+  // @@protoc_insertion_point(field_release:minidfs.InlineFile.data)
+  return _impl_.data_.Release();
+}
+inline void InlineFile::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.InlineFile.data)
+}
+
+// -------------------------------------------------------------------
+
+// LocatedBlocks
+
+// repeated .minidfs.LocatedBlock locatedBlks = 1;
+inline int LocatedBlocks::_internal_locatedblks_size() const {
+  return _impl_.locatedblks_.size();
+}
+inline int LocatedBlocks::locatedblks_size() const {
+  return _internal_locatedblks_size();
+}
+inline void LocatedBlocks::clear_locatedblks() {
+  _impl_.locatedblks_.Clear();
+}
+inline ::minidfs::LocatedBlock* LocatedBlocks::mutable_locatedblks(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.LocatedBlocks.locatedBlks)
+  return _impl_.locatedblks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock >*
+LocatedBlocks::mutable_locatedblks() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.LocatedBlocks.locatedBlks)
+  return &_impl_.locatedblks_;
+}
+inline const ::minidfs::LocatedBlock& LocatedBlocks::_internal_locatedblks(int index) const {
+  return _impl_.locatedblks_.Get(index);
+}
+inline const ::minidfs::LocatedBlock& LocatedBlocks::locatedblks(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.LocatedBlocks.locatedBlks)
+  return _internal_locatedblks(index);
+}
+inline ::minidfs::LocatedBlock* LocatedBlocks::_internal_add_locatedblks() {
+  return _impl_.locatedblks_.Add();
+}
+inline ::minidfs::LocatedBlock* LocatedBlocks::add_locatedblks() {
+  ::minidfs::LocatedBlock* _add = _internal_add_locatedblks();
+  // @@protoc_insertion_point(field_add:minidfs.LocatedBlocks.locatedBlks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock >&
+LocatedBlocks::locatedblks() const {
+  // @@protoc_insertion_point(field_list:minidfs.LocatedBlocks.locatedBlks)
+  return _impl_.locatedblks_;
+}
+
+// bytes inlineData = 2;
+inline void LocatedBlocks::clear_inlinedata() {
+  _impl_.inlinedata_.ClearToEmpty();
+}
+inline const std::string& LocatedBlocks::inlinedata() const {
+  // @@protoc_insertion_point(field_get:minidfs.LocatedBlocks.inlineData)
+  return _internal_inlinedata();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LocatedBlocks::set_inlinedata(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.inlinedata_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.LocatedBlocks.inlineData)
+}
+inline std::string* LocatedBlocks::mutable_inlinedata() {
+  std::string* _s = _internal_mutable_inlinedata();
+  // @@protoc_insertion_point(field_mutable:minidfs.LocatedBlocks.inlineData)
+  return _s;
+}
+inline const std::string& LocatedBlocks::_internal_inlinedata() const {
+  return _impl_.inlinedata_.Get();
+}
+inline void LocatedBlocks::_internal_set_inlinedata(const std::string& value) {
+  
+  _impl_.inlinedata_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LocatedBlocks::_internal_mutable_inlinedata() {
+  
+  return _impl_.inlinedata_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LocatedBlocks::release_inlinedata() {
+  // @@protoc_insertion_point(field_release:minidfs.LocatedBlocks.inlineData)
+  return _impl_.inlinedata_.Release();
+}
+inline void LocatedBlocks::set_allocated_inlinedata(std::string* inlinedata) {
+  if (inlinedata != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.inlinedata_.SetAllocated(inlinedata, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.inlinedata_.IsDefault()) {
+    _impl_.inlinedata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.LocatedBlocks.inlineData)
+}
+
+// -------------------------------------------------------------------
+
+// BlkIDs
+
+// repeated int32 blkIDs = 1;
+inline int BlkIDs::_internal_blkids_size() const {
+  return _impl_.blkids_.size();
+}
+inline int BlkIDs::blkids_size() const {
+  return _internal_blkids_size();
+}
+inline void BlkIDs::clear_blkids() {
+  _impl_.blkids_.Clear();
+}
+inline int32_t BlkIDs::_internal_blkids(int index) const {
+  return _impl_.blkids_.Get(index);
+}
+inline int32_t BlkIDs::blkids(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.BlkIDs.blkIDs)
+  return _internal_blkids(index);
+}
+inline void BlkIDs::set_blkids(int index, int32_t value) {
+  _impl_.blkids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:minidfs.BlkIDs.blkIDs)
+}
+inline void BlkIDs::_internal_add_blkids(int32_t value) {
+  _impl_.blkids_.Add(value);
+}
+inline void BlkIDs::add_blkids(int32_t value) {
+  _internal_add_blkids(value);
+  // @@protoc_insertion_point(field_add:minidfs.BlkIDs.blkIDs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+BlkIDs::_internal_blkids() const {
+  return _impl_.blkids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+BlkIDs::blkids() const {
+  // @@protoc_insertion_point(field_list:minidfs.BlkIDs.blkIDs)
+  return _internal_blkids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+BlkIDs::_internal_mutable_blkids() {
+  return &_impl_.blkids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+BlkIDs::mutable_blkids() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.BlkIDs.blkIDs)
+  return _internal_mutable_blkids();
+}
+
+// -------------------------------------------------------------------
+
+// BlockReport
+
+// .minidfs.ChunkserverInfo chunkserverInfo = 1;
+inline bool BlockReport::_internal_has_chunkserverinfo() const {
+  return this != internal_default_instance() && _impl_.chunkserverinfo_ != nullptr;
+}
+inline bool BlockReport::has_chunkserverinfo() const {
+  return _internal_has_chunkserverinfo();
+}
+inline void BlockReport::clear_chunkserverinfo() {
+  if (GetArenaForAllocation() == nullptr && _impl_.chunkserverinfo_ != nullptr) {
+    delete _impl_.chunkserverinfo_;
+  }
+  _impl_.chunkserverinfo_ = nullptr;
+}
+inline const ::minidfs::ChunkserverInfo& BlockReport::_internal_chunkserverinfo() const {
+  const ::minidfs::ChunkserverInfo* p = _impl_.chunkserverinfo_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::ChunkserverInfo&>(
+      ::minidfs::_ChunkserverInfo_default_instance_);
+}
+inline const ::minidfs::ChunkserverInfo& BlockReport::chunkserverinfo() const {
+  // @@protoc_insertion_point(field_get:minidfs.BlockReport.chunkserverInfo)
+  return _internal_chunkserverinfo();
+}
+inline void BlockReport::unsafe_arena_set_allocated_chunkserverinfo(
+    ::minidfs::ChunkserverInfo* chunkserverinfo) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.chunkserverinfo_);
+  }
+  _impl_.chunkserverinfo_ = chunkserverinfo;
+  if (chunkserverinfo) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.BlockReport.chunkserverInfo)
+}
+inline ::minidfs::ChunkserverInfo* BlockReport::release_chunkserverinfo() {
+  
+  ::minidfs::ChunkserverInfo* temp = _impl_.chunkserverinfo_;
+  _impl_.chunkserverinfo_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::ChunkserverInfo* BlockReport::unsafe_arena_release_chunkserverinfo() {
+  // @@protoc_insertion_point(field_release:minidfs.BlockReport.chunkserverInfo)
+  
+  ::minidfs::ChunkserverInfo* temp = _impl_.chunkserverinfo_;
+  _impl_.chunkserverinfo_ = nullptr;
+  return temp;
+}
+inline ::minidfs::ChunkserverInfo* BlockReport::_internal_mutable_chunkserverinfo() {
+  
+  if (_impl_.chunkserverinfo_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::ChunkserverInfo>(GetArenaForAllocation());
+    _impl_.chunkserverinfo_ = p;
+  }
+  return _impl_.chunkserverinfo_;
+}
+inline ::minidfs::ChunkserverInfo* BlockReport::mutable_chunkserverinfo() {
+  ::minidfs::ChunkserverInfo* _msg = _internal_mutable_chunkserverinfo();
+  // @@protoc_insertion_point(field_mutable:minidfs.BlockReport.chunkserverInfo)
+  return _msg;
+}
+inline void BlockReport::set_allocated_chunkserverinfo(::minidfs::ChunkserverInfo* chunkserverinfo) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.chunkserverinfo_;
+  }
+  if (chunkserverinfo) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chunkserverinfo);
+    if (message_arena != submessage_arena) {
+      chunkserverinfo = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, chunkserverinfo, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.chunkserverinfo_ = chunkserverinfo;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.BlockReport.chunkserverInfo)
+}
+
+// repeated int32 blkIDs = 2;
+inline int BlockReport::_internal_blkids_size() const {
+  return _impl_.blkids_.size();
+}
+inline int BlockReport::blkids_size() const {
+  return _internal_blkids_size();
+}
+inline void BlockReport::clear_blkids() {
+  _impl_.blkids_.Clear();
+}
+inline int32_t BlockReport::_internal_blkids(int index) const {
+  return _impl_.blkids_.Get(index);
+}
+inline int32_t BlockReport::blkids(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.BlockReport.blkIDs)
+  return _internal_blkids(index);
+}
+inline void BlockReport::set_blkids(int index, int32_t value) {
+  _impl_.blkids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:minidfs.BlockReport.blkIDs)
+}
+inline void BlockReport::_internal_add_blkids(int32_t value) {
+  _impl_.blkids_.Add(value);
+}
+inline void BlockReport::add_blkids(int32_t value) {
+  _internal_add_blkids(value);
+  // @@protoc_insertion_point(field_add:minidfs.BlockReport.blkIDs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+BlockReport::_internal_blkids() const {
+  return _impl_.blkids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+BlockReport::blkids() const {
+  // @@protoc_insertion_point(field_list:minidfs.BlockReport.blkIDs)
+  return _internal_blkids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+BlockReport::_internal_mutable_blkids() {
+  return &_impl_.blkids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+BlockReport::mutable_blkids() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.BlockReport.blkIDs)
+  return _internal_mutable_blkids();
+}
+
+// bytes encodedBlkIDs = 3;
+inline void BlockReport::clear_encodedblkids() {
+  _impl_.encodedblkids_.ClearToEmpty();
+}
+inline const std::string& BlockReport::encodedblkids() const {
+  // @@protoc_insertion_point(field_get:minidfs.BlockReport.encodedBlkIDs)
+  return _internal_encodedblkids();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BlockReport::set_encodedblkids(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.encodedblkids_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.BlockReport.encodedBlkIDs)
+}
+inline std::string* BlockReport::mutable_encodedblkids() {
+  std::string* _s = _internal_mutable_encodedblkids();
+  // @@protoc_insertion_point(field_mutable:minidfs.BlockReport.encodedBlkIDs)
+  return _s;
+}
+inline const std::string& BlockReport::_internal_encodedblkids() const {
+  return _impl_.encodedblkids_.Get();
+}
+inline void BlockReport::_internal_set_encodedblkids(const std::string& value) {
+  
+  _impl_.encodedblkids_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BlockReport::_internal_mutable_encodedblkids() {
+  
+  return _impl_.encodedblkids_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BlockReport::release_encodedblkids() {
+  // @@protoc_insertion_point(field_release:minidfs.BlockReport.encodedBlkIDs)
+  return _impl_.encodedblkids_.Release();
+}
+inline void BlockReport::set_allocated_encodedblkids(std::string* encodedblkids) {
+  if (encodedblkids != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.encodedblkids_.SetAllocated(encodedblkids, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.encodedblkids_.IsDefault()) {
+    _impl_.encodedblkids_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.BlockReport.encodedBlkIDs)
+}
+
+// -------------------------------------------------------------------
+
+// VolumeInfo
+
+// string dir = 1;
+inline void VolumeInfo::clear_dir() {
+  _impl_.dir_.ClearToEmpty();
+}
+inline const std::string& VolumeInfo::dir() const {
+  // @@protoc_insertion_point(field_get:minidfs.VolumeInfo.dir)
+  return _internal_dir();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VolumeInfo::set_dir(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.dir_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.VolumeInfo.dir)
+}
+inline std::string* VolumeInfo::mutable_dir() {
+  std::string* _s = _internal_mutable_dir();
+  // @@protoc_insertion_point(field_mutable:minidfs.VolumeInfo.dir)
+  return _s;
+}
+inline const std::string& VolumeInfo::_internal_dir() const {
+  return _impl_.dir_.Get();
+}
+inline void VolumeInfo::_internal_set_dir(const std::string& value) {
+  
+  _impl_.dir_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VolumeInfo::_internal_mutable_dir() {
+  
+  return _impl_.dir_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VolumeInfo::release_dir() {
+  // @@protoc_insertion_point(field_release:minidfs.VolumeInfo.dir)
+  return _impl_.dir_.Release();
+}
+inline void VolumeInfo::set_allocated_dir(std::string* dir) {
+  if (dir != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.dir_.SetAllocated(dir, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.dir_.IsDefault()) {
+    _impl_.dir_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.VolumeInfo.dir)
+}
+
+// int64 capacity = 2;
+inline void VolumeInfo::clear_capacity() {
+  _impl_.capacity_ = int64_t{0};
+}
+inline int64_t VolumeInfo::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline int64_t VolumeInfo::capacity() const {
+  // @@protoc_insertion_point(field_get:minidfs.VolumeInfo.capacity)
+  return _internal_capacity();
+}
+inline void VolumeInfo::_internal_set_capacity(int64_t value) {
+  
+  _impl_.capacity_ = value;
+}
+inline void VolumeInfo::set_capacity(int64_t value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:minidfs.VolumeInfo.capacity)
+}
+
+// int64 available = 3;
+inline void VolumeInfo::clear_available() {
+  _impl_.available_ = int64_t{0};
+}
+inline int64_t VolumeInfo::_internal_available() const {
+  return _impl_.available_;
+}
+inline int64_t VolumeInfo::available() const {
+  // @@protoc_insertion_point(field_get:minidfs.VolumeInfo.available)
+  return _internal_available();
+}
+inline void VolumeInfo::_internal_set_available(int64_t value) {
+  
+  _impl_.available_ = value;
+}
+inline void VolumeInfo::set_available(int64_t value) {
+  _internal_set_available(value);
+  // @@protoc_insertion_point(field_set:minidfs.VolumeInfo.available)
+}
+
+// int32 nPendingIO = 4;
+inline void VolumeInfo::clear_npendingio() {
+  _impl_.npendingio_ = 0;
+}
+inline int32_t VolumeInfo::_internal_npendingio() const {
+  return _impl_.npendingio_;
+}
+inline int32_t VolumeInfo::npendingio() const {
+  // @@protoc_insertion_point(field_get:minidfs.VolumeInfo.nPendingIO)
+  return _internal_npendingio();
+}
+inline void VolumeInfo::_internal_set_npendingio(int32_t value) {
+  
+  _impl_.npendingio_ = value;
+}
+inline void VolumeInfo::set_npendingio(int32_t value) {
+  _internal_set_npendingio(value);
+  // @@protoc_insertion_point(field_set:minidfs.VolumeInfo.nPendingIO)
+}
+
+// -------------------------------------------------------------------
+
+// Heartbeat
+
+// .minidfs.ChunkserverInfo chunkserverInfo = 1;
+inline bool Heartbeat::_internal_has_chunkserverinfo() const {
+  return this != internal_default_instance() && _impl_.chunkserverinfo_ != nullptr;
+}
+inline bool Heartbeat::has_chunkserverinfo() const {
+  return _internal_has_chunkserverinfo();
+}
+inline void Heartbeat::clear_chunkserverinfo() {
+  if (GetArenaForAllocation() == nullptr && _impl_.chunkserverinfo_ != nullptr) {
+    delete _impl_.chunkserverinfo_;
+  }
+  _impl_.chunkserverinfo_ = nullptr;
+}
+inline const ::minidfs::ChunkserverInfo& Heartbeat::_internal_chunkserverinfo() const {
+  const ::minidfs::ChunkserverInfo* p = _impl_.chunkserverinfo_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::ChunkserverInfo&>(
+      ::minidfs::_ChunkserverInfo_default_instance_);
+}
+inline const ::minidfs::ChunkserverInfo& Heartbeat::chunkserverinfo() const {
+  // @@protoc_insertion_point(field_get:minidfs.Heartbeat.chunkserverInfo)
+  return _internal_chunkserverinfo();
+}
+inline void Heartbeat::unsafe_arena_set_allocated_chunkserverinfo(
+    ::minidfs::ChunkserverInfo* chunkserverinfo) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.chunkserverinfo_);
+  }
+  _impl_.chunkserverinfo_ = chunkserverinfo;
+  if (chunkserverinfo) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.Heartbeat.chunkserverInfo)
+}
+inline ::minidfs::ChunkserverInfo* Heartbeat::release_chunkserverinfo() {
+  
+  ::minidfs::ChunkserverInfo* temp = _impl_.chunkserverinfo_;
+  _impl_.chunkserverinfo_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::ChunkserverInfo* Heartbeat::unsafe_arena_release_chunkserverinfo() {
+  // @@protoc_insertion_point(field_release:minidfs.Heartbeat.chunkserverInfo)
+  
+  ::minidfs::ChunkserverInfo* temp = _impl_.chunkserverinfo_;
+  _impl_.chunkserverinfo_ = nullptr;
+  return temp;
+}
+inline ::minidfs::ChunkserverInfo* Heartbeat::_internal_mutable_chunkserverinfo() {
+  
+  if (_impl_.chunkserverinfo_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::ChunkserverInfo>(GetArenaForAllocation());
+    _impl_.chunkserverinfo_ = p;
+  }
+  return _impl_.chunkserverinfo_;
+}
+inline ::minidfs::ChunkserverInfo* Heartbeat::mutable_chunkserverinfo() {
+  ::minidfs::ChunkserverInfo* _msg = _internal_mutable_chunkserverinfo();
+  // @@protoc_insertion_point(field_mutable:minidfs.Heartbeat.chunkserverInfo)
+  return _msg;
+}
+inline void Heartbeat::set_allocated_chunkserverinfo(::minidfs::ChunkserverInfo* chunkserverinfo) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.chunkserverinfo_;
+  }
+  if (chunkserverinfo) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chunkserverinfo);
+    if (message_arena != submessage_arena) {
+      chunkserverinfo = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, chunkserverinfo, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.chunkserverinfo_ = chunkserverinfo;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.Heartbeat.chunkserverInfo)
+}
+
+// int32 nActiveXfers = 2;
+inline void Heartbeat::clear_nactivexfers() {
+  _impl_.nactivexfers_ = 0;
+}
+inline int32_t Heartbeat::_internal_nactivexfers() const {
+  return _impl_.nactivexfers_;
+}
+inline int32_t Heartbeat::nactivexfers() const {
+  // @@protoc_insertion_point(field_get:minidfs.Heartbeat.nActiveXfers)
+  return _internal_nactivexfers();
+}
+inline void Heartbeat::_internal_set_nactivexfers(int32_t value) {
+  
+  _impl_.nactivexfers_ = value;
+}
+inline void Heartbeat::set_nactivexfers(int32_t value) {
+  _internal_set_nactivexfers(value);
+  // @@protoc_insertion_point(field_set:minidfs.Heartbeat.nActiveXfers)
+}
+
+// repeated int32 recvedBlkIDs = 3;
+inline int Heartbeat::_internal_recvedblkids_size() const {
+  return _impl_.recvedblkids_.size();
+}
+inline int Heartbeat::recvedblkids_size() const {
+  return _internal_recvedblkids_size();
+}
+inline void Heartbeat::clear_recvedblkids() {
+  _impl_.recvedblkids_.Clear();
+}
+inline int32_t Heartbeat::_internal_recvedblkids(int index) const {
+  return _impl_.recvedblkids_.Get(index);
+}
+inline int32_t Heartbeat::recvedblkids(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.Heartbeat.recvedBlkIDs)
+  return _internal_recvedblkids(index);
+}
+inline void Heartbeat::set_recvedblkids(int index, int32_t value) {
+  _impl_.recvedblkids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:minidfs.Heartbeat.recvedBlkIDs)
+}
+inline void Heartbeat::_internal_add_recvedblkids(int32_t value) {
+  _impl_.recvedblkids_.Add(value);
+}
+inline void Heartbeat::add_recvedblkids(int32_t value) {
+  _internal_add_recvedblkids(value);
+  // @@protoc_insertion_point(field_add:minidfs.Heartbeat.recvedBlkIDs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Heartbeat::_internal_recvedblkids() const {
+  return _impl_.recvedblkids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Heartbeat::recvedblkids() const {
+  // @@protoc_insertion_point(field_list:minidfs.Heartbeat.recvedBlkIDs)
+  return _internal_recvedblkids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Heartbeat::_internal_mutable_recvedblkids() {
+  return &_impl_.recvedblkids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Heartbeat::mutable_recvedblkids() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.Heartbeat.recvedBlkIDs)
+  return _internal_mutable_recvedblkids();
+}
+
+// bool acceptBlkTasks = 4;
+inline void Heartbeat::clear_acceptblktasks() {
+  _impl_.acceptblktasks_ = false;
+}
+inline bool Heartbeat::_internal_acceptblktasks() const {
+  return _impl_.acceptblktasks_;
+}
+inline bool Heartbeat::acceptblktasks() const {
+  // @@protoc_insertion_point(field_get:minidfs.Heartbeat.acceptBlkTasks)
+  return _internal_acceptblktasks();
+}
+inline void Heartbeat::_internal_set_acceptblktasks(bool value) {
+  
+  _impl_.acceptblktasks_ = value;
+}
+inline void Heartbeat::set_acceptblktasks(bool value) {
+  _internal_set_acceptblktasks(value);
+  // @@protoc_insertion_point(field_set:minidfs.Heartbeat.acceptBlkTasks)
+}
+
+// repeated int32 failedBlkIDs = 5;
+inline int Heartbeat::_internal_failedblkids_size() const {
+  return _impl_.failedblkids_.size();
+}
+inline int Heartbeat::failedblkids_size() const {
+  return _internal_failedblkids_size();
+}
+inline void Heartbeat::clear_failedblkids() {
+  _impl_.failedblkids_.Clear();
+}
+inline int32_t Heartbeat::_internal_failedblkids(int index) const {
+  return _impl_.failedblkids_.Get(index);
+}
+inline int32_t Heartbeat::failedblkids(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.Heartbeat.failedBlkIDs)
+  return _internal_failedblkids(index);
+}
+inline void Heartbeat::set_failedblkids(int index, int32_t value) {
+  _impl_.failedblkids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:minidfs.Heartbeat.failedBlkIDs)
+}
+inline void Heartbeat::_internal_add_failedblkids(int32_t value) {
+  _impl_.failedblkids_.Add(value);
+}
+inline void Heartbeat::add_failedblkids(int32_t value) {
+  _internal_add_failedblkids(value);
+  // @@protoc_insertion_point(field_add:minidfs.Heartbeat.failedBlkIDs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Heartbeat::_internal_failedblkids() const {
+  return _impl_.failedblkids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Heartbeat::failedblkids() const {
+  // @@protoc_insertion_point(field_list:minidfs.Heartbeat.failedBlkIDs)
+  return _internal_failedblkids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Heartbeat::_internal_mutable_failedblkids() {
+  return &_impl_.failedblkids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Heartbeat::mutable_failedblkids() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.Heartbeat.failedBlkIDs)
+  return _internal_mutable_failedblkids();
+}
+
+// repeated int32 corruptBlkIDs = 6;
+inline int Heartbeat::_internal_corruptblkids_size() const {
+  return _impl_.corruptblkids_.size();
+}
+inline int Heartbeat::corruptblkids_size() const {
+  return _internal_corruptblkids_size();
+}
+inline void Heartbeat::clear_corruptblkids() {
+  _impl_.corruptblkids_.Clear();
+}
+inline int32_t Heartbeat::_internal_corruptblkids(int index) const {
+  return _impl_.corruptblkids_.Get(index);
+}
+inline int32_t Heartbeat::corruptblkids(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.Heartbeat.corruptBlkIDs)
+  return _internal_corruptblkids(index);
+}
+inline void Heartbeat::set_corruptblkids(int index, int32_t value) {
+  _impl_.corruptblkids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:minidfs.Heartbeat.corruptBlkIDs)
+}
+inline void Heartbeat::_internal_add_corruptblkids(int32_t value) {
+  _impl_.corruptblkids_.Add(value);
+}
+inline void Heartbeat::add_corruptblkids(int32_t value) {
+  _internal_add_corruptblkids(value);
+  // @@protoc_insertion_point(field_add:minidfs.Heartbeat.corruptBlkIDs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Heartbeat::_internal_corruptblkids() const {
+  return _impl_.corruptblkids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Heartbeat::corruptblkids() const {
+  // @@protoc_insertion_point(field_list:minidfs.Heartbeat.corruptBlkIDs)
+  return _internal_corruptblkids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Heartbeat::_internal_mutable_corruptblkids() {
+  return &_impl_.corruptblkids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Heartbeat::mutable_corruptblkids() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.Heartbeat.corruptBlkIDs)
+  return _internal_mutable_corruptblkids();
+}
+
+// repeated .minidfs.VolumeInfo volumes = 7;
+inline int Heartbeat::_internal_volumes_size() const {
+  return _impl_.volumes_.size();
+}
+inline int Heartbeat::volumes_size() const {
+  return _internal_volumes_size();
+}
+inline void Heartbeat::clear_volumes() {
+  _impl_.volumes_.Clear();
+}
+inline ::minidfs::VolumeInfo* Heartbeat::mutable_volumes(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.Heartbeat.volumes)
+  return _impl_.volumes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::VolumeInfo >*
+Heartbeat::mutable_volumes() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.Heartbeat.volumes)
+  return &_impl_.volumes_;
+}
+inline const ::minidfs::VolumeInfo& Heartbeat::_internal_volumes(int index) const {
+  return _impl_.volumes_.Get(index);
+}
+inline const ::minidfs::VolumeInfo& Heartbeat::volumes(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.Heartbeat.volumes)
+  return _internal_volumes(index);
+}
+inline ::minidfs::VolumeInfo* Heartbeat::_internal_add_volumes() {
+  return _impl_.volumes_.Add();
+}
+inline ::minidfs::VolumeInfo* Heartbeat::add_volumes() {
+  ::minidfs::VolumeInfo* _add = _internal_add_volumes();
+  // @@protoc_insertion_point(field_add:minidfs.Heartbeat.volumes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::VolumeInfo >&
+Heartbeat::volumes() const {
+  // @@protoc_insertion_point(field_list:minidfs.Heartbeat.volumes)
+  return _impl_.volumes_;
+}
+
+// -------------------------------------------------------------------
+
+// BlockTask
+
+// int32 operation = 1;
+inline void BlockTask::clear_operation() {
+  _impl_.operation_ = 0;
+}
+inline int32_t BlockTask::_internal_operation() const {
+  return _impl_.operation_;
+}
+inline int32_t BlockTask::operation() const {
+  // @@protoc_insertion_point(field_get:minidfs.BlockTask.operation)
+  return _internal_operation();
+}
+inline void BlockTask::_internal_set_operation(int32_t value) {
+  
+  _impl_.operation_ = value;
+}
+inline void BlockTask::set_operation(int32_t value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:minidfs.BlockTask.operation)
+}
+
+// .minidfs.LocatedBlock locatedBlk = 2;
+inline bool BlockTask::_internal_has_locatedblk() const {
+  return this != internal_default_instance() && _impl_.locatedblk_ != nullptr;
+}
+inline bool BlockTask::has_locatedblk() const {
+  return _internal_has_locatedblk();
+}
+inline void BlockTask::clear_locatedblk() {
+  if (GetArenaForAllocation() == nullptr && _impl_.locatedblk_ != nullptr) {
+    delete _impl_.locatedblk_;
+  }
+  _impl_.locatedblk_ = nullptr;
+}
+inline const ::minidfs::LocatedBlock& BlockTask::_internal_locatedblk() const {
+  const ::minidfs::LocatedBlock* p = _impl_.locatedblk_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::LocatedBlock&>(
+      ::minidfs::_LocatedBlock_default_instance_);
+}
+inline const ::minidfs::LocatedBlock& BlockTask::locatedblk() const {
+  // @@protoc_insertion_point(field_get:minidfs.BlockTask.locatedBlk)
+  return _internal_locatedblk();
+}
+inline void BlockTask::unsafe_arena_set_allocated_locatedblk(
+    ::minidfs::LocatedBlock* locatedblk) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.locatedblk_);
+  }
+  _impl_.locatedblk_ = locatedblk;
+  if (locatedblk) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.BlockTask.locatedBlk)
+}
+inline ::minidfs::LocatedBlock* BlockTask::release_locatedblk() {
+  
+  ::minidfs::LocatedBlock* temp = _impl_.locatedblk_;
+  _impl_.locatedblk_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::LocatedBlock* BlockTask::unsafe_arena_release_locatedblk() {
+  // @@protoc_insertion_point(field_release:minidfs.BlockTask.locatedBlk)
+  
+  ::minidfs::LocatedBlock* temp = _impl_.locatedblk_;
+  _impl_.locatedblk_ = nullptr;
+  return temp;
+}
+inline ::minidfs::LocatedBlock* BlockTask::_internal_mutable_locatedblk() {
+  
+  if (_impl_.locatedblk_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::LocatedBlock>(GetArenaForAllocation());
+    _impl_.locatedblk_ = p;
+  }
+  return _impl_.locatedblk_;
+}
+inline ::minidfs::LocatedBlock* BlockTask::mutable_locatedblk() {
+  ::minidfs::LocatedBlock* _msg = _internal_mutable_locatedblk();
+  // @@protoc_insertion_point(field_mutable:minidfs.BlockTask.locatedBlk)
+  return _msg;
+}
+inline void BlockTask::set_allocated_locatedblk(::minidfs::LocatedBlock* locatedblk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.locatedblk_;
+  }
+  if (locatedblk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(locatedblk);
+    if (message_arena != submessage_arena) {
+      locatedblk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, locatedblk, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.locatedblk_ = locatedblk;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.BlockTask.locatedBlk)
+}
+
+// .minidfs.LocatedBlock blkGroup = 3;
+inline bool BlockTask::_internal_has_blkgroup() const {
+  return this != internal_default_instance() && _impl_.blkgroup_ != nullptr;
+}
+inline bool BlockTask::has_blkgroup() const {
+  return _internal_has_blkgroup();
+}
+inline void BlockTask::clear_blkgroup() {
+  if (GetArenaForAllocation() == nullptr && _impl_.blkgroup_ != nullptr) {
+    delete _impl_.blkgroup_;
+  }
+  _impl_.blkgroup_ = nullptr;
+}
+inline const ::minidfs::LocatedBlock& BlockTask::_internal_blkgroup() const {
+  const ::minidfs::LocatedBlock* p = _impl_.blkgroup_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::LocatedBlock&>(
+      ::minidfs::_LocatedBlock_default_instance_);
+}
+inline const ::minidfs::LocatedBlock& BlockTask::blkgroup() const {
+  // @@protoc_insertion_point(field_get:minidfs.BlockTask.blkGroup)
+  return _internal_blkgroup();
+}
+inline void BlockTask::unsafe_arena_set_allocated_blkgroup(
+    ::minidfs::LocatedBlock* blkgroup) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.blkgroup_);
+  }
+  _impl_.blkgroup_ = blkgroup;
+  if (blkgroup) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.BlockTask.blkGroup)
+}
+inline ::minidfs::LocatedBlock* BlockTask::release_blkgroup() {
+  
+  ::minidfs::LocatedBlock* temp = _impl_.blkgroup_;
+  _impl_.blkgroup_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::LocatedBlock* BlockTask::unsafe_arena_release_blkgroup() {
+  // @@protoc_insertion_point(field_release:minidfs.BlockTask.blkGroup)
+  
+  ::minidfs::LocatedBlock* temp = _impl_.blkgroup_;
+  _impl_.blkgroup_ = nullptr;
+  return temp;
+}
+inline ::minidfs::LocatedBlock* BlockTask::_internal_mutable_blkgroup() {
+  
+  if (_impl_.blkgroup_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::LocatedBlock>(GetArenaForAllocation());
+    _impl_.blkgroup_ = p;
+  }
+  return _impl_.blkgroup_;
+}
+inline ::minidfs::LocatedBlock* BlockTask::mutable_blkgroup() {
+  ::minidfs::LocatedBlock* _msg = _internal_mutable_blkgroup();
+  // @@protoc_insertion_point(field_mutable:minidfs.BlockTask.blkGroup)
+  return _msg;
+}
+inline void BlockTask::set_allocated_blkgroup(::minidfs::LocatedBlock* blkgroup) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.blkgroup_;
+  }
+  if (blkgroup) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(blkgroup);
+    if (message_arena != submessage_arena) {
+      blkgroup = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, blkgroup, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.blkgroup_ = blkgroup;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.BlockTask.blkGroup)
+}
+
+// -------------------------------------------------------------------
+
+// BlockTasks
+
+// repeated .minidfs.BlockTask blkTasks = 1;
+inline int BlockTasks::_internal_blktasks_size() const {
+  return _impl_.blktasks_.size();
+}
+inline int BlockTasks::blktasks_size() const {
+  return _internal_blktasks_size();
+}
+inline void BlockTasks::clear_blktasks() {
+  _impl_.blktasks_.Clear();
+}
+inline ::minidfs::BlockTask* BlockTasks::mutable_blktasks(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.BlockTasks.blkTasks)
+  return _impl_.blktasks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask >*
+BlockTasks::mutable_blktasks() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.BlockTasks.blkTasks)
+  return &_impl_.blktasks_;
+}
+inline const ::minidfs::BlockTask& BlockTasks::_internal_blktasks(int index) const {
+  return _impl_.blktasks_.Get(index);
+}
+inline const ::minidfs::BlockTask& BlockTasks::blktasks(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.BlockTasks.blkTasks)
+  return _internal_blktasks(index);
+}
+inline ::minidfs::BlockTask* BlockTasks::_internal_add_blktasks() {
+  return _impl_.blktasks_.Add();
+}
+inline ::minidfs::BlockTask* BlockTasks::add_blktasks() {
+  ::minidfs::BlockTask* _add = _internal_add_blktasks();
+  // @@protoc_insertion_point(field_add:minidfs.BlockTasks.blkTasks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask >&
+BlockTasks::blktasks() const {
+  // @@protoc_insertion_point(field_list:minidfs.BlockTasks.blkTasks)
+  return _impl_.blktasks_;
+}
+
+// -------------------------------------------------------------------
+
+// Inode
+
+// int32 id = 1;
+inline void Inode::clear_id() {
+  _impl_.id_ = 0;
+}
+inline int32_t Inode::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Inode::id() const {
+  // @@protoc_insertion_point(field_get:minidfs.Inode.id)
+  return _internal_id();
+}
+inline void Inode::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Inode::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:minidfs.Inode.id)
+}
+
+// string name = 2;
+inline void Inode::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Inode::name() const {
+  // @@protoc_insertion_point(field_get:minidfs.Inode.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Inode::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.Inode.name)
+}
+inline std::string* Inode::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:minidfs.Inode.name)
+  return _s;
+}
+inline const std::string& Inode::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Inode::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Inode::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Inode::release_name() {
+  // @@protoc_insertion_point(field_release:minidfs.Inode.name)
+  return _impl_.name_.Release();
+}
+inline void Inode::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.Inode.name)
+}
+
+// bool isDir = 3;
+inline void Inode::clear_isdir() {
+  _impl_.isdir_ = false;
+}
+inline bool Inode::_internal_isdir() const {
+  return _impl_.isdir_;
+}
+inline bool Inode::isdir() const {
+  // @@protoc_insertion_point(field_get:minidfs.Inode.isDir)
+  return _internal_isdir();
+}
+inline void Inode::_internal_set_isdir(bool value) {
+  
+  _impl_.isdir_ = value;
+}
+inline void Inode::set_isdir(bool value) {
+  _internal_set_isdir(value);
+  // @@protoc_insertion_point(field_set:minidfs.Inode.isDir)
+}
+
+// repeated .minidfs.Block blks = 4;
+inline int Inode::_internal_blks_size() const {
+  return _impl_.blks_.size();
+}
+inline int Inode::blks_size() const {
+  return _internal_blks_size();
+}
+inline void Inode::clear_blks() {
+  _impl_.blks_.Clear();
+}
+inline ::minidfs::Block* Inode::mutable_blks(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.Inode.blks)
+  return _impl_.blks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >*
+Inode::mutable_blks() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.Inode.blks)
+  return &_impl_.blks_;
+}
+inline const ::minidfs::Block& Inode::_internal_blks(int index) const {
+  return _impl_.blks_.Get(index);
+}
+inline const ::minidfs::Block& Inode::blks(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.Inode.blks)
+  return _internal_blks(index);
+}
+inline ::minidfs::Block* Inode::_internal_add_blks() {
+  return _impl_.blks_.Add();
+}
+inline ::minidfs::Block* Inode::add_blks() {
+  ::minidfs::Block* _add = _internal_add_blks();
+  // @@protoc_insertion_point(field_add:minidfs.Inode.blks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >&
+Inode::blks() const {
+  // @@protoc_insertion_point(field_list:minidfs.Inode.blks)
+  return _impl_.blks_;
+}
+
+// bytes inlineData = 5;
+inline void Inode::clear_inlinedata() {
+  _impl_.inlinedata_.ClearToEmpty();
+}
+inline const std::string& Inode::inlinedata() const {
+  // @@protoc_insertion_point(field_get:minidfs.Inode.inlineData)
+  return _internal_inlinedata();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Inode::set_inlinedata(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.inlinedata_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.Inode.inlineData)
+}
+inline std::string* Inode::mutable_inlinedata() {
+  std::string* _s = _internal_mutable_inlinedata();
+  // @@protoc_insertion_point(field_mutable:minidfs.Inode.inlineData)
+  return _s;
+}
+inline const std::string& Inode::_internal_inlinedata() const {
+  return _impl_.inlinedata_.Get();
+}
+inline void Inode::_internal_set_inlinedata(const std::string& value) {
+  
+  _impl_.inlinedata_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Inode::_internal_mutable_inlinedata() {
+  
+  return _impl_.inlinedata_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Inode::release_inlinedata() {
+  // @@protoc_insertion_point(field_release:minidfs.Inode.inlineData)
+  return _impl_.inlinedata_.Release();
+}
+inline void Inode::set_allocated_inlinedata(std::string* inlinedata) {
+  if (inlinedata != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.inlinedata_.SetAllocated(inlinedata, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.inlinedata_.IsDefault()) {
+    _impl_.inlinedata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.Inode.inlineData)
+}
+
+// -------------------------------------------------------------------
+
+// InodeSection
+
+// repeated .minidfs.Inode inodes = 1;
+inline int InodeSection::_internal_inodes_size() const {
+  return _impl_.inodes_.size();
+}
+inline int InodeSection::inodes_size() const {
+  return _internal_inodes_size();
+}
+inline void InodeSection::clear_inodes() {
+  _impl_.inodes_.Clear();
+}
+inline ::minidfs::Inode* InodeSection::mutable_inodes(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.InodeSection.inodes)
+  return _impl_.inodes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode >*
+InodeSection::mutable_inodes() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.InodeSection.inodes)
+  return &_impl_.inodes_;
+}
+inline const ::minidfs::Inode& InodeSection::_internal_inodes(int index) const {
+  return _impl_.inodes_.Get(index);
+}
+inline const ::minidfs::Inode& InodeSection::inodes(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.InodeSection.inodes)
+  return _internal_inodes(index);
+}
+inline ::minidfs::Inode* InodeSection::_internal_add_inodes() {
+  return _impl_.inodes_.Add();
+}
+inline ::minidfs::Inode* InodeSection::add_inodes() {
+  ::minidfs::Inode* _add = _internal_add_inodes();
+  // @@protoc_insertion_point(field_add:minidfs.InodeSection.inodes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode >&
+InodeSection::inodes() const {
+  // @@protoc_insertion_point(field_list:minidfs.InodeSection.inodes)
+  return _impl_.inodes_;
+}
+
+// -------------------------------------------------------------------
+
+// Dentry
+
+// int32 id = 1;
+inline void Dentry::clear_id() {
+  _impl_.id_ = 0;
+}
+inline int32_t Dentry::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Dentry::id() const {
+  // @@protoc_insertion_point(field_get:minidfs.Dentry.id)
+  return _internal_id();
+}
+inline void Dentry::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Dentry::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:minidfs.Dentry.id)
+}
+
+// repeated int32 subDentries = 2;
+inline int Dentry::_internal_subdentries_size() const {
+  return _impl_.subdentries_.size();
+}
+inline int Dentry::subdentries_size() const {
+  return _internal_subdentries_size();
+}
+inline void Dentry::clear_subdentries() {
+  _impl_.subdentries_.Clear();
+}
+inline int32_t Dentry::_internal_subdentries(int index) const {
+  return _impl_.subdentries_.Get(index);
+}
+inline int32_t Dentry::subdentries(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.Dentry.subDentries)
+  return _internal_subdentries(index);
+}
+inline void Dentry::set_subdentries(int index, int32_t value) {
+  _impl_.subdentries_.Set(index, value);
+  // @@protoc_insertion_point(field_set:minidfs.Dentry.subDentries)
+}
+inline void Dentry::_internal_add_subdentries(int32_t value) {
+  _impl_.subdentries_.Add(value);
+}
+inline void Dentry::add_subdentries(int32_t value) {
+  _internal_add_subdentries(value);
+  // @@protoc_insertion_point(field_add:minidfs.Dentry.subDentries)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Dentry::_internal_subdentries() const {
+  return _impl_.subdentries_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Dentry::subdentries() const {
+  // @@protoc_insertion_point(field_list:minidfs.Dentry.subDentries)
+  return _internal_subdentries();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Dentry::_internal_mutable_subdentries() {
+  return &_impl_.subdentries_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Dentry::mutable_subdentries() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.Dentry.subDentries)
+  return _internal_mutable_subdentries();
+}
+
+// -------------------------------------------------------------------
+
+// DentrySection
+
+// repeated .minidfs.Dentry dentries = 1;
+inline int DentrySection::_internal_dentries_size() const {
+  return _impl_.dentries_.size();
+}
+inline int DentrySection::dentries_size() const {
+  return _internal_dentries_size();
+}
+inline void DentrySection::clear_dentries() {
+  _impl_.dentries_.Clear();
+}
+inline ::minidfs::Dentry* DentrySection::mutable_dentries(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.DentrySection.dentries)
+  return _impl_.dentries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry >*
+DentrySection::mutable_dentries() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.DentrySection.dentries)
+  return &_impl_.dentries_;
+}
+inline const ::minidfs::Dentry& DentrySection::_internal_dentries(int index) const {
+  return _impl_.dentries_.Get(index);
+}
+inline const ::minidfs::Dentry& DentrySection::dentries(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.DentrySection.dentries)
+  return _internal_dentries(index);
+}
+inline ::minidfs::Dentry* DentrySection::_internal_add_dentries() {
+  return _impl_.dentries_.Add();
+}
+inline ::minidfs::Dentry* DentrySection::add_dentries() {
+  ::minidfs::Dentry* _add = _internal_add_dentries();
+  // @@protoc_insertion_point(field_add:minidfs.DentrySection.dentries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry >&
+DentrySection::dentries() const {
+  // @@protoc_insertion_point(field_list:minidfs.DentrySection.dentries)
+  return _impl_.dentries_;
+}
+
+// -------------------------------------------------------------------
+
+// NameSystem
+
+// int32 maxDfID = 1;
+inline void NameSystem::clear_maxdfid() {
+  _impl_.maxdfid_ = 0;
+}
+inline int32_t NameSystem::_internal_maxdfid() const {
+  return _impl_.maxdfid_;
+}
+inline int32_t NameSystem::maxdfid() const {
+  // @@protoc_insertion_point(field_get:minidfs.NameSystem.maxDfID)
+  return _internal_maxdfid();
+}
+inline void NameSystem::_internal_set_maxdfid(int32_t value) {
+  
+  _impl_.maxdfid_ = value;
+}
+inline void NameSystem::set_maxdfid(int32_t value) {
+  _internal_set_maxdfid(value);
+  // @@protoc_insertion_point(field_set:minidfs.NameSystem.maxDfID)
+}
+
+// int32 maxBlkID = 2;
+inline void NameSystem::clear_maxblkid() {
+  _impl_.maxblkid_ = 0;
+}
+inline int32_t NameSystem::_internal_maxblkid() const {
+  return _impl_.maxblkid_;
+}
+inline int32_t NameSystem::maxblkid() const {
+  // @@protoc_insertion_point(field_get:minidfs.NameSystem.maxBlkID)
+  return _internal_maxblkid();
+}
+inline void NameSystem::_internal_set_maxblkid(int32_t value) {
+  
+  _impl_.maxblkid_ = value;
+}
+inline void NameSystem::set_maxblkid(int32_t value) {
+  _internal_set_maxblkid(value);
+  // @@protoc_insertion_point(field_set:minidfs.NameSystem.maxBlkID)
+}
+
+// .minidfs.InodeSection inodeSection = 3;
+inline bool NameSystem::_internal_has_inodesection() const {
+  return this != internal_default_instance() && _impl_.inodesection_ != nullptr;
+}
+inline bool NameSystem::has_inodesection() const {
+  return _internal_has_inodesection();
+}
+inline void NameSystem::clear_inodesection() {
+  if (GetArenaForAllocation() == nullptr && _impl_.inodesection_ != nullptr) {
+    delete _impl_.inodesection_;
+  }
+  _impl_.inodesection_ = nullptr;
+}
+inline const ::minidfs::InodeSection& NameSystem::_internal_inodesection() const {
+  const ::minidfs::InodeSection* p = _impl_.inodesection_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::InodeSection&>(
+      ::minidfs::_InodeSection_default_instance_);
+}
+inline const ::minidfs::InodeSection& NameSystem::inodesection() const {
+  // @@protoc_insertion_point(field_get:minidfs.NameSystem.inodeSection)
+  return _internal_inodesection();
+}
+inline void NameSystem::unsafe_arena_set_allocated_inodesection(
+    ::minidfs::InodeSection* inodesection) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.inodesection_);
+  }
+  _impl_.inodesection_ = inodesection;
+  if (inodesection) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.NameSystem.inodeSection)
 }
-inline std::string* ChunkserverInfo::release_chunkserverip() {
-  // @@protoc_insertion_point(field_release:minidfs.ChunkserverInfo.chunkserverIP)
+inline ::minidfs::InodeSection* NameSystem::release_inodesection() {
+  
+  ::minidfs::InodeSection* temp = _impl_.inodesection_;
+  _impl_.inodesection_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::minidfs::InodeSection* NameSystem::unsafe_arena_release_inodesection() {
+  // @@protoc_insertion_point(field_release:minidfs.NameSystem.inodeSection)
   
-  return chunkserverip_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::minidfs::InodeSection* temp = _impl_.inodesection_;
+  _impl_.inodesection_ = nullptr;
+  return temp;
 }
-inline void ChunkserverInfo::set_allocated_chunkserverip(std::string* chunkserverip) {
-  if (chunkserverip != nullptr) {
+inline ::minidfs::InodeSection* NameSystem::_internal_mutable_inodesection() {
+  
+  if (_impl_.inodesection_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::InodeSection>(GetArenaForAllocation());
+    _impl_.inodesection_ = p;
+  }
+  return _impl_.inodesection_;
+}
+inline ::minidfs::InodeSection* NameSystem::mutable_inodesection() {
+  ::minidfs::InodeSection* _msg = _internal_mutable_inodesection();
+  // @@protoc_insertion_point(field_mutable:minidfs.NameSystem.inodeSection)
+  return _msg;
+}
+inline void NameSystem::set_allocated_inodesection(::minidfs::InodeSection* inodesection) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.inodesection_;
+  }
+  if (inodesection) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(inodesection);
+    if (message_arena != submessage_arena) {
+      inodesection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, inodesection, submessage_arena);
+    }
     
   } else {
     
   }
-  chunkserverip_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), chunkserverip);
-  // @@protoc_insertion_point(field_set_allocated:minidfs.ChunkserverInfo.chunkserverIP)
+  _impl_.inodesection_ = inodesection;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.NameSystem.inodeSection)
 }
 
-// int32 chunkserverPort = 2;
-inline void ChunkserverInfo::clear_chunkserverport() {
-  chunkserverport_ = 0;
+// .minidfs.DentrySection dentrySection = 4;
+inline bool NameSystem::_internal_has_dentrysection() const {
+  return this != internal_default_instance() && _impl_.dentrysection_ != nullptr;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ChunkserverInfo::chunkserverport() const {
-  // @@protoc_insertion_point(field_get:minidfs.ChunkserverInfo.chunkserverPort)
-  return chunkserverport_;
+inline bool NameSystem::has_dentrysection() const {
+  return _internal_has_dentrysection();
 }
-inline void ChunkserverInfo::set_chunkserverport(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  chunkserverport_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.ChunkserverInfo.chunkserverPort)
+inline void NameSystem::clear_dentrysection() {
+  if (GetArenaForAllocation() == nullptr && _impl_.dentrysection_ != nullptr) {
+    delete _impl_.dentrysection_;
+  }
+  _impl_.dentrysection_ = nullptr;
 }
-
-// -------------------------------------------------------------------
-
-// LocatedBlock
-
-// .minidfs.Block block = 1;
-inline bool LocatedBlock::has_block() const {
-  return this != internal_default_instance() && block_ != nullptr;
+inline const ::minidfs::DentrySection& NameSystem::_internal_dentrysection() const {
+  const ::minidfs::DentrySection* p = _impl_.dentrysection_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::DentrySection&>(
+      ::minidfs::_DentrySection_default_instance_);
 }
-inline void LocatedBlock::clear_block() {
-  if (GetArenaNoVirtual() == nullptr && block_ != nullptr) {
-    delete block_;
+inline const ::minidfs::DentrySection& NameSystem::dentrysection() const {
+  // @@protoc_insertion_point(field_get:minidfs.NameSystem.dentrySection)
+  return _internal_dentrysection();
+}
+inline void NameSystem::unsafe_arena_set_allocated_dentrysection(
+    ::minidfs::DentrySection* dentrysection) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dentrysection_);
+  }
+  _impl_.dentrysection_ = dentrysection;
+  if (dentrysection) {
+    
+  } else {
+    
   }
-  block_ = nullptr;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.NameSystem.dentrySection)
 }
-inline const ::minidfs::Block& LocatedBlock::block() const {
-  const ::minidfs::Block* p = block_;
-  // @@protoc_insertion_point(field_get:minidfs.LocatedBlock.block)
-  return p != nullptr ? *p : *reinterpret_cast<const ::minidfs::Block*>(
-      &::minidfs::_Block_default_instance_);
+inline ::minidfs::DentrySection* NameSystem::release_dentrysection() {
+  
+  ::minidfs::DentrySection* temp = _impl_.dentrysection_;
+  _impl_.dentrysection_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::minidfs::Block* LocatedBlock::release_block() {
-  // @@protoc_insertion_point(field_release:minidfs.LocatedBlock.block)
+inline ::minidfs::DentrySection* NameSystem::unsafe_arena_release_dentrysection() {
+  // @@protoc_insertion_point(field_release:minidfs.NameSystem.dentrySection)
   
-  ::minidfs::Block* temp = block_;
-  block_ = nullptr;
+  ::minidfs::DentrySection* temp = _impl_.dentrysection_;
+  _impl_.dentrysection_ = nullptr;
   return temp;
 }
-inline ::minidfs::Block* LocatedBlock::mutable_block() {
+inline ::minidfs::DentrySection* NameSystem::_internal_mutable_dentrysection() {
   
-  if (block_ == nullptr) {
-    auto* p = CreateMaybeMessage<::minidfs::Block>(GetArenaNoVirtual());
-    block_ = p;
+  if (_impl_.dentrysection_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::DentrySection>(GetArenaForAllocation());
+    _impl_.dentrysection_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:minidfs.LocatedBlock.block)
-  return block_;
+  return _impl_.dentrysection_;
 }
-inline void LocatedBlock::set_allocated_block(::minidfs::Block* block) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline ::minidfs::DentrySection* NameSystem::mutable_dentrysection() {
+  ::minidfs::DentrySection* _msg = _internal_mutable_dentrysection();
+  // @@protoc_insertion_point(field_mutable:minidfs.NameSystem.dentrySection)
+  return _msg;
+}
+inline void NameSystem::set_allocated_dentrysection(::minidfs::DentrySection* dentrysection) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete block_;
+    delete _impl_.dentrysection_;
   }
-  if (block) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+  if (dentrysection) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dentrysection);
     if (message_arena != submessage_arena) {
-      block = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, block, submessage_arena);
+      dentrysection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dentrysection, submessage_arena);
     }
     
   } else {
     
   }
-  block_ = block;
-  // @@protoc_insertion_point(field_set_allocated:minidfs.LocatedBlock.block)
+  _impl_.dentrysection_ = dentrysection;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.NameSystem.dentrySection)
 }
 
-// repeated .minidfs.ChunkserverInfo chunkserverInfos = 2;
-inline int LocatedBlock::chunkserverinfos_size() const {
-  return chunkserverinfos_.size();
+// -------------------------------------------------------------------
+
+// EditLog
+
+// int32 op = 1;
+inline void EditLog::clear_op() {
+  _impl_.op_ = 0;
 }
-inline void LocatedBlock::clear_chunkserverinfos() {
-  chunkserverinfos_.Clear();
+inline int32_t EditLog::_internal_op() const {
+  return _impl_.op_;
 }
-inline ::minidfs::ChunkserverInfo* LocatedBlock::mutable_chunkserverinfos(int index) {
-  // @@protoc_insertion_point(field_mutable:minidfs.LocatedBlock.chunkserverInfos)
-  return chunkserverinfos_.Mutable(index);
+inline int32_t EditLog::op() const {
+  // @@protoc_insertion_point(field_get:minidfs.EditLog.op)
+  return _internal_op();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo >*
-LocatedBlock::mutable_chunkserverinfos() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.LocatedBlock.chunkserverInfos)
-  return &chunkserverinfos_;
+inline void EditLog::_internal_set_op(int32_t value) {
+  
+  _impl_.op_ = value;
 }
-inline const ::minidfs::ChunkserverInfo& LocatedBlock::chunkserverinfos(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.LocatedBlock.chunkserverInfos)
-  return chunkserverinfos_.Get(index);
+inline void EditLog::set_op(int32_t value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:minidfs.EditLog.op)
 }
-inline ::minidfs::ChunkserverInfo* LocatedBlock::add_chunkserverinfos() {
-  // @@protoc_insertion_point(field_add:minidfs.LocatedBlock.chunkserverInfos)
-  return chunkserverinfos_.Add();
+
+// string src = 2;
+inline void EditLog::clear_src() {
+  _impl_.src_.ClearToEmpty();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::ChunkserverInfo >&
-LocatedBlock::chunkserverinfos() const {
-  // @@protoc_insertion_point(field_list:minidfs.LocatedBlock.chunkserverInfos)
-  return chunkserverinfos_;
+inline const std::string& EditLog::src() const {
+  // @@protoc_insertion_point(field_get:minidfs.EditLog.src)
+  return _internal_src();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EditLog::set_src(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.src_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.EditLog.src)
+}
+inline std::string* EditLog::mutable_src() {
+  std::string* _s = _internal_mutable_src();
+  // @@protoc_insertion_point(field_mutable:minidfs.EditLog.src)
+  return _s;
+}
+inline const std::string& EditLog::_internal_src() const {
+  return _impl_.src_.Get();
+}
+inline void EditLog::_internal_set_src(const std::string& value) {
+  
+  _impl_.src_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EditLog::_internal_mutable_src() {
+  
+  return _impl_.src_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EditLog::release_src() {
+  // @@protoc_insertion_point(field_release:minidfs.EditLog.src)
+  return _impl_.src_.Release();
+}
+inline void EditLog::set_allocated_src(std::string* src) {
+  if (src != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.src_.SetAllocated(src, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.src_.IsDefault()) {
+    _impl_.src_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.EditLog.src)
 }
 
-// -------------------------------------------------------------------
-
-// LocatedBlocks
+// int32 dfID = 3;
+inline void EditLog::clear_dfid() {
+  _impl_.dfid_ = 0;
+}
+inline int32_t EditLog::_internal_dfid() const {
+  return _impl_.dfid_;
+}
+inline int32_t EditLog::dfid() const {
+  // @@protoc_insertion_point(field_get:minidfs.EditLog.dfID)
+  return _internal_dfid();
+}
+inline void EditLog::_internal_set_dfid(int32_t value) {
+  
+  _impl_.dfid_ = value;
+}
+inline void EditLog::set_dfid(int32_t value) {
+  _internal_set_dfid(value);
+  // @@protoc_insertion_point(field_set:minidfs.EditLog.dfID)
+}
 
-// repeated .minidfs.LocatedBlock locatedBlks = 1;
-inline int LocatedBlocks::locatedblks_size() const {
-  return locatedblks_.size();
+// repeated .minidfs.Block blks = 6;
+inline int EditLog::_internal_blks_size() const {
+  return _impl_.blks_.size();
 }
-inline void LocatedBlocks::clear_locatedblks() {
-  locatedblks_.Clear();
+inline int EditLog::blks_size() const {
+  return _internal_blks_size();
 }
-inline ::minidfs::LocatedBlock* LocatedBlocks::mutable_locatedblks(int index) {
-  // @@protoc_insertion_point(field_mutable:minidfs.LocatedBlocks.locatedBlks)
-  return locatedblks_.Mutable(index);
+inline void EditLog::clear_blks() {
+  _impl_.blks_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock >*
-LocatedBlocks::mutable_locatedblks() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.LocatedBlocks.locatedBlks)
-  return &locatedblks_;
+inline ::minidfs::Block* EditLog::mutable_blks(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.EditLog.blks)
+  return _impl_.blks_.Mutable(index);
 }
-inline const ::minidfs::LocatedBlock& LocatedBlocks::locatedblks(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.LocatedBlocks.locatedBlks)
-  return locatedblks_.Get(index);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >*
+EditLog::mutable_blks() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.EditLog.blks)
+  return &_impl_.blks_;
 }
-inline ::minidfs::LocatedBlock* LocatedBlocks::add_locatedblks() {
-  // @@protoc_insertion_point(field_add:minidfs.LocatedBlocks.locatedBlks)
-  return locatedblks_.Add();
+inline const ::minidfs::Block& EditLog::_internal_blks(int index) const {
+  return _impl_.blks_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LocatedBlock >&
-LocatedBlocks::locatedblks() const {
-  // @@protoc_insertion_point(field_list:minidfs.LocatedBlocks.locatedBlks)
-  return locatedblks_;
+inline const ::minidfs::Block& EditLog::blks(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.EditLog.blks)
+  return _internal_blks(index);
+}
+inline ::minidfs::Block* EditLog::_internal_add_blks() {
+  return _impl_.blks_.Add();
+}
+inline ::minidfs::Block* EditLog::add_blks() {
+  ::minidfs::Block* _add = _internal_add_blks();
+  // @@protoc_insertion_point(field_add:minidfs.EditLog.blks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >&
+EditLog::blks() const {
+  // @@protoc_insertion_point(field_list:minidfs.EditLog.blks)
+  return _impl_.blks_;
 }
 
-// -------------------------------------------------------------------
-
-// BlkIDs
+// bytes inlineData = 7;
+inline void EditLog::clear_inlinedata() {
+  _impl_.inlinedata_.ClearToEmpty();
+}
+inline const std::string& EditLog::inlinedata() const {
+  // @@protoc_insertion_point(field_get:minidfs.EditLog.inlineData)
+  return _internal_inlinedata();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EditLog::set_inlinedata(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.inlinedata_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.EditLog.inlineData)
+}
+inline std::string* EditLog::mutable_inlinedata() {
+  std::string* _s = _internal_mutable_inlinedata();
+  // @@protoc_insertion_point(field_mutable:minidfs.EditLog.inlineData)
+  return _s;
+}
+inline const std::string& EditLog::_internal_inlinedata() const {
+  return _impl_.inlinedata_.Get();
+}
+inline void EditLog::_internal_set_inlinedata(const std::string& value) {
+  
+  _impl_.inlinedata_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EditLog::_internal_mutable_inlinedata() {
+  
+  return _impl_.inlinedata_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EditLog::release_inlinedata() {
+  // @@protoc_insertion_point(field_release:minidfs.EditLog.inlineData)
+  return _impl_.inlinedata_.Release();
+}
+inline void EditLog::set_allocated_inlinedata(std::string* inlinedata) {
+  if (inlinedata != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.inlinedata_.SetAllocated(inlinedata, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.inlinedata_.IsDefault()) {
+    _impl_.inlinedata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.EditLog.inlineData)
+}
 
-// repeated int32 blkIDs = 1;
-inline int BlkIDs::blkids_size() const {
-  return blkids_.size();
+// repeated .minidfs.EditLog creates = 8;
+inline int EditLog::_internal_creates_size() const {
+  return _impl_.creates_.size();
 }
-inline void BlkIDs::clear_blkids() {
-  blkids_.Clear();
+inline int EditLog::creates_size() const {
+  return _internal_creates_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 BlkIDs::blkids(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.BlkIDs.blkIDs)
-  return blkids_.Get(index);
+inline void EditLog::clear_creates() {
+  _impl_.creates_.Clear();
 }
-inline void BlkIDs::set_blkids(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
-  blkids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:minidfs.BlkIDs.blkIDs)
+inline ::minidfs::EditLog* EditLog::mutable_creates(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.EditLog.creates)
+  return _impl_.creates_.Mutable(index);
 }
-inline void BlkIDs::add_blkids(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  blkids_.Add(value);
-  // @@protoc_insertion_point(field_add:minidfs.BlkIDs.blkIDs)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::EditLog >*
+EditLog::mutable_creates() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.EditLog.creates)
+  return &_impl_.creates_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-BlkIDs::blkids() const {
-  // @@protoc_insertion_point(field_list:minidfs.BlkIDs.blkIDs)
-  return blkids_;
+inline const ::minidfs::EditLog& EditLog::_internal_creates(int index) const {
+  return _impl_.creates_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-BlkIDs::mutable_blkids() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.BlkIDs.blkIDs)
-  return &blkids_;
+inline const ::minidfs::EditLog& EditLog::creates(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.EditLog.creates)
+  return _internal_creates(index);
+}
+inline ::minidfs::EditLog* EditLog::_internal_add_creates() {
+  return _impl_.creates_.Add();
+}
+inline ::minidfs::EditLog* EditLog::add_creates() {
+  ::minidfs::EditLog* _add = _internal_add_creates();
+  // @@protoc_insertion_point(field_add:minidfs.EditLog.creates)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::EditLog >&
+EditLog::creates() const {
+  // @@protoc_insertion_point(field_list:minidfs.EditLog.creates)
+  return _impl_.creates_;
 }
 
 // -------------------------------------------------------------------
 
-// BlockReport
+// FileInfo
 
-// .minidfs.ChunkserverInfo chunkserverInfo = 1;
-inline bool BlockReport::has_chunkserverinfo() const {
-  return this != internal_default_instance() && chunkserverinfo_ != nullptr;
+// string name = 1;
+inline void FileInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline void BlockReport::clear_chunkserverinfo() {
-  if (GetArenaNoVirtual() == nullptr && chunkserverinfo_ != nullptr) {
-    delete chunkserverinfo_;
+inline const std::string& FileInfo::name() const {
+  // @@protoc_insertion_point(field_get:minidfs.FileInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.FileInfo.name)
+}
+inline std::string* FileInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:minidfs.FileInfo.name)
+  return _s;
+}
+inline const std::string& FileInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void FileInfo::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileInfo::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileInfo::release_name() {
+  // @@protoc_insertion_point(field_release:minidfs.FileInfo.name)
+  return _impl_.name_.Release();
+}
+inline void FileInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  chunkserverinfo_ = nullptr;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.FileInfo.name)
 }
-inline const ::minidfs::ChunkserverInfo& BlockReport::chunkserverinfo() const {
-  const ::minidfs::ChunkserverInfo* p = chunkserverinfo_;
-  // @@protoc_insertion_point(field_get:minidfs.BlockReport.chunkserverInfo)
-  return p != nullptr ? *p : *reinterpret_cast<const ::minidfs::ChunkserverInfo*>(
-      &::minidfs::_ChunkserverInfo_default_instance_);
+
+// bool isDir = 2;
+inline void FileInfo::clear_isdir() {
+  _impl_.isdir_ = false;
+}
+inline bool FileInfo::_internal_isdir() const {
+  return _impl_.isdir_;
+}
+inline bool FileInfo::isdir() const {
+  // @@protoc_insertion_point(field_get:minidfs.FileInfo.isDir)
+  return _internal_isdir();
+}
+inline void FileInfo::_internal_set_isdir(bool value) {
+  
+  _impl_.isdir_ = value;
+}
+inline void FileInfo::set_isdir(bool value) {
+  _internal_set_isdir(value);
+  // @@protoc_insertion_point(field_set:minidfs.FileInfo.isDir)
+}
+
+// int64 fileLen = 3;
+inline void FileInfo::clear_filelen() {
+  _impl_.filelen_ = int64_t{0};
+}
+inline int64_t FileInfo::_internal_filelen() const {
+  return _impl_.filelen_;
 }
-inline ::minidfs::ChunkserverInfo* BlockReport::release_chunkserverinfo() {
-  // @@protoc_insertion_point(field_release:minidfs.BlockReport.chunkserverInfo)
-  
-  ::minidfs::ChunkserverInfo* temp = chunkserverinfo_;
-  chunkserverinfo_ = nullptr;
-  return temp;
+inline int64_t FileInfo::filelen() const {
+  // @@protoc_insertion_point(field_get:minidfs.FileInfo.fileLen)
+  return _internal_filelen();
 }
-inline ::minidfs::ChunkserverInfo* BlockReport::mutable_chunkserverinfo() {
+inline void FileInfo::_internal_set_filelen(int64_t value) {
   
-  if (chunkserverinfo_ == nullptr) {
-    auto* p = CreateMaybeMessage<::minidfs::ChunkserverInfo>(GetArenaNoVirtual());
-    chunkserverinfo_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:minidfs.BlockReport.chunkserverInfo)
-  return chunkserverinfo_;
+  _impl_.filelen_ = value;
 }
-inline void BlockReport::set_allocated_chunkserverinfo(::minidfs::ChunkserverInfo* chunkserverinfo) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete chunkserverinfo_;
-  }
-  if (chunkserverinfo) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      chunkserverinfo = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, chunkserverinfo, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  chunkserverinfo_ = chunkserverinfo;
-  // @@protoc_insertion_point(field_set_allocated:minidfs.BlockReport.chunkserverInfo)
+inline void FileInfo::set_filelen(int64_t value) {
+  _internal_set_filelen(value);
+  // @@protoc_insertion_point(field_set:minidfs.FileInfo.fileLen)
 }
 
-// repeated int32 blkIDs = 2;
-inline int BlockReport::blkids_size() const {
-  return blkids_.size();
+// -------------------------------------------------------------------
+
+// FileInfos
+
+// repeated .minidfs.FileInfo fileInfos = 1;
+inline int FileInfos::_internal_fileinfos_size() const {
+  return _impl_.fileinfos_.size();
 }
-inline void BlockReport::clear_blkids() {
-  blkids_.Clear();
+inline int FileInfos::fileinfos_size() const {
+  return _internal_fileinfos_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 BlockReport::blkids(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.BlockReport.blkIDs)
-  return blkids_.Get(index);
+inline void FileInfos::clear_fileinfos() {
+  _impl_.fileinfos_.Clear();
 }
-inline void BlockReport::set_blkids(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
-  blkids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:minidfs.BlockReport.blkIDs)
+inline ::minidfs::FileInfo* FileInfos::mutable_fileinfos(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.FileInfos.fileInfos)
+  return _impl_.fileinfos_.Mutable(index);
 }
-inline void BlockReport::add_blkids(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  blkids_.Add(value);
-  // @@protoc_insertion_point(field_add:minidfs.BlockReport.blkIDs)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo >*
+FileInfos::mutable_fileinfos() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.FileInfos.fileInfos)
+  return &_impl_.fileinfos_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-BlockReport::blkids() const {
-  // @@protoc_insertion_point(field_list:minidfs.BlockReport.blkIDs)
-  return blkids_;
+inline const ::minidfs::FileInfo& FileInfos::_internal_fileinfos(int index) const {
+  return _impl_.fileinfos_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-BlockReport::mutable_blkids() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.BlockReport.blkIDs)
-  return &blkids_;
+inline const ::minidfs::FileInfo& FileInfos::fileinfos(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.FileInfos.fileInfos)
+  return _internal_fileinfos(index);
+}
+inline ::minidfs::FileInfo* FileInfos::_internal_add_fileinfos() {
+  return _impl_.fileinfos_.Add();
+}
+inline ::minidfs::FileInfo* FileInfos::add_fileinfos() {
+  ::minidfs::FileInfo* _add = _internal_add_fileinfos();
+  // @@protoc_insertion_point(field_add:minidfs.FileInfos.fileInfos)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo >&
+FileInfos::fileinfos() const {
+  // @@protoc_insertion_point(field_list:minidfs.FileInfos.fileInfos)
+  return _impl_.fileinfos_;
 }
 
 // -------------------------------------------------------------------
 
-// BlockTask
+// LaneStats
 
-// int32 operation = 1;
-inline void BlockTask::clear_operation() {
-  operation_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 BlockTask::operation() const {
-  // @@protoc_insertion_point(field_get:minidfs.BlockTask.operation)
-  return operation_;
+// string name = 1;
+inline void LaneStats::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline void BlockTask::set_operation(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  operation_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.BlockTask.operation)
+inline const std::string& LaneStats::name() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.name)
+  return _internal_name();
 }
-
-// .minidfs.LocatedBlock locatedBlk = 2;
-inline bool BlockTask::has_locatedblk() const {
-  return this != internal_default_instance() && locatedblk_ != nullptr;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LaneStats::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.name)
 }
-inline void BlockTask::clear_locatedblk() {
-  if (GetArenaNoVirtual() == nullptr && locatedblk_ != nullptr) {
-    delete locatedblk_;
-  }
-  locatedblk_ = nullptr;
+inline std::string* LaneStats::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:minidfs.LaneStats.name)
+  return _s;
 }
-inline const ::minidfs::LocatedBlock& BlockTask::locatedblk() const {
-  const ::minidfs::LocatedBlock* p = locatedblk_;
-  // @@protoc_insertion_point(field_get:minidfs.BlockTask.locatedBlk)
-  return p != nullptr ? *p : *reinterpret_cast<const ::minidfs::LocatedBlock*>(
-      &::minidfs::_LocatedBlock_default_instance_);
+inline const std::string& LaneStats::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline ::minidfs::LocatedBlock* BlockTask::release_locatedblk() {
-  // @@protoc_insertion_point(field_release:minidfs.BlockTask.locatedBlk)
+inline void LaneStats::_internal_set_name(const std::string& value) {
   
-  ::minidfs::LocatedBlock* temp = locatedblk_;
-  locatedblk_ = nullptr;
-  return temp;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::minidfs::LocatedBlock* BlockTask::mutable_locatedblk() {
+inline std::string* LaneStats::_internal_mutable_name() {
   
-  if (locatedblk_ == nullptr) {
-    auto* p = CreateMaybeMessage<::minidfs::LocatedBlock>(GetArenaNoVirtual());
-    locatedblk_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:minidfs.BlockTask.locatedBlk)
-  return locatedblk_;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline void BlockTask::set_allocated_locatedblk(::minidfs::LocatedBlock* locatedblk) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete locatedblk_;
-  }
-  if (locatedblk) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      locatedblk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, locatedblk, submessage_arena);
-    }
+inline std::string* LaneStats::release_name() {
+  // @@protoc_insertion_point(field_release:minidfs.LaneStats.name)
+  return _impl_.name_.Release();
+}
+inline void LaneStats::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  locatedblk_ = locatedblk;
-  // @@protoc_insertion_point(field_set_allocated:minidfs.BlockTask.locatedBlk)
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.LaneStats.name)
 }
 
-// -------------------------------------------------------------------
-
-// BlockTasks
-
-// repeated .minidfs.BlockTask blkTasks = 1;
-inline int BlockTasks::blktasks_size() const {
-  return blktasks_.size();
+// int32 nThread = 2;
+inline void LaneStats::clear_nthread() {
+  _impl_.nthread_ = 0;
 }
-inline void BlockTasks::clear_blktasks() {
-  blktasks_.Clear();
+inline int32_t LaneStats::_internal_nthread() const {
+  return _impl_.nthread_;
 }
-inline ::minidfs::BlockTask* BlockTasks::mutable_blktasks(int index) {
-  // @@protoc_insertion_point(field_mutable:minidfs.BlockTasks.blkTasks)
-  return blktasks_.Mutable(index);
+inline int32_t LaneStats::nthread() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.nThread)
+  return _internal_nthread();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask >*
-BlockTasks::mutable_blktasks() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.BlockTasks.blkTasks)
-  return &blktasks_;
+inline void LaneStats::_internal_set_nthread(int32_t value) {
+  
+  _impl_.nthread_ = value;
 }
-inline const ::minidfs::BlockTask& BlockTasks::blktasks(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.BlockTasks.blkTasks)
-  return blktasks_.Get(index);
+inline void LaneStats::set_nthread(int32_t value) {
+  _internal_set_nthread(value);
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.nThread)
 }
-inline ::minidfs::BlockTask* BlockTasks::add_blktasks() {
-  // @@protoc_insertion_point(field_add:minidfs.BlockTasks.blkTasks)
-  return blktasks_.Add();
+
+// int64 queued = 3;
+inline void LaneStats::clear_queued() {
+  _impl_.queued_ = int64_t{0};
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::BlockTask >&
-BlockTasks::blktasks() const {
-  // @@protoc_insertion_point(field_list:minidfs.BlockTasks.blkTasks)
-  return blktasks_;
+inline int64_t LaneStats::_internal_queued() const {
+  return _impl_.queued_;
+}
+inline int64_t LaneStats::queued() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.queued)
+  return _internal_queued();
+}
+inline void LaneStats::_internal_set_queued(int64_t value) {
+  
+  _impl_.queued_ = value;
+}
+inline void LaneStats::set_queued(int64_t value) {
+  _internal_set_queued(value);
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.queued)
 }
 
-// -------------------------------------------------------------------
-
-// Inode
-
-// int32 id = 1;
-inline void Inode::clear_id() {
-  id_ = 0;
+// int64 handled = 4;
+inline void LaneStats::clear_handled() {
+  _impl_.handled_ = int64_t{0};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Inode::id() const {
-  // @@protoc_insertion_point(field_get:minidfs.Inode.id)
-  return id_;
+inline int64_t LaneStats::_internal_handled() const {
+  return _impl_.handled_;
+}
+inline int64_t LaneStats::handled() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.handled)
+  return _internal_handled();
 }
-inline void Inode::set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void LaneStats::_internal_set_handled(int64_t value) {
   
-  id_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.Inode.id)
+  _impl_.handled_ = value;
+}
+inline void LaneStats::set_handled(int64_t value) {
+  _internal_set_handled(value);
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.handled)
 }
 
-// string name = 2;
-inline void Inode::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// int64 rejected = 5;
+inline void LaneStats::clear_rejected() {
+  _impl_.rejected_ = int64_t{0};
 }
-inline const std::string& Inode::name() const {
-  // @@protoc_insertion_point(field_get:minidfs.Inode.name)
-  return name_.GetNoArena();
+inline int64_t LaneStats::_internal_rejected() const {
+  return _impl_.rejected_;
 }
-inline void Inode::set_name(const std::string& value) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:minidfs.Inode.name)
+inline int64_t LaneStats::rejected() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.rejected)
+  return _internal_rejected();
 }
-inline void Inode::set_name(std::string&& value) {
+inline void LaneStats::_internal_set_rejected(int64_t value) {
   
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:minidfs.Inode.name)
+  _impl_.rejected_ = value;
 }
-inline void Inode::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:minidfs.Inode.name)
+inline void LaneStats::set_rejected(int64_t value) {
+  _internal_set_rejected(value);
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.rejected)
 }
-inline void Inode::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:minidfs.Inode.name)
+
+// int32 active = 6;
+inline void LaneStats::clear_active() {
+  _impl_.active_ = 0;
 }
-inline std::string* Inode::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:minidfs.Inode.name)
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline int32_t LaneStats::_internal_active() const {
+  return _impl_.active_;
 }
-inline std::string* Inode::release_name() {
-  // @@protoc_insertion_point(field_release:minidfs.Inode.name)
+inline int32_t LaneStats::active() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.active)
+  return _internal_active();
+}
+inline void LaneStats::_internal_set_active(int32_t value) {
   
-  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.active_ = value;
 }
-inline void Inode::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:minidfs.Inode.name)
+inline void LaneStats::set_active(int32_t value) {
+  _internal_set_active(value);
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.active)
 }
 
-// bool isDir = 3;
-inline void Inode::clear_isdir() {
-  isdir_ = false;
+// int32 maxThread = 7;
+inline void LaneStats::clear_maxthread() {
+  _impl_.maxthread_ = 0;
 }
-inline bool Inode::isdir() const {
-  // @@protoc_insertion_point(field_get:minidfs.Inode.isDir)
-  return isdir_;
+inline int32_t LaneStats::_internal_maxthread() const {
+  return _impl_.maxthread_;
 }
-inline void Inode::set_isdir(bool value) {
+inline int32_t LaneStats::maxthread() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.maxThread)
+  return _internal_maxthread();
+}
+inline void LaneStats::_internal_set_maxthread(int32_t value) {
   
-  isdir_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.Inode.isDir)
+  _impl_.maxthread_ = value;
+}
+inline void LaneStats::set_maxthread(int32_t value) {
+  _internal_set_maxthread(value);
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.maxThread)
 }
 
-// repeated .minidfs.Block blks = 4;
-inline int Inode::blks_size() const {
-  return blks_.size();
+// int64 completed = 8;
+inline void LaneStats::clear_completed() {
+  _impl_.completed_ = int64_t{0};
 }
-inline void Inode::clear_blks() {
-  blks_.Clear();
+inline int64_t LaneStats::_internal_completed() const {
+  return _impl_.completed_;
 }
-inline ::minidfs::Block* Inode::mutable_blks(int index) {
-  // @@protoc_insertion_point(field_mutable:minidfs.Inode.blks)
-  return blks_.Mutable(index);
+inline int64_t LaneStats::completed() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.completed)
+  return _internal_completed();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >*
-Inode::mutable_blks() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.Inode.blks)
-  return &blks_;
+inline void LaneStats::_internal_set_completed(int64_t value) {
+  
+  _impl_.completed_ = value;
 }
-inline const ::minidfs::Block& Inode::blks(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.Inode.blks)
-  return blks_.Get(index);
+inline void LaneStats::set_completed(int64_t value) {
+  _internal_set_completed(value);
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.completed)
 }
-inline ::minidfs::Block* Inode::add_blks() {
-  // @@protoc_insertion_point(field_add:minidfs.Inode.blks)
-  return blks_.Add();
+
+// int64 waitUs = 9;
+inline void LaneStats::clear_waitus() {
+  _impl_.waitus_ = int64_t{0};
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >&
-Inode::blks() const {
-  // @@protoc_insertion_point(field_list:minidfs.Inode.blks)
-  return blks_;
+inline int64_t LaneStats::_internal_waitus() const {
+  return _impl_.waitus_;
 }
-
-// -------------------------------------------------------------------
-
-// InodeSection
-
-// repeated .minidfs.Inode inodes = 1;
-inline int InodeSection::inodes_size() const {
-  return inodes_.size();
+inline int64_t LaneStats::waitus() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.waitUs)
+  return _internal_waitus();
 }
-inline void InodeSection::clear_inodes() {
-  inodes_.Clear();
+inline void LaneStats::_internal_set_waitus(int64_t value) {
+  
+  _impl_.waitus_ = value;
 }
-inline ::minidfs::Inode* InodeSection::mutable_inodes(int index) {
-  // @@protoc_insertion_point(field_mutable:minidfs.InodeSection.inodes)
-  return inodes_.Mutable(index);
+inline void LaneStats::set_waitus(int64_t value) {
+  _internal_set_waitus(value);
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.waitUs)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode >*
-InodeSection::mutable_inodes() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.InodeSection.inodes)
-  return &inodes_;
+
+// int64 runUs = 10;
+inline void LaneStats::clear_runus() {
+  _impl_.runus_ = int64_t{0};
 }
-inline const ::minidfs::Inode& InodeSection::inodes(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.InodeSection.inodes)
-  return inodes_.Get(index);
+inline int64_t LaneStats::_internal_runus() const {
+  return _impl_.runus_;
 }
-inline ::minidfs::Inode* InodeSection::add_inodes() {
-  // @@protoc_insertion_point(field_add:minidfs.InodeSection.inodes)
-  return inodes_.Add();
+inline int64_t LaneStats::runus() const {
+  // @@protoc_insertion_point(field_get:minidfs.LaneStats.runUs)
+  return _internal_runus();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Inode >&
-InodeSection::inodes() const {
-  // @@protoc_insertion_point(field_list:minidfs.InodeSection.inodes)
-  return inodes_;
+inline void LaneStats::_internal_set_runus(int64_t value) {
+  
+  _impl_.runus_ = value;
+}
+inline void LaneStats::set_runus(int64_t value) {
+  _internal_set_runus(value);
+  // @@protoc_insertion_point(field_set:minidfs.LaneStats.runUs)
 }
 
 // -------------------------------------------------------------------
 
-// Dentry
+// ServerStats
 
-// int32 id = 1;
-inline void Dentry::clear_id() {
-  id_ = 0;
+// repeated .minidfs.LaneStats lanes = 1;
+inline int ServerStats::_internal_lanes_size() const {
+  return _impl_.lanes_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Dentry::id() const {
-  // @@protoc_insertion_point(field_get:minidfs.Dentry.id)
-  return id_;
+inline int ServerStats::lanes_size() const {
+  return _internal_lanes_size();
 }
-inline void Dentry::set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  id_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.Dentry.id)
+inline void ServerStats::clear_lanes() {
+  _impl_.lanes_.Clear();
 }
-
-// repeated int32 subDentries = 2;
-inline int Dentry::subdentries_size() const {
-  return subdentries_.size();
+inline ::minidfs::LaneStats* ServerStats::mutable_lanes(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.ServerStats.lanes)
+  return _impl_.lanes_.Mutable(index);
 }
-inline void Dentry::clear_subdentries() {
-  subdentries_.Clear();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LaneStats >*
+ServerStats::mutable_lanes() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.ServerStats.lanes)
+  return &_impl_.lanes_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Dentry::subdentries(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.Dentry.subDentries)
-  return subdentries_.Get(index);
+inline const ::minidfs::LaneStats& ServerStats::_internal_lanes(int index) const {
+  return _impl_.lanes_.Get(index);
 }
-inline void Dentry::set_subdentries(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
-  subdentries_.Set(index, value);
-  // @@protoc_insertion_point(field_set:minidfs.Dentry.subDentries)
+inline const ::minidfs::LaneStats& ServerStats::lanes(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.ServerStats.lanes)
+  return _internal_lanes(index);
 }
-inline void Dentry::add_subdentries(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  subdentries_.Add(value);
-  // @@protoc_insertion_point(field_add:minidfs.Dentry.subDentries)
+inline ::minidfs::LaneStats* ServerStats::_internal_add_lanes() {
+  return _impl_.lanes_.Add();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-Dentry::subdentries() const {
-  // @@protoc_insertion_point(field_list:minidfs.Dentry.subDentries)
-  return subdentries_;
+inline ::minidfs::LaneStats* ServerStats::add_lanes() {
+  ::minidfs::LaneStats* _add = _internal_add_lanes();
+  // @@protoc_insertion_point(field_add:minidfs.ServerStats.lanes)
+  return _add;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-Dentry::mutable_subdentries() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.Dentry.subDentries)
-  return &subdentries_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::LaneStats >&
+ServerStats::lanes() const {
+  // @@protoc_insertion_point(field_list:minidfs.ServerStats.lanes)
+  return _impl_.lanes_;
 }
 
-// -------------------------------------------------------------------
-
-// DentrySection
-
-// repeated .minidfs.Dentry dentries = 1;
-inline int DentrySection::dentries_size() const {
-  return dentries_.size();
+// repeated .minidfs.CallerStats callers = 2;
+inline int ServerStats::_internal_callers_size() const {
+  return _impl_.callers_.size();
 }
-inline void DentrySection::clear_dentries() {
-  dentries_.Clear();
+inline int ServerStats::callers_size() const {
+  return _internal_callers_size();
 }
-inline ::minidfs::Dentry* DentrySection::mutable_dentries(int index) {
-  // @@protoc_insertion_point(field_mutable:minidfs.DentrySection.dentries)
-  return dentries_.Mutable(index);
+inline void ServerStats::clear_callers() {
+  _impl_.callers_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry >*
-DentrySection::mutable_dentries() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.DentrySection.dentries)
-  return &dentries_;
+inline ::minidfs::CallerStats* ServerStats::mutable_callers(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.ServerStats.callers)
+  return _impl_.callers_.Mutable(index);
 }
-inline const ::minidfs::Dentry& DentrySection::dentries(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.DentrySection.dentries)
-  return dentries_.Get(index);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::CallerStats >*
+ServerStats::mutable_callers() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.ServerStats.callers)
+  return &_impl_.callers_;
 }
-inline ::minidfs::Dentry* DentrySection::add_dentries() {
-  // @@protoc_insertion_point(field_add:minidfs.DentrySection.dentries)
-  return dentries_.Add();
+inline const ::minidfs::CallerStats& ServerStats::_internal_callers(int index) const {
+  return _impl_.callers_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Dentry >&
-DentrySection::dentries() const {
-  // @@protoc_insertion_point(field_list:minidfs.DentrySection.dentries)
-  return dentries_;
+inline const ::minidfs::CallerStats& ServerStats::callers(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.ServerStats.callers)
+  return _internal_callers(index);
 }
-
-// -------------------------------------------------------------------
-
-// NameSystem
-
-// int32 maxDfID = 1;
-inline void NameSystem::clear_maxdfid() {
-  maxdfid_ = 0;
+inline ::minidfs::CallerStats* ServerStats::_internal_add_callers() {
+  return _impl_.callers_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 NameSystem::maxdfid() const {
-  // @@protoc_insertion_point(field_get:minidfs.NameSystem.maxDfID)
-  return maxdfid_;
+inline ::minidfs::CallerStats* ServerStats::add_callers() {
+  ::minidfs::CallerStats* _add = _internal_add_callers();
+  // @@protoc_insertion_point(field_add:minidfs.ServerStats.callers)
+  return _add;
 }
-inline void NameSystem::set_maxdfid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  maxdfid_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.NameSystem.maxDfID)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::CallerStats >&
+ServerStats::callers() const {
+  // @@protoc_insertion_point(field_list:minidfs.ServerStats.callers)
+  return _impl_.callers_;
 }
 
-// int32 maxBlkID = 2;
-inline void NameSystem::clear_maxblkid() {
-  maxblkid_ = 0;
+// .minidfs.Metrics metrics = 3;
+inline bool ServerStats::_internal_has_metrics() const {
+  return this != internal_default_instance() && _impl_.metrics_ != nullptr;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 NameSystem::maxblkid() const {
-  // @@protoc_insertion_point(field_get:minidfs.NameSystem.maxBlkID)
-  return maxblkid_;
+inline bool ServerStats::has_metrics() const {
+  return _internal_has_metrics();
 }
-inline void NameSystem::set_maxblkid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  maxblkid_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.NameSystem.maxBlkID)
+inline void ServerStats::clear_metrics() {
+  if (GetArenaForAllocation() == nullptr && _impl_.metrics_ != nullptr) {
+    delete _impl_.metrics_;
+  }
+  _impl_.metrics_ = nullptr;
 }
-
-// .minidfs.InodeSection inodeSection = 3;
-inline bool NameSystem::has_inodesection() const {
-  return this != internal_default_instance() && inodesection_ != nullptr;
+inline const ::minidfs::Metrics& ServerStats::_internal_metrics() const {
+  const ::minidfs::Metrics* p = _impl_.metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::minidfs::Metrics&>(
+      ::minidfs::_Metrics_default_instance_);
 }
-inline void NameSystem::clear_inodesection() {
-  if (GetArenaNoVirtual() == nullptr && inodesection_ != nullptr) {
-    delete inodesection_;
+inline const ::minidfs::Metrics& ServerStats::metrics() const {
+  // @@protoc_insertion_point(field_get:minidfs.ServerStats.metrics)
+  return _internal_metrics();
+}
+inline void ServerStats::unsafe_arena_set_allocated_metrics(
+    ::minidfs::Metrics* metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.metrics_);
+  }
+  _impl_.metrics_ = metrics;
+  if (metrics) {
+    
+  } else {
+    
   }
-  inodesection_ = nullptr;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:minidfs.ServerStats.metrics)
 }
-inline const ::minidfs::InodeSection& NameSystem::inodesection() const {
-  const ::minidfs::InodeSection* p = inodesection_;
-  // @@protoc_insertion_point(field_get:minidfs.NameSystem.inodeSection)
-  return p != nullptr ? *p : *reinterpret_cast<const ::minidfs::InodeSection*>(
-      &::minidfs::_InodeSection_default_instance_);
+inline ::minidfs::Metrics* ServerStats::release_metrics() {
+  
+  ::minidfs::Metrics* temp = _impl_.metrics_;
+  _impl_.metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::minidfs::InodeSection* NameSystem::release_inodesection() {
-  // @@protoc_insertion_point(field_release:minidfs.NameSystem.inodeSection)
+inline ::minidfs::Metrics* ServerStats::unsafe_arena_release_metrics() {
+  // @@protoc_insertion_point(field_release:minidfs.ServerStats.metrics)
   
-  ::minidfs::InodeSection* temp = inodesection_;
-  inodesection_ = nullptr;
+  ::minidfs::Metrics* temp = _impl_.metrics_;
+  _impl_.metrics_ = nullptr;
   return temp;
 }
-inline ::minidfs::InodeSection* NameSystem::mutable_inodesection() {
+inline ::minidfs::Metrics* ServerStats::_internal_mutable_metrics() {
   
-  if (inodesection_ == nullptr) {
-    auto* p = CreateMaybeMessage<::minidfs::InodeSection>(GetArenaNoVirtual());
-    inodesection_ = p;
+  if (_impl_.metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::minidfs::Metrics>(GetArenaForAllocation());
+    _impl_.metrics_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:minidfs.NameSystem.inodeSection)
-  return inodesection_;
+  return _impl_.metrics_;
 }
-inline void NameSystem::set_allocated_inodesection(::minidfs::InodeSection* inodesection) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline ::minidfs::Metrics* ServerStats::mutable_metrics() {
+  ::minidfs::Metrics* _msg = _internal_mutable_metrics();
+  // @@protoc_insertion_point(field_mutable:minidfs.ServerStats.metrics)
+  return _msg;
+}
+inline void ServerStats::set_allocated_metrics(::minidfs::Metrics* metrics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete inodesection_;
+    delete _impl_.metrics_;
   }
-  if (inodesection) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+  if (metrics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(metrics);
     if (message_arena != submessage_arena) {
-      inodesection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, inodesection, submessage_arena);
+      metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, metrics, submessage_arena);
     }
     
   } else {
     
   }
-  inodesection_ = inodesection;
-  // @@protoc_insertion_point(field_set_allocated:minidfs.NameSystem.inodeSection)
+  _impl_.metrics_ = metrics;
+  // @@protoc_insertion_point(field_set_allocated:minidfs.ServerStats.metrics)
 }
 
-// .minidfs.DentrySection dentrySection = 4;
-inline bool NameSystem::has_dentrysection() const {
-  return this != internal_default_instance() && dentrysection_ != nullptr;
+// -------------------------------------------------------------------
+
+// Metric
+
+// string name = 1;
+inline void Metric::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline void NameSystem::clear_dentrysection() {
-  if (GetArenaNoVirtual() == nullptr && dentrysection_ != nullptr) {
-    delete dentrysection_;
-  }
-  dentrysection_ = nullptr;
+inline const std::string& Metric::name() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.name)
+  return _internal_name();
 }
-inline const ::minidfs::DentrySection& NameSystem::dentrysection() const {
-  const ::minidfs::DentrySection* p = dentrysection_;
-  // @@protoc_insertion_point(field_get:minidfs.NameSystem.dentrySection)
-  return p != nullptr ? *p : *reinterpret_cast<const ::minidfs::DentrySection*>(
-      &::minidfs::_DentrySection_default_instance_);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Metric::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.Metric.name)
 }
-inline ::minidfs::DentrySection* NameSystem::release_dentrysection() {
-  // @@protoc_insertion_point(field_release:minidfs.NameSystem.dentrySection)
+inline std::string* Metric::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:minidfs.Metric.name)
+  return _s;
+}
+inline const std::string& Metric::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Metric::_internal_set_name(const std::string& value) {
   
-  ::minidfs::DentrySection* temp = dentrysection_;
-  dentrysection_ = nullptr;
-  return temp;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::minidfs::DentrySection* NameSystem::mutable_dentrysection() {
+inline std::string* Metric::_internal_mutable_name() {
   
-  if (dentrysection_ == nullptr) {
-    auto* p = CreateMaybeMessage<::minidfs::DentrySection>(GetArenaNoVirtual());
-    dentrysection_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:minidfs.NameSystem.dentrySection)
-  return dentrysection_;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline void NameSystem::set_allocated_dentrysection(::minidfs::DentrySection* dentrysection) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete dentrysection_;
-  }
-  if (dentrysection) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      dentrysection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, dentrysection, submessage_arena);
-    }
+inline std::string* Metric::release_name() {
+  // @@protoc_insertion_point(field_release:minidfs.Metric.name)
+  return _impl_.name_.Release();
+}
+inline void Metric::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  dentrysection_ = dentrysection;
-  // @@protoc_insertion_point(field_set_allocated:minidfs.NameSystem.dentrySection)
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.Metric.name)
 }
 
-// -------------------------------------------------------------------
-
-// EditLog
+// .minidfs.Metric.Type type = 2;
+inline void Metric::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::minidfs::Metric_Type Metric::_internal_type() const {
+  return static_cast< ::minidfs::Metric_Type >(_impl_.type_);
+}
+inline ::minidfs::Metric_Type Metric::type() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.type)
+  return _internal_type();
+}
+inline void Metric::_internal_set_type(::minidfs::Metric_Type value) {
+  
+  _impl_.type_ = value;
+}
+inline void Metric::set_type(::minidfs::Metric_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:minidfs.Metric.type)
+}
 
-// int32 op = 1;
-inline void EditLog::clear_op() {
-  op_ = 0;
+// int64 value = 3;
+inline void Metric::clear_value() {
+  _impl_.value_ = int64_t{0};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 EditLog::op() const {
-  // @@protoc_insertion_point(field_get:minidfs.EditLog.op)
-  return op_;
+inline int64_t Metric::_internal_value() const {
+  return _impl_.value_;
 }
-inline void EditLog::set_op(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline int64_t Metric::value() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.value)
+  return _internal_value();
+}
+inline void Metric::_internal_set_value(int64_t value) {
   
-  op_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.EditLog.op)
+  _impl_.value_ = value;
+}
+inline void Metric::set_value(int64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:minidfs.Metric.value)
 }
 
-// string src = 2;
-inline void EditLog::clear_src() {
-  src_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// int64 count = 4;
+inline void Metric::clear_count() {
+  _impl_.count_ = int64_t{0};
 }
-inline const std::string& EditLog::src() const {
-  // @@protoc_insertion_point(field_get:minidfs.EditLog.src)
-  return src_.GetNoArena();
+inline int64_t Metric::_internal_count() const {
+  return _impl_.count_;
+}
+inline int64_t Metric::count() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.count)
+  return _internal_count();
 }
-inline void EditLog::set_src(const std::string& value) {
+inline void Metric::_internal_set_count(int64_t value) {
   
-  src_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:minidfs.EditLog.src)
+  _impl_.count_ = value;
+}
+inline void Metric::set_count(int64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:minidfs.Metric.count)
 }
-inline void EditLog::set_src(std::string&& value) {
+
+// int64 sum = 5;
+inline void Metric::clear_sum() {
+  _impl_.sum_ = int64_t{0};
+}
+inline int64_t Metric::_internal_sum() const {
+  return _impl_.sum_;
+}
+inline int64_t Metric::sum() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.sum)
+  return _internal_sum();
+}
+inline void Metric::_internal_set_sum(int64_t value) {
   
-  src_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:minidfs.EditLog.src)
+  _impl_.sum_ = value;
+}
+inline void Metric::set_sum(int64_t value) {
+  _internal_set_sum(value);
+  // @@protoc_insertion_point(field_set:minidfs.Metric.sum)
+}
+
+// int64 max = 6;
+inline void Metric::clear_max() {
+  _impl_.max_ = int64_t{0};
+}
+inline int64_t Metric::_internal_max() const {
+  return _impl_.max_;
 }
-inline void EditLog::set_src(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline int64_t Metric::max() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.max)
+  return _internal_max();
+}
+inline void Metric::_internal_set_max(int64_t value) {
   
-  src_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:minidfs.EditLog.src)
+  _impl_.max_ = value;
+}
+inline void Metric::set_max(int64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:minidfs.Metric.max)
+}
+
+// int64 p50 = 7;
+inline void Metric::clear_p50() {
+  _impl_.p50_ = int64_t{0};
 }
-inline void EditLog::set_src(const char* value, size_t size) {
+inline int64_t Metric::_internal_p50() const {
+  return _impl_.p50_;
+}
+inline int64_t Metric::p50() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.p50)
+  return _internal_p50();
+}
+inline void Metric::_internal_set_p50(int64_t value) {
   
-  src_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:minidfs.EditLog.src)
+  _impl_.p50_ = value;
 }
-inline std::string* EditLog::mutable_src() {
+inline void Metric::set_p50(int64_t value) {
+  _internal_set_p50(value);
+  // @@protoc_insertion_point(field_set:minidfs.Metric.p50)
+}
+
+// int64 p90 = 8;
+inline void Metric::clear_p90() {
+  _impl_.p90_ = int64_t{0};
+}
+inline int64_t Metric::_internal_p90() const {
+  return _impl_.p90_;
+}
+inline int64_t Metric::p90() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.p90)
+  return _internal_p90();
+}
+inline void Metric::_internal_set_p90(int64_t value) {
   
-  // @@protoc_insertion_point(field_mutable:minidfs.EditLog.src)
-  return src_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.p90_ = value;
 }
-inline std::string* EditLog::release_src() {
-  // @@protoc_insertion_point(field_release:minidfs.EditLog.src)
+inline void Metric::set_p90(int64_t value) {
+  _internal_set_p90(value);
+  // @@protoc_insertion_point(field_set:minidfs.Metric.p90)
+}
+
+// int64 p99 = 9;
+inline void Metric::clear_p99() {
+  _impl_.p99_ = int64_t{0};
+}
+inline int64_t Metric::_internal_p99() const {
+  return _impl_.p99_;
+}
+inline int64_t Metric::p99() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.p99)
+  return _internal_p99();
+}
+inline void Metric::_internal_set_p99(int64_t value) {
   
-  return src_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.p99_ = value;
 }
-inline void EditLog::set_allocated_src(std::string* src) {
-  if (src != nullptr) {
-    
-  } else {
-    
-  }
-  src_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), src);
-  // @@protoc_insertion_point(field_set_allocated:minidfs.EditLog.src)
+inline void Metric::set_p99(int64_t value) {
+  _internal_set_p99(value);
+  // @@protoc_insertion_point(field_set:minidfs.Metric.p99)
 }
 
-// int32 dfID = 3;
-inline void EditLog::clear_dfid() {
-  dfid_ = 0;
+// int64 p999 = 10;
+inline void Metric::clear_p999() {
+  _impl_.p999_ = int64_t{0};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 EditLog::dfid() const {
-  // @@protoc_insertion_point(field_get:minidfs.EditLog.dfID)
-  return dfid_;
+inline int64_t Metric::_internal_p999() const {
+  return _impl_.p999_;
 }
-inline void EditLog::set_dfid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline int64_t Metric::p999() const {
+  // @@protoc_insertion_point(field_get:minidfs.Metric.p999)
+  return _internal_p999();
+}
+inline void Metric::_internal_set_p999(int64_t value) {
   
-  dfid_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.EditLog.dfID)
+  _impl_.p999_ = value;
+}
+inline void Metric::set_p999(int64_t value) {
+  _internal_set_p999(value);
+  // @@protoc_insertion_point(field_set:minidfs.Metric.p999)
 }
 
-// repeated .minidfs.Block blks = 6;
-inline int EditLog::blks_size() const {
-  return blks_.size();
+// -------------------------------------------------------------------
+
+// Metrics
+
+// repeated .minidfs.Metric metrics = 1;
+inline int Metrics::_internal_metrics_size() const {
+  return _impl_.metrics_.size();
 }
-inline void EditLog::clear_blks() {
-  blks_.Clear();
+inline int Metrics::metrics_size() const {
+  return _internal_metrics_size();
 }
-inline ::minidfs::Block* EditLog::mutable_blks(int index) {
-  // @@protoc_insertion_point(field_mutable:minidfs.EditLog.blks)
-  return blks_.Mutable(index);
+inline void Metrics::clear_metrics() {
+  _impl_.metrics_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >*
-EditLog::mutable_blks() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.EditLog.blks)
-  return &blks_;
+inline ::minidfs::Metric* Metrics::mutable_metrics(int index) {
+  // @@protoc_insertion_point(field_mutable:minidfs.Metrics.metrics)
+  return _impl_.metrics_.Mutable(index);
 }
-inline const ::minidfs::Block& EditLog::blks(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.EditLog.blks)
-  return blks_.Get(index);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Metric >*
+Metrics::mutable_metrics() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.Metrics.metrics)
+  return &_impl_.metrics_;
 }
-inline ::minidfs::Block* EditLog::add_blks() {
-  // @@protoc_insertion_point(field_add:minidfs.EditLog.blks)
-  return blks_.Add();
+inline const ::minidfs::Metric& Metrics::_internal_metrics(int index) const {
+  return _impl_.metrics_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Block >&
-EditLog::blks() const {
-  // @@protoc_insertion_point(field_list:minidfs.EditLog.blks)
-  return blks_;
+inline const ::minidfs::Metric& Metrics::metrics(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.Metrics.metrics)
+  return _internal_metrics(index);
+}
+inline ::minidfs::Metric* Metrics::_internal_add_metrics() {
+  return _impl_.metrics_.Add();
+}
+inline ::minidfs::Metric* Metrics::add_metrics() {
+  ::minidfs::Metric* _add = _internal_add_metrics();
+  // @@protoc_insertion_point(field_add:minidfs.Metrics.metrics)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::Metric >&
+Metrics::metrics() const {
+  // @@protoc_insertion_point(field_list:minidfs.Metrics.metrics)
+  return _impl_.metrics_;
 }
 
 // -------------------------------------------------------------------
 
-// FileInfo
+// CallerStats
 
-// string name = 1;
-inline void FileInfo::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string caller = 1;
+inline void CallerStats::clear_caller() {
+  _impl_.caller_.ClearToEmpty();
 }
-inline const std::string& FileInfo::name() const {
-  // @@protoc_insertion_point(field_get:minidfs.FileInfo.name)
-  return name_.GetNoArena();
+inline const std::string& CallerStats::caller() const {
+  // @@protoc_insertion_point(field_get:minidfs.CallerStats.caller)
+  return _internal_caller();
 }
-inline void FileInfo::set_name(const std::string& value) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:minidfs.FileInfo.name)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallerStats::set_caller(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.caller_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.CallerStats.caller)
 }
-inline void FileInfo::set_name(std::string&& value) {
-  
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:minidfs.FileInfo.name)
+inline std::string* CallerStats::mutable_caller() {
+  std::string* _s = _internal_mutable_caller();
+  // @@protoc_insertion_point(field_mutable:minidfs.CallerStats.caller)
+  return _s;
 }
-inline void FileInfo::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:minidfs.FileInfo.name)
+inline const std::string& CallerStats::_internal_caller() const {
+  return _impl_.caller_.Get();
 }
-inline void FileInfo::set_name(const char* value, size_t size) {
+inline void CallerStats::_internal_set_caller(const std::string& value) {
   
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:minidfs.FileInfo.name)
+  _impl_.caller_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FileInfo::mutable_name() {
+inline std::string* CallerStats::_internal_mutable_caller() {
   
-  // @@protoc_insertion_point(field_mutable:minidfs.FileInfo.name)
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.caller_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FileInfo::release_name() {
-  // @@protoc_insertion_point(field_release:minidfs.FileInfo.name)
-  
-  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* CallerStats::release_caller() {
+  // @@protoc_insertion_point(field_release:minidfs.CallerStats.caller)
+  return _impl_.caller_.Release();
 }
-inline void FileInfo::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void CallerStats::set_allocated_caller(std::string* caller) {
+  if (caller != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:minidfs.FileInfo.name)
+  _impl_.caller_.SetAllocated(caller, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.caller_.IsDefault()) {
+    _impl_.caller_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.CallerStats.caller)
 }
 
-// bool isDir = 2;
-inline void FileInfo::clear_isdir() {
-  isdir_ = false;
+// int64 queued = 2;
+inline void CallerStats::clear_queued() {
+  _impl_.queued_ = int64_t{0};
 }
-inline bool FileInfo::isdir() const {
-  // @@protoc_insertion_point(field_get:minidfs.FileInfo.isDir)
-  return isdir_;
+inline int64_t CallerStats::_internal_queued() const {
+  return _impl_.queued_;
 }
-inline void FileInfo::set_isdir(bool value) {
+inline int64_t CallerStats::queued() const {
+  // @@protoc_insertion_point(field_get:minidfs.CallerStats.queued)
+  return _internal_queued();
+}
+inline void CallerStats::_internal_set_queued(int64_t value) {
   
-  isdir_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.FileInfo.isDir)
+  _impl_.queued_ = value;
+}
+inline void CallerStats::set_queued(int64_t value) {
+  _internal_set_queued(value);
+  // @@protoc_insertion_point(field_set:minidfs.CallerStats.queued)
 }
 
-// int64 fileLen = 3;
-inline void FileInfo::clear_filelen() {
-  filelen_ = PROTOBUF_LONGLONG(0);
+// int64 handled = 3;
+inline void CallerStats::clear_handled() {
+  _impl_.handled_ = int64_t{0};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 FileInfo::filelen() const {
-  // @@protoc_insertion_point(field_get:minidfs.FileInfo.fileLen)
-  return filelen_;
+inline int64_t CallerStats::_internal_handled() const {
+  return _impl_.handled_;
+}
+inline int64_t CallerStats::handled() const {
+  // @@protoc_insertion_point(field_get:minidfs.CallerStats.handled)
+  return _internal_handled();
 }
-inline void FileInfo::set_filelen(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void CallerStats::_internal_set_handled(int64_t value) {
   
-  filelen_ = value;
-  // @@protoc_insertion_point(field_set:minidfs.FileInfo.fileLen)
+  _impl_.handled_ = value;
+}
+inline void CallerStats::set_handled(int64_t value) {
+  _internal_set_handled(value);
+  // @@protoc_insertion_point(field_set:minidfs.CallerStats.handled)
+}
+
+// int64 rejected = 4;
+inline void CallerStats::clear_rejected() {
+  _impl_.rejected_ = int64_t{0};
+}
+inline int64_t CallerStats::_internal_rejected() const {
+  return _impl_.rejected_;
+}
+inline int64_t CallerStats::rejected() const {
+  // @@protoc_insertion_point(field_get:minidfs.CallerStats.rejected)
+  return _internal_rejected();
+}
+inline void CallerStats::_internal_set_rejected(int64_t value) {
+  
+  _impl_.rejected_ = value;
+}
+inline void CallerStats::set_rejected(int64_t value) {
+  _internal_set_rejected(value);
+  // @@protoc_insertion_point(field_set:minidfs.CallerStats.rejected)
+}
+
+// int64 rate = 5;
+inline void CallerStats::clear_rate() {
+  _impl_.rate_ = int64_t{0};
+}
+inline int64_t CallerStats::_internal_rate() const {
+  return _impl_.rate_;
+}
+inline int64_t CallerStats::rate() const {
+  // @@protoc_insertion_point(field_get:minidfs.CallerStats.rate)
+  return _internal_rate();
+}
+inline void CallerStats::_internal_set_rate(int64_t value) {
+  
+  _impl_.rate_ = value;
+}
+inline void CallerStats::set_rate(int64_t value) {
+  _internal_set_rate(value);
+  // @@protoc_insertion_point(field_set:minidfs.CallerStats.rate)
 }
 
 // -------------------------------------------------------------------
 
-// FileInfos
+// ServerBusy
 
-// repeated .minidfs.FileInfo fileInfos = 1;
-inline int FileInfos::fileinfos_size() const {
-  return fileinfos_.size();
+// int32 retryAfterMs = 1;
+inline void ServerBusy::clear_retryafterms() {
+  _impl_.retryafterms_ = 0;
 }
-inline void FileInfos::clear_fileinfos() {
-  fileinfos_.Clear();
+inline int32_t ServerBusy::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
 }
-inline ::minidfs::FileInfo* FileInfos::mutable_fileinfos(int index) {
-  // @@protoc_insertion_point(field_mutable:minidfs.FileInfos.fileInfos)
-  return fileinfos_.Mutable(index);
+inline int32_t ServerBusy::retryafterms() const {
+  // @@protoc_insertion_point(field_get:minidfs.ServerBusy.retryAfterMs)
+  return _internal_retryafterms();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo >*
-FileInfos::mutable_fileinfos() {
-  // @@protoc_insertion_point(field_mutable_list:minidfs.FileInfos.fileInfos)
-  return &fileinfos_;
+inline void ServerBusy::_internal_set_retryafterms(int32_t value) {
+  
+  _impl_.retryafterms_ = value;
 }
-inline const ::minidfs::FileInfo& FileInfos::fileinfos(int index) const {
-  // @@protoc_insertion_point(field_get:minidfs.FileInfos.fileInfos)
-  return fileinfos_.Get(index);
+inline void ServerBusy::set_retryafterms(int32_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:minidfs.ServerBusy.retryAfterMs)
 }
-inline ::minidfs::FileInfo* FileInfos::add_fileinfos() {
-  // @@protoc_insertion_point(field_add:minidfs.FileInfos.fileInfos)
-  return fileinfos_.Add();
+
+// -------------------------------------------------------------------
+
+// BlockIndexSnapshot
+
+// repeated int64 subdirMtimes = 1;
+inline int BlockIndexSnapshot::_internal_subdirmtimes_size() const {
+  return _impl_.subdirmtimes_.size();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::minidfs::FileInfo >&
-FileInfos::fileinfos() const {
-  // @@protoc_insertion_point(field_list:minidfs.FileInfos.fileInfos)
-  return fileinfos_;
+inline int BlockIndexSnapshot::subdirmtimes_size() const {
+  return _internal_subdirmtimes_size();
+}
+inline void BlockIndexSnapshot::clear_subdirmtimes() {
+  _impl_.subdirmtimes_.Clear();
+}
+inline int64_t BlockIndexSnapshot::_internal_subdirmtimes(int index) const {
+  return _impl_.subdirmtimes_.Get(index);
+}
+inline int64_t BlockIndexSnapshot::subdirmtimes(int index) const {
+  // @@protoc_insertion_point(field_get:minidfs.BlockIndexSnapshot.subdirMtimes)
+  return _internal_subdirmtimes(index);
+}
+inline void BlockIndexSnapshot::set_subdirmtimes(int index, int64_t value) {
+  _impl_.subdirmtimes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:minidfs.BlockIndexSnapshot.subdirMtimes)
+}
+inline void BlockIndexSnapshot::_internal_add_subdirmtimes(int64_t value) {
+  _impl_.subdirmtimes_.Add(value);
+}
+inline void BlockIndexSnapshot::add_subdirmtimes(int64_t value) {
+  _internal_add_subdirmtimes(value);
+  // @@protoc_insertion_point(field_add:minidfs.BlockIndexSnapshot.subdirMtimes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+BlockIndexSnapshot::_internal_subdirmtimes() const {
+  return _impl_.subdirmtimes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+BlockIndexSnapshot::subdirmtimes() const {
+  // @@protoc_insertion_point(field_list:minidfs.BlockIndexSnapshot.subdirMtimes)
+  return _internal_subdirmtimes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+BlockIndexSnapshot::_internal_mutable_subdirmtimes() {
+  return &_impl_.subdirmtimes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+BlockIndexSnapshot::mutable_subdirmtimes() {
+  // @@protoc_insertion_point(field_mutable_list:minidfs.BlockIndexSnapshot.subdirMtimes)
+  return _internal_mutable_subdirmtimes();
+}
+
+// bytes encodedBlkIDs = 2;
+inline void BlockIndexSnapshot::clear_encodedblkids() {
+  _impl_.encodedblkids_.ClearToEmpty();
+}
+inline const std::string& BlockIndexSnapshot::encodedblkids() const {
+  // @@protoc_insertion_point(field_get:minidfs.BlockIndexSnapshot.encodedBlkIDs)
+  return _internal_encodedblkids();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BlockIndexSnapshot::set_encodedblkids(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.encodedblkids_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:minidfs.BlockIndexSnapshot.encodedBlkIDs)
+}
+inline std::string* BlockIndexSnapshot::mutable_encodedblkids() {
+  std::string* _s = _internal_mutable_encodedblkids();
+  // @@protoc_insertion_point(field_mutable:minidfs.BlockIndexSnapshot.encodedBlkIDs)
+  return _s;
+}
+inline const std::string& BlockIndexSnapshot::_internal_encodedblkids() const {
+  return _impl_.encodedblkids_.Get();
+}
+inline void BlockIndexSnapshot::_internal_set_encodedblkids(const std::string& value) {
+  
+  _impl_.encodedblkids_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BlockIndexSnapshot::_internal_mutable_encodedblkids() {
+  
+  return _impl_.encodedblkids_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BlockIndexSnapshot::release_encodedblkids() {
+  // @@protoc_insertion_point(field_release:minidfs.BlockIndexSnapshot.encodedBlkIDs)
+  return _impl_.encodedblkids_.Release();
+}
+inline void BlockIndexSnapshot::set_allocated_encodedblkids(std::string* encodedblkids) {
+  if (encodedblkids != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.encodedblkids_.SetAllocated(encodedblkids, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.encodedblkids_.IsDefault()) {
+    _impl_.encodedblkids_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:minidfs.BlockIndexSnapshot.encodedBlkIDs)
 }
 
 #ifdef __GNUC__
@@ -3522,11 +9918,51 @@ FileInfos::fileinfos() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace minidfs
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::minidfs::Metric_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::minidfs::Metric_Type>() {
+  return ::minidfs::Metric_Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
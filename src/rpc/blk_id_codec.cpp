@@ -0,0 +1,80 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+
+#include <rpc/blk_id_codec.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+namespace rpc {
+
+void encodeBlkIDs(const std::vector<int>& blkIDs, string* encoded) {
+  encoded->clear();
+  std::vector<int> ids(blkIDs);
+  /// reports built from std::set are sorted already
+  if (std::is_sorted(ids.begin(), ids.end()) == false) {
+    std::sort(ids.begin(), ids.end());
+  }
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+  ids.erase(ids.begin(), std::lower_bound(ids.begin(), ids.end(), 0));
+
+  google::protobuf::io::StringOutputStream outRaw(encoded);
+  google::protobuf::io::CodedOutputStream outCoded(&outRaw);
+
+  uint32_t prev = 0;
+  size_t i = 0;
+  while (i < ids.size()) {
+    size_t start = i;
+    while (i + 1 < ids.size() && ids[i + 1] == ids[i] + 1) {
+      ++i;
+    }
+    uint64_t gap = static_cast<uint32_t>(ids[start]) - prev;
+    uint32_t runLen = i - start + 1;
+    outCoded.WriteVarint64(gap << 1 | (runLen > 1 ? 1 : 0));
+    if (runLen > 1) {
+      outCoded.WriteVarint32(runLen - 1);
+    }
+    prev = static_cast<uint32_t>(ids[i]);
+    ++i;
+  }
+}
+
+int decodeBlkIDs(const string& encoded, std::vector<int>* blkIDs, size_t maxIDs) {
+  blkIDs->clear();
+  google::protobuf::io::CodedInputStream inCoded(
+      reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size());
+
+  /// 64-bit, so a gap can't wrap an id around past INT_MAX
+  uint64_t prev = 0;
+  while (inCoded.CurrentPosition() < static_cast<int>(encoded.size())) {
+    uint64_t head = 0;
+    if (false == inCoded.ReadVarint64(&head)) {
+      return -1;
+    }
+    uint32_t runLen = 1;
+    if (head & 1) {
+      uint32_t extra = 0;
+      if (false == inCoded.ReadVarint32(&extra) || extra >= (1u << 30)) {
+        return -1;
+      }
+      runLen += extra;
+    }
+    uint64_t id = prev + (head >> 1);
+    if (id + runLen - 1 > INT_MAX || blkIDs->size() + runLen > maxIDs) {
+      return -1;
+    }
+    for (uint32_t j = 0; j < runLen; ++j) {
+      blkIDs->push_back(static_cast<int>(id + j));
+    }
+    prev = id + runLen - 1;
+  }
+  return 0;
+}
+
+} // namespace rpc
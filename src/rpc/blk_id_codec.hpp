@@ -0,0 +1,49 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Compact encoding of block id lists used by block reports.
+
+#ifndef BLK_ID_CODEC_H_
+#define BLK_ID_CODEC_H_
+
+#include <string>
+#include <vector>
+
+using std::string;
+
+namespace rpc {
+
+/// Max number of ids decoded from one byte string. A run of a few bytes
+/// stands for up to 2^30 ids, so a malformed report must not be expanded
+/// blindly. 16M ids are 64 MB decoded, far more than a chunkserver holds.
+const size_t kMaxDecodedBlkIDs = 1 << 24;
+
+/// \brief Encode block ids into a compact byte string.
+///
+/// The ids are sorted and deduplicated first. Then each run of consecutive ids
+/// is written as varints:
+/// gap << 1 | hasRun : [runLength - 1]
+/// gap is the distance to the end of the previous run (to 0 for the 1st run).
+/// runLength is only written when hasRun is set, i.e. the run is longer than 1.
+/// Blocks are allocated sequentially, so a full report usually costs 1-2 bytes
+/// per scattered block and a few bytes per run of consecutive blocks.
+///
+/// \param blkIDs block ids, in any order. Block ids are positive, the
+/// negative ones are not encoded.
+/// \param encoded the returning encoded bytes
+void encodeBlkIDs(const std::vector<int>& blkIDs, string* encoded);
+
+/// \brief Decode the bytes produced by encodeBlkIDs().
+///
+/// \param encoded encoded bytes
+/// \param blkIDs the returning block ids, sorted in ascending order
+/// \param maxIDs max number of ids to decode
+/// \return return 0 on success, -1 for malformed input, for an id above
+/// INT_MAX or for more than maxIDs ids
+int decodeBlkIDs(const string& encoded, std::vector<int>* blkIDs,
+                 size_t maxIDs = kMaxDecodedBlkIDs);
+
+} // namespace rpc
+
+#endif
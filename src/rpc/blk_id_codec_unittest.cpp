@@ -0,0 +1,163 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for block id codec
+
+#include <rpc/blk_id_codec.hpp>
+#include <proto/minidfs.pb.h>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <algorithm>
+
+namespace {
+
+void RoundTrip(const std::vector<int>& ids) {
+  string encoded;
+  rpc::encodeBlkIDs(ids, &encoded);
+
+  std::vector<int> expected(ids);
+  std::sort(expected.begin(), expected.end());
+  expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+  std::vector<int> decoded;
+  assert(0 == rpc::decodeBlkIDs(encoded, &decoded));
+  assert(decoded == expected);
+}
+
+void TestRoundTrip() {
+  RoundTrip({});
+  RoundTrip({1});
+  RoundTrip({1, 2, 3, 4, 5});
+  RoundTrip({9, 3, 3, 1, 2, 100, 101, 7});
+  RoundTrip({0, 5, 2147483646, 2147483647});
+
+  string encoded;
+  rpc::encodeBlkIDs({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, &encoded);
+  /// one run: head and length
+  assert(encoded.size() == 2);
+
+  /// negative ids are not block ids
+  rpc::encodeBlkIDs({-5, -1, 3}, &encoded);
+  std::vector<int> decoded;
+  assert(0 == rpc::decodeBlkIDs(encoded, &decoded));
+  assert(decoded == std::vector<int>({3}));
+
+  assert(-1 == rpc::decodeBlkIDs(string(1, '\x80'), &decoded));
+
+  ::printf("round trip pass ...\n");
+}
+
+void TestMalformed() {
+  std::vector<int> decoded;
+  string encoded;
+  {
+    /// a run of 2^30 ids in 6 bytes
+    google::protobuf::io::StringOutputStream outRaw(&encoded);
+    google::protobuf::io::CodedOutputStream outCoded(&outRaw);
+    outCoded.WriteVarint64(1 << 1 | 1);
+    outCoded.WriteVarint32((1u << 30) - 1);
+  }
+  assert(-1 == rpc::decodeBlkIDs(encoded, &decoded));
+  assert(-1 == rpc::decodeBlkIDs(encoded, &decoded, 100));
+
+  /// the same run is fine below the limit
+  encoded.clear();
+  {
+    google::protobuf::io::StringOutputStream outRaw(&encoded);
+    google::protobuf::io::CodedOutputStream outCoded(&outRaw);
+    outCoded.WriteVarint64(1 << 1 | 1);
+    outCoded.WriteVarint32(99);
+  }
+  assert(0 == rpc::decodeBlkIDs(encoded, &decoded, 100) && decoded.size() == 100);
+  assert(-1 == rpc::decodeBlkIDs(encoded, &decoded, 99));
+
+  /// ids past INT_MAX, by a single gap or by a run
+  encoded.clear();
+  {
+    google::protobuf::io::StringOutputStream outRaw(&encoded);
+    google::protobuf::io::CodedOutputStream outCoded(&outRaw);
+    outCoded.WriteVarint64(uint64_t(1) << 40);
+  }
+  assert(-1 == rpc::decodeBlkIDs(encoded, &decoded));
+  encoded.clear();
+  {
+    google::protobuf::io::StringOutputStream outRaw(&encoded);
+    google::protobuf::io::CodedOutputStream outCoded(&outRaw);
+    outCoded.WriteVarint64(uint64_t(2147483646) << 1 | 1);
+    outCoded.WriteVarint32(2);
+  }
+  assert(-1 == rpc::decodeBlkIDs(encoded, &decoded));
+
+  ::printf("malformed pass ...\n");
+}
+
+/// Compare the encoded report with the repeated int32 field for 1M blocks.
+void Measure(const char* name, const std::vector<int>& ids) {
+  using std::chrono::steady_clock;
+  using std::chrono::microseconds;
+
+  auto start = steady_clock::now();
+  minidfs::BlockReport plain;
+  for (int id : ids) {
+    plain.add_blkids(id);
+  }
+  string plainBytes = plain.SerializeAsString();
+  auto plainUs = std::chrono::duration_cast<microseconds>(steady_clock::now() - start).count();
+
+  start = steady_clock::now();
+  string encoded;
+  rpc::encodeBlkIDs(ids, &encoded);
+  auto encodeUs = std::chrono::duration_cast<microseconds>(steady_clock::now() - start).count();
+
+  start = steady_clock::now();
+  std::vector<int> decoded;
+  assert(0 == rpc::decodeBlkIDs(encoded, &decoded));
+  auto decodeUs = std::chrono::duration_cast<microseconds>(steady_clock::now() - start).count();
+  assert(decoded.size() == ids.size());
+
+  ::printf("%s: %zu blocks, repeated int32 %zu bytes (%lld us), "
+           "encoded %zu bytes (encode %lld us, decode %lld us)\n",
+           name, ids.size(), plainBytes.size(), (long long)plainUs,
+           encoded.size(), (long long)encodeUs, (long long)decodeUs);
+}
+
+void TestMillionBlocks() {
+  const int nBlks = 1000000;
+
+  /// a single chunkserver holds every block
+  std::vector<int> dense(nBlks);
+  for (int i = 0; i < nBlks; ++i) {
+    dense[i] = i + 1;
+  }
+  Measure("dense", dense);
+
+  /// a chunkserver holds 1M of 3M blocks, e.g. 3 replicas on 9 nodes
+  std::mt19937 rng(7);
+  std::vector<int> sparse;
+  for (int id = 1; (int)sparse.size() < nBlks; ++id) {
+    if (rng() % 3 == 0) {
+      sparse.push_back(id);
+    }
+  }
+  std::shuffle(sparse.begin(), sparse.end(), rng);
+  Measure("sparse", sparse);
+}
+
+} // namespace
+
+void TestBlkIDCodec() {
+  ::printf("Test BlkIDCodec...\n");
+
+  TestRoundTrip();
+  TestMalformed();
+  TestMillionBlocks();
+
+  ::printf("\n");
+}
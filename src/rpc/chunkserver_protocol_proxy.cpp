@@ -4,6 +4,7 @@
 /// \author Wang Xi
 
 #include <rpc/chunkserver_protocol_proxy.hpp>
+#include <rpc/blk_id_codec.hpp>
 #include "logging/logger.h"
 
 
@@ -14,55 +15,41 @@ ChunkserverProtocolProxy::ChunkserverProtocolProxy(const string& serverIP, int s
 }
 
 
-int ChunkserverProtocolProxy::heartBeat(const minidfs::ChunkserverInfo& chunkserverInfo){
-  /// connect Master
-  if (client.connectMaster() < 0) {
-    LOG_ERROR  << "Connection to master failed";
+int ChunkserverProtocolProxy::heartBeat(const minidfs::Heartbeat& heartbeat, minidfs::BlockTasks* blkTasks){
+  /// call the master, retrying while it is busy
+  int status = OpCode::OP_FAILURE;
+  string response;
+  if (client.call(101, heartbeat.SerializeAsString(), &status, &response) < 0) {
+    LOG_ERROR << "Failed to send heart beat";
     return OpCode::OP_FAILURE;
   }
-
-  /// send the request
-  if (client.sendRequest(101, chunkserverInfo.SerializeAsString()) < 0) {
-    LOG_ERROR  << "Failed to send heart beat";
-    return OpCode::OP_FAILURE;
+  if (status == OpCode::OP_SERVER_BUSY) {
+    LOG_WARN << "Master is busy, heart beat dropped";
+    return status;
   }
-
-  /// recv the response
-  int status;
-  string response;
-  int success = client.recvResponse(&status, &response);
-
-  /// close the connection
-  client.closeConnection();
+  blkTasks->ParseFromString(response);
 
   LOG_DEBUG << "Send heartbeat rpc successfully";
   return status;
 }
 
 int ChunkserverProtocolProxy::blkReport(const minidfs::ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs, std::vector<int>& deletedBlks) {
-  /// connect Master
-  if (client.connectMaster() < 0) {
-    LOG_ERROR  << "Connection to master failed";
-    return OpCode::OP_FAILURE;
-  }
-
   /// construct the request
   minidfs::BlockReport blkReport;
   *blkReport.mutable_chunkserverinfo() = chunkserverInfo;
-  for (int blkid : blkIDs) {
-    blkReport.add_blkids(blkid);
-  }
+  encodeBlkIDs(blkIDs, blkReport.mutable_encodedblkids());
 
-  /// send the request
-  if (client.sendRequest(102, blkReport.SerializeAsString()) < 0) {
-    LOG_ERROR  << "Failed to send blk report";
+  /// call the master, retrying while it is busy
+  int status = OpCode::OP_FAILURE;
+  string response;
+  if (client.call(102, blkReport.SerializeAsString(), &status, &response) < 0) {
+    LOG_ERROR << "Failed to send blk report";
     return OpCode::OP_FAILURE;
   }
-
-  /// recv the response
-  int status;
-  string response;
-  int success = client.recvResponse(&status, &response);
+  if (status == OpCode::OP_SERVER_BUSY) {
+    LOG_WARN << "Master is busy, blk report dropped";
+    return status;
+  }
 
   minidfs::BlkIDs deletedBlkIDs;
   deletedBlkIDs.ParseFromString(response);
@@ -70,71 +57,10 @@ int ChunkserverProtocolProxy::blkReport(const minidfs::ChunkserverInfo& chunkser
   for (int i = 0; i < deletedBlkIDs.blkids_size(); ++i) {
     deletedBlks.push_back(deletedBlkIDs.blkids(i));
   }
-  
-  /// close the connection
-  client.closeConnection();
 
   LOG_DEBUG << "Send blk report rpc successfully";
   return status;
 }
 
-int ChunkserverProtocolProxy::getBlkTask(const minidfs::ChunkserverInfo& chunkserverInfo, minidfs::BlockTasks* blkTasks) {
-  /// connect Master
-  if (client.connectMaster() < 0) {
-    LOG_ERROR << "Connection to master failed";
-    return OpCode::OP_FAILURE;
-  }
-
-  /// send the request
-  if (client.sendRequest(103, chunkserverInfo.SerializeAsString()) < 0) {
-    LOG_ERROR << "Failed to send get blk task request";
-    return OpCode::OP_FAILURE;
-  }
-
-  /// recv the response
-  int status;
-  string response;
-  int success = client.recvResponse(&status, &response);
-  blkTasks->ParseFromString(response);
-
-  /// close the connection
-  client.closeConnection();
-
-  LOG_DEBUG << "Send get blk task rpc successfully";
-  return status;
-}
-
-int ChunkserverProtocolProxy::recvedBlks(const minidfs::ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs) {
-  /// connect Master
-  if (client.connectMaster() < 0) {
-    LOG_ERROR << "Connection to master failed";
-    return OpCode::OP_FAILURE;
-  }
-
-  /// construct the request
-  minidfs::BlockReport blkReport;
-  *blkReport.mutable_chunkserverinfo() = chunkserverInfo;
-  for (int blkid : blkIDs) {
-    blkReport.add_blkids(blkid);
-  }
-
-  /// send the request
-  if (client.sendRequest(104, blkReport.SerializeAsString()) < 0) {
-    LOG_ERROR << "Failed to send recvedBlks rpc request";
-    return OpCode::OP_FAILURE;
-  }
-
-  /// recv the response
-  int status;
-  string response;
-  int success = client.recvResponse(&status, &response);
-  
-  /// close the connection
-  client.closeConnection();
-
-  LOG_DEBUG << "Send recved blks rpc successfully";
-  return status;
-}
-
 
 } // namespace rpc
\ No newline at end of file
@@ -30,9 +30,11 @@ class ChunkserverProtocolProxy: public minidfs::ChunkserverProtocol {
 
   /// \brief Send heartbeat information to Master. MethodID = 101.
   ///
-  /// \param chunkserverInfo containing the ip and port of the chunkserver
+  /// \param heartbeat containing the chunkserver info, load and received blocks
+  /// \param blkTasks block tasks from master.
+  ///        It is the returning parameter.
   /// \return return OpCode.
-  virtual int heartBeat(const minidfs::ChunkserverInfo& chunkserverInfo) override;
+  virtual int heartBeat(const minidfs::Heartbeat& heartbeat, minidfs::BlockTasks* blkTasks) override;
 
   /// \brief Send block report to Master. MethodID = 102.
   ///
@@ -44,22 +46,6 @@ class ChunkserverProtocolProxy: public minidfs::ChunkserverProtocol {
   /// \return return OpCode.
   virtual int blkReport(const minidfs::ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs, std::vector<int>& deletedBlks) override;
 
-  /// \brief Get block task from Master. MethodID = 103.
-  ///
-  /// \param chunkserverInfo containing the ip and port of the chunkserver
-  /// \param blkTasks block tasks from master. 
-  ///        It is the returning parameter.      
-  /// \return return OpCode.
-  virtual int getBlkTask(const minidfs::ChunkserverInfo& chunkserverInfo, minidfs::BlockTasks* blkTasks) override;
-
-  /// \brief Inform Master about the received blocks. MethodID = 104.
-  ///
-  /// The chunkserver informs Master about all the blocks it received
-  /// \param chunkserverInfo containing the ip and port of the chunkserver
-  /// \param blkIDs all the block ids it received
-  /// \return return OpCode.
-  virtual int recvedBlks(const minidfs::ChunkserverInfo& chunkserverInfo, const std::vector<int>& blkIDs) override;
-
 };
 
 } // namespace rpc
@@ -17,184 +17,113 @@ ClientProtocolProxy::~ClientProtocolProxy() {
 
 
 int ClientProtocolProxy::getBlockLocations(const string& file, minidfs::LocatedBlocks* locatedBlks){
-  /// send request
-  int connOp = -1;
-  if ((connOp = connectAndRequest(file, 1)) != OpCode::OP_SUCCESS) {
-    return connOp;
-  }
-
-  /// recv the response
-  int status;
   string response;
-  int success = client.recvResponse(&status, &response);
+  int status = call(1, file, &response);
   locatedBlks->ParseFromString(response);
-
-  /// close the connection
-  client.closeConnection();
-
   return status;
 }
 
 int ClientProtocolProxy::create(const string& file, minidfs::LocatedBlock* locatedBlk) {
-  /// send request
-  int connOp = -1;
-  if ((connOp = connectAndRequest(file, 2)) != OpCode::OP_SUCCESS) {
-    return connOp;
-  }
-
-  /// recv the response
-  int status;
   string response;
-  int success = client.recvResponse(&status, &response);
+  int status = call(2, file, &response);
   locatedBlk->ParseFromString(response);
-
-  /// close the connection
-  client.closeConnection();
-  
   return status;
 }
 
-int ClientProtocolProxy::addBlock(const string& file, minidfs::LocatedBlock* locatedBlk) {
-  /// send request
-  int connOp = -1;
-  if ((connOp = connectAndRequest(file, 3)) != OpCode::OP_SUCCESS) {
-    return connOp;
-  }
+int ClientProtocolProxy::createEC(const string& file, const minidfs::ECSchema& schema,
+                                  minidfs::LocatedBlock* locatedBlk) {
+  minidfs::ECFile request;
+  request.set_name(file);
+  *request.mutable_ecschema() = schema;
 
-  /// recv the response
-  int status;
   string response;
-  int success = client.recvResponse(&status, &response);
+  int status = call(6, request.SerializeAsString(), &response);
   locatedBlk->ParseFromString(response);
+  return status;
+}
 
-  /// close the connection
-  client.closeConnection();
-  
+int ClientProtocolProxy::addBlock(const string& file, minidfs::LocatedBlock* locatedBlk) {
+  string response;
+  int status = call(3, file, &response);
+  locatedBlk->ParseFromString(response);
   return status;
 }
 
 int ClientProtocolProxy::blockAck(const minidfs::LocatedBlock& locatedBlk) {
-  /// send request
-  int connOp = -1;
-  if ((connOp = connectAndRequest(locatedBlk.SerializeAsString(), 4)) != OpCode::OP_SUCCESS) {
-    return connOp;
-  }
-
-  /// recv the response
-  int status;
   string response;
-  int success = client.recvResponse(&status, &response);
-
-  /// close the connection
-  client.closeConnection();
-  
+  int status = call(4, locatedBlk.SerializeAsString(), &response);
   return status;
 }
 
 int ClientProtocolProxy::complete(const string& file) {
-  /// send request
-  int connOp = -1;
-  if ((connOp = connectAndRequest(file, 5)) != OpCode::OP_SUCCESS) {
-    return connOp;
-  }
-
-  /// recv the response
-  int status;
   string response;
-  int success = client.recvResponse(&status, &response);
+  int status = call(5, file, &response);
+  return status;
+}
 
-  /// close the connection
-  client.closeConnection();
-  
+int ClientProtocolProxy::createPack(const minidfs::Pack& pack, minidfs::LocatedBlock* locatedBlk) {
+  string response;
+  int status = call(7, pack.SerializeAsString(), &response);
+  locatedBlk->ParseFromString(response);
   return status;
 }
 
-int ClientProtocolProxy::remove(const string& file) {
-  /// send request
-  int connOp = -1;
-  if ((connOp = connectAndRequest(file, 11)) != OpCode::OP_SUCCESS) {
-    return connOp;
-  }
+int ClientProtocolProxy::completePack(const minidfs::Pack& pack) {
+  string response;
+  int status = call(8, pack.SerializeAsString(), &response);
+  return status;
+}
 
-  /// recv the response
-  int status;
+int ClientProtocolProxy::createInline(const minidfs::InlineFile& file) {
   string response;
-  int success = client.recvResponse(&status, &response);
+  int status = call(9, file.SerializeAsString(), &response);
+  return status;
+}
 
-  /// close the connection
-  client.closeConnection();
-  
+int ClientProtocolProxy::remove(const string& file) {
+  string response;
+  int status = call(11, file, &response);
   return status;
 }
 
 int ClientProtocolProxy::exists(const string& file) {
-  /// send request
-  int connOp = -1;
-  if ((connOp = connectAndRequest(file, 12)) != OpCode::OP_SUCCESS) {
-    return connOp;
-  }
-
-  /// recv the response
-  int status;
   string response;
-  int success = client.recvResponse(&status, &response);
-
-  /// close the connection
-  client.closeConnection();
-  
+  int status = call(12, file, &response);
   return status;
 }
 
 int ClientProtocolProxy::makeDir(const string& dirName) {
-  /// send request
-  int connOp = -1;
-  if ((connOp = connectAndRequest(dirName, 13)) != OpCode::OP_SUCCESS) {
-    return connOp;
-  }
-
-  /// recv the response
-  int status;
   string response;
-  int success = client.recvResponse(&status, &response);
-
-  /// close the connection
-  client.closeConnection();
-  
+  int status = call(13, dirName, &response);
   return status;
 }
 
 int ClientProtocolProxy::listDir(const string& dirName, minidfs::FileInfos& items) {
-  /// send request
-  int connOp = -1;
-  if ((connOp = connectAndRequest(dirName, 14)) != OpCode::OP_SUCCESS) {
-    return connOp;
-  }
-
-  /// recv the response
-  int status;
   string response;
-  int success = client.recvResponse(&status, &response);
+  int status = call(14, dirName, &response);
   items.ParseFromString(response);
+  return status;
+}
 
-  /// close the connection
-  client.closeConnection();
-  
+int ClientProtocolProxy::getServerStats(minidfs::ServerStats* stats) {
+  string response;
+  int status = call(21, string(), &response);
+  stats->ParseFromString(response);
   return status;
 }
 
-int ClientProtocolProxy::connectAndRequest(const string& requst, int methodID) {
-  /// connect Master
-  if (client.connectMaster() < 0) {
-    LOG_ERROR  << "Connection to master failed";
+int ClientProtocolProxy::call(int methodID, const string& request, string* response) {
+  int status = OpCode::OP_FAILURE;
+  if (client.call(methodID, request, &status, response) < 0) {
+    LOG_ERROR  << "Failed to call master, method id: " << methodID;
     return OpCode::OP_FAILURE;
   }
-
-  /// send the request
-  if (client.sendRequest(methodID, requst) < 0) {
-    LOG_ERROR  << "Failed to send request to master";
-    return OpCode::OP_FAILURE;
+  if (status == OpCode::OP_SERVER_BUSY) {
+    /// the response is a ServerBusy, not the one of the method
+    LOG_WARN << "Master is still busy, method id: " << methodID;
+    response->clear();
   }
-  return OpCode::OP_SUCCESS;
+  return status;
 }
 
 } // namespace rpc
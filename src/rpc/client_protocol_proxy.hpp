@@ -54,6 +54,16 @@ class ClientProtocolProxy: public minidfs::ClientProtocol {
   /// \return return OpCode.
   virtual int create(const string& file, minidfs::LocatedBlock* locatedBlk) override;
 
+  /// \brief Create an erasure-coded file. MethodID = 6.
+  ///
+  /// \param file the file name stored in minidfs.
+  /// \param schema the layout of the block groups
+  /// \param locatedBlk contains chunkservers' information.
+  ///        It is the returning parameter. 
+  /// \return return OpCode.
+  virtual int createEC(const string& file, const minidfs::ECSchema& schema,
+                       minidfs::LocatedBlock* locatedBlk) override;
+
   /// \brief Add a block when the client has finished the previous block. MethodID = 3.
   ///
   /// When the client create() a file and finishes the 1st block, it calls addBlock()
@@ -87,6 +97,26 @@ class ClientProtocolProxy: public minidfs::ClientProtocol {
   /// \return return OpCode.
   virtual int complete(const string& file) override;
 
+  /// \brief Create small files packed into a shared container block. MethodID = 7.
+  ///
+  /// \param pack the names and lengths of the files
+  /// \param locatedBlk the container block and its chunkservers.
+  ///        It is the returning parameter.
+  /// \return return OpCode.
+  virtual int createPack(const minidfs::Pack& pack, minidfs::LocatedBlock* locatedBlk) override;
+
+  /// \brief Complete writing packed small files. MethodID = 8.
+  ///
+  /// \param pack the files and the written container block
+  /// \return return OpCode.
+  virtual int completePack(const minidfs::Pack& pack) override;
+
+  /// \brief Create a tiny file stored inline in the master. MethodID = 9.
+  ///
+  /// \param file the name and the contents of the file
+  /// \return return OpCode.
+  virtual int createInline(const minidfs::InlineFile& file) override;
+
 
   //////////////////////////
   /// Name system operations
@@ -118,14 +148,22 @@ class ClientProtocolProxy: public minidfs::ClientProtocol {
   /// \return return OpCode.
   virtual int listDir(const string& dirName,  minidfs::FileInfos& items) override;
 
+  /// \brief Get the statistics of the master's RPC server. MethodID = 21.
+  ///
+  /// \param stats the queue depth and the calls handled of each lane.
+  ///        It is the returning parameter.
+  /// \return return OpCode.
+  virtual int getServerStats(minidfs::ServerStats* stats) override;
+
  private:
  
-  /// \brief Connect the master and send the request.
+  /// \brief Call the master, retrying while it is busy.
   ///
-  /// \param request the request.
   /// \param methodID method ID
+  /// \param request the request.
+  /// \param response the returning response.
   /// \return return OpCode.
-  int connectAndRequest(const string& requst, int methodID);
+  int call(int methodID, const string& request, string* response);
 };
 
 
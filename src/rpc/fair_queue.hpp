@@ -0,0 +1,273 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief A queue shared fairly by the callers with deficit round robin.
+
+#ifndef FAIR_QUEUE_H_
+#define FAIR_QUEUE_H_
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using std::string;
+
+namespace rpc {
+
+/// \brief Queued and handled items of a caller.
+struct CallerStats {
+  string caller;
+  long long queued;
+  long long handled;
+  long long rejected;
+  /// items popped in the last full second
+  long long rate;
+};
+
+/// \brief FairQueue keeps a FIFO queue per caller, and pops across the callers
+/// with deficit round robin (Shreedhar and Varghese, SIGCOMM 1995).
+///
+/// Each round, a caller with queued items earns a quantum of credit, and its
+/// items are popped while the credit lasts. An item popped is charged the
+/// average cost of the items of its caller, and settled with its actual cost,
+/// e.g. the time it took, once handled. So a caller of expensive calls gets
+/// fewer of them popped, even while they are handled concurrently, and a
+/// caller of cheap ones is not stuck behind them. The debt of an idle caller
+/// is kept, and the credit is not.
+///
+/// A caller with no item queued or being handled is idle. Idle callers are
+/// kept for their debt and statistics in an LRU list of bounded size, and the
+/// least recently seen is forgotten beyond it.
+///
+/// It is thread safe.
+template<class T>
+class FairQueue {
+ private:
+  struct Flow {
+    std::deque<T> items;
+    long long deficit = 0;
+    /// 8 times the average cost of the items, which is charged when one is popped
+    long long estimateX8 = 0;
+    /// in the round robin list
+    bool active = false;
+    /// items popped but not settled
+    long long inFlight = 0;
+
+    long long handled = 0;
+    long long rejected = 0;
+    /// for the rate: the second of the current window, the items popped in
+    /// it and in the one before
+    long long windowSec = 0;
+    long long inWindow = 0;
+    long long lastWindow = 0;
+  };
+
+  typedef std::unordered_map<string, Flow> FlowMap;
+  typedef std::list<std::pair<string, Flow>> IdleList;
+
+  const long long quantum;
+
+  const size_t maxIdle;
+
+  /// callers with queued or in-flight items
+  FlowMap flows;
+
+  /// idle callers, the most recently seen first
+  IdleList idle;
+  std::unordered_map<string, typename IdleList::iterator> idleIndex;
+
+  /// callers with queued items, in round robin order
+  std::deque<string> active;
+
+  size_t nItems;
+
+  mutable std::mutex mutexFlows;
+
+ public:
+  /// \param quantum credit earned by a caller each round, and the estimated
+  /// cost of the first item of a caller
+  /// \param maxIdle max number of idle callers kept
+  explicit FairQueue(long long quantum, size_t maxIdle = 1024)
+      : quantum(quantum), maxIdle(maxIdle), nItems(0) {
+  }
+
+  /// \brief Queue an item of a caller.
+  ///
+  /// When maxItems are queued, the item is refused if the caller has its fair
+  /// share of them, so a caller flooding the queue is refused first.
+  ///
+  /// \param caller the caller
+  /// \param item the item
+  /// \param maxItems max number of queued items, 0 for no limit
+  /// \return false if the item is refused
+  bool push(const string& caller, T item, size_t maxItems = 0) {
+    std::lock_guard<std::mutex> lockFlows(mutexFlows);
+    auto it = getFlow(caller);
+    Flow& flow = it->second;
+    if (maxItems > 0 && nItems >= maxItems
+        && flow.items.size() >= std::max<size_t>(1, maxItems / (active.size() + !flow.active))) {
+      ++flow.rejected;
+      retireIfIdle(it);
+      return false;
+    }
+    flow.items.push_back(std::move(item));
+    ++nItems;
+    if (flow.active == false) {
+      flow.active = true;
+      active.push_back(caller);
+    }
+    return true;
+  }
+
+  /// \brief Pop the next item in deficit round robin order, and charge its
+  /// caller the estimated cost. settle() it once handled.
+  ///
+  /// \param caller the returning caller of the item
+  /// \param item the returning item
+  /// \param charged the returning cost charged
+  /// \return false if the queue is empty
+  bool pop(string* caller, T* item, long long* charged) {
+    std::lock_guard<std::mutex> lockFlows(mutexFlows);
+    while (active.empty() == false) {
+      Flow& flow = flows[active.front()];
+      if (flow.deficit <= 0) {
+        /// the turn of the caller is over, it earns the credit of next round
+        flow.deficit += quantum;
+        active.push_back(active.front());
+        active.pop_front();
+        continue;
+      }
+      *caller = active.front();
+      *item = std::move(flow.items.front());
+      flow.items.pop_front();
+      --nItems;
+      *charged = flow.estimateX8 / 8;
+      flow.deficit -= *charged;
+      ++flow.inFlight;
+      count(&flow);
+      if (flow.items.empty()) {
+        /// the credit is not saved for later
+        flow.deficit = std::min(flow.deficit, 0LL);
+        flow.active = false;
+        active.pop_front();
+      }
+      return true;
+    }
+    return false;
+  }
+
+  /// \brief Settle the cost of an item popped, and update the estimate of
+  /// its caller.
+  ///
+  /// \param caller the caller
+  /// \param charged the cost charged by pop()
+  /// \param cost the actual cost, in the unit of the quantum
+  void settle(const string& caller, long long charged, long long cost) {
+    std::lock_guard<std::mutex> lockFlows(mutexFlows);
+    auto it = flows.find(caller);
+    if (it == flows.end()) {
+      return;
+    }
+    Flow& flow = it->second;
+    flow.deficit += charged - cost;
+    /// moving average over about 8 items
+    flow.estimateX8 += cost - flow.estimateX8 / 8;
+    --flow.inFlight;
+    retireIfIdle(it);
+  }
+
+  /// \brief Number of queued items.
+  size_t size() const {
+    std::lock_guard<std::mutex> lockFlows(mutexFlows);
+    return nItems;
+  }
+
+  /// \brief Get the statistics of the callers not idle, and of the idle
+  /// ones kept.
+  ///
+  /// \param stats the returning statistics
+  void getStats(std::vector<CallerStats>* stats) const {
+    long long now = nowSec();
+    std::lock_guard<std::mutex> lockFlows(mutexFlows);
+    for (const auto& f : flows) {
+      stats->push_back(toStats(f.first, f.second, now));
+    }
+    for (const auto& f : idle) {
+      stats->push_back(toStats(f.first, f.second, now));
+    }
+  }
+
+ private:
+  static long long nowSec() {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  static CallerStats toStats(const string& caller, const Flow& flow, long long now) {
+    long long rate = 0;
+    if (flow.windowSec == now) {
+      rate = flow.lastWindow;
+    } else if (flow.windowSec == now - 1) {
+      rate = flow.inWindow;
+    }
+    return CallerStats{caller, static_cast<long long>(flow.items.size()),
+                       flow.handled, flow.rejected, rate};
+  }
+
+  /// Get the flow of a caller, bringing it back from the idle ones, or a new one.
+  typename FlowMap::iterator getFlow(const string& caller) {
+    auto it = flows.find(caller);
+    if (it != flows.end()) {
+      return it;
+    }
+    it = flows.emplace(caller, Flow()).first;
+    auto idleIt = idleIndex.find(caller);
+    if (idleIt != idleIndex.end()) {
+      it->second = std::move(idleIt->second->second);
+      idle.erase(idleIt->second);
+      idleIndex.erase(idleIt);
+    } else {
+      it->second.estimateX8 = quantum * 8;
+    }
+    return it;
+  }
+
+  /// Move the flow of a caller to the idle ones if it has no item queued or
+  /// in flight, and forget the least recently seen one beyond maxIdle.
+  void retireIfIdle(typename FlowMap::iterator it) {
+    Flow& flow = it->second;
+    if (flow.active || flow.inFlight > 0) {
+      return;
+    }
+    /// nor the one settled after the last item was popped
+    flow.deficit = std::min(flow.deficit, 0LL);
+    idle.emplace_front(it->first, std::move(flow));
+    idleIndex[it->first] = idle.begin();
+    flows.erase(it);
+    if (idle.size() > maxIdle) {
+      idleIndex.erase(idle.back().first);
+      idle.pop_back();
+    }
+  }
+
+  void count(Flow* flow) {
+    ++flow->handled;
+    long long now = nowSec();
+    if (flow->windowSec != now) {
+      flow->lastWindow = flow->windowSec == now - 1 ? flow->inWindow : 0;
+      flow->windowSec = now;
+      flow->inWindow = 0;
+    }
+    ++flow->inWindow;
+  }
+};
+
+} // namespace rpc
+
+#endif
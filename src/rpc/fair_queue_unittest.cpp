@@ -0,0 +1,157 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for FairQueue
+
+#include <rpc/fair_queue.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <map>
+
+namespace {
+
+void TestRoundRobin() {
+  rpc::FairQueue<int> queue(1);
+  for (int i = 0; i < 100; ++i) {
+    assert(queue.push("batch", i));
+  }
+  for (int i = 0; i < 3; ++i) {
+    assert(queue.push("shell", i));
+  }
+  assert(queue.size() == 103);
+
+  /// the shell calls are not queued behind the batch ones
+  std::map<string, int> popped;
+  string caller;
+  int item = -1;
+  long long charged = 0;
+  for (int i = 0; i < 6; ++i) {
+    assert(queue.pop(&caller, &item, &charged));
+    assert(item == popped[caller]++);
+    queue.settle(caller, charged, 1);
+  }
+  assert(popped["shell"] == 3 && popped["batch"] == 3);
+
+  while (queue.pop(&caller, &item, &charged)) {
+    assert(caller == "batch" && item == popped[caller]++);
+  }
+  assert(queue.size() == 0 && popped["batch"] == 100);
+  ::printf("round robin pass ...\n");
+}
+
+void TestCost() {
+  rpc::FairQueue<int> queue(5);
+  for (int i = 0; i < 1000; ++i) {
+    queue.push("heavy", i);
+    queue.push("light", i);
+  }
+  /// heavy calls cost 10 times more, so they get a tenth of the pops
+  std::map<string, int> popped;
+  string caller;
+  int item = -1;
+  long long charged = 0;
+  for (int i = 0; i < 1100; ++i) {
+    assert(queue.pop(&caller, &item, &charged));
+    ++popped[caller];
+    queue.settle(caller, charged, caller == "heavy" ? 10 : 1);
+  }
+  assert(popped["heavy"] >= 90 && popped["heavy"] <= 110);
+  ::printf("cost pass ...\n");
+}
+
+void TestAdmission() {
+  rpc::FairQueue<int> queue(1);
+  for (int i = 0; i < 10; ++i) {
+    assert(queue.push("batch", i, 10));
+  }
+  /// the queue is full, and only the caller flooding it is refused
+  assert(!queue.push("batch", 10, 10));
+  assert(queue.push("shell", 0, 10));
+  assert(queue.push("shell", 1, 10));
+
+  std::vector<rpc::CallerStats> stats;
+  string caller;
+  int item = -1;
+  long long charged = 0;
+  queue.pop(&caller, &item, &charged);
+  queue.getStats(&stats);
+  assert(stats.size() == 2);
+  for (const auto& s : stats) {
+    if (s.caller == "batch") {
+      assert(s.queued == 9 && s.handled == 1 && s.rejected == 1);
+    } else {
+      assert(s.caller == "shell" && s.queued == 2 && s.handled == 0 && s.rejected == 0);
+    }
+  }
+  ::printf("admission pass ...\n");
+}
+
+void TestEstimate() {
+  rpc::FairQueue<int> queue(10);
+  for (int i = 0; i < 10; ++i) {
+    queue.push("heavy", i);
+    queue.push("light", i);
+  }
+  /// the items handled concurrently are charged before their cost is known
+  std::map<string, int> popped;
+  string caller;
+  int item = -1;
+  long long charged = 0;
+  for (int i = 0; i < 4; ++i) {
+    assert(queue.pop(&caller, &item, &charged));
+    assert(charged == 10);
+    ++popped[caller];
+  }
+  assert(popped["heavy"] == 2 && popped["light"] == 2);
+
+  /// the estimate follows the costs settled, also across idle times
+  rpc::FairQueue<int> cheap(10);
+  for (int i = 0; i < 40; ++i) {
+    cheap.push("light", i);
+    assert(cheap.pop(&caller, &item, &charged));
+    cheap.settle(caller, charged, 1);
+  }
+  assert(charged == 1);
+  ::printf("estimate pass ...\n");
+}
+
+void TestIdle() {
+  rpc::FairQueue<int> queue(1, 2);
+  string caller;
+  int item = -1;
+  long long charged = 0;
+  for (const char* c : {"a", "b", "c"}) {
+    queue.push(c, 0);
+    assert(queue.pop(&caller, &item, &charged));
+    queue.settle(caller, charged, 5);
+  }
+  /// only the callers seen last are kept once idle
+  std::vector<rpc::CallerStats> stats;
+  queue.getStats(&stats);
+  assert(stats.size() == 2);
+  for (const auto& s : stats) {
+    assert((s.caller == "b" || s.caller == "c") && s.handled == 1);
+  }
+
+  /// and their debt with them
+  queue.push("c", 1);
+  queue.push("d", 1);
+  assert(queue.pop(&caller, &item, &charged) && caller == "d");
+  ::printf("idle pass ...\n");
+}
+
+} // namespace
+
+void TestFairQueue() {
+  ::printf("Test FairQueue...\n");
+
+  TestRoundRobin();
+  TestCost();
+  TestAdmission();
+  TestEstimate();
+  TestIdle();
+
+  ::printf("\n");
+}
@@ -6,6 +6,11 @@
 #include <rpc/rpc_client.hpp>
 #include "logging/logger.h"
 
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+
 namespace rpc {
 
 RPCClient::RPCClient(const string& serverIP, int serverPort):
@@ -42,7 +47,10 @@ int RPCClient::connectMaster() {
 }
 
 void RPCClient::closeConnection() {
-  close(sockfd);
+  if (sockfd >= 0) {
+    close(sockfd);
+    sockfd = -1;
+  }
 }
 
 int RPCClient::sendRequest(int methodID, const string& request) {
@@ -85,10 +93,10 @@ int RPCClient::recvResponse(int* status, string* response) {
   *status = statusCh;
   LOG_DEBUG << "Recv response status: " << *status;
   
-  /// read response
+  /// read response. It may arrive in several segments.
   std::vector<char> buf(len-5);
 
-  if (recv(sockfd, buf.data(), len-5, 0) < 0) {
+  if (recv(sockfd, buf.data(), len-5, MSG_WAITALL) < 0) {
     return -1;
   }
   *response = string(buf.begin(), buf.end());
@@ -97,4 +105,36 @@ int RPCClient::recvResponse(int* status, string* response) {
   return 0;
 }
 
+int RPCClient::call(int methodID, const string& request, int* status, string* response) {
+  for (int attempt = 1; ; ++attempt) {
+    if (connectMaster() < 0) {
+      closeConnection();
+      return -1;
+    }
+    if (sendRequest(methodID, request) < 0 || recvResponse(status, response) < 0) {
+      LOG_ERROR << "Failed to call method " << methodID;
+      closeConnection();
+      return -1;
+    }
+    closeConnection();
+
+    if (*status != minidfs::OpCode::OP_SERVER_BUSY || attempt == kMaxBusyAttempts) {
+      return 0;
+    }
+    minidfs::ServerBusy busy;
+    busy.ParseFromString(*response);
+    LOG_DEBUG << "Master busy, retry method " << methodID << " in " << busy.retryafterms() << " ms";
+    backoff(attempt, busy.retryafterms());
+  }
+}
+
+void RPCClient::backoff(int attempt, int retryAfterMs) {
+  static thread_local std::minstd_rand random(std::random_device{}());
+  /// retryAfterMs * 2^(attempt-1), then a random delay in [half of it, all of it]
+  long long delayMs = std::min<long long>(std::max(retryAfterMs, 1) * (1LL << (attempt - 1)),
+                                          kMaxBackoffMs);
+  std::uniform_int_distribution<long long> jitter(delayMs / 2, delayMs);
+  std::this_thread::sleep_for(std::chrono::milliseconds(jitter(random)));
+}
+
 } // namespace rpc
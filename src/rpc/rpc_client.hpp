@@ -18,6 +18,7 @@
 
 #include <string>
 #include <proto/minidfs.pb.h>
+#include <minidfs/op_code.hpp>
 
 using std::string;
 
@@ -33,6 +34,12 @@ class RPCClient {
 
   int sockfd;
 
+  /// attempts of a call shed by the busy Master before giving up
+  static const int kMaxBusyAttempts = 5;
+
+  /// cap of the backoff between the attempts
+  static const int kMaxBackoffMs = 2000;
+
  public:
   /// \brief Construct the RPCClient.
   ///
@@ -66,6 +73,28 @@ class RPCClient {
   /// len(4 Byte) : status(1 Byte) : response
   /// \return return 0 on success, -1 for errors.
   int recvResponse(int* status, string* response);
+
+  /// \brief Call a remote procedure: connect, send the request, receive the
+  /// response and close the connection.
+  ///
+  /// When the Master answers OP_SERVER_BUSY, the call is retried after the
+  /// delay it asks for, doubled on each attempt, with random jitter so that
+  /// the shed callers don't come back all at once. After kMaxBusyAttempts the
+  /// status OP_SERVER_BUSY is returned to the caller.
+  ///
+  /// \param methodID remote procedure call ID
+  /// \param request the serialized parameters
+  /// \param status the returning status
+  /// \param response the returning serialized response
+  /// \return return 0 on success, -1 for errors.
+  int call(int methodID, const string& request, int* status, string* response);
+
+ private:
+  /// \brief Sleep before retrying a shed call.
+  ///
+  /// \param attempt number of attempts made
+  /// \param retryAfterMs the delay asked by the Master
+  void backoff(int attempt, int retryAfterMs);
 };
 
 } // namespace rpc
@@ -5,13 +5,38 @@
 
 
 #include <rpc/rpc_server.hpp>
+#include <rpc/blk_id_codec.hpp>
 #include <minidfs/dfs_master.hpp>
 #include "logging/logger.h"
 
+#include <fcntl.h>
+#include <poll.h>
+
 namespace rpc {
-RPCServer::RPCServer(int serverPort, int maxConns, minidfs::DFSMaster* master, size_t nThread)
+
+const int RPCServer::kRecvTimeoutMs;
+
+RPCServer::RPCServer(int serverPort, int maxConns, minidfs::DFSMaster* master, size_t nThread,
+                     size_t nChunkserverThread, int maxQueuedCalls, int busyRetryMs,
+                     size_t maxThread, int maxQueueDelayMs, size_t nReaderThread)
     : serverPort(serverPort), maxConnections(maxConns), master(master), isSafeMode(true),
-      threadPool(nThread) {
+      nextReader(0), nPendingConns(0), clientPool(nThread, maxThread, maxQueueDelayMs),
+      chunkserverPool(nChunkserverThread),
+      maxQueuedCalls(maxQueuedCalls), busyRetryMs(busyRetryMs), clientCalls(kQuantumUs) {
+  auto registry = metrics::Registry::global();
+  nClientCalls = registry->counter("rpc.client.calls");
+  nChunkserverCalls = registry->counter("rpc.chunkserver.calls");
+  nClientRejected = registry->counter("rpc.client.rejected");
+  nChunkserverRejected = registry->counter("rpc.chunkserver.rejected");
+  nReaderRejected = registry->counter("rpc.reader.rejected");
+  nRequestsRead = registry->counter("rpc.reader.requests");
+  bytesIn = registry->counter("rpc.bytes.in");
+  bytesOut = registry->counter("rpc.bytes.out");
+  clientPool.exportMetrics("rpc.client");
+  chunkserverPool.exportMetrics("rpc.chunkserver");
+  for (size_t i = 0; i < std::max<size_t>(nReaderThread, 1); ++i) {
+    readers.emplace_back(new Reader());
+  }
 }
 
 RPCServer::~RPCServer() {
@@ -26,10 +51,21 @@ int RPCServer::init() {
     LOG_FATAL  << "Failed to init server";
     return -1;
   }
+  for (auto& reader : readers) {
+    /// the accept thread never blocks on a reader slow to wake up
+    if (pipe2(reader->wakeFds, O_NONBLOCK) == -1) {
+      LOG_FATAL << "Failed to create a pipe: " << strerror(errno);
+      return -1;
+    }
+  }
   return 0;
 }
 
 void RPCServer::run() {
+  for (auto& reader : readers) {
+    std::thread readerThread(&RPCServer::readRequests, this, reader.get());
+    readerThread.detach();
+  }
   while(true) {
     struct sockaddr_in clientAddr;
     socklen_t clientAddrSize = sizeof(clientAddr);
@@ -38,8 +74,19 @@ void RPCServer::run() {
       LOG_ERROR  << "Failed to accept socket " << strerror(errno);
       continue;
     }
-    std::function<void()> func = std::bind(&RPCServer::handleRequest, this, connfd);
-    threadPool.enqueue(func);
+    /// every connection is taken, the readers shed the client ones once they
+    /// know the method
+    fcntl(connfd, F_SETFL, fcntl(connfd, F_GETFL) | O_NONBLOCK);
+    ++nPendingConns;
+    Reader* reader = readers[nextReader++ % readers.size()].get();
+    {
+      std::lock_guard<std::mutex> lockNewConns(reader->mutexNewConns);
+      reader->newConns.push_back(connfd);
+    }
+    char wake = 0;
+    if (write(reader->wakeFds[1], &wake, 1) == -1 && errno != EAGAIN) {
+      LOG_ERROR << "Failed to wake a reader: " << strerror(errno);
+    }
   }
 }
 
@@ -75,32 +122,174 @@ int RPCServer::bindRPCCalls() {
   rpcBindings[3] = std::bind(&RPCServer::addBlock, this, std::placeholders::_1, std::placeholders::_2);
   rpcBindings[4] = std::bind(&RPCServer::blockAck, this, std::placeholders::_1, std::placeholders::_2);
   rpcBindings[5] = std::bind(&RPCServer::complete, this, std::placeholders::_1, std::placeholders::_2);
+  rpcBindings[6] = std::bind(&RPCServer::createEC, this, std::placeholders::_1, std::placeholders::_2);
+  rpcBindings[7] = std::bind(&RPCServer::createPack, this, std::placeholders::_1, std::placeholders::_2);
+  rpcBindings[8] = std::bind(&RPCServer::completePack, this, std::placeholders::_1, std::placeholders::_2);
+  rpcBindings[9] = std::bind(&RPCServer::createInline, this, std::placeholders::_1, std::placeholders::_2);
   
   rpcBindings[11] = std::bind(&RPCServer::remove, this, std::placeholders::_1, std::placeholders::_2);
   rpcBindings[12] = std::bind(&RPCServer::exists, this, std::placeholders::_1, std::placeholders::_2);
   rpcBindings[13] = std::bind(&RPCServer::makeDir, this, std::placeholders::_1, std::placeholders::_2);
   rpcBindings[14] = std::bind(&RPCServer::listDir, this, std::placeholders::_1, std::placeholders::_2);
+
+  rpcBindings[21] = std::bind(&RPCServer::getServerStats, this, std::placeholders::_1, std::placeholders::_2);
   
 
   /// Chunkserver protocol
   rpcBindings[101] = std::bind(&RPCServer::heartBeat, this, std::placeholders::_1, std::placeholders::_2);
   rpcBindings[102] = std::bind(&RPCServer::blkReport, this, std::placeholders::_1, std::placeholders::_2);
-  rpcBindings[103] = std::bind(&RPCServer::getBlkTask, this, std::placeholders::_1, std::placeholders::_2);
-  rpcBindings[104] = std::bind(&RPCServer::recvedBlks, this, std::placeholders::_1, std::placeholders::_2);
+  /// 103 (getBlkTask) and 104 (recvedBlks) are folded into the heartbeat
+
+  const std::pair<int, const char*> methodNames[] = {
+    {1, "getBlockLocations"}, {2, "create"}, {3, "addBlock"}, {4, "blockAck"},
+    {5, "complete"}, {6, "createEC"}, {7, "createPack"}, {8, "completePack"},
+    {9, "createInline"}, {11, "remove"}, {12, "exists"}, {13, "makeDir"}, {14, "listDir"},
+    {21, "getServerStats"}, {101, "heartBeat"}, {102, "blkReport"}
+  };
+  for (const auto& m : methodNames) {
+    methodLatency[m.first] = metrics::Registry::global()->histogram(string("rpc.") + m.second + ".us");
+  }
   return 0;
 }
 
-void RPCServer::handleRequest(int connfd) {
-  //
-  // recv request
-  //
-  int methodID = -1;
-  string request;
-  if (recvRequest(connfd, methodID, request) == -1) {
-    LOG_ERROR  << "Failed to recv request";
+void RPCServer::readRequests(Reader* reader) {
+  std::vector<PendingRequest> pendings;
+  std::vector<struct pollfd> fds;
+  while (true) {
+    fds.assign(1, pollfd{reader->wakeFds[0], POLLIN, 0});
+    for (const auto& p : pendings) {
+      fds.push_back(pollfd{p.connfd, POLLIN, 0});
+    }
+    if (poll(fds.data(), fds.size(), kPollIntervalMs) == -1 && errno != EINTR) {
+      LOG_ERROR << "Failed to poll the connections: " << strerror(errno);
+    }
+    auto now = std::chrono::steady_clock::now();
+
+    /// take what has arrived, and dispatch the complete requests
+    size_t kept = 0;
+    for (size_t i = 0; i < pendings.size(); ++i) {
+      PendingRequest& p = pendings[i];
+      int ret = 0;
+      if (fds[i + 1].revents != 0) {
+        int methodID = -1;
+        string request;
+        ret = recvRequest(&p, methodID, request);
+        /// with the readers saturated, a client call is shed as soon as its
+        /// header is in, instead of reading it. The chunkserver calls never
+        /// are, so heartbeats get through a storm of client connections.
+        if (ret != -1 && p.data.size() >= 5 && p.admitted == false) {
+          p.admitted = true;
+          if (p.data[4] <= 100
+              && maxQueuedCalls > 0 && nPendingConns > maxQueuedCalls) {
+            --nPendingConns;
+            nReaderRejected->inc();
+            fcntl(p.connfd, F_SETFL, fcntl(p.connfd, F_GETFL) & ~O_NONBLOCK);
+            rejectConnection(p.connfd);
+            continue;
+          }
+        }
+        if (ret == 1) {
+          --nPendingConns;
+          nRequestsRead->inc();
+          /// the handlers send the response blocking
+          fcntl(p.connfd, F_SETFL, fcntl(p.connfd, F_GETFL) & ~O_NONBLOCK);
+          dispatchRequest(p.connfd, methodID, std::move(request));
+          continue;
+        }
+      }
+      if (ret == -1 || now >= p.deadline) {
+        LOG_ERROR  << "Failed to recv request";
+        --nPendingConns;
+        close(p.connfd);
+        continue;
+      }
+      if (kept != i) {
+        pendings[kept] = std::move(p);
+      }
+      ++kept;
+    }
+    pendings.resize(kept);
+
+    /// the connections handed over by the accept thread
+    if (fds[0].revents != 0) {
+      char buf[256];
+      while (read(reader->wakeFds[0], buf, sizeof(buf)) > 0) {
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lockNewConns(reader->mutexNewConns);
+      for (int connfd : reader->newConns) {
+        pendings.push_back(PendingRequest{connfd, string(), false,
+                                          now + std::chrono::milliseconds(kRecvTimeoutMs)});
+      }
+      reader->newConns.clear();
+    }
+  }
+}
+
+void RPCServer::dispatchRequest(int connfd, int methodID, string request) {
+  if (rpcBindings.find(methodID) == rpcBindings.end()) {
+    LOG_ERROR  << "Unknown method id: " << methodID;
     close(connfd);
     return;
   }
+  if (methodID == 21) {
+    handleRequest(connfd, methodID, request);
+    return;
+  }
+
+  if (methodID > 100) {
+    if (!chunkserverPool.tryPost(Call{this, connfd, methodID, std::move(request)}, maxQueuedCalls)) {
+      nChunkserverRejected->inc();
+      rejectRequest(connfd);
+    }
+    return;
+  }
+
+  /// the call is queued by caller, and a thread takes the next one in fair order
+  if (!clientCalls.push(getPeerIP(connfd), Call{this, connfd, methodID, std::move(request)},
+                        maxQueuedCalls)) {
+    nClientRejected->inc();
+    rejectRequest(connfd);
+    return;
+  }
+  clientPool.post([this]() { handleClientCall(); });
+}
+
+void RPCServer::handleClientCall() {
+  string caller;
+  Call call;
+  long long charged = 0;
+  if (!clientCalls.pop(&caller, &call, &charged)) {
+    return;
+  }
+  auto start = std::chrono::steady_clock::now();
+  call();
+  clientCalls.settle(caller, charged, std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count());
+}
+
+void RPCServer::rejectRequest(int connfd) {
+  minidfs::ServerBusy busy;
+  busy.set_retryafterms(busyRetryMs);
+  if (sendResponse(connfd, OpCode::OP_SERVER_BUSY, busy.SerializeAsString()) < 0) {
+    LOG_DEBUG << "Failed to send busy response";
+  }
+  close(connfd);
+}
+
+void RPCServer::rejectConnection(int connfd) {
+  /// drain what has arrived of the request, since closing with unread data
+  /// resets the connection, and the caller may lose the answer
+  char buf[4096];
+  while (recv(connfd, buf, sizeof(buf), MSG_DONTWAIT) > 0) {
+  }
+  rejectRequest(connfd);
+}
+
+void RPCServer::handleRequest(int connfd, int methodID, const string& request) {
+  (methodID > 100 ? nChunkserverCalls : nClientCalls)->inc();
+  metrics::ScopedTimer timer(methodLatency.at(methodID));
 
   /// In safe mode, rpc calls from clients are ignored!
   if (isSafeMode == true && methodID <= 100) {
@@ -108,14 +297,14 @@ void RPCServer::handleRequest(int connfd) {
     string response;
     sendResponse(connfd, status, response);
 
-    LOG_INFO  << "In safe mode";
+    LOG_EVERY_T(INFO, 1000) << "In safe mode";
     close(connfd);
     
     isSafeMode = !master->isSafe();
     return;
   }
 
-  auto func = rpcBindings[methodID];
+  const auto& func = rpcBindings.at(methodID);
   if (func(connfd, request) < 0) {
     LOG_ERROR  << "Failed to send response to request: " << request;
     close(connfd);
@@ -138,7 +327,19 @@ int RPCServer::getBlockLocations(int connfd, const string& request) {
 
 int RPCServer::create(int connfd, const string& request) {
   minidfs::LocatedBlock locatedBlk;
-  int status = master->create(request, &locatedBlk);
+  int status = master->create(request, &locatedBlk, getPeerIP(connfd));
+  string response = locatedBlk.SerializeAsString();
+
+  return sendResponse(connfd, status, response);
+}
+
+int RPCServer::createEC(int connfd, const string& request) {
+  minidfs::ECFile ecFile;
+  minidfs::LocatedBlock locatedBlk;
+  int status = OpCode::OP_FAILURE;
+  if (ecFile.ParseFromString(request)) {
+    status = master->createEC(ecFile.name(), ecFile.ecschema(), &locatedBlk, getPeerIP(connfd));
+  }
   string response = locatedBlk.SerializeAsString();
 
   return sendResponse(connfd, status, response);
@@ -146,7 +347,7 @@ int RPCServer::create(int connfd, const string& request) {
 
 int RPCServer::addBlock(int connfd, const string& request) {
   minidfs::LocatedBlock locatedBlk;
-  int status = master->addBlock(request, &locatedBlk);
+  int status = master->addBlock(request, &locatedBlk, getPeerIP(connfd));
   string response = locatedBlk.SerializeAsString();
 
   return sendResponse(connfd, status, response);
@@ -169,6 +370,40 @@ int RPCServer::complete(int connfd, const string& request) {
   return sendResponse(connfd, status, response);
 }
 
+int RPCServer::createPack(int connfd, const string& request) {
+  minidfs::Pack pack;
+  minidfs::LocatedBlock locatedBlk;
+  int status = OpCode::OP_FAILURE;
+  if (pack.ParseFromString(request)) {
+    status = master->createPack(pack, &locatedBlk, getPeerIP(connfd));
+  }
+  string response = locatedBlk.SerializeAsString();
+
+  return sendResponse(connfd, status, response);
+}
+
+int RPCServer::completePack(int connfd, const string& request) {
+  minidfs::Pack pack;
+  int status = OpCode::OP_FAILURE;
+  if (pack.ParseFromString(request)) {
+    status = master->completePack(pack);
+  }
+  string response;
+
+  return sendResponse(connfd, status, response);
+}
+
+int RPCServer::createInline(int connfd, const string& request) {
+  minidfs::InlineFile file;
+  int status = OpCode::OP_FAILURE;
+  if (file.ParseFromString(request)) {
+    status = master->createInline(file);
+  }
+  string response;
+
+  return sendResponse(connfd, status, response);
+}
+
 int RPCServer::remove(int connfd, const string& request) {
   int status = master->remove(request);
   string response;
@@ -199,107 +434,172 @@ int RPCServer::listDir(int connfd, const string& request) {
 }
 
 
-int RPCServer::heartBeat(int connfd, const string& request) {
-  minidfs::ChunkserverInfo chunkserverInfo;
-  chunkserverInfo.ParseFromString(request);
-  int status = master->heartBeat(chunkserverInfo);
-  /// No response
-  string response;
+int RPCServer::getServerStats(int connfd, const string& /*request*/) {
+  minidfs::ServerStats stats;
+  int status = master->getServerStats(&stats);
+  string response = stats.SerializeAsString();
+
   return sendResponse(connfd, status, response);
 }
 
-int RPCServer::blkReport(int connfd, const string& request) {
-  minidfs::BlockReport report;
-  report.ParseFromString(request);
-
-  std::vector<int> blkIDs;
-  for (int i = 0; i < report.blkids_size(); ++i) {
-    blkIDs.push_back(report.blkids(i));
+void RPCServer::getStats(minidfs::ServerStats* stats) {
+  auto addLane = [stats](const char* name, const ::minidfs::ThreadPool& pool,
+                         long long handled, long long rejected) {
+    auto poolStats = pool.getStats();
+    auto lane = stats->add_lanes();
+    lane->set_name(name);
+    lane->set_nthread(poolStats.nThread);
+    lane->set_queued(poolStats.queued);
+    lane->set_handled(handled);
+    lane->set_rejected(rejected);
+    lane->set_active(poolStats.active);
+    lane->set_maxthread(poolStats.maxThread);
+    lane->set_completed(poolStats.completed);
+    lane->set_waitus(poolStats.waitUs);
+    lane->set_runus(poolStats.runUs);
+  };
+  /// the readers receive the requests of the connections, not the calls
+  auto reader = stats->add_lanes();
+  reader->set_name("reader");
+  reader->set_nthread(readers.size());
+  reader->set_maxthread(readers.size());
+  reader->set_queued(nPendingConns);
+  reader->set_handled(nRequestsRead->value());
+  reader->set_rejected(nReaderRejected->value());
+  addLane("chunkserver", chunkserverPool, nChunkserverCalls->value(), nChunkserverRejected->value());
+  addLane("client", clientPool, nClientCalls->value(), nClientRejected->value());
+
+  std::vector<CallerStats> callers;
+  clientCalls.getStats(&callers);
+  for (const auto& c : callers) {
+    auto caller = stats->add_callers();
+    caller->set_caller(c.caller);
+    caller->set_queued(c.queued);
+    caller->set_handled(c.handled);
+    caller->set_rejected(c.rejected);
+    caller->set_rate(c.rate);
   }
 
-  std::vector<int> deletedBlks;
-  int status = master->blkReport(report.chunkserverinfo(), blkIDs, deletedBlks);
-  /// construct the response
-  minidfs::BlkIDs response;
-  for (int i : deletedBlks) {
-    response.add_blkids(i);
-  }
-  return sendResponse(connfd, status, response.SerializeAsString());
+  metrics::Registry::global()->dump(stats->mutable_metrics());
 }
 
-int RPCServer::getBlkTask(int connfd, const string& request) {
-  minidfs::ChunkserverInfo chunkserverInfo;
-  chunkserverInfo.ParseFromString(request);
+int RPCServer::heartBeat(int connfd, const string& request) {
+  minidfs::Heartbeat heartbeat;
+  heartbeat.ParseFromString(request);
 
   minidfs::BlockTasks blkTasks;
-  int status = master->getBlkTask(chunkserverInfo, &blkTasks);
-  
+  int status = master->heartBeat(heartbeat, &blkTasks);
+
   return sendResponse(connfd, status, blkTasks.SerializeAsString());
 }
 
-int RPCServer::recvedBlks(int connfd, const string& request) {
+int RPCServer::blkReport(int connfd, const string& request) {
   minidfs::BlockReport report;
   report.ParseFromString(request);
 
   std::vector<int> blkIDs;
-  for (int i = 0; i < report.blkids_size(); ++i) {
-    blkIDs.push_back(report.blkids(i));
+  if (-1 == parseBlkIDs(report, &blkIDs)) {
+    LOG_ERROR << "Malformed block ids from " << report.chunkserverinfo().chunkserverip();
+    return sendResponse(connfd, OpCode::OP_FAILURE, string());
   }
 
-  int status = master->recvedBlks(report.chunkserverinfo(), blkIDs);
-  /// No response
-  string response;
-  return sendResponse(connfd, status, response);
+  std::vector<int> deletedBlks;
+  int status = master->blkReport(report.chunkserverinfo(), blkIDs, deletedBlks);
+  /// construct the response
+  minidfs::BlkIDs response;
+  for (int i : deletedBlks) {
+    response.add_blkids(i);
+  }
+  return sendResponse(connfd, status, response.SerializeAsString());
 }
 
 
-int RPCServer::recvRequest(int connfd, int& methodID, string& request) {
-  int32_t len = 0;
-  /// read the length
-  if (recv(connfd, &len, 4, 0) < 0) {
-    return -1;
+int RPCServer::recvRequest(PendingRequest* pending, int& methodID, string& request) {
+  string& data = pending->data;
+  char buf[64 * 1024];
+  while (true) {
+    /// read the length first, then up to the end of the request
+    size_t need = 4 - std::min<size_t>(data.size(), 4);
+    int32_t len = 0;
+    if (need == 0) {
+      memcpy(&len, data.data(), 4);
+      len = ntohl(len);
+      /// the length covers itself and the methodID
+      if (len < 5 || len > kMaxRequestLen) {
+        LOG_ERROR << "Invalid request length: " << len;
+        return -1;
+      }
+      data.reserve(len);
+      need = len - data.size();
+    }
+    if (need == 0) {
+      break;
+    }
+    ssize_t ret = recv(pending->connfd, buf, std::min(need, sizeof(buf)), MSG_DONTWAIT);
+    if (ret == -1 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+      return 0;
+    }
+    if (ret <= 0) {
+      return -1;
+    }
+    data.append(buf, ret);
   }
-  len = ntohl(len);
-  LOG_DEBUG << "Recved request length: " << len;
 
   /// read methodID
-  char mID = methodID;
-  if (recv(connfd, &mID, 1, 0) == -1) {
-    return -1;
-  }
+  char mID = data[4];
   methodID = mID;
   LOG_DEBUG << "Recved request method id: " << mID;
 
-  /// recv request
-  std::vector<char> buf(len-5);
-  int ret = recv(connfd, buf.data(), buf.size(), 0);
-  if (ret == -1) {
-    return -1;
-  }
-  request = string(buf.begin(), buf.end());
+  request = data.substr(5);
+  bytesIn->add(data.size());
   LOG_DEBUG << "Succeed to recv request: " << request;
+  return 1;
+}
+
+int RPCServer::parseBlkIDs(const minidfs::BlockReport& report, std::vector<int>* blkIDs) {
+  if (report.encodedblkids().empty() == false) {
+    return decodeBlkIDs(report.encodedblkids(), blkIDs);
+  }
+  for (int i = 0; i < report.blkids_size(); ++i) {
+    blkIDs->push_back(report.blkids(i));
+  }
   return 0;
 }
 
+string RPCServer::getPeerIP(int connfd) {
+  struct sockaddr_in peerAddr;
+  socklen_t peerAddrSize = sizeof(peerAddr);
+  if (getpeername(connfd, (struct sockaddr*)&peerAddr, &peerAddrSize) == -1) {
+    LOG_WARN << "Failed to get peer address: " << strerror(errno);
+    return string();
+  }
+  char ip[INET_ADDRSTRLEN] = {0};
+  if (inet_ntop(AF_INET, &peerAddr.sin_addr, ip, sizeof(ip)) == nullptr) {
+    return string();
+  }
+  return string(ip);
+}
+
 int RPCServer::sendResponse(int connfd, int status, const string& response) {
-  /// Send len
+  /// Send len. A caller gone must not kill the server with SIGPIPE.
   uint32_t len = htonl(4 + 1 + response.size());
-  if (send(connfd, &len, 4, 0) == -1) {
+  if (send(connfd, &len, 4, MSG_NOSIGNAL) == -1) {
     return -1;
   }
   LOG_DEBUG << "Send response length: " << len;
 
   /// send the status
   char statusCh = status;
-  if (send(connfd, &statusCh, 1, 0) < 0) {
+  if (send(connfd, &statusCh, 1, MSG_NOSIGNAL) < 0) {
     return -1;
   }
   LOG_DEBUG << "Send response status: " << status;
   
   /// send response
-  if (send(connfd, response.data(), response.size(), 0) < 0) {
+  if (send(connfd, response.data(), response.size(), MSG_NOSIGNAL) < 0) {
     return -1;
   }
+  bytesOut->add(4 + 1 + response.size());
   LOG_DEBUG << "Succeed to send response" << response;
   return 0;
 }
@@ -15,12 +15,19 @@
 #include <sys/socket.h>
 #include <errno.h>
 #include <netinet/in.h>
+#include <arpa/inet.h>
+#include <atomic>
 #include <thread>
+#include <chrono>
+#include <mutex>
+#include <vector>
 #include <unistd.h>
 
 #include <proto/minidfs.pb.h>
 #include <minidfs/op_code.hpp>
 #include <threadpool/thread_pool.hpp>
+#include <rpc/fair_queue.hpp>
+#include "metrics/registry.h"
 
 using std::string;
 using minidfs::OpCode;
@@ -44,6 +51,26 @@ namespace rpc {
 /// or chunkserver handler.
 /// After return from handlers, it serializes the return values to
 /// socket. And return the rpc calls.  
+///
+/// The requests are received by a few reader threads, and then queued to
+/// a lane by method ID: the chunkserver calls to threads of their own, and
+/// the client calls to the others. So heartbeats are never queued behind
+/// a storm of client calls. The readers poll the connections and take the
+/// bytes as they arrive, so callers slow to send, or not sending at all,
+/// hold up no thread.
+///
+/// The client calls are queued per caller, by its IP address, and taken with
+/// deficit round robin, charged with the time they take. So a job hammering
+/// the master gets its share of the threads, and an interactive user doesn't
+/// wait behind its calls.
+///
+/// The lanes are bounded, and so are the connections being read. A call arriving
+/// at a full one is answered with OP_SERVER_BUSY at once, telling the caller
+/// when to retry, so that an overloaded master keeps answering instead of
+/// queueing without end.
+///
+/// The calls, the bytes and the latency of each method are counted in the
+/// metrics registry, under "rpc.".
 /// TODO: xiw, how to stop this server? 
 class RPCServer {
  private:
@@ -64,8 +91,91 @@ class RPCServer {
   /// \brief When in safemode, only recv the block-report rpc calls from chunkserver.
   bool isSafeMode;
 
-  /// thread pool
-  ::minidfs::ThreadPool threadPool;
+  /// a connection whose request is being received
+  struct PendingRequest {
+    int connfd;
+    /// the bytes received so far, starting with the length and the methodID
+    string data;
+    /// the methodID is received, and the connection isn't shed
+    bool admitted;
+    /// the connection is dropped if the request isn't complete by then
+    std::chrono::steady_clock::time_point deadline;
+  };
+
+  /// a reader thread, receiving the requests of the connections handed to it
+  struct Reader {
+    /// written by the accept thread to wake the reader for new connections
+    int wakeFds[2];
+    std::mutex mutexNewConns;
+    std::vector<int> newConns;
+  };
+
+  /// receive the requests from the accepted connections
+  std::vector<std::unique_ptr<Reader>> readers;
+
+  /// the reader the next connection is handed to
+  size_t nextReader;
+
+  /// connections accepted, whose requests aren't received yet
+  std::atomic<long long> nPendingConns;
+
+  /// handles the client calls, MethodID <= 100
+  ::minidfs::ThreadPool clientPool;
+
+  /// handles the chunkserver calls, MethodID > 100
+  ::minidfs::ThreadPool chunkserverPool;
+
+  /// calls handled by each lane
+  metrics::Counter* nClientCalls;
+  metrics::Counter* nChunkserverCalls;
+
+  /// calls shed by each lane
+  metrics::Counter* nClientRejected;
+  metrics::Counter* nChunkserverRejected;
+  /// client connections shed after their header, with the readers saturated
+  metrics::Counter* nReaderRejected;
+  /// requests received by the readers
+  metrics::Counter* nRequestsRead;
+
+  /// bytes of the requests and the responses
+  metrics::Counter* bytesIn;
+  metrics::Counter* bytesOut;
+
+  /// time to handle and answer a call, by method ID
+  std::unordered_map<int, metrics::Histogram*> methodLatency;
+
+  /// max calls waiting in a lane, 0 for no limit
+  long long maxQueuedCalls;
+
+  /// retry hint for the shed callers
+  int busyRetryMs;
+
+  /// a request longer than it, in bytes, is taken as corrupt
+  static const int32_t kMaxRequestLen = 256 << 20;
+
+  /// a caller has this long to send its request, from the connection
+  static const int kRecvTimeoutMs = 1000;
+
+  /// a reader drops the connections past their deadline this often at least
+  static const int kPollIntervalMs = 100;
+
+  /// handler time a caller is given each round, in us
+  static const long long kQuantumUs = 1000;
+
+  /// a received request queued to a lane
+  struct Call {
+    RPCServer* server;
+    int connfd;
+    int methodID;
+    string request;
+
+    void operator()() {
+      server->handleRequest(connfd, methodID, request);
+    }
+  };
+
+  /// the client calls waiting for clientPool, per caller
+  FairQueue<Call> clientCalls;
 
  public:
 
@@ -73,7 +183,16 @@ class RPCServer {
   ///
   /// \param serverPort Master's serving port
   /// \param maxConns maximum number of connections
-  RPCServer(int serverPort, int maxConns, minidfs::DFSMaster* master, size_t nThread);
+  /// \param nThread number of threads for the client calls
+  /// \param nChunkserverThread number of threads reserved for the chunkserver calls
+  /// \param maxQueuedCalls max calls waiting in each lane, 0 for no limit
+  /// \param busyRetryMs how long a shed caller is told to wait before retrying
+  /// \param maxThread max number of threads for the client calls, nThread or less for a fixed size
+  /// \param maxQueueDelayMs the client threads grow in number when the calls wait longer than it
+  /// \param nReaderThread number of threads receiving the requests
+  RPCServer(int serverPort, int maxConns, minidfs::DFSMaster* master, size_t nThread,
+            size_t nChunkserverThread, int maxQueuedCalls = 0, int busyRetryMs = 0,
+            size_t maxThread = 0, int maxQueueDelayMs = 0, size_t nReaderThread = 2);
 
   ~RPCServer();
 
@@ -89,22 +208,59 @@ class RPCServer {
   /// The first stage of run() is in safe mode.
   void run();
 
+  /// \brief Get the threads, the queue depth, the calls handled and shed and the
+  /// times of each lane, and the calls of each client.
+  ///
+  /// \param stats the returning statistics
+  void getStats(minidfs::ServerStats* stats);
+
  private:
   /// \brief Bind the ip and port using socket.
   ///
   /// \return return 0 on success, -1 for errors.
   int initServer();
 
-  /// \brief Bind the rpc method IDs with member functions. The Method ID starts
-  /// from 1.
+  /// \brief Bind the rpc method IDs with member functions, and name their
+  /// latency histograms. The Method ID starts from 1.
   ///
   /// \return return 0 on success, -1 for errors.
   int bindRPCCalls();
 
+  /// \brief Reader thread method. It polls the connections handed to the
+  /// reader, receives their requests without blocking, and dispatches the
+  /// complete ones.
+  ///
+  /// \param reader the reader of the thread
+  void readRequests(Reader* reader);
+
+  /// \brief Queue a received request to the lane of its method.
+  ///
+  /// \param connfd the accepted socket fd.
+  /// \param methodID remote procedure call ID
+  /// \param request the serialized parameters
+  void dispatchRequest(int connfd, int methodID, string request);
+
+  /// \brief Answer a call shed by a full lane with OP_SERVER_BUSY, and close the connection.
+  ///
+  /// \param connfd the accepted socket fd.
+  void rejectRequest(int connfd);
+
+  /// \brief Answer a connection shed by a reader, once the methodID is known
+  /// and before the rest of the request is read, with OP_SERVER_BUSY, and
+  /// close it.
+  ///
+  /// \param connfd the accepted socket fd.
+  void rejectConnection(int connfd);
+
+  /// \brief Take the next client call in fair order, and handle it.
+  void handleClientCall();
+
   /// \brief Handle the request.
   ///
   /// \param connfd the accepted socket fd.
-  void handleRequest(int connfd);
+  /// \param methodID remote procedure call ID
+  /// \param request the serialized parameters
+  void handleRequest(int connfd, int methodID, const string& request);
 
 
   ////////////////////////
@@ -133,6 +289,15 @@ class RPCServer {
   /// \return return 0 on success, -1 for errors.
   int create(int connfd, const string& request);
 
+  /// \brief Create an erasure-coded file. MethodID = 6.
+  /// This method forwards the request to master and fetches the response.
+  /// Then it sends the response back to client.
+  ///
+  /// \param connfd the connected sockfd
+  /// \param request serialized ECFile, the file name and the schema.
+  /// \return return 0 on success, -1 for errors.
+  int createEC(int connfd, const string& request);
+
   /// \brief Add a block when the client has finished the previous block. MethodID = 3.
   /// This method forwards the request to master and fetches the response.
   /// Then it sends the response back to client.
@@ -162,6 +327,33 @@ class RPCServer {
   /// \return return 0 on success, -1 for errors.
   int complete(int connfd, const string& request);
 
+  /// \brief Create small files packed into a shared container block. MethodID = 7.
+  /// This method forwards the request to master and fetches the response.
+  /// Then it sends the response back to client.
+  ///
+  /// \param connfd the connected sockfd
+  /// \param request serialized Pack, the names and lengths of the files.
+  /// \return return 0 on success, -1 for errors.
+  int createPack(int connfd, const string& request);
+
+  /// \brief Complete writing packed small files. MethodID = 8.
+  /// This method forwards the request to master and fetches the response.
+  /// Then it sends the response back to client.
+  ///
+  /// \param connfd the connected sockfd
+  /// \param request serialized Pack, the files and the written container block.
+  /// \return return 0 on success, -1 for errors.
+  int completePack(int connfd, const string& request);
+
+  /// \brief Create a tiny file stored inline in the master. MethodID = 9.
+  /// This method forwards the request to master and fetches the response.
+  /// Then it sends the response back to client.
+  ///
+  /// \param connfd the connected sockfd
+  /// \param request serialized InlineFile, the name and the contents of the file.
+  /// \return return 0 on success, -1 for errors.
+  int createInline(int connfd, const string& request);
+
 
   /////////////////////////////// Name system operations
 
@@ -204,6 +396,18 @@ class RPCServer {
   int listDir(int connfd, const string& request);
 
 
+  ////////////////// Administration
+
+
+  /// \brief Get the statistics of this server. MethodID = 21.
+  /// It is answered by the reader thread, without being queued.
+  ///
+  /// \param connfd the connected sockfd
+  /// \param request empty
+  /// \return return 0 on success, -1 for errors.
+  int getServerStats(int connfd, const string& request);
+
+
   ////////////////////////
   /// ChunkserverProtocol
   ////////////////////////
@@ -211,8 +415,9 @@ class RPCServer {
 
   /// \brief Send heartbeat information to Master. MethodID = 101.
   ///
+  /// The response is the serialized BlockTasks for the chunkserver.
   /// \param connfd the connected sockfd
-  /// \param request serialized chunkserverInfo which contains the ip and port of the chunkserver
+  /// \param request serialized Heartbeat
   /// \return return 0 on success, -1 for errors.
   int heartBeat(int connfd, const string& request);
   
@@ -224,32 +429,32 @@ class RPCServer {
   /// \return return 0 on success, -1 for errors.
   int blkReport(int connfd, const string& request);
 
-  /// \brief Get block task from Master. MethodID = 103.
-  ///
-  /// \param connfd the connected sockfd
-  /// \param request serialized chunkserverInfo which contains the ip and port of the chunkserver
-  /// \return return 0 on success, -1 for errors.  
-  int getBlkTask(int connfd, const string& request);
 
-  /// \brief Inform Master about the received blocks. MethodID = 104.
-  ///
-  /// \param connfd the connected sockfd
-  /// \param request serialized BlkIDs that contains all the block ids it received
-  /// \return return 0 on success, -1 for errors.  
-  int recvedBlks(int connfd, const string& request);
-
-
-
-  /// \brief Recv rpc request from the RPCClient.
+  /// \brief Recv what has arrived of a rpc request from the RPCClient,
+  /// without blocking.
   ///
   /// The format of request is:
   /// len(4 Byte) : methodID(1 Byte) : request
   ///
-  /// \param connfd the accepted socket fd.
-  /// \param methodID remote procedure call ID
-  /// \param request the serialized parameters
+  /// \param pending the connection and the bytes received before
+  /// \param methodID the returning remote procedure call ID
+  /// \param request the returning serialized parameters
+  /// \return return 1 when the request is complete, 0 if more is to come,
+  ///         -1 for errors.
+  int recvRequest(PendingRequest* pending, int& methodID, string& request);
+
+  /// \brief Get the block ids carried by a block report, either encoded or not.
+  ///
+  /// \param report the received report
+  /// \param blkIDs the returning block ids
   /// \return return 0 on success, -1 for errors.
-  int recvRequest(int connfd, int& methodID, string& request);
+  int parseBlkIDs(const minidfs::BlockReport& report, std::vector<int>* blkIDs);
+
+  /// \brief Get the IP address of the caller from the connected socket.
+  ///
+  /// \param connfd the accepted socket fd.
+  /// \return the peer IP in dotted-decimal form; empty string for errors.
+  string getPeerIP(int connfd);
 
   /// \brief Send rpc response to the RPCClient.
   ///
@@ -0,0 +1,138 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for RPCServer
+
+#include <rpc/rpc_server.hpp>
+#include <rpc/rpc_client.hpp>
+#include <minidfs/dfs_master.hpp>
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+
+namespace {
+
+const string kDir = "/tmp/rpc_server_unittest";
+const int kPort = 22346;
+
+minidfs::ChunkserverInfo Chunkserver() {
+  minidfs::ChunkserverInfo cs;
+  cs.set_chunkserverip("127.0.0.1");
+  cs.set_chunkserverport(9000);
+  return cs;
+}
+
+/// Start a server of one reader, that runs until the test exits.
+minidfs::DFSMaster* StartServer(int port, int maxQueuedCalls) {
+  ::mkdir(kDir.c_str(), 0755);
+  string dir = kDir + "/" + std::to_string(port);
+  ::mkdir(dir.c_str(), 0755);
+  auto master = new minidfs::DFSMaster(dir + "/namesys", dir + "/editlog", 0, 1, 1, 1, 1);
+  assert(master->format() == 0);
+  std::vector<int> deleted;
+  assert(master->blkReport(Chunkserver(), std::vector<int>(), deleted) == OpCode::OP_SUCCESS);
+  auto server = new rpc::RPCServer(port, 64, master, 1, 1, maxQueuedCalls, 0, 0, 0, 1);
+  assert(server->init() == 0);
+  std::thread(&rpc::RPCServer::run, server).detach();
+  return master;
+}
+
+/// Connect to the server, and send part of a request, or nothing.
+int Connect(int port, const string& partial) {
+  int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  assert(fd != -1 && ::connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0);
+  assert(partial.empty() || ::send(fd, partial.data(), partial.size(), 0) == (ssize_t)partial.size());
+  return fd;
+}
+
+/// Send a request, and return the status of the response.
+int Call(int port, int methodID, const string& request) {
+  int fd = Connect(port, string());
+  uint32_t len = htonl(5 + request.size());
+  string data(reinterpret_cast<const char*>(&len), 4);
+  data += static_cast<char>(methodID);
+  data += request;
+  assert(::send(fd, data.data(), data.size(), 0) == (ssize_t)data.size());
+  char header[5] = {0};
+  assert(::recv(fd, header, 5, MSG_WAITALL) == 5);
+  ::close(fd);
+  return header[4];
+}
+
+/// Send a heartbeat, and return its status and how long it took in ms.
+int HeartBeat(int port, long long* ms) {
+  minidfs::Heartbeat heartbeat;
+  *heartbeat.mutable_chunkserverinfo() = Chunkserver();
+  rpc::RPCClient client("127.0.0.1", port);
+  int status = -1;
+  string response;
+  auto start = std::chrono::steady_clock::now();
+  assert(client.call(101, heartbeat.SerializeAsString(), &status, &response) == 0);
+  *ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start).count();
+  return status;
+}
+
+void TestIdleConnections() {
+  StartServer(kPort, 0);
+  /// callers connected and sending nothing, or part of a request, hold up
+  /// no reader
+  std::vector<int> fds;
+  for (int i = 0; i < 8; ++i) {
+    fds.push_back(Connect(kPort, i % 2 ? string() : string("\0\0", 2)));
+  }
+  long long ms = 0;
+  assert(HeartBeat(kPort, &ms) == OpCode::OP_SUCCESS);
+  assert(ms < 500);
+  for (int fd : fds) {
+    ::close(fd);
+  }
+  ::printf("idle connections pass ...\n");
+}
+
+void TestShedAfterHeader() {
+  const int port = kPort + 1;
+  StartServer(port, 2);
+  /// the readers are saturated by callers sending nothing
+  std::vector<int> fds;
+  for (int i = 0; i < 8; ++i) {
+    fds.push_back(Connect(port, string()));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  /// the client calls are shed once their header is in
+  assert(Call(port, 12, "/") == OpCode::OP_SERVER_BUSY);
+
+  /// and the heartbeats are not
+  long long ms = 0;
+  for (int i = 0; i < 5; ++i) {
+    assert(HeartBeat(port, &ms) == OpCode::OP_SUCCESS);
+  }
+  for (int fd : fds) {
+    ::close(fd);
+  }
+  ::printf("shed after header pass ...\n");
+}
+
+} // namespace
+
+void TestRPCServer() {
+  ::printf("Test RPCServer...\n");
+
+  TestIdleConnections();
+  TestShedAfterHeader();
+
+  ::printf("\n");
+}
@@ -0,0 +1,154 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief A move-only callable stored inline when it is small.
+
+#ifndef TASK_H_
+#define TASK_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace minidfs {
+
+/// \brief Task holds a callable with no arguments.
+///
+/// Unlike std::function, it is move-only, and a callable of up to kInlineSize
+/// bytes that can be moved without throwing is stored in the Task itself,
+/// so constructing it doesn't allocate. Larger callables are kept on the heap.
+class Task {
+ public:
+  static const size_t kInlineSize = 48;
+
+ private:
+  struct Ops {
+    void (*invoke)(void* storage);
+    /// move-construct dst from src, and destroy src
+    void (*move)(void* dst, void* src);
+    void (*destroy)(void* storage);
+  };
+
+  template<class F>
+  struct InlineOps {
+    static void invoke(void* storage) {
+      (*static_cast<F*>(storage))();
+    }
+    static void move(void* dst, void* src) {
+      new (dst) F(std::move(*static_cast<F*>(src)));
+      static_cast<F*>(src)->~F();
+    }
+    static void destroy(void* storage) {
+      static_cast<F*>(storage)->~F();
+    }
+    static const Ops ops;
+  };
+
+  template<class F>
+  struct HeapOps {
+    static void invoke(void* storage) {
+      (**static_cast<F**>(storage))();
+    }
+    static void move(void* dst, void* src) {
+      *static_cast<F**>(dst) = *static_cast<F**>(src);
+    }
+    static void destroy(void* storage) {
+      delete *static_cast<F**>(storage);
+    }
+    static const Ops ops;
+  };
+
+  template<class F>
+  struct FitsInline {
+    static const bool value = sizeof(F) <= kInlineSize
+        && alignof(std::max_align_t) % alignof(F) == 0
+        && std::is_nothrow_move_constructible<F>::value;
+  };
+
+  typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type storage;
+
+  /// nullptr if empty
+  const Ops* ops;
+
+ public:
+  Task() : ops(nullptr) {
+  }
+
+  template<class F, class = typename std::enable_if<
+      !std::is_same<typename std::decay<F>::type, Task>::value>::type>
+  Task(F&& fn) : ops(nullptr) {
+    init<typename std::decay<F>::type>(std::forward<F>(fn));
+  }
+
+  Task(Task&& other) : ops(other.ops) {
+    if (ops != nullptr) {
+      ops->move(&storage, &other.storage);
+      other.ops = nullptr;
+    }
+  }
+
+  Task& operator=(Task&& other) {
+    if (this != &other) {
+      reset();
+      ops = other.ops;
+      if (ops != nullptr) {
+        ops->move(&storage, &other.storage);
+        other.ops = nullptr;
+      }
+    }
+    return *this;
+  }
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  ~Task() {
+    reset();
+  }
+
+  /// Call the callable. The Task must not be empty.
+  void operator()() {
+    ops->invoke(&storage);
+  }
+
+  explicit operator bool() const {
+    return ops != nullptr;
+  }
+
+  /// Destroy the callable, and leave the Task empty.
+  void reset() {
+    if (ops != nullptr) {
+      ops->destroy(&storage);
+      ops = nullptr;
+    }
+  }
+
+ private:
+  template<class F, class G>
+  typename std::enable_if<FitsInline<F>::value>::type init(G&& fn) {
+    new (&storage) F(std::forward<G>(fn));
+    ops = &InlineOps<F>::ops;
+  }
+
+  template<class F, class G>
+  typename std::enable_if<!FitsInline<F>::value>::type init(G&& fn) {
+    *reinterpret_cast<F**>(&storage) = new F(std::forward<G>(fn));
+    ops = &HeapOps<F>::ops;
+  }
+};
+
+template<class F>
+const Task::Ops Task::InlineOps<F>::ops = {
+  &Task::InlineOps<F>::invoke, &Task::InlineOps<F>::move, &Task::InlineOps<F>::destroy
+};
+
+template<class F>
+const Task::Ops Task::HeapOps<F>::ops = {
+  &Task::HeapOps<F>::invoke, &Task::HeapOps<F>::move, &Task::HeapOps<F>::destroy
+};
+
+} // namespace minidfs
+
+#endif
@@ -4,47 +4,371 @@
 /// \author Wang Xi
 
 #include <threadpool/thread_pool.hpp>
+#include "metrics/registry.h"
 
 namespace minidfs {
 
+thread_local ThreadPool* ThreadPool::currentPool = nullptr;
+thread_local size_t ThreadPool::currentWorker = 0;
+
+const uint32_t ThreadPool::kSlotChunk;
+const uint32_t ThreadPool::kMaxSlotChunks;
+const size_t ThreadPool::kInjectBatch;
+const int ThreadPool::kSpinRounds;
+const int ThreadPool::kMonitorIntervalMs;
+const int ThreadPool::kIdleChecks;
+
+ThreadPool::Worker::Worker(uint32_t seed)
+    : tasks(10), seed(seed), alive(false), busy(false), completed(0), waitNs(0), runNs(0) {
+}
+
 ThreadPool::ThreadPool(size_t nThread)
-    : nThread(nThread), running(true) {
-  for (int i = 0; i < nThread; ++i) {
-    pool.emplace_back(std::thread(&ThreadPool::work, this));
+    : ThreadPool(nThread, nThread, 0) {
+}
+
+ThreadPool::ThreadPool(size_t minThread, size_t maxThread, int maxQueueDelayMs)
+    : running(true), injected(64), injectedHead(0), nInjected(0),
+      nQueued(0), nParked(0), nThread(minThread), nStarted(minThread), minThread(minThread),
+      maxThread(std::max(minThread, maxThread)),
+      maxQueueDelayNs(static_cast<long long>(maxQueueDelayMs) * 1000000), nResized(0),
+      waitHistogram(nullptr), runHistogram(nullptr), nSlotChunks(0), freeSlots(0) {
+  for (uint32_t i = 0; i < kMaxSlotChunks; ++i) {
+    slotChunks[i] = nullptr;
+  }
+  for (size_t i = 0; i < this->maxThread; ++i) {
+    workers.emplace_back(new Worker(i * 2654435761u + 1));
+  }
+  pool.resize(this->maxThread);
+  {
+    std::unique_lock<std::mutex> lockPark(mutexPark);
+    for (size_t i = 0; i < minThread; ++i) {
+      startWorker(i);
+    }
+  }
+  if (this->maxThread > minThread) {
+    monitor = std::thread(&ThreadPool::resize, this);
   }
 }
 
 
 ThreadPool::~ThreadPool() {
-  running = false;
+  if (metricsName.empty() == false) {
+    auto registry = metrics::Registry::global();
+    registry->remove_gauge_fn(metricsName + ".threads");
+    registry->remove_gauge_fn(metricsName + ".active");
+    registry->remove_gauge_fn(metricsName + ".queued");
+  }
+  {
+    std::unique_lock<std::mutex> lockPark(mutexPark);
+    running = false;
+  }
   condition.notify_all();
+  conditionMonitor.notify_all();
 
+  if (monitor.joinable()) {
+    monitor.join();
+  }
   for (auto& t : pool) {
-    t.join();
+    if (t.joinable()) {
+      t.join();
+    }
+  }
+
+  /// the tasks not started are dropped with the slots
+  for (uint32_t i = 0; i < nSlotChunks; ++i) {
+    delete[] slotChunks[i].load();
+  }
+}
+
+ThreadPool::Slot* ThreadPool::slotAt(uint32_t index) const {
+  return slotChunks[index / kSlotChunk].load(std::memory_order_acquire) + index % kSlotChunk;
+}
+
+ThreadPool::Slot* ThreadPool::acquireSlot() {
+  while (true) {
+    uint64_t head = freeSlots.load(std::memory_order_acquire);
+    uint32_t top = static_cast<uint32_t>(head);
+    if (top != 0) {
+      Slot* slot = slotAt(top - 1);
+      /// the slot may be taken by another thread meanwhile, then the tag
+      /// has changed and the exchange fails
+      uint64_t newHead = ((head >> 32) + 1) << 32 | slot->next.load(std::memory_order_relaxed);
+      if (freeSlots.compare_exchange_weak(head, newHead, std::memory_order_acquire)) {
+        return slot;
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lockSlots(mutexSlots);
+    if (static_cast<uint32_t>(freeSlots.load()) != 0) {
+      continue;
+    }
+    if (nSlotChunks == kMaxSlotChunks) {
+      throw std::runtime_error("Too many tasks in thread pool");
+    }
+    Slot* chunk = new Slot[kSlotChunk];
+    uint32_t first = nSlotChunks * kSlotChunk;
+    for (uint32_t i = 0; i < kSlotChunk; ++i) {
+      chunk[i].index = first + i;
+    }
+    slotChunks[nSlotChunks++].store(chunk, std::memory_order_release);
+    /// keep the first one, and free the others
+    for (uint32_t i = kSlotChunk - 1; i > 0; --i) {
+      releaseSlot(&chunk[i]);
+    }
+    return &chunk[0];
+  }
+}
+
+void ThreadPool::releaseSlot(Slot* slot) {
+  uint64_t head = freeSlots.load(std::memory_order_relaxed);
+  do {
+    slot->next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+  } while (!freeSlots.compare_exchange_weak(head, ((head >> 32) + 1) << 32 | (slot->index + 1),
+                                            std::memory_order_release, std::memory_order_relaxed));
+}
+
+void ThreadPool::push(Slot* slot) {
+  if (currentPool != this || !workers[currentWorker]->tasks.push(slot)) {
+    std::unique_lock<std::mutex> lockInjected(mutexInjected);
+    if (nInjected == injected.size()) {
+      /// grow the ring, and never shrink it
+      std::vector<Slot*> grown(injected.size() * 2);
+      for (size_t i = 0; i < nInjected; ++i) {
+        grown[i] = injected[(injectedHead + i) % injected.size()];
+      }
+      injected.swap(grown);
+      injectedHead = 0;
+    }
+    injected[(injectedHead + nInjected) % injected.size()] = slot;
+    ++nInjected;
+  }
+  /// pairs with the check of nQueued in work(), so a parking worker either
+  /// sees the task or is woken up
+  nQueued.fetch_add(1);
+  if (nParked.load() > 0) {
+    std::unique_lock<std::mutex> lockPark(mutexPark);
+    condition.notify_one();
   }
 }
 
-void ThreadPool::work() {
+ThreadPool::Slot* ThreadPool::take(size_t self) {
+  Slot* slot = workers[self]->tasks.pop();
+  if (slot == nullptr) {
+    slot = takeInjected(self);
+  }
+  if (slot == nullptr) {
+    slot = steal(self);
+  }
+  if (slot != nullptr) {
+    nQueued.fetch_sub(1);
+  }
+  return slot;
+}
+
+ThreadPool::Slot* ThreadPool::takeInjected(size_t self) {
+  std::unique_lock<std::mutex> lockInjected(mutexInjected);
+  if (nInjected == 0) {
+    return nullptr;
+  }
+  Slot* slot = injected[injectedHead];
+  injectedHead = (injectedHead + 1) % injected.size();
+  --nInjected;
+  /// leave a fair share to the other workers. The batch is pushed newest
+  /// first, so that the worker pops it in FIFO order.
+  size_t n = std::min(kInjectBatch, nInjected / std::max<size_t>(nThread.load(), 1));
+  auto& tasks = workers[self]->tasks;
+  n = std::min<size_t>(n, tasks.capacity() - tasks.size());
+  for (size_t i = n; i > 0; --i) {
+    tasks.push(injected[(injectedHead + i - 1) % injected.size()]);
+  }
+  injectedHead = (injectedHead + n) % injected.size();
+  nInjected -= n;
+  return slot;
+}
+
+ThreadPool::Slot* ThreadPool::steal(size_t self) {
+  /// the retired workers may have left tasks behind
+  size_t nVictim = nStarted.load();
+  if (nVictim < 2) {
+    return nullptr;
+  }
+  /// xorshift
+  uint32_t& seed = workers[self]->seed;
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  size_t start = seed % nVictim;
+  for (size_t i = 0; i < nVictim; ++i) {
+    size_t victim = (start + i) % nVictim;
+    if (victim == self) {
+      continue;
+    }
+    Slot* slot = workers[victim]->tasks.steal();
+    if (slot != nullptr) {
+      return slot;
+    }
+  }
+  return nullptr;
+}
+
+void ThreadPool::work(size_t self) {
+  currentPool = this;
+  currentWorker = self;
   while (running) {
-    std::function<void()> task;
-    {
-      std::unique_lock<std::mutex> lockTasks(mutexTasks);
-      if (tasks.empty() == true) {
-        condition.wait(lockTasks, [this]{return this->tasks.empty() == false || this->running == false;});
-      } 
-      if (running) {
-        /// fetch one task and remove it from the queue
-        task = std::move(tasks.front());
-        tasks.pop();
-      } else {
-        /// this is stopped
-        return;
+    Slot* slot = nullptr;
+    for (int i = 0; i < kSpinRounds && slot == nullptr && running; ++i) {
+      slot = take(self);
+      if (slot == nullptr) {
+        std::this_thread::yield();
       }
     }
-    if (task) {
-      task();
+    if (slot != nullptr) {
+      run(self, slot);
+      continue;
+    }
+
+    /// park until a task is enqueued, or retire. The deque of the worker is
+    /// empty, as only the worker itself pushes to it.
+    std::unique_lock<std::mutex> lockPark(mutexPark);
+    if (self >= nThread.load()) {
+      workers[self]->alive = false;
+      return;
     }
+    nParked.fetch_add(1);
+    condition.wait(lockPark, [this, self]{
+      return this->nQueued.load() > 0 || this->running == false || self >= this->nThread.load();
+    });
+    nParked.fetch_sub(1);
+  }
+}
+
+void ThreadPool::run(size_t self, Slot* slot) {
+  Worker& worker = *workers[self];
+  long long start = nowNs();
+  long long waitNs = start - slot->postedNs;
+  worker.busy.store(true, std::memory_order_relaxed);
+  slot->task();
+  slot->task.reset();
+  worker.busy.store(false, std::memory_order_relaxed);
+  long long end = nowNs();
+  releaseSlot(slot);
+
+  /// only this worker writes its counters
+  worker.waitNs.store(worker.waitNs.load(std::memory_order_relaxed) + waitNs,
+                      std::memory_order_relaxed);
+  worker.runNs.store(worker.runNs.load(std::memory_order_relaxed) + end - start,
+                     std::memory_order_relaxed);
+  worker.completed.store(worker.completed.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+  metrics::Histogram* waitHist = waitHistogram.load(std::memory_order_acquire);
+  if (waitHist != nullptr) {
+    waitHist->record(waitNs / 1000);
+    runHistogram.load(std::memory_order_relaxed)->record((end - start) / 1000);
   }
 }
 
-}
\ No newline at end of file
+void ThreadPool::startWorker(size_t self) {
+  if (pool[self].joinable()) {
+    /// the retired thread has left mutexPark, and is about to exit
+    pool[self].join();
+  }
+  workers[self]->alive = true;
+  pool[self] = std::thread(&ThreadPool::work, this, self);
+  if (nStarted.load() < self + 1) {
+    nStarted.store(self + 1);
+  }
+}
+
+void ThreadPool::resize() {
+  Stats last = getStats();
+  int idleChecks = 0;
+  std::unique_lock<std::mutex> lockPark(mutexPark);
+  while (running) {
+    conditionMonitor.wait_for(lockPark, std::chrono::milliseconds(kMonitorIntervalMs));
+    if (running == false) {
+      break;
+    }
+    Stats now = getStats();
+    long long completed = now.completed - last.completed;
+    long long waitNs = (now.waitUs - last.waitUs) * 1000;
+    long long busyNs = (now.runUs - last.runUs) * 1000;
+    last = now;
+
+    /// the tasks wait too long, or none completes while some are waiting,
+    /// e.g. all the workers are blocked
+    bool late = completed > 0 ? waitNs / completed > maxQueueDelayNs : now.queued > 0;
+    size_t n = nThread.load();
+    if (late && n < maxThread) {
+      nThread.store(n + 1);
+      if (workers[n]->alive == false) {
+        startWorker(n);
+      }
+      ++nResized;
+      idleChecks = 0;
+      LOG_INFO << "Thread pool grows to " << n + 1 << " threads, "
+               << static_cast<int64_t>(now.queued) << " tasks queued";
+      continue;
+    }
+
+    bool idle = now.queued == 0
+        && busyNs < static_cast<long long>(n) * kMonitorIntervalMs * 1000000 / 2;
+    idleChecks = idle ? idleChecks + 1 : 0;
+    if (idleChecks >= kIdleChecks && n > minThread) {
+      /// worker n - 1 retires once idle
+      nThread.store(n - 1);
+      condition.notify_all();
+      ++nResized;
+      idleChecks = 0;
+      LOG_INFO << "Thread pool shrinks to " << n - 1 << " threads";
+    }
+  }
+}
+
+ThreadPool::Stats ThreadPool::getStats() const {
+  Stats stats;
+  stats.nThread = nThread.load();
+  stats.minThread = minThread;
+  stats.maxThread = maxThread;
+  stats.queued = nQueued.load();
+  stats.active = 0;
+  stats.completed = 0;
+  stats.waitUs = 0;
+  stats.runUs = 0;
+  long long waitNs = 0;
+  long long runNs = 0;
+  for (const auto& worker : workers) {
+    stats.active += worker->busy.load(std::memory_order_relaxed);
+    stats.completed += worker->completed.load(std::memory_order_relaxed);
+    waitNs += worker->waitNs.load(std::memory_order_relaxed);
+    runNs += worker->runNs.load(std::memory_order_relaxed);
+  }
+  stats.waitUs = waitNs / 1000;
+  stats.runUs = runNs / 1000;
+  stats.slots = static_cast<long long>(nSlotChunks.load()) * kSlotChunk;
+  stats.resized = nResized.load();
+  return stats;
+}
+
+void ThreadPool::exportMetrics(const std::string& name) {
+  auto registry = metrics::Registry::global();
+  metricsName = name;
+  runHistogram.store(registry->histogram(name + ".run.us"), std::memory_order_relaxed);
+  waitHistogram.store(registry->histogram(name + ".wait.us"), std::memory_order_release);
+  registry->gauge_fn(name + ".threads", [this]() -> int64_t {
+    return nThread.load();
+  });
+  registry->gauge_fn(name + ".active", [this]() -> int64_t {
+    return getStats().active;
+  });
+  registry->gauge_fn(name + ".queued", [this]() -> int64_t {
+    return nQueued.load();
+  });
+}
+
+long long ThreadPool::nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
@@ -2,7 +2,7 @@
 ///
 /// MIT License
 /// \author Wang Xi
-/// \brief A simple thread pool.
+/// \brief A work-stealing thread pool.
 
 #ifndef THREAD_POOL_H_
 #define THREAD_POOL_H_
@@ -10,7 +10,6 @@
 #include <thread>
 #include <atomic>
 #include <vector>
-#include <queue>
 #include <functional>
 #include <mutex>
 #include <condition_variable>
@@ -18,52 +17,260 @@
 #include <stdexcept>
 #include <iostream>
 #include <memory>
+#include <string>
 
 #include "logging/logger.h"
+#include "metrics/histogram.h"
+#include <threadpool/task.hpp>
+#include <threadpool/work_stealing_deque.hpp>
 
 namespace minidfs {
 
+/// \brief ThreadPool runs the tasks with a number of workers.
+///
+/// Each worker has its own lock-free deque. A task enqueued by a worker goes
+/// to the worker's deque; a task enqueued by any other thread goes to the
+/// injection queue, which the workers drain in batches into their deques.
+/// An idle worker steals from the deques of randomly chosen workers, spins
+/// for a while, and then parks until a task is enqueued.
+///
+/// The tasks are kept in slots recycled through a lock-free freelist, so
+/// post() doesn't allocate once the pool is warmed up.
+///
+/// The pool records how long the tasks wait in the queue and run. Given a
+/// range of sizes, it also grows by a worker when the tasks wait longer than
+/// maxQueueDelayMs, e.g. when the workers are blocked on disk, and shrinks by
+/// one when the workers have been mostly idle for a while.
+///
+/// Once exported, the queue delay and the run time of each task are also
+/// recorded in histograms of the metrics registry.
 class ThreadPool {
+ public:
+  /// \brief Statistics of the pool. The times are summed over all the tasks.
+  struct Stats {
+    size_t nThread;
+    size_t minThread;
+    size_t maxThread;
+    long long queued;
+    /// workers running a task
+    size_t active;
+    long long completed;
+    /// from post() to the start of the task
+    long long waitUs;
+    long long runUs;
+    /// times the pool grew or shrank
+    long long resized;
+    /// slots allocated for the tasks, taken or free
+    long long slots;
+  };
 
  private:
+  /// a queued task
+  struct Slot {
+    Task task;
+    uint32_t index;
+    /// index + 1 of the next free slot, 0 for none
+    std::atomic<uint32_t> next;
+    /// when the task was posted, in ns of steady_clock
+    long long postedNs;
+  };
+
+  struct Worker {
+    WorkStealingDeque<Slot> tasks;
+    /// state of the random victim selection
+    uint32_t seed;
+
+    /// has a thread, guarded by mutexPark
+    bool alive;
+
+    /// written by the worker only, read by getStats()
+    std::atomic<bool> busy;
+    std::atomic<long long> completed;
+    std::atomic<long long> waitNs;
+    std::atomic<long long> runNs;
+
+    explicit Worker(uint32_t seed);
+  };
+
   /// set to false when shutting down
   std::atomic<bool> running;
 
-  /// tasks to be executed by this thread pool
-  std::queue<std::function<void()>> tasks;
-  
-  /// mutex for tasks
-  std::mutex mutexTasks;
+  /// ring buffer of the tasks enqueued by threads out of the pool
+  std::vector<Slot*> injected;
+  size_t injectedHead;
+  size_t nInjected;
+
+  /// mutex for injected
+  std::mutex mutexInjected;
+
+  /// number of tasks enqueued but not taken by a worker yet
+  std::atomic<long long> nQueued;
+
+  /// number of parked workers
+  std::atomic<int> nParked;
 
-  /// condition variable for tasks
+  /// mutex for parking
+  std::mutex mutexPark;
+
+  /// condition variable for parked workers
   std::condition_variable condition;
 
-  /// number of threads
-  size_t nThread;
+  /// number of workers wanted. The workers from nThread on retire when idle.
+  std::atomic<size_t> nThread;
+
+  /// number of workers ever started, which may still have tasks to steal
+  std::atomic<size_t> nStarted;
+
+  const size_t minThread;
+  const size_t maxThread;
+  const long long maxQueueDelayNs;
+
+  /// maxThread workers, with or without a thread
+  std::vector<std::unique_ptr<Worker>> workers;
 
   /// threads
   std::vector<std::thread> pool;
 
+  /// resizes the pool, if maxThread > minThread
+  std::thread monitor;
+
+  /// condition variable for the monitor to sleep
+  std::condition_variable conditionMonitor;
+
+  std::atomic<long long> nResized;
+
+  /// the histograms of the tasks, null until exportMetrics(). The workers
+  /// may be running by then: runHistogram is set first, and waitHistogram
+  /// publishes both.
+  std::atomic<metrics::Histogram*> waitHistogram;
+  std::atomic<metrics::Histogram*> runHistogram;
+
+  /// prefix of the metrics exported
+  std::string metricsName;
+
+  /// slots are allocated kSlotChunk at a time, and freed with the pool
+  static const uint32_t kSlotChunk = 256;
+  static const uint32_t kMaxSlotChunks = 1024;
+  std::atomic<Slot*> slotChunks[kMaxSlotChunks];
+  /// written under mutexSlots, read by getStats()
+  std::atomic<uint32_t> nSlotChunks;
+
+  /// mutex for allocating slot chunks
+  std::mutex mutexSlots;
+
+  /// top of the freelist: a tag against ABA in the high 32 bits, and
+  /// index + 1 of the slot in the low 32 bits
+  std::atomic<uint64_t> freeSlots;
+
+  /// the pool and the index of the worker running on this thread
+  static thread_local ThreadPool* currentPool;
+  static thread_local size_t currentWorker;
+
+  /// max number of tasks moved from the injection queue at a time
+  static const size_t kInjectBatch = 32;
 
+  /// rounds of stealing before a worker parks
+  static const int kSpinRounds = 64;
+
+  /// interval between two checks of the monitor
+  static const int kMonitorIntervalMs = 100;
+
+  /// the pool shrinks after this many checks with the workers busy less than
+  /// a half of the time
+  static const int kIdleChecks = 10;
 
  public:
   /// Create a thread pool of nThread threads
   /// and start all the threads
   ThreadPool(size_t nThread);
 
+  /// \brief Create a thread pool sized between minThread and maxThread with
+  /// the queue delay, and start minThread threads.
+  ///
+  /// \param minThread min number of threads
+  /// \param maxThread max number of threads, the pool size is fixed if not above minThread
+  /// \param maxQueueDelayMs the pool grows when the tasks wait longer than it
+  ThreadPool(size_t minThread, size_t maxThread, int maxQueueDelayMs);
+
   /// Add a task into the tasks queue
   template<class F, class... Args>
-  auto enqueue(F&& f, Args&&... args) 
+  auto enqueue(F&& f, Args&&... args)
     -> std::future<typename std::result_of<F(Args...)>::type>;
 
-  /// Wake all threads and stop them all
+  /// \brief Add a task whose result is not needed. Unlike enqueue(), it
+  /// doesn't allocate if the callable fits in a Task.
+  template<class F>
+  void post(F&& fn);
+
+  /// \brief Add a task like post(), unless maxQueued tasks are waiting already.
+  /// The bound may be exceeded slightly by concurrent callers.
+  ///
+  /// \param fn the task
+  /// \param maxQueued max number of waiting tasks, 0 for no limit
+  /// \return false if the task is refused
+  template<class F>
+  bool tryPost(F&& fn, long long maxQueued);
+
+  /// Number of tasks waiting to run
+  long long queued() const { return nQueued.load(); }
+
+  /// Number of threads
+  size_t size() const { return nThread.load(); }
+
+  /// Get the statistics of the pool
+  Stats getStats() const;
+
+  /// \brief Export the statistics to the metrics registry of the process: the
+  /// histograms name.wait.us and name.run.us, and the gauges name.threads,
+  /// name.active and name.queued. Call it once. The tasks run before it are
+  /// not recorded in the histograms.
+  ///
+  /// \param name prefix of the metrics, e.g. "rpc.client"
+  void exportMetrics(const std::string& name);
+
+  /// Wake all threads and stop them all.
+  /// The tasks not started yet are dropped.
   ~ThreadPool();
 
 
  private:
+  /// Take a free slot, allocating a chunk of them if there is none.
+  Slot* acquireSlot();
+
+  /// Return a slot with an empty task to the freelist.
+  void releaseSlot(Slot* slot);
+
+  Slot* slotAt(uint32_t index) const;
+
+  /// Push a task to the deque of the current worker, or inject it.
+  void push(Slot* slot);
+
+  /// \brief Take a task: from the deque of the worker, then from the
+  /// injection queue, and then from the other workers.
+  ///
+  /// \return nullptr if no task is found
+  Slot* take(size_t self);
+
+  /// Move a batch of injected tasks to the deque of worker self, and return one of them.
+  Slot* takeInjected(size_t self);
+
+  /// Steal a task from the workers other than self, starting at a random one.
+  Slot* steal(size_t self);
+
   /// Worker thread method. Each worker runs this
   /// method to wait for available tasks.
-  void work();
+  void work(size_t self);
+
+  /// Run a task taken by worker self, and record its times.
+  void run(size_t self, Slot* slot);
+
+  /// Start a thread for worker self. Call with mutexPark held.
+  void startWorker(size_t self);
+
+  /// Monitor thread method. It resizes the pool by the queue delay.
+  void resize();
+
+  static long long nowNs();
 };
 
 
@@ -71,24 +278,36 @@ class ThreadPool {
 template<class F, class... Args>
 auto ThreadPool::enqueue(F&& fn, Args&&... args) -> std::future<typename std::result_of<F(Args...)>::type> {
   using retType = typename std::result_of<F(Args...)>::type;
-  
+
   /// bind the function and the return value
   auto task = std::make_shared<std::packaged_task<retType()>>(std::bind(std::forward<F>(fn), std::forward<Args>(args)...));
   auto res = task->get_future();
+  post([task](){(*task)();});
+  return res;
+}
+
+template<class F>
+void ThreadPool::post(F&& fn) {
   if (running == false) {
     throw std::runtime_error("Add a new task to stopped thread pool");
   }
-  {
-    std::unique_lock<std::mutex> lockTasks(mutexTasks);
-    tasks.emplace([task](){(*task)();});
-    LOG_DEBUG << "Number of tasks: " << tasks.size();
+  Slot* slot = acquireSlot();
+  slot->task = Task(std::forward<F>(fn));
+  slot->postedNs = nowNs();
+  push(slot);
+}
+
+template<class F>
+bool ThreadPool::tryPost(F&& fn, long long maxQueued) {
+  if (maxQueued > 0 && nQueued.load() >= maxQueued) {
+    return false;
   }
-  condition.notify_one();
-  return res;    
+  post(std::forward<F>(fn));
+  return true;
 }
 
 
 } // namespace minidfs
 
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,186 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Benchmark for ThreadPool. It counts the heap allocations by
+/// replacing operator new, so it is a binary of its own.
+
+#include <threadpool/thread_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/// heap allocations of this thread
+static thread_local long long tAllocs = 0;
+
+void* operator new(size_t size) {
+  ++tAllocs;
+  void* p = ::malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  ::free(p);
+}
+
+namespace {
+
+using std::chrono::steady_clock;
+
+/// The former pool: one FIFO queue behind one mutex, as the baseline.
+class SingleQueuePool {
+ private:
+  std::atomic<bool> running;
+  std::queue<std::function<void()>> tasks;
+  std::mutex mutexTasks;
+  std::condition_variable condition;
+  std::vector<std::thread> pool;
+
+ public:
+  explicit SingleQueuePool(size_t nThread) : running(true) {
+    for (size_t i = 0; i < nThread; ++i) {
+      pool.emplace_back([this]() {
+        while (running) {
+          std::function<void()> task;
+          {
+            std::unique_lock<std::mutex> lockTasks(mutexTasks);
+            condition.wait(lockTasks, [this]{return !tasks.empty() || !running;});
+            if (!running) {
+              return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop();
+          }
+          task();
+        }
+      });
+    }
+  }
+
+  template<class F>
+  std::future<void> enqueue(F&& fn) {
+    auto task = std::make_shared<std::packaged_task<void()>>(std::forward<F>(fn));
+    auto res = task->get_future();
+    {
+      std::unique_lock<std::mutex> lockTasks(mutexTasks);
+      tasks.emplace([task](){(*task)();});
+    }
+    condition.notify_one();
+    return res;
+  }
+
+  ~SingleQueuePool() {
+    running = false;
+    condition.notify_all();
+    for (auto& t : pool) {
+      t.join();
+    }
+  }
+};
+
+void WaitFor(const std::atomic<int>& done, int n) {
+  while (done.load() < n) {
+    std::this_thread::yield();
+  }
+}
+
+/// nSubmitter threads enqueue nTask empty tasks in total. Print the throughput
+/// and the 99th percentile of the latency from enqueue to start.
+template<class Pool>
+void Bench(const char* name, size_t nThread, int nSubmitter, int nTask) {
+  std::vector<long long> latency(nTask);
+  std::atomic<int> done(0);
+  auto start = steady_clock::now();
+  {
+    Pool pool(nThread);
+    std::vector<std::thread> submitters;
+    for (int s = 0; s < nSubmitter; ++s) {
+      submitters.emplace_back([&, s]() {
+        for (int i = s; i < nTask; i += nSubmitter) {
+          auto submitted = steady_clock::now();
+          pool.enqueue([&latency, &done, i, submitted]() {
+            latency[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                steady_clock::now() - submitted).count();
+            done.fetch_add(1);
+          });
+        }
+      });
+    }
+    for (auto& t : submitters) {
+      t.join();
+    }
+    WaitFor(done, nTask);
+  }
+  double seconds = std::chrono::duration<double>(steady_clock::now() - start).count();
+  std::sort(latency.begin(), latency.end());
+  ::printf("%-12s %2zu threads: %8.0f tasks/s, p99 %8.1f us\n", name, nThread,
+           nTask / seconds, latency[nTask * 99 / 100] / 1000.0);
+}
+
+/// A connection storm: nSubmitter threads dispatch nConn handlers capturing a
+/// connfd, like RPCServer::run(), through enqueue() or post(). Print the heap
+/// allocations per connection and the latency from dispatch to start.
+void BenchDispatch(bool post, int nSubmitter, int nConn) {
+  minidfs::ThreadPool pool(4);
+  std::vector<long long> latency(nConn);
+  std::atomic<int> done(0);
+  auto dispatch = [&](int connfd) {
+    auto submitted = steady_clock::now();
+    auto handler = [&latency, &done, connfd, submitted]() {
+      latency[connfd] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          steady_clock::now() - submitted).count();
+      done.fetch_add(1);
+    };
+    if (post) {
+      pool.post(handler);
+    } else {
+      pool.enqueue(handler);
+    }
+  };
+  /// warm up the slots
+  for (int i = 0; i < nConn; ++i) {
+    dispatch(i);
+  }
+  WaitFor(done, nConn);
+  done = 0;
+
+  std::atomic<long long> allocs(0);
+  std::vector<std::thread> submitters;
+  for (int s = 0; s < nSubmitter; ++s) {
+    submitters.emplace_back([&, s]() {
+      long long before = tAllocs;
+      for (int i = s; i < nConn; i += nSubmitter) {
+        dispatch(i);
+      }
+      allocs.fetch_add(tAllocs - before);
+    });
+  }
+  for (auto& t : submitters) {
+    t.join();
+  }
+  WaitFor(done, nConn);
+  double allocsPerConn = double(allocs.load()) / nConn;
+  std::sort(latency.begin(), latency.end());
+  ::printf("%-7s %6.2f allocs/conn, p50 %7.1f us, p99 %7.1f us\n", post ? "post" : "enqueue",
+           allocsPerConn, latency[nConn / 2] / 1000.0, latency[nConn * 99 / 100] / 1000.0);
+}
+
+} // namespace
+
+int main() {
+  for (size_t nThread : {2, 4, 16, 64}) {
+    Bench<SingleQueuePool>("single queue", nThread, 4, 20000);
+    Bench<minidfs::ThreadPool>("stealing", nThread, 4, 20000);
+  }
+  BenchDispatch(false, 4, 50000);
+  BenchDispatch(true, 4, 50000);
+  return 0;
+}
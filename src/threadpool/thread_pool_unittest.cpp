@@ -0,0 +1,265 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief Test for ThreadPool
+
+#include <threadpool/thread_pool.hpp>
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void WaitFor(const std::atomic<int>& done, int n) {
+  while (done.load() < n) {
+    std::this_thread::yield();
+  }
+}
+
+struct Counted {
+  static int alive;
+  Counted() { ++alive; }
+  Counted(const Counted&) { ++alive; }
+  Counted(Counted&&) noexcept { ++alive; }
+  ~Counted() { --alive; }
+};
+int Counted::alive = 0;
+
+/// records where it is stored when called
+template<size_t N>
+struct Where {
+  const void** at;
+  char pad[N];
+  explicit Where(const void** at) : at(at), pad() {}
+  void operator()() { *at = this; }
+};
+
+bool Inside(const void* p, const minidfs::Task& task) {
+  const char* begin = reinterpret_cast<const char*>(&task);
+  return p >= begin && p < begin + sizeof(task);
+}
+
+void TestTask() {
+  int calls = 0;
+  Counted counted;
+  const void* at = nullptr;
+  {
+    minidfs::Task task([&calls, counted]() { ++calls; });
+    minidfs::Task moved(std::move(task));
+    assert(!task && moved);
+    moved();
+    assert(calls == 1 && Counted::alive == 2);
+
+    /// small callables are stored inline
+    minidfs::Task small(Where<8>{&at});
+    small();
+    assert(Inside(at, small));
+  }
+  assert(Counted::alive == 1);
+
+  char big[minidfs::Task::kInlineSize + 1] = {1};
+  minidfs::Task task([&calls, big, counted]() { calls += big[0]; });
+  minidfs::Task other;
+  other = std::move(task);
+  other();
+  assert(calls == 2 && Counted::alive == 2);
+  other.reset();
+  assert(!other && Counted::alive == 1);
+
+  /// a large one is kept on the heap
+  minidfs::Task large(Where<minidfs::Task::kInlineSize>{&at});
+  large();
+  assert(!Inside(at, large));
+  ::printf("task pass ...\n");
+}
+
+void TestPost() {
+  minidfs::ThreadPool pool(3);
+  std::atomic<int> done(0);
+  /// more than a chunk of slots
+  for (int i = 0; i < 2000; ++i) {
+    pool.post([&done]() { done.fetch_add(1); });
+  }
+  WaitFor(done, 2000);
+
+  /// the slots are recycled
+  long long slots = pool.getStats().slots;
+  for (int i = 0; i < 2000; ++i) {
+    pool.post([&done]() { done.fetch_add(1); });
+    if (i % 100 == 0) {
+      WaitFor(done, 2000 + i);
+    }
+  }
+  WaitFor(done, 4000);
+  assert(pool.getStats().slots == slots);
+  ::printf("post pass ...\n");
+}
+
+void TestTryPost() {
+  minidfs::ThreadPool pool(1);
+  std::atomic<int> started(0);
+  std::atomic<bool> release(false);
+  pool.post([&]() {
+    started.fetch_add(1);
+    while (!release) {
+      std::this_thread::yield();
+    }
+  });
+  WaitFor(started, 1);
+
+  /// the worker is busy, so the tasks wait in the queue
+  std::atomic<int> done(0);
+  for (int i = 0; i < 4; ++i) {
+    assert(pool.tryPost([&done]() { done.fetch_add(1); }, 4));
+  }
+  assert(!pool.tryPost([&done]() { done.fetch_add(1); }, 4));
+  assert(pool.tryPost([&done]() { done.fetch_add(1); }, 0));
+  release = true;
+  WaitFor(done, 5);
+  assert(pool.tryPost([&done]() { done.fetch_add(1); }, 4));
+  WaitFor(done, 6);
+  ::printf("try post pass ...\n");
+}
+
+void TestStats() {
+  minidfs::ThreadPool pool(2);
+  std::atomic<int> done(0);
+  for (int i = 0; i < 10; ++i) {
+    pool.post([&done]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      done.fetch_add(1);
+    });
+  }
+  WaitFor(done, 10);
+  /// the counters are written after the task
+  while (pool.getStats().completed < 10) {
+    std::this_thread::yield();
+  }
+  auto stats = pool.getStats();
+  assert(stats.nThread == 2 && stats.minThread == 2 && stats.maxThread == 2);
+  assert(stats.queued == 0 && stats.active == 0 && stats.resized == 0);
+  assert(stats.runUs >= 10 * 2000);
+  /// 10 tasks of 2 ms on 2 threads, the last ones wait 8 ms
+  assert(stats.waitUs >= 8000);
+  ::printf("stats pass ...\n");
+}
+
+void TestResize() {
+  minidfs::ThreadPool pool(1, 4, 5);
+  std::atomic<int> done(0);
+  /// the workers are blocked, so the tasks wait
+  for (int i = 0; i < 40; ++i) {
+    pool.post([&done]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      done.fetch_add(1);
+    });
+  }
+  WaitFor(done, 40);
+  auto stats = pool.getStats();
+  assert(stats.nThread > 1 && stats.nThread <= 4 && stats.resized > 0);
+
+  /// idle, it shrinks one thread a second
+  size_t grown = stats.nThread;
+  while (pool.size() == grown) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+  assert(pool.size() == grown - 1);
+
+  /// and grows again
+  done = 0;
+  for (int i = 0; i < 100; ++i) {
+    pool.post([&done]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      done.fetch_add(1);
+    });
+  }
+  WaitFor(done, 100);
+  ::printf("resize pass ...\n");
+}
+
+void TestResults() {
+  minidfs::ThreadPool pool(4);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 1000; ++i) {
+    results.push_back(pool.enqueue([](int x) { return x * x; }, i));
+  }
+  for (int i = 0; i < 1000; ++i) {
+    assert(results[i].get() == i * i);
+  }
+  ::printf("results pass ...\n");
+}
+
+/// tasks enqueued by the workers go to their own deques and are stolen
+void Spawn(minidfs::ThreadPool* pool, std::atomic<int>* done, int depth) {
+  done->fetch_add(1);
+  if (depth == 0) {
+    return;
+  }
+  for (int i = 0; i < 2; ++i) {
+    pool->enqueue(Spawn, pool, done, depth - 1);
+  }
+}
+
+void TestNested() {
+  for (size_t nThread : {1, 3, 8}) {
+    minidfs::ThreadPool pool(nThread);
+    std::atomic<int> done(0);
+    /// more than a deque holds
+    pool.enqueue(Spawn, &pool, &done, 12);
+    WaitFor(done, (1 << 13) - 1);
+    assert(pool.queued() == 0);
+  }
+  ::printf("nested pass ...\n");
+}
+
+void TestParking() {
+  minidfs::ThreadPool pool(4);
+  std::atomic<int> done(0);
+  for (int round = 0; round < 20; ++round) {
+    /// the workers park in between
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    for (int i = 0; i < 10; ++i) {
+      pool.enqueue([&done]() { done.fetch_add(1); });
+    }
+    WaitFor(done, (round + 1) * 10);
+  }
+  ::printf("parking pass ...\n");
+}
+
+void TestShutdown() {
+  std::atomic<int> started(0);
+  {
+    minidfs::ThreadPool pool(2);
+    for (int i = 0; i < 100; ++i) {
+      pool.enqueue([&started]() {
+        started.fetch_add(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      });
+    }
+  }
+  /// the tasks not started are dropped
+  assert(started.load() < 100);
+  ::printf("shutdown pass ...\n");
+}
+
+} // namespace
+
+void TestThreadPool() {
+  ::printf("Test ThreadPool...\n");
+
+  TestTask();
+  TestPost();
+  TestTryPost();
+  TestStats();
+  TestResize();
+  TestResults();
+  TestNested();
+  TestParking();
+  TestShutdown();
+
+  ::printf("\n");
+}
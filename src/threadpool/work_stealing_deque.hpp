@@ -0,0 +1,123 @@
+/// Copyright (c) 2020 xiw
+///
+/// MIT License
+/// \author Wang Xi
+/// \brief A bounded lock-free work-stealing deque.
+
+#ifndef WORK_STEALING_DEQUE_H_
+#define WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace minidfs {
+
+/// \brief Chase-Lev deque of pointers with a fixed capacity.
+///
+/// The owner thread pushes and pops at the bottom, in LIFO order.
+/// Any other thread steals from the top, in FIFO order.
+/// The memory orders follow "Correct and Efficient Work-Stealing for
+/// Weak Memory Models" (Le et al., PPoPP 2013).
+template<class T>
+class WorkStealingDeque {
+ private:
+  static constexpr size_t kCacheLine = 64;
+
+  /// power of 2
+  const int64_t capacityItems;
+
+  std::vector<std::atomic<T*>> items;
+
+  /// top and bottom are kept on cache lines of their own by padding, since
+  /// operator new of C++11 doesn't honor alignas(64) on the heap
+  char padTop[kCacheLine];
+
+  /// next to be stolen
+  std::atomic<int64_t> top;
+  char padBottom[kCacheLine - sizeof(std::atomic<int64_t>)];
+
+  /// next to be pushed by the owner
+  std::atomic<int64_t> bottom;
+  char padEnd[kCacheLine - sizeof(std::atomic<int64_t>)];
+
+ public:
+  /// \param logCapacity the deque holds 2^logCapacity items
+  explicit WorkStealingDeque(int logCapacity)
+      : capacityItems(int64_t(1) << logCapacity), items(capacityItems), top(0), bottom(0) {
+  }
+
+  /// \brief Push an item at the bottom. Owner only.
+  ///
+  /// \return false if the deque is full
+  bool push(T* item) {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    if (b - t >= capacityItems) {
+      return false;
+    }
+    items[b & (capacityItems - 1)].store(item, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /// \brief Pop the item pushed last. Owner only.
+  ///
+  /// \return nullptr if the deque is empty
+  T* pop() {
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+    if (t > b) {
+      bottom.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    T* item = items[b & (capacityItems - 1)].load(std::memory_order_relaxed);
+    if (t == b) {
+      /// the last item, race with the thieves
+      if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        item = nullptr;
+      }
+      bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return item;
+  }
+
+  /// \brief Steal the item pushed first. Any thread.
+  ///
+  /// \return nullptr if the deque is empty or another thread won the race
+  T* steal() {
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_acquire);
+    if (t >= b) {
+      return nullptr;
+    }
+    T* item = items[t & (capacityItems - 1)].load(std::memory_order_relaxed);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return item;
+  }
+
+  /// \brief Max number of items.
+  int64_t capacity() const {
+    return capacityItems;
+  }
+
+  /// \brief Approximate number of items.
+  int64_t size() const {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_relaxed);
+    return b > t ? b - t : 0;
+  }
+};
+
+} // namespace minidfs
+
+#endif
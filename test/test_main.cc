@@ -8,7 +8,23 @@
 
 extern void TestLogStream();
 extern void TestLogger();
+extern void TestAsyncLogging();
 extern void TestConfig();
+extern void TestBlkIDCodec();
+extern void TestDataThrottler();
+extern void TestBlockDeleter();
+extern void TestBlockIndex();
+extern void TestBlockStore();
+extern void TestDFSMaster();
+extern void TestVolume();
+extern void TestCrc32c();
+extern void TestReedSolomon();
+extern void TestCompressedBlock();
+extern void TestThreadPool();
+extern void TestFairQueue();
+extern void TestRPCServer();
+extern void TestHistogram();
+extern void TestRegistry();
 
 
 int main(int argc, char const *argv[]) {
@@ -16,7 +32,23 @@ int main(int argc, char const *argv[]) {
 
   TestLogStream();
   TestLogger();
+  TestAsyncLogging();
   TestConfig();
+  TestBlkIDCodec();
+  TestDataThrottler();
+  TestBlockDeleter();
+  TestBlockIndex();
+  TestBlockStore();
+  TestDFSMaster();
+  TestVolume();
+  TestCrc32c();
+  TestReedSolomon();
+  TestCompressedBlock();
+  TestThreadPool();
+  TestFairQueue();
+  TestRPCServer();
+  TestHistogram();
+  TestRegistry();
   
   printf("=================Test ends=================\n");
   return 0;